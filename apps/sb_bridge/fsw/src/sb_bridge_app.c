@@ -0,0 +1,484 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: sb_bridge_app.c
+**
+** Purpose:
+**  This file contains the source code for the SB Bridge application, which
+**  connects the software buses of two cFE instances on the same host through
+**  a POSIX shared memory region.
+**
+** Notes:
+**  Messages listed in the export table are copied, unmodified, into the
+**  outgoing ring.  Packets taken from the incoming ring are republished on
+**  the local bus with CFE_SB_ZeroCopyPass so the sequence count set by the
+**  originating instance is kept.  There is no EDS pack/unpack step since
+**  both instances share the mission EDS and the host byte order.
+**
+**  The export pipe is opened with CFE_SB_PIPEOPTS_IGNOREMINE so anything
+**  this app republishes is never delivered back to it.  That prevents an
+**  imported packet from bouncing between the instances when both export
+**  the same message ID.
+**
+*************************************************************************/
+
+#include "sb_bridge_app.h"
+#include "sb_bridge_events.h"
+#include "sb_bridge_msgids.h"
+#include "sb_bridge_perfids.h"
+#include "sb_bridge_version.h"
+#include "sb_bridge_export_table.h"
+#include "sb_bridge_shm.h"
+
+#include "cfe_sb_eds.h"
+
+#include "sb_bridge_eds_dictionary.h"
+#include "sb_bridge_eds_dispatcher.h"
+
+/*
+** Global Data Section
+*/
+typedef union
+{
+    CFE_SB_Msg_t      MsgHdr;
+    SB_BRIDGE_HkTlm_t HkTlm;
+} SB_BRIDGE_HkTlm_Buffer_t;
+
+typedef struct
+{
+    CFE_SB_PipeId_t CmdPipe;
+    CFE_SB_PipeId_t ExportPipe;
+
+    SB_BRIDGE_Shm_t Shm;
+
+    SB_BRIDGE_HkTlm_Buffer_t HkBuf;
+
+    CFE_TBL_Handle_t     ExportTblHandle;
+    SB_BRIDGE_Exports_t *ExportTbl;
+} SB_BRIDGE_GlobalData_t;
+
+SB_BRIDGE_GlobalData_t SB_BRIDGE_Global;
+
+/*
+** Event Filter Table
+*/
+static CFE_EVS_BinFilter_t SB_BRIDGE_EVS_Filters[] = {/* Event ID    mask */
+                                                      {SB_BRIDGE_EXPORT_ERR_EID, CFE_EVS_FIRST_16_STOP},
+                                                      {SB_BRIDGE_IMPORT_ERR_EID, CFE_EVS_FIRST_16_STOP}};
+
+/*
+** Prototypes Section
+*/
+int32 SB_BRIDGE_Init(void);
+void  SB_BRIDGE_ProcessCommands(void);
+void  SB_BRIDGE_ProcessExports(int32 TimeOut);
+bool  SB_BRIDGE_ProcessImports(void);
+
+/*
+ * Individual Command Handler prototypes
+ */
+int32 SB_BRIDGE_Noop(const SB_BRIDGE_Noop_t *data);
+int32 SB_BRIDGE_ResetCounters(const SB_BRIDGE_ResetCounters_t *data);
+int32 SB_BRIDGE_SendHousekeeping(const SB_BRIDGE_SendHkCommand_t *data);
+
+static const SB_BRIDGE_Application_Component_Telecommand_DispatchTable_t SB_BRIDGE_TC_DISPATCH_TABLE = {
+    .CMD     = {.Noop_indication = SB_BRIDGE_Noop, .ResetCounters_indication = SB_BRIDGE_ResetCounters},
+    .SEND_HK = {.indication = SB_BRIDGE_SendHousekeeping}};
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                   */
+/* SB_BRIDGE_AppMain() -- Application entry point and main loop      */
+/*                                                                   */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SB_BRIDGE_AppMain(void)
+{
+    uint32 RunStatus = CFE_ES_RunStatus_APP_RUN;
+    int32  status;
+    bool   Busy;
+
+    CFE_ES_PerfLogEntry(SB_BRIDGE_MAIN_TASK_PERF_ID);
+
+    status = SB_BRIDGE_Init();
+
+    if (status != CFE_SUCCESS)
+    {
+        RunStatus = CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    /*
+    ** SB_BRIDGE RunLoop
+    */
+    while (CFE_ES_RunLoop(&RunStatus) == true)
+    {
+        /*
+         * Only pend on the export pipe when the incoming ring was drained,
+         * otherwise keep cycling so imports are not delayed.
+         */
+        Busy = SB_BRIDGE_ProcessImports();
+
+        CFE_ES_PerfLogExit(SB_BRIDGE_MAIN_TASK_PERF_ID);
+        SB_BRIDGE_ProcessExports(Busy ? CFE_SB_POLL : SB_BRIDGE_IDLE_MSEC);
+        CFE_ES_PerfLogEntry(SB_BRIDGE_MAIN_TASK_PERF_ID);
+
+        SB_BRIDGE_ProcessCommands();
+    }
+
+    SB_BRIDGE_ShmDetach(&SB_BRIDGE_Global.Shm);
+
+    CFE_ES_PerfLogExit(SB_BRIDGE_MAIN_TASK_PERF_ID);
+    CFE_ES_ExitApp(RunStatus);
+
+} /* End of SB_BRIDGE_AppMain() */
+
+/*
+** SB_BRIDGE delete callback function.
+** This function will be called in the event that the app is killed.
+** It releases this side of the shared memory region so that a restarted
+** instance can claim it again.
+*/
+void SB_BRIDGE_DeleteCallback(void)
+{
+    SB_BRIDGE_ShmDetach(&SB_BRIDGE_Global.Shm);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_Init() -- SB_BRIDGE initialization                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 SB_BRIDGE_Init(void)
+{
+    int32          status;
+    uint16         i;
+    CFE_SB_MsgId_t MsgId;
+
+    CFE_ES_RegisterApp();
+
+    memset(&SB_BRIDGE_Global, 0, sizeof(SB_BRIDGE_Global));
+    SB_BRIDGE_Global.Shm.Side = SB_BRIDGE_NO_SIDE;
+
+    /*
+    ** Register event filter table...
+    */
+    CFE_EVS_Register(SB_BRIDGE_EVS_Filters, sizeof(SB_BRIDGE_EVS_Filters) / sizeof(CFE_EVS_BinFilter_t),
+                     CFE_EVS_EventFilter_BINARY);
+
+    /*
+     * Register message dictionary with SB
+     */
+    CFE_SB_EDS_RegisterSelf(&SB_BRIDGE_DATATYPE_DB);
+
+    /*
+    ** Initialize housekeeping packet (clear user data area)...
+    */
+    CFE_SB_InitMsg(&SB_BRIDGE_Global.HkBuf.MsgHdr, SB_BRIDGE_HK_TLM_MID, sizeof(SB_BRIDGE_Global.HkBuf.HkTlm),
+                   true);
+
+    status = CFE_TBL_Register(&SB_BRIDGE_Global.ExportTblHandle, "SB_BRIDGE_Exports", EDS_INDEX(SB_BRIDGE),
+                              SB_BRIDGE_Exports_DATADICTIONARY, CFE_TBL_OPT_DEFAULT, NULL);
+
+    if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d SB_BRIDGE Can't register table status %i", __LINE__, (int)status);
+        return status;
+    }
+
+    status = CFE_TBL_Load(SB_BRIDGE_Global.ExportTblHandle, CFE_TBL_SRC_FILE, "/cf/sb_bridge_exports.tbl");
+
+    if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d SB_BRIDGE Can't load table status %i", __LINE__, (int)status);
+        return status;
+    }
+
+    status = CFE_TBL_GetAddress((void *)&SB_BRIDGE_Global.ExportTbl, SB_BRIDGE_Global.ExportTblHandle);
+
+    if (status != CFE_SUCCESS && status != CFE_TBL_INFO_UPDATED)
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d SB_BRIDGE Can't get table addr status %i", __LINE__, (int)status);
+        return status;
+    }
+
+    status = SB_BRIDGE_ShmAttach(&SB_BRIDGE_Global.Shm, SB_BRIDGE_SHM_NAME);
+    if (status != SB_BRIDGE_SHM_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_SHM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d SB_BRIDGE Can't attach shared memory %s status %i", __LINE__, SB_BRIDGE_SHM_NAME,
+                          (int)status);
+        return status;
+    }
+
+    /*
+    ** Install the delete handler
+    */
+    OS_TaskInstallDeleteHandler(&SB_BRIDGE_DeleteCallback);
+
+    /* Subscribe to my commands */
+    status = CFE_SB_CreatePipe(&SB_BRIDGE_Global.CmdPipe, SB_BRIDGE_CMD_PIPE_DEPTH, "SB_BRIDGE_CMD_PIPE");
+    if (status == CFE_SUCCESS)
+    {
+        CFE_SB_Subscribe(SB_BRIDGE_CMD_MID, SB_BRIDGE_Global.CmdPipe);
+        CFE_SB_Subscribe(SB_BRIDGE_SEND_HK_MID, SB_BRIDGE_Global.CmdPipe);
+    }
+    else
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_CRCMDPIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d SB_BRIDGE Can't create cmd pipe status %i", __LINE__, (int)status);
+        return status;
+    }
+
+    /* Create the export pipe; anything this app sends is never delivered to it */
+    status = CFE_SB_CreatePipe(&SB_BRIDGE_Global.ExportPipe, SB_BRIDGE_EXPORT_PIPE_DEPTH, "SB_BRIDGE_EXP_PIPE");
+    if (status == CFE_SUCCESS)
+    {
+        status = CFE_SB_SetPipeOpts(SB_BRIDGE_Global.ExportPipe, CFE_SB_PIPEOPTS_IGNOREMINE);
+    }
+
+    if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_CREXPPIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d SB_BRIDGE Can't create export pipe status %i", __LINE__, (int)status);
+        return status;
+    }
+
+    /* Subscriptions for the export pipe */
+    for (i = 0; i < CFE_MISSION_SB_BRIDGE_MAX_EXPORT_ENTRIES; i++)
+    {
+        if (SB_BRIDGE_Global.ExportTbl->Exports[i].TopicId == SB_BRIDGE_UNUSED)
+        {
+            break;
+        }
+
+        MsgId  = CFE_SB_MsgId_From_TopicId(SB_BRIDGE_Global.ExportTbl->Exports[i].TopicId);
+        status = CFE_SB_SubscribeEx(MsgId, SB_BRIDGE_Global.ExportPipe, SB_BRIDGE_Global.ExportTbl->Exports[i].Qos,
+                                    SB_BRIDGE_Global.ExportTbl->Exports[i].BufLimit);
+
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SB_BRIDGE_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "L%d SB_BRIDGE Can't subscribe to stream 0x%x status %i", __LINE__,
+                              (unsigned int)CFE_SB_MsgIdToValue(MsgId), (int)status);
+        }
+    }
+
+    SB_BRIDGE_Global.HkBuf.HkTlm.Payload.Side = SB_BRIDGE_Global.Shm.Side;
+
+    CFE_EVS_SendEvent(SB_BRIDGE_INIT_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "SB Bridge Initialized on side %u of %s.%s", (unsigned int)SB_BRIDGE_Global.Shm.Side,
+                      SB_BRIDGE_SHM_NAME, SB_BRIDGE_VERSION_STRING);
+
+    return CFE_SUCCESS;
+} /* End of SB_BRIDGE_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_ProcessCommands() -- Process command pipe message     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SB_BRIDGE_ProcessCommands(void)
+{
+    CFE_SB_Msg_t *MsgPtr;
+    int32         status;
+
+    while (1)
+    {
+        status = CFE_SB_RcvMsg(&MsgPtr, SB_BRIDGE_Global.CmdPipe, CFE_SB_POLL);
+        if (status != CFE_SUCCESS)
+        {
+            /* Exit command processing loop if no message received. */
+            break;
+        }
+
+        status = SB_BRIDGE_Application_Component_Telecommand_Dispatch(CFE_SB_Telecommand_indication_Command_ID,
+                                                                      MsgPtr, &SB_BRIDGE_TC_DISPATCH_TABLE);
+
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SB_BRIDGE_MSGID_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "L%d SB_BRIDGE: Invalid Msg ID Rcvd 0x%x status=0x%08x", __LINE__,
+                              (unsigned int)CFE_SB_MsgIdToValue(CFE_SB_GetMsgId(MsgPtr)), (unsigned int)status);
+            ++SB_BRIDGE_Global.HkBuf.HkTlm.Payload.CommandErrorCounter;
+        }
+    }
+} /* End of SB_BRIDGE_ProcessCommands() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_ProcessExports() -- Copy exported messages to the peer*/
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SB_BRIDGE_ProcessExports(int32 TimeOut)
+{
+    CFE_SB_Msg_t *MsgPtr;
+    int32         status;
+    uint32        Count;
+
+    for (Count = 0; Count < SB_BRIDGE_MAX_BURST; ++Count)
+    {
+        status = CFE_SB_RcvMsg(&MsgPtr, SB_BRIDGE_Global.ExportPipe, TimeOut);
+        if (status != CFE_SUCCESS)
+        {
+            break;
+        }
+
+        /* only the first receive may pend */
+        TimeOut = CFE_SB_POLL;
+
+        status = SB_BRIDGE_RingWrite(SB_BRIDGE_Global.Shm.TxRing, MsgPtr, CFE_SB_GetTotalMsgLength(MsgPtr));
+        if (status == SB_BRIDGE_SHM_SUCCESS)
+        {
+            ++SB_BRIDGE_Global.HkBuf.HkTlm.Payload.ExportPackets;
+        }
+        else
+        {
+            ++SB_BRIDGE_Global.HkBuf.HkTlm.Payload.ExportDrops;
+            CFE_EVS_SendEvent(SB_BRIDGE_EXPORT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_BRIDGE: Dropped export of 0x%x, status %i",
+                              (unsigned int)CFE_SB_MsgIdToValue(CFE_SB_GetMsgId(MsgPtr)), (int)status);
+        }
+    }
+} /* End of SB_BRIDGE_ProcessExports() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_ProcessImports() -- Republish packets from the peer   */
+/* Returns true if the incoming ring may still hold packets        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SB_BRIDGE_ProcessImports(void)
+{
+    CFE_SB_ZeroCopyHandle_t BufferHandle;
+    CFE_SB_Msg_t *          MsgPtr;
+    uint32                  Size;
+    uint32                  Count;
+    int32                   status;
+
+    for (Count = 0; Count < SB_BRIDGE_MAX_BURST; ++Count)
+    {
+        status = SB_BRIDGE_RingPeek(SB_BRIDGE_Global.Shm.RxRing, &Size);
+        if (status == SB_BRIDGE_SHM_RING_EMPTY)
+        {
+            return false;
+        }
+
+        if (status == SB_BRIDGE_SHM_CORRUPT)
+        {
+            ++SB_BRIDGE_Global.HkBuf.HkTlm.Payload.ImportErrors;
+            CFE_EVS_SendEvent(SB_BRIDGE_IMPORT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_BRIDGE: Discarded corrupt contents of the incoming ring");
+            return false;
+        }
+
+        CFE_ES_PerfLogEntry(SB_BRIDGE_IMPORT_PERF_ID);
+
+        /* Copy straight from the ring into an SB buffer, there is no intermediate copy */
+        MsgPtr = NULL;
+        if (Size >= sizeof(CCSDS_SpacePacket_t) && Size <= CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+        {
+            MsgPtr = CFE_SB_ZeroCopyGetPtr(Size, &BufferHandle);
+        }
+
+        if (MsgPtr == NULL)
+        {
+            SB_BRIDGE_RingDiscard(SB_BRIDGE_Global.Shm.RxRing);
+            status = CFE_SB_BUF_ALOC_ERR;
+        }
+        else
+        {
+            SB_BRIDGE_RingRead(SB_BRIDGE_Global.Shm.RxRing, MsgPtr, Size);
+
+            if (CFE_SB_GetTotalMsgLength(MsgPtr) != Size)
+            {
+                CFE_SB_ZeroCopyReleasePtr(MsgPtr, BufferHandle);
+                status = CFE_SB_MSG_TOO_BIG;
+            }
+            else
+            {
+                status = CFE_SB_ZeroCopyPass(MsgPtr, BufferHandle);
+            }
+        }
+
+        if (status == CFE_SUCCESS)
+        {
+            ++SB_BRIDGE_Global.HkBuf.HkTlm.Payload.ImportPackets;
+        }
+        else
+        {
+            ++SB_BRIDGE_Global.HkBuf.HkTlm.Payload.ImportErrors;
+            CFE_EVS_SendEvent(SB_BRIDGE_IMPORT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_BRIDGE: Dropped import of %lu bytes, status %i", (unsigned long)Size, (int)status);
+        }
+
+        CFE_ES_PerfLogExit(SB_BRIDGE_IMPORT_PERF_ID);
+    }
+
+    return true;
+} /* End of SB_BRIDGE_ProcessImports() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_Noop() -- Noop Handler                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 SB_BRIDGE_Noop(const SB_BRIDGE_Noop_t *data)
+{
+    CFE_EVS_SendEvent(SB_BRIDGE_NOOP_INF_EID, CFE_EVS_EventType_INFORMATION, "No-op command. %s",
+                      SB_BRIDGE_VERSION_STRING);
+    ++SB_BRIDGE_Global.HkBuf.HkTlm.Payload.CommandCounter;
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_ResetCounters() -- Reset counters                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 SB_BRIDGE_ResetCounters(const SB_BRIDGE_ResetCounters_t *data)
+{
+    SB_BRIDGE_Global.HkBuf.HkTlm.Payload.CommandCounter      = 0;
+    SB_BRIDGE_Global.HkBuf.HkTlm.Payload.CommandErrorCounter = 0;
+    SB_BRIDGE_Global.HkBuf.HkTlm.Payload.ExportPackets       = 0;
+    SB_BRIDGE_Global.HkBuf.HkTlm.Payload.ExportDrops         = 0;
+    SB_BRIDGE_Global.HkBuf.HkTlm.Payload.ImportPackets       = 0;
+    SB_BRIDGE_Global.HkBuf.HkTlm.Payload.ImportErrors        = 0;
+
+    CFE_EVS_SendEvent(SB_BRIDGE_RESET_INF_EID, CFE_EVS_EventType_DEBUG, "Reset counters command");
+    return CFE_SUCCESS;
+} /* End of SB_BRIDGE_ResetCounters() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_SendHousekeeping() -- HK status                       */
+/* Does not increment CommandCounter                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 SB_BRIDGE_SendHousekeeping(const SB_BRIDGE_SendHkCommand_t *data)
+{
+    SB_BRIDGE_Global.HkBuf.HkTlm.Payload.PeerAttached = SB_BRIDGE_ShmPeerAttached(&SB_BRIDGE_Global.Shm);
+
+    CFE_SB_TimeStampMsg(&SB_BRIDGE_Global.HkBuf.MsgHdr);
+    CFE_SB_SendMsg(&SB_BRIDGE_Global.HkBuf.MsgHdr);
+    return CFE_SUCCESS;
+} /* End of SB_BRIDGE_SendHousekeeping() */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,90 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: sb_bridge_app.h
+**
+** Purpose:
+**  Define SB Bridge Application header file
+**
+** Notes:
+**
+*************************************************************************/
+
+#ifndef _sb_bridge_app_h_
+#define _sb_bridge_app_h_
+
+#include "cfe_error.h"
+#include "cfe_sb.h"
+#include "cfe_time.h"
+#include "cfe_evs.h"
+#include "cfe_es.h"
+#include "cfe_tbl.h"
+
+#include <string.h>
+
+#include "common_types.h"
+#include "osapi.h"
+
+/* Use the EDS generated type definitions */
+#include "sb_bridge_eds_defines.h"
+#include "sb_bridge_eds_typedefs.h"
+
+/*****************************************************************************/
+
+#define SB_BRIDGE_UNUSED 0
+
+/**
+ * Name of the POSIX shared memory object shared by the two bridged instances
+ */
+#define SB_BRIDGE_SHM_NAME "/cfe_sb_bridge"
+
+/**
+ * Depth of pipe for commands to the SB_BRIDGE application itself
+ */
+#define SB_BRIDGE_CMD_PIPE_DEPTH 8
+
+/**
+ * Depth of pipe for messages exported to the peer instance
+ */
+#define SB_BRIDGE_EXPORT_PIPE_DEPTH OS_QUEUE_MAX_DEPTH
+
+/**
+ * Time to wait on the export pipe when there is nothing else to do.
+ * This bounds the import latency, since the peer does not signal
+ * this process when it writes to the ring.
+ */
+#define SB_BRIDGE_IDLE_MSEC 1
+
+/**
+ * Maximum number of packets moved in each direction per loop iteration,
+ * so that one busy direction cannot starve the other or the command pipe
+ */
+#define SB_BRIDGE_MAX_BURST 64
+
+/******************************************************************************/
+
+/*
+** Prototypes Section
+*/
+void SB_BRIDGE_AppMain(void);
+
+/******************************************************************************/
+
+#endif /* _sb_bridge_app_h_ */
@@ -0,0 +1,51 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: sb_bridge_events.h
+**
+** Purpose:
+**  Define SB Bridge Event messages
+**
+** Notes:
+**
+*************************************************************************/
+#ifndef _sb_bridge_events_h_
+#define _sb_bridge_events_h_
+
+/*****************************************************************************/
+
+/* Event message ID's */
+#define SB_BRIDGE_EVM_RESERVED 0
+
+#define SB_BRIDGE_INIT_INF_EID       1
+#define SB_BRIDGE_CRCMDPIPE_ERR_EID  2
+#define SB_BRIDGE_CREXPPIPE_ERR_EID  3
+#define SB_BRIDGE_SUBSCRIBE_ERR_EID  4
+#define SB_BRIDGE_TBL_ERR_EID        5
+#define SB_BRIDGE_SHM_ERR_EID        6
+#define SB_BRIDGE_MSGID_ERR_EID      7
+#define SB_BRIDGE_EXPORT_ERR_EID     8
+#define SB_BRIDGE_IMPORT_ERR_EID     9
+#define SB_BRIDGE_NOOP_INF_EID       10
+#define SB_BRIDGE_RESET_INF_EID      11
+
+/******************************************************************************/
+
+#endif /* _sb_bridge_events_h_ */
@@ -0,0 +1,454 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: sb_bridge_shm.c
+**
+** Purpose:
+**  Shared memory region and lock-free ring implementation for the SB Bridge
+**
+** Notes:
+**  See sb_bridge_shm.h for the region layout.
+**
+*************************************************************************/
+
+#include "sb_bridge_shm.h"
+
+#include "osapi.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*
+ * Length word written in place of a record to skip the rest of the data area
+ */
+#define SB_BRIDGE_RING_PAD_MARKER 0xFFFFFFFF
+
+#define SB_BRIDGE_RING_MASK (SB_BRIDGE_RING_SIZE - 1)
+
+/*
+ * Total ring space used by a packet of the given size
+ */
+#define SB_BRIDGE_RECORD_SIZE(x) (sizeof(uint32) + (((x) + 3) & ~3))
+
+/*
+ * Owner tokens hold the process ID in the low word and the process
+ * start time in the high word
+ */
+#define SB_BRIDGE_OWNER_TOKEN(pid, start) (((uint64)(start) << 32) | (uint32)(pid))
+#define SB_BRIDGE_OWNER_PID(token)        ((uint32)(token))
+#define SB_BRIDGE_OWNER_START(token)      ((uint32)((token) >> 32))
+
+/*
+ * Field of /proc/<pid>/stat holding the start time of the process
+ */
+#define SB_BRIDGE_STAT_STARTTIME_FIELD 22
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_ProcessStartTime() -- Start time of a process         */
+/* Returns 0 if it is not known                                    */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 SB_BRIDGE_ProcessStartTime(uint32 Pid)
+{
+    char    Path[32];
+    char    Buf[512];
+    char *  Field;
+    ssize_t Len;
+    int     Fd;
+    int     i;
+
+    snprintf(Path, sizeof(Path), "/proc/%lu/stat", (unsigned long)Pid);
+    Fd = open(Path, O_RDONLY);
+    if (Fd < 0)
+    {
+        return 0;
+    }
+
+    Len = read(Fd, Buf, sizeof(Buf) - 1);
+    close(Fd);
+    if (Len <= 0)
+    {
+        return 0;
+    }
+    Buf[Len] = 0;
+
+    /* the command name in field 2 may itself contain spaces and parentheses */
+    Field = strrchr(Buf, ')');
+    for (i = 2; Field != NULL && i < SB_BRIDGE_STAT_STARTTIME_FIELD; ++i)
+    {
+        Field = strchr(Field + 1, ' ');
+    }
+
+    if (Field == NULL)
+    {
+        return 0;
+    }
+
+    return (uint32)strtoull(Field + 1, NULL, 10);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_OwnerIsStale() -- Check if a side owner has exited    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool SB_BRIDGE_OwnerIsStale(uint64 Owner)
+{
+    uint32 Start;
+
+    if (Owner == 0)
+    {
+        return false;
+    }
+
+    if (kill((pid_t)SB_BRIDGE_OWNER_PID(Owner), 0) < 0 && errno == ESRCH)
+    {
+        return true;
+    }
+
+    /* A live process with a different start time has reused the process ID */
+    Start = SB_BRIDGE_ProcessStartTime(SB_BRIDGE_OWNER_PID(Owner));
+    return (Start != 0 && SB_BRIDGE_OWNER_START(Owner) != 0 && Start != SB_BRIDGE_OWNER_START(Owner));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_ClaimSide() -- Claim a free or abandoned side         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint8 SB_BRIDGE_ClaimSide(SB_BRIDGE_ShmRegion_t *Region, uint64 Self)
+{
+    uint64 Owner;
+    uint8  Side;
+
+    for (Side = 0; Side < 2; ++Side)
+    {
+        Owner = __atomic_load_n(&Region->Owner[Side], __ATOMIC_ACQUIRE);
+        if ((Owner == 0 || SB_BRIDGE_OwnerIsStale(Owner)) &&
+            __atomic_compare_exchange_n(&Region->Owner[Side], &Owner, Self, false, __ATOMIC_ACQ_REL,
+                                        __ATOMIC_ACQUIRE))
+        {
+            return Side;
+        }
+    }
+
+    return SB_BRIDGE_NO_SIDE;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_ShmAttach() -- Map the region and claim a side        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 SB_BRIDGE_ShmAttach(SB_BRIDGE_Shm_t *Shm, const char *Name)
+{
+    struct stat Stat;
+    bool        Creator;
+    uint32      Retries;
+    void *      Addr;
+
+    memset(Shm, 0, sizeof(*Shm));
+    Shm->Side = SB_BRIDGE_NO_SIDE;
+
+    Shm->Fd = shm_open(Name, O_RDWR | O_CREAT | O_EXCL, 0660);
+    Creator = (Shm->Fd >= 0);
+    if (!Creator && errno == EEXIST)
+    {
+        Shm->Fd = shm_open(Name, O_RDWR, 0);
+    }
+
+    if (Shm->Fd < 0)
+    {
+        return SB_BRIDGE_SHM_ERROR;
+    }
+
+    if (Creator)
+    {
+        /* ftruncate() zero fills, so both rings start out empty */
+        if (ftruncate(Shm->Fd, sizeof(SB_BRIDGE_ShmRegion_t)) < 0)
+        {
+            close(Shm->Fd);
+            shm_unlink(Name);
+            return SB_BRIDGE_SHM_ERROR;
+        }
+    }
+    else
+    {
+        /* The creator may not have sized the region yet */
+        Retries = 0;
+        while (fstat(Shm->Fd, &Stat) == 0 && Stat.st_size == 0 && Retries < SB_BRIDGE_ATTACH_RETRIES)
+        {
+            OS_TaskDelay(10);
+            ++Retries;
+        }
+
+        if (fstat(Shm->Fd, &Stat) < 0 || Stat.st_size != sizeof(SB_BRIDGE_ShmRegion_t))
+        {
+            close(Shm->Fd);
+            return SB_BRIDGE_SHM_MISMATCH;
+        }
+    }
+
+    Addr = mmap(NULL, sizeof(SB_BRIDGE_ShmRegion_t), PROT_READ | PROT_WRITE, MAP_SHARED, Shm->Fd, 0);
+    if (Addr == MAP_FAILED)
+    {
+        close(Shm->Fd);
+        return SB_BRIDGE_SHM_ERROR;
+    }
+
+    Shm->Region = Addr;
+
+    if (Creator)
+    {
+        Shm->Region->RingSize = SB_BRIDGE_RING_SIZE;
+        __atomic_store_n(&Shm->Region->Magic, SB_BRIDGE_SHM_MAGIC, __ATOMIC_RELEASE);
+    }
+    else
+    {
+        Retries = 0;
+        while (__atomic_load_n(&Shm->Region->Magic, __ATOMIC_ACQUIRE) != SB_BRIDGE_SHM_MAGIC &&
+               Retries < SB_BRIDGE_ATTACH_RETRIES)
+        {
+            OS_TaskDelay(10);
+            ++Retries;
+        }
+
+        if (__atomic_load_n(&Shm->Region->Magic, __ATOMIC_ACQUIRE) != SB_BRIDGE_SHM_MAGIC ||
+            Shm->Region->RingSize != SB_BRIDGE_RING_SIZE)
+        {
+            SB_BRIDGE_ShmDetach(Shm);
+            return SB_BRIDGE_SHM_MISMATCH;
+        }
+    }
+
+    Shm->OwnerToken = SB_BRIDGE_OWNER_TOKEN(getpid(), SB_BRIDGE_ProcessStartTime((uint32)getpid()));
+    Shm->Side       = SB_BRIDGE_ClaimSide(Shm->Region, Shm->OwnerToken);
+    if (Shm->Side == SB_BRIDGE_NO_SIDE)
+    {
+        SB_BRIDGE_ShmDetach(Shm);
+        return SB_BRIDGE_SHM_BUSY;
+    }
+
+    Shm->TxRing = &Shm->Region->Ring[Shm->Side];
+    Shm->RxRing = &Shm->Region->Ring[Shm->Side ^ 1];
+
+    return SB_BRIDGE_SHM_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_ShmDetach() -- Release the side and unmap the region  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SB_BRIDGE_ShmDetach(SB_BRIDGE_Shm_t *Shm)
+{
+    uint64 Self;
+
+    if (Shm->Region != NULL)
+    {
+        if (Shm->Side != SB_BRIDGE_NO_SIDE)
+        {
+            Self = Shm->OwnerToken;
+            __atomic_compare_exchange_n(&Shm->Region->Owner[Shm->Side], &Self, 0, false, __ATOMIC_ACQ_REL,
+                                        __ATOMIC_ACQUIRE);
+        }
+
+        munmap(Shm->Region, sizeof(SB_BRIDGE_ShmRegion_t));
+        close(Shm->Fd);
+    }
+
+    Shm->Region = NULL;
+    Shm->TxRing = NULL;
+    Shm->RxRing = NULL;
+    Shm->Side   = SB_BRIDGE_NO_SIDE;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_ShmPeerAttached() -- Check for a peer instance        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SB_BRIDGE_ShmPeerAttached(const SB_BRIDGE_Shm_t *Shm)
+{
+    uint64 Owner;
+
+    if (Shm->Region == NULL || Shm->Side == SB_BRIDGE_NO_SIDE)
+    {
+        return false;
+    }
+
+    Owner = __atomic_load_n(&Shm->Region->Owner[Shm->Side ^ 1], __ATOMIC_ACQUIRE);
+
+    return (Owner != 0 && !SB_BRIDGE_OwnerIsStale(Owner));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_RingWrite() -- Append a packet (producer side)        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 SB_BRIDGE_RingWrite(SB_BRIDGE_Ring_t *Ring, const void *Packet, uint32 Size)
+{
+    uint32 Head;
+    uint32 Tail;
+    uint32 Pos;
+    uint32 Contig;
+    uint32 Needed;
+    uint32 Record;
+
+    if (Size == 0 || Size > SB_BRIDGE_RING_MAX_PACKET)
+    {
+        return SB_BRIDGE_SHM_BAD_SIZE;
+    }
+
+    /* Head is only written by this side, Tail is published by the consumer */
+    Head = __atomic_load_n(&Ring->Head, __ATOMIC_RELAXED);
+    Tail = __atomic_load_n(&Ring->Tail, __ATOMIC_ACQUIRE);
+
+    Record = SB_BRIDGE_RECORD_SIZE(Size);
+    Pos    = Head & SB_BRIDGE_RING_MASK;
+    Contig = SB_BRIDGE_RING_SIZE - Pos;
+    Needed = Record;
+    if (Contig < Record)
+    {
+        /* records never wrap, so the tail end of the data area is skipped */
+        Needed += Contig;
+    }
+
+    if ((SB_BRIDGE_RING_SIZE - (Head - Tail)) < Needed)
+    {
+        return SB_BRIDGE_SHM_RING_FULL;
+    }
+
+    if (Contig < Record)
+    {
+        *(uint32 *)&Ring->Data[Pos] = SB_BRIDGE_RING_PAD_MARKER;
+        Head += Contig;
+        Pos = 0;
+    }
+
+    *(uint32 *)&Ring->Data[Pos] = Size;
+    memcpy(&Ring->Data[Pos + sizeof(uint32)], Packet, Size);
+
+    __atomic_store_n(&Ring->Head, Head + Record, __ATOMIC_RELEASE);
+
+    return SB_BRIDGE_SHM_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_RingPeek() -- Size of the next packet (consumer side) */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 SB_BRIDGE_RingPeek(SB_BRIDGE_Ring_t *Ring, uint32 *SizePtr)
+{
+    uint32 Head;
+    uint32 Tail;
+    uint32 Used;
+    uint32 Pos;
+    uint32 Size;
+
+    *SizePtr = 0;
+    Tail     = __atomic_load_n(&Ring->Tail, __ATOMIC_RELAXED);
+
+    while (1)
+    {
+        Head = __atomic_load_n(&Ring->Head, __ATOMIC_ACQUIRE);
+        if (Head == Tail)
+        {
+            return SB_BRIDGE_SHM_RING_EMPTY;
+        }
+
+        /*
+         * Head and the length words are written by the peer, so a record
+         * must lie within the published part of the ring before it is used
+         */
+        Used = Head - Tail;
+        Pos  = Tail & SB_BRIDGE_RING_MASK;
+        if (Used > SB_BRIDGE_RING_SIZE || Used < sizeof(uint32) || (Pos & 3) != 0)
+        {
+            break;
+        }
+
+        Size = *(const uint32 *)&Ring->Data[Pos];
+        if (Size != SB_BRIDGE_RING_PAD_MARKER)
+        {
+            if (Size == 0 || Size > SB_BRIDGE_RING_MAX_PACKET || SB_BRIDGE_RECORD_SIZE(Size) > Used ||
+                SB_BRIDGE_RECORD_SIZE(Size) > (SB_BRIDGE_RING_SIZE - Pos))
+            {
+                break;
+            }
+
+            *SizePtr = Size;
+            return SB_BRIDGE_SHM_SUCCESS;
+        }
+
+        if ((SB_BRIDGE_RING_SIZE - Pos) > Used)
+        {
+            break;
+        }
+
+        Tail += SB_BRIDGE_RING_SIZE - Pos;
+        __atomic_store_n(&Ring->Tail, Tail, __ATOMIC_RELEASE);
+    }
+
+    /* drop everything the peer has published and resume at its next record */
+    __atomic_store_n(&Ring->Tail, Head, __ATOMIC_RELEASE);
+
+    return SB_BRIDGE_SHM_CORRUPT;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_RingRead() -- Remove the next packet (consumer side)  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SB_BRIDGE_RingRead(SB_BRIDGE_Ring_t *Ring, void *Dest, uint32 Size)
+{
+    uint32 Tail;
+
+    Tail = __atomic_load_n(&Ring->Tail, __ATOMIC_RELAXED);
+    memcpy(Dest, &Ring->Data[(Tail & SB_BRIDGE_RING_MASK) + sizeof(uint32)], Size);
+
+    __atomic_store_n(&Ring->Tail, Tail + SB_BRIDGE_RECORD_SIZE(Size), __ATOMIC_RELEASE);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_RingDiscard() -- Drop the next packet (consumer side) */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SB_BRIDGE_RingDiscard(SB_BRIDGE_Ring_t *Ring)
+{
+    uint32 Size;
+
+    if (SB_BRIDGE_RingPeek(Ring, &Size) == SB_BRIDGE_SHM_SUCCESS)
+    {
+        __atomic_store_n(&Ring->Tail, __atomic_load_n(&Ring->Tail, __ATOMIC_RELAXED) + SB_BRIDGE_RECORD_SIZE(Size),
+                         __ATOMIC_RELEASE);
+    }
+}
@@ -0,0 +1,179 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: sb_bridge_shm.h
+**
+** Purpose:
+**  Shared memory ring pair used by the SB Bridge to move CCSDS packets
+**  between two cFE instances running on the same host.
+**
+** Notes:
+**  The region holds one single-producer/single-consumer ring per direction.
+**  Ring[N] is written only by the instance that claimed side N and read only
+**  by its peer, so neither ring needs a lock: the producer owns Head, the
+**  consumer owns Tail, and each publishes its index with release ordering.
+**
+**  Packets are stored as a 32-bit length word followed by the raw packet,
+**  padded to a 4 byte boundary.  A record never wraps; when it does not fit
+**  at the end of the data area the producer writes a pad marker instead and
+**  continues at offset zero.
+**
+**  This uses POSIX shared memory (shm_open/mmap) and GCC atomic builtins,
+**  and is therefore limited to POSIX hosts.
+**
+*************************************************************************/
+#ifndef _sb_bridge_shm_h_
+#define _sb_bridge_shm_h_
+
+#include "common_types.h"
+
+/*****************************************************************************/
+
+/**
+ * Magic number marking a fully initialized region.  Changed whenever the
+ * layout of the region changes.
+ */
+#define SB_BRIDGE_SHM_MAGIC 0x53425248
+
+/**
+ * Size of the data area of each ring, in bytes.  Must be a power of two.
+ */
+#define SB_BRIDGE_RING_SIZE (256 * 1024)
+
+/**
+ * Largest packet that can be carried by a ring
+ */
+#define SB_BRIDGE_RING_MAX_PACKET (SB_BRIDGE_RING_SIZE / 4)
+
+/**
+ * Value reported by SB_BRIDGE_ShmAttach() in the side output when
+ * no side could be claimed
+ */
+#define SB_BRIDGE_NO_SIDE 0xFF
+
+/**
+ * Number of 10ms waits for a peer that is still initializing the region
+ */
+#define SB_BRIDGE_ATTACH_RETRIES 100
+
+/*
+ * Return codes from the shared memory functions
+ */
+#define SB_BRIDGE_SHM_SUCCESS    0
+#define SB_BRIDGE_SHM_ERROR      (-1) /**< OS error creating or mapping the region */
+#define SB_BRIDGE_SHM_MISMATCH   (-2) /**< Region exists with a different layout */
+#define SB_BRIDGE_SHM_BUSY       (-3) /**< Both sides are claimed by live processes */
+#define SB_BRIDGE_SHM_RING_FULL  (-4) /**< Not enough free space in the ring */
+#define SB_BRIDGE_SHM_BAD_SIZE   (-5) /**< Packet is empty or exceeds #SB_BRIDGE_RING_MAX_PACKET */
+#define SB_BRIDGE_SHM_RING_EMPTY (-6) /**< No packet in the ring */
+#define SB_BRIDGE_SHM_CORRUPT    (-7) /**< Ring indices or record length are invalid, ring was emptied */
+
+/*
+ * The producer and consumer indices are kept on separate cache lines
+ * so the two processes do not contend on the same line.
+ */
+#define SB_BRIDGE_CACHE_LINE 64
+
+typedef struct
+{
+    uint32 Head; /**< Free-running write index, updated by the producer only */
+    uint8  HeadPad[SB_BRIDGE_CACHE_LINE - sizeof(uint32)];
+    uint32 Tail; /**< Free-running read index, updated by the consumer only */
+    uint8  TailPad[SB_BRIDGE_CACHE_LINE - sizeof(uint32)];
+    uint8  Data[SB_BRIDGE_RING_SIZE];
+} SB_BRIDGE_Ring_t;
+
+typedef struct
+{
+    uint32 Magic;
+    uint32 RingSize;
+    uint64 Owner[2]; /**< Owner token of the instance holding each side, 0 if free */
+    uint8  Pad[SB_BRIDGE_CACHE_LINE - (2 * sizeof(uint32)) - (2 * sizeof(uint64))];
+
+    SB_BRIDGE_Ring_t Ring[2]; /**< Ring[N] carries packets sent by side N */
+} SB_BRIDGE_ShmRegion_t;
+
+/**
+ * Local handle for an attached region
+ */
+typedef struct
+{
+    int                    Fd;
+    uint8                  Side;
+    uint64                 OwnerToken; /**< Value stored in the Owner entry of the claimed side */
+    SB_BRIDGE_ShmRegion_t *Region;
+    SB_BRIDGE_Ring_t *     TxRing;
+    SB_BRIDGE_Ring_t *     RxRing;
+} SB_BRIDGE_Shm_t;
+
+/******************************************************************************/
+
+/*
+** Prototypes Section
+*/
+
+/*
+ * Create or open the named region, map it, and claim a free side.
+ * A side whose owner process no longer exists is reclaimed, so an instance
+ * can be restarted without removing the region.  The owner token holds the
+ * process ID and the start time of the process, so a process that was
+ * given the ID of an exited owner does not keep its side claimed.
+ */
+int32 SB_BRIDGE_ShmAttach(SB_BRIDGE_Shm_t *Shm, const char *Name);
+
+/*
+ * Release the claimed side and unmap the region.  The region itself is
+ * left in place for the peer.
+ */
+void SB_BRIDGE_ShmDetach(SB_BRIDGE_Shm_t *Shm);
+
+/*
+ * Returns true if the other side of the region is currently claimed
+ */
+bool SB_BRIDGE_ShmPeerAttached(const SB_BRIDGE_Shm_t *Shm);
+
+/*
+ * Append one packet to the ring.  Never blocks.
+ */
+int32 SB_BRIDGE_RingWrite(SB_BRIDGE_Ring_t *Ring, const void *Packet, uint32 Size);
+
+/*
+ * Get the size of the next packet in the ring.  The packet stays in the ring
+ * until SB_BRIDGE_RingRead() or SB_BRIDGE_RingDiscard().
+ *
+ * The indices and length words come from the peer and are checked before use.
+ * If they are invalid the ring is emptied and SB_BRIDGE_SHM_CORRUPT returned.
+ */
+int32 SB_BRIDGE_RingPeek(SB_BRIDGE_Ring_t *Ring, uint32 *SizePtr);
+
+/*
+ * Copy the next packet, whose size was returned by SB_BRIDGE_RingPeek(),
+ * into Dest and remove it from the ring.
+ */
+void SB_BRIDGE_RingRead(SB_BRIDGE_Ring_t *Ring, void *Dest, uint32 Size);
+
+/*
+ * Remove the next packet from the ring without copying it
+ */
+void SB_BRIDGE_RingDiscard(SB_BRIDGE_Ring_t *Ring);
+
+/******************************************************************************/
+
+#endif /* _sb_bridge_shm_h_ */
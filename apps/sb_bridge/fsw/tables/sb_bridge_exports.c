@@ -0,0 +1,49 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: sb_bridge_exports.c
+**
+** Purpose:
+**  Define SB Bridge CPU specific export table
+**
+** Notes:
+**  Every message ID listed here is forwarded to the peer instance and
+**  republished on its software bus.  Both instances may export the same
+**  message ID; the bridge never re-exports a message it imported.
+**
+*************************************************************************/
+
+#include "cfe_tbl_filedef.h"  /* Required to obtain the CFE_TBL_FILEDEF macro definition */
+
+#include "sb_bridge_export_table.h"
+#include "sb_bridge_app.h"
+
+SB_BRIDGE_Exports_t SB_BRIDGE_Exports =
+{
+    .Exports =
+    {
+        {CFE_MISSION_SAMPLE_APP_HK_TLM_TOPICID, {0, 0}, 4},
+
+        /* SB_BRIDGE_UNUSED entry to mark the end of valid MsgIds */
+        {SB_BRIDGE_UNUSED, {0, 0}, 0}
+    }
+};
+
+CFE_TBL_FILEDEF(SB_BRIDGE_Exports, "SB_BRIDGE.SB_BRIDGE_Exports", "SB Bridge Export Tbl", "sb_bridge_exports.tbl", "SB_BRIDGE/Exports")
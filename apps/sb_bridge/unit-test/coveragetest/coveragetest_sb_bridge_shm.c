@@ -0,0 +1,357 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** File: coveragetest_sb_bridge_shm.c
+**
+** Purpose:
+** Coverage Unit Test cases for the SB Bridge shared memory ring
+**
+** Notes:
+** The ring functions are tested on a local ring object.  The attach
+** tests use a real POSIX shared memory object named after the test
+** process, which is removed at the end of the test.
+*/
+
+
+/*
+ * Includes
+ */
+
+#include "sb_bridge_coveragetest_common.h"
+
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+/*
+ * Ring used by the ring test cases; too large for the stack
+ */
+static SB_BRIDGE_Ring_t UT_Ring;
+
+/*
+ * Fill a test packet with a pattern derived from its size
+ */
+static void UT_FillPacket(uint8 *Packet, uint32 Size)
+{
+    uint32 i;
+
+    for (i = 0; i < Size; ++i)
+    {
+        Packet[i] = (uint8)(Size + i);
+    }
+}
+
+/*
+ * Check that the next packet in the ring matches UT_FillPacket() for the given size
+ */
+static void UT_CheckNextPacket(uint32 ExpectedSize)
+{
+    static uint8 Expected[SB_BRIDGE_RING_MAX_PACKET];
+    static uint8 Actual[SB_BRIDGE_RING_MAX_PACKET];
+    uint32       Size = 0;
+
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingPeek(&UT_Ring, &Size), SB_BRIDGE_SHM_SUCCESS);
+    UtAssert_True(Size == ExpectedSize, "Size (%lu) == %lu", (unsigned long)Size, (unsigned long)ExpectedSize);
+    if (Size == ExpectedSize)
+    {
+        UT_FillPacket(Expected, Size);
+        SB_BRIDGE_RingRead(&UT_Ring, Actual, Size);
+        UtAssert_True(memcmp(Actual, Expected, Size) == 0, "Packet of %lu bytes is intact", (unsigned long)Size);
+    }
+}
+
+/*
+ * Place the (empty) ring at the given free-running index
+ */
+static void UT_SetRingIndex(uint32 Index)
+{
+    UT_Ring.Head = Index;
+    UT_Ring.Tail = Index;
+}
+
+void Test_SB_BRIDGE_RingWriteRead(void)
+{
+    /*
+     * Test Case For:
+     * int32 SB_BRIDGE_RingWrite(SB_BRIDGE_Ring_t *Ring, const void *Packet, uint32 Size)
+     * int32 SB_BRIDGE_RingPeek(SB_BRIDGE_Ring_t *Ring, uint32 *SizePtr)
+     * void SB_BRIDGE_RingRead(SB_BRIDGE_Ring_t *Ring, void *Dest, uint32 Size)
+     * void SB_BRIDGE_RingDiscard(SB_BRIDGE_Ring_t *Ring)
+     */
+    uint8  Packet[64];
+    uint32 Size;
+
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingPeek(&UT_Ring, &Size), SB_BRIDGE_SHM_RING_EMPTY);
+    UtAssert_True(Size == 0, "Size (%lu) == 0", (unsigned long)Size);
+
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, 0), SB_BRIDGE_SHM_BAD_SIZE);
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, SB_BRIDGE_RING_MAX_PACKET + 1), SB_BRIDGE_SHM_BAD_SIZE);
+
+    /* odd sizes are padded to the next record boundary */
+    UT_FillPacket(Packet, 13);
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, 13), SB_BRIDGE_SHM_SUCCESS);
+    UT_FillPacket(Packet, 20);
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, 20), SB_BRIDGE_SHM_SUCCESS);
+    UT_FillPacket(Packet, 7);
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, 7), SB_BRIDGE_SHM_SUCCESS);
+
+    UT_CheckNextPacket(13);
+    SB_BRIDGE_RingDiscard(&UT_Ring);
+    UT_CheckNextPacket(7);
+
+    UtAssert_True(UT_Ring.Head == UT_Ring.Tail, "Ring is empty after reading all packets");
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingPeek(&UT_Ring, &Size), SB_BRIDGE_SHM_RING_EMPTY);
+
+    /* discarding from an empty ring has no effect */
+    SB_BRIDGE_RingDiscard(&UT_Ring);
+    UtAssert_True(UT_Ring.Head == UT_Ring.Tail, "Discard of an empty ring leaves it empty");
+}
+
+void Test_SB_BRIDGE_RingWrap(void)
+{
+    /*
+     * Test Case For:
+     * Records that do not fit at the end of the data area, and
+     * free-running indices that wrap around zero
+     */
+    static uint8 Packet[SB_BRIDGE_RING_MAX_PACKET];
+
+    /* a record that ends exactly at the end of the data area */
+    UT_SetRingIndex(SB_BRIDGE_RING_SIZE - 16);
+
+    UT_FillPacket(Packet, 12);
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, 12), SB_BRIDGE_SHM_SUCCESS);
+    UtAssert_True((UT_Ring.Head & (SB_BRIDGE_RING_SIZE - 1)) == 0, "Record fills the data area exactly");
+
+    /* one that does not fit in the last 16 bytes is placed at offset 0, and the index wraps */
+    UT_SetRingIndex(0xFFFFFFF0);
+    UT_FillPacket(Packet, 100);
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, 100), SB_BRIDGE_SHM_SUCCESS);
+    UtAssert_True(UT_Ring.Head == 104, "Head (%lu) == 104 after wrapping", (unsigned long)UT_Ring.Head);
+    UT_FillPacket(Packet, 40);
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, 40), SB_BRIDGE_SHM_SUCCESS);
+
+    UT_CheckNextPacket(100);
+    UtAssert_True(UT_Ring.Tail == 104, "Tail (%lu) == 104 after skipping the pad", (unsigned long)UT_Ring.Tail);
+    UT_CheckNextPacket(40);
+    UtAssert_True(UT_Ring.Head == UT_Ring.Tail, "Ring is empty after reading all packets");
+
+    /* the skipped bytes at the end count against the free space */
+    UT_SetRingIndex(SB_BRIDGE_RING_SIZE - 8);
+    UT_Ring.Tail = 16;
+    UT_FillPacket(Packet, 16);
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, 16), SB_BRIDGE_SHM_RING_FULL);
+}
+
+void Test_SB_BRIDGE_RingFull(void)
+{
+    /*
+     * Test Case For:
+     * A producer that gets ahead of the consumer
+     */
+    static uint8 Packet[SB_BRIDGE_RING_MAX_PACKET];
+    uint32       Count;
+
+    UT_FillPacket(Packet, SB_BRIDGE_RING_MAX_PACKET);
+    Count = 0;
+    while (SB_BRIDGE_RingWrite(&UT_Ring, Packet, SB_BRIDGE_RING_MAX_PACKET) == SB_BRIDGE_SHM_SUCCESS)
+    {
+        ++Count;
+    }
+
+    /* each record carries a length word, so one less than the ring size allows */
+    UtAssert_True(Count == 3, "Count (%lu) == 3", (unsigned long)Count);
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, SB_BRIDGE_RING_MAX_PACKET), SB_BRIDGE_SHM_RING_FULL);
+
+    /* a smaller packet still fits in the space left */
+    UT_FillPacket(Packet, 64);
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, 64), SB_BRIDGE_SHM_SUCCESS);
+
+    /* reading one record makes room for another */
+    UT_CheckNextPacket(SB_BRIDGE_RING_MAX_PACKET);
+    UT_FillPacket(Packet, SB_BRIDGE_RING_MAX_PACKET);
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, SB_BRIDGE_RING_MAX_PACKET), SB_BRIDGE_SHM_SUCCESS);
+
+    UT_CheckNextPacket(SB_BRIDGE_RING_MAX_PACKET);
+    UT_CheckNextPacket(SB_BRIDGE_RING_MAX_PACKET);
+    UT_CheckNextPacket(64);
+    UT_CheckNextPacket(SB_BRIDGE_RING_MAX_PACKET);
+    UtAssert_True(UT_Ring.Head == UT_Ring.Tail, "Ring is empty after reading all packets");
+}
+
+/*
+ * Check that a Peek of the corrupted ring empties it
+ */
+static void UT_CheckCorrupt(const char *Desc)
+{
+    uint32 Size = 1;
+    int32  Status;
+
+    Status = SB_BRIDGE_RingPeek(&UT_Ring, &Size);
+    UtAssert_True(Status == SB_BRIDGE_SHM_CORRUPT, "%s: status (%ld) == SB_BRIDGE_SHM_CORRUPT", Desc, (long)Status);
+    UtAssert_True(Size == 0, "%s: Size (%lu) == 0", Desc, (unsigned long)Size);
+    UtAssert_True(UT_Ring.Tail == UT_Ring.Head, "%s: Tail (%lu) == Head (%lu)", Desc, (unsigned long)UT_Ring.Tail,
+                  (unsigned long)UT_Ring.Head);
+}
+
+void Test_SB_BRIDGE_RingCorrupt(void)
+{
+    /*
+     * Test Case For:
+     * Indices and length words from a faulty peer
+     */
+    uint8  Packet[32];
+    uint32 Size;
+
+    memset(Packet, 0, sizeof(Packet));
+
+    /* length word larger than any packet */
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, sizeof(Packet)), SB_BRIDGE_SHM_SUCCESS);
+    *(uint32 *)&UT_Ring.Data[UT_Ring.Tail] = SB_BRIDGE_RING_MAX_PACKET + 1;
+    UT_CheckCorrupt("Oversized length");
+
+    /* zero length */
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, sizeof(Packet)), SB_BRIDGE_SHM_SUCCESS);
+    *(uint32 *)&UT_Ring.Data[UT_Ring.Tail] = 0;
+    UT_CheckCorrupt("Zero length");
+
+    /* length beyond what the producer has published */
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, sizeof(Packet)), SB_BRIDGE_SHM_SUCCESS);
+    *(uint32 *)&UT_Ring.Data[UT_Ring.Tail] = sizeof(Packet) + 4;
+    UT_CheckCorrupt("Length beyond head");
+
+    /* record running past the end of the data area */
+    UT_SetRingIndex(SB_BRIDGE_RING_SIZE - 8);
+    *(uint32 *)&UT_Ring.Data[SB_BRIDGE_RING_SIZE - 8] = 16;
+    UT_Ring.Head += 64;
+    UT_CheckCorrupt("Record past end of data");
+
+    /* pad marker skipping past the head */
+    UT_SetRingIndex(64);
+    *(uint32 *)&UT_Ring.Data[64] = 0xFFFFFFFF;
+    UT_Ring.Head += 16;
+    UT_CheckCorrupt("Pad past head");
+
+    /* head more than a ring ahead of the tail */
+    UT_SetRingIndex(128);
+    UT_Ring.Head += SB_BRIDGE_RING_SIZE + 4;
+    UT_CheckCorrupt("Head too far ahead");
+
+    /* head that is not on a record boundary */
+    UT_SetRingIndex(256);
+    UT_Ring.Head += 2;
+    UT_CheckCorrupt("Partial length word");
+
+    /* the ring is usable again after it was emptied */
+    UT_SetRingIndex(512);
+    UT_FillPacket(Packet, 24);
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, 24), SB_BRIDGE_SHM_SUCCESS);
+    UT_CheckNextPacket(24);
+
+    /* Discard of a corrupt record also empties the ring */
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, 24), SB_BRIDGE_SHM_SUCCESS);
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingWrite(&UT_Ring, Packet, 24), SB_BRIDGE_SHM_SUCCESS);
+    *(uint32 *)&UT_Ring.Data[UT_Ring.Tail & (SB_BRIDGE_RING_SIZE - 1)] = 0;
+    SB_BRIDGE_RingDiscard(&UT_Ring);
+    UtAssert_True(UT_Ring.Tail == UT_Ring.Head, "Discard of a corrupt record empties the ring");
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_RingPeek(&UT_Ring, &Size), SB_BRIDGE_SHM_RING_EMPTY);
+}
+
+void Test_SB_BRIDGE_ShmAttach(void)
+{
+    /*
+     * Test Case For:
+     * int32 SB_BRIDGE_ShmAttach(SB_BRIDGE_Shm_t *Shm, const char *Name)
+     * void SB_BRIDGE_ShmDetach(SB_BRIDGE_Shm_t *Shm)
+     * bool SB_BRIDGE_ShmPeerAttached(const SB_BRIDGE_Shm_t *Shm)
+     */
+    SB_BRIDGE_Shm_t First;
+    SB_BRIDGE_Shm_t Second;
+    SB_BRIDGE_Shm_t Third;
+    char            Name[32];
+    uint64          Token;
+
+    snprintf(Name, sizeof(Name), "/sb_bridge_ut_%lu", (unsigned long)getpid());
+    shm_unlink(Name);
+
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_ShmAttach(&First, Name), SB_BRIDGE_SHM_SUCCESS);
+    UtAssert_True(First.Side == 0, "First instance claims side 0");
+    UtAssert_True(!SB_BRIDGE_ShmPeerAttached(&First), "No peer before the second attach");
+
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_ShmAttach(&Second, Name), SB_BRIDGE_SHM_SUCCESS);
+    UtAssert_True(Second.Side == 1, "Second instance claims side 1");
+    UtAssert_True(SB_BRIDGE_ShmPeerAttached(&First), "Peer attached after the second attach");
+    UtAssert_True(First.Region->Owner[0] == First.OwnerToken, "Side 0 holds the owner token");
+
+    /* both sides are held by a live process */
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_ShmAttach(&Third, Name), SB_BRIDGE_SHM_BUSY);
+
+    /* a live process whose start time differs has reused the ID of the owner */
+    Token = First.Region->Owner[1];
+    First.Region->Owner[1] = Token + ((uint64)1 << 32);
+    UtAssert_True(!SB_BRIDGE_ShmPeerAttached(&First), "Peer with a reused process ID is not attached");
+    UT_TEST_FUNCTION_RC(SB_BRIDGE_ShmAttach(&Third, Name), SB_BRIDGE_SHM_SUCCESS);
+    UtAssert_True(Third.Side == 1, "Side with a reused process ID is reclaimed");
+    UtAssert_True(SB_BRIDGE_ShmPeerAttached(&First), "Peer attached after reclaim");
+
+    SB_BRIDGE_ShmDetach(&Third);
+    UtAssert_True(First.Region->Owner[1] == 0, "Side 1 released on detach");
+    UtAssert_True(!SB_BRIDGE_ShmPeerAttached(&First), "No peer after detach");
+
+    /* a side that is no longer held by the instance is left alone */
+    SB_BRIDGE_ShmDetach(&Second);
+    UtAssert_True(First.Region->Owner[1] == 0, "Side 1 still free after a second detach");
+
+    SB_BRIDGE_ShmDetach(&First);
+    UtAssert_True(First.Region == NULL && First.Side == SB_BRIDGE_NO_SIDE, "Handle cleared on detach");
+
+    shm_unlink(Name);
+}
+
+/*
+ * Setup function prior to every test
+ */
+void SB_BRIDGE_UT_Setup(void)
+{
+    UT_ResetState(0);
+    memset(&UT_Ring, 0, sizeof(UT_Ring));
+}
+
+/*
+ * Teardown function after every test
+ */
+void SB_BRIDGE_UT_TearDown(void)
+{
+
+}
+
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SB_BRIDGE_RingWriteRead);
+    ADD_TEST(SB_BRIDGE_RingWrap);
+    ADD_TEST(SB_BRIDGE_RingFull);
+    ADD_TEST(SB_BRIDGE_RingCorrupt);
+    ADD_TEST(SB_BRIDGE_ShmAttach);
+}
@@ -178,7 +178,9 @@
 **       The recommended case to to have this value the same across all mission platforms
 **
 **  \par Limits
-**       This parameter has a lower limit of 1 and an upper limit of 0xFFFF. Note
+**       This parameter has a lower limit of 1 and an upper limit of 0xFFFF, unless
+**       #CFE_PLATFORM_SB_HASHED_MSG_MAP is true in which case it may use the full
+**       range of the message ID type. Note
 **       for current implementations, V2/Extended headers assign 0xFFFFFFFF as the invalid
 **       message ID value, and default headers assigns 0xFFFF as the invalid value.  This
 **       means for default headers, 0xFFFF is invalid even if you set the value
@@ -188,6 +190,25 @@
 #define CFE_PLATFORM_SB_HIGHEST_VALID_MSGID      0x1FFF
 
 
+/**
+**  \cfesbcfg Use a Hashed Message Map
+**
+**  \par Description:
+**       Selects how SB maps message IDs to routing table entries.  When false,
+**       the message map is a dense lookup table with one entry per message ID
+**       up to #CFE_PLATFORM_SB_HIGHEST_VALID_MSGID.  When true, the message map
+**       is an open-addressed hash table keyed on the full message ID, whose size
+**       depends only on #CFE_PLATFORM_SB_MAX_MSG_IDS.  The hashed map allows
+**       #CFE_PLATFORM_SB_HIGHEST_VALID_MSGID to cover a wide (e.g. 32 bit)
+**       message ID space without a correspondingly large table.
+**
+**  \par Limits
+**       Must be true or false.  The dense table is slightly faster for small,
+**       compact message ID spaces.
+*/
+#define CFE_PLATFORM_SB_HASHED_MSG_MAP           false
+
+
 /**
 **  \cfesbcfg Default Routing Information Filename
 **
@@ -319,6 +340,23 @@
 */
 #define CFE_PLATFORM_SB_DEFAULT_REPORT_SENDER      1
 
+/**
+**  \cfesbcfg Define SB Information File Staging Buffer Size
+**
+**  \par Description:
+**       Size, in bytes, of the buffer used to stage entries of the SB routing,
+**       pipe and message map information files.  Entries are collected into
+**       this buffer while the SB shared data lock is held and written to the
+**       file after the lock is released, so a larger buffer means fewer lock
+**       acquisitions and fewer file writes per dump.  The buffer is taken from
+**       the SB memory pool only while a file is being written.
+**
+**  \par Limits
+**       This parameter must be a multiple of 4 and may not exceed
+**       #CFE_PLATFORM_SB_MAX_BLOCK_SIZE.
+*/
+#define CFE_PLATFORM_SB_FILE_DUMP_BUFFER_SIZE      16384
+
 
 /**
 **  \cfetimecfg Time Server or Time Client Selection
@@ -1170,6 +1208,77 @@
 */
 #define CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS             50
 
+/**
+**  \cfeescfg Define Async Job Queue Depth
+**
+**  \par Description:
+**       This parameter defines the number of jobs that can be queued for the
+**       Executive Services async job workers at one time, including the jobs
+**       that are currently running.  A submission beyond this is rejected.
+**
+**  \par Limits
+**       There is a lower limit of 1.  There are no restrictions on the upper limit
+**       however, the queue is statically allocated and each entry occupies
+**       #CFE_PLATFORM_ES_ASYNC_JOB_ARG_SIZE bytes plus some overhead.
+*/
+#define CFE_PLATFORM_ES_ASYNC_JOB_QUEUE_DEPTH              16
+
+/**
+**  \cfeescfg Define Async Job Argument Size
+**
+**  \par Description:
+**       This parameter defines the maximum size of the argument data that is
+**       copied into the queue along with each async job.  It must be large
+**       enough to hold a file name, as the core services use it to queue
+**       file dumps.
+**
+**  \par Limits
+**       This must be at least OS_MAX_PATH_LEN + 16, so a file name can be queued
+**       along with a small amount of other data, and a multiple of 4.
+*/
+#define CFE_PLATFORM_ES_ASYNC_JOB_ARG_SIZE                 128
+
+/**
+**  \cfeescfg Define Number of Async Job Worker Tasks
+**
+**  \par Description:
+**       This parameter defines the number of child tasks spawned by the
+**       Executive Services to run async jobs.  This is the number of jobs
+**       that can be in progress at the same time.
+**
+**  \par Limits
+**       There is a lower limit of 1 and an upper limit of 8.
+*/
+#define CFE_PLATFORM_ES_ASYNC_JOB_WORKERS                  2
+
+/**
+**  \cfeescfg Define Async Job Worker Task Priority
+**
+**  \par Description:
+**       This parameter defines the priority of the async job worker tasks.
+**       Lower numbers are higher priority, with 1 being the highest priority
+**       in the case of a child task.
+**
+**  \par Limits
+**       Valid range for a child task is 1 to 255 however, the priority cannot
+**       be higher (lower number) than the ES parent application priority.
+*/
+#define CFE_PLATFORM_ES_ASYNC_JOB_PRIORITY                 200
+
+/**
+**  \cfeescfg Define Async Job Worker Task Stack Size
+**
+**  \par Description:
+**       This parameter defines the stack size of the async job worker tasks.
+**       The jobs run on this stack, so it must be large enough for the
+**       deepest job that is queued.
+**
+**  \par Limits
+**       There is a lower limit of 2048.  This parameter is limited by the
+**       maximum value allowed by the data type.
+*/
+#define CFE_PLATFORM_ES_ASYNC_JOB_STACK_SIZE               8192
+
 /**
 **  \cfeescfg Define Default Stack Size for an Application
 **
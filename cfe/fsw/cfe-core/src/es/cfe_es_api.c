@@ -181,19 +181,19 @@ int32 CFE_ES_RestartApp(uint32 AppID)
        */
        if ( CFE_ES_Global.AppTable[AppID].Type == CFE_ES_AppType_CORE )
        {
-          CFE_ES_SysLogWrite_Unsync ("CFE_ES_RestartApp: Cannot Restart a CORE Application: %s.\n",
-                             CFE_ES_Global.AppTable[AppID].StartParams.Name );
+          CFE_ES_SysLogWrite ("CFE_ES_RestartApp: Cannot Restart a CORE Application: %s.\n",
+                              CFE_ES_Global.AppTable[AppID].StartParams.Name );
           ReturnCode = CFE_ES_ERR_APPID;
        }
        else if ( CFE_ES_Global.AppTable[AppID].AppState != CFE_ES_AppState_RUNNING )
        {
-          CFE_ES_SysLogWrite_Unsync ("CFE_ES_RestartApp: Cannot Restart Application %s, It is not running.\n",
+          CFE_ES_SysLogWrite ("CFE_ES_RestartApp: Cannot Restart Application %s, It is not running.\n",
                               CFE_ES_Global.AppTable[AppID].StartParams.Name);
           ReturnCode = CFE_ES_ERR_APPID;
        }
        else
        {
-          CFE_ES_SysLogWrite_Unsync("CFE_ES_RestartApp: Restart Application %s Initiated\n",
+          CFE_ES_SysLogWrite("CFE_ES_RestartApp: Restart Application %s Initiated\n",
                              CFE_ES_Global.AppTable[AppID].StartParams.Name);
           CFE_ES_Global.AppTable[AppID].ControlReq.AppControlRequest = CFE_ES_RunStatus_SYS_RESTART;
        }
@@ -228,14 +228,14 @@ int32 CFE_ES_ReloadApp(uint32 AppID, const char *AppFileName)
     */
     if ( CFE_ES_Global.AppTable[AppID].Type == CFE_ES_AppType_CORE )
     {
-       CFE_ES_SysLogWrite_Unsync ("CFE_ES_DeleteApp: Cannot Reload a CORE Application: %s.\n",
-       CFE_ES_Global.AppTable[AppID].StartParams.Name );
+       CFE_ES_SysLogWrite ("CFE_ES_DeleteApp: Cannot Reload a CORE Application: %s.\n",
+                           CFE_ES_Global.AppTable[AppID].StartParams.Name );
        ReturnCode = CFE_ES_ERR_APPID;
     }
     else if ( CFE_ES_Global.AppTable[AppID].AppState != CFE_ES_AppState_RUNNING )
     {
-       CFE_ES_SysLogWrite_Unsync ("CFE_ES_ReloadApp: Cannot Reload Application %s, It is not running.\n",
-                              CFE_ES_Global.AppTable[AppID].StartParams.Name);
+       CFE_ES_SysLogWrite ("CFE_ES_ReloadApp: Cannot Reload Application %s, It is not running.\n",
+                           CFE_ES_Global.AppTable[AppID].StartParams.Name);
        ReturnCode = CFE_ES_ERR_APPID;
     }
     else
@@ -245,16 +245,16 @@ int32 CFE_ES_ReloadApp(uint32 AppID, const char *AppFileName)
        */
        if (OS_stat(AppFileName, &FileStatus) == OS_SUCCESS)
        {
-           CFE_ES_SysLogWrite_Unsync("CFE_ES_ReloadApp: Reload Application %s Initiated. New filename = %s\n",
-                                CFE_ES_Global.AppTable[AppID].StartParams.Name, AppFileName);
+           CFE_ES_SysLogWrite("CFE_ES_ReloadApp: Reload Application %s Initiated. New filename = %s\n",
+                              CFE_ES_Global.AppTable[AppID].StartParams.Name, AppFileName);
            strncpy((char *)CFE_ES_Global.AppTable[AppID].StartParams.FileName, AppFileName, OS_MAX_PATH_LEN);
            CFE_ES_Global.AppTable[AppID].ControlReq.AppControlRequest = CFE_ES_RunStatus_SYS_RELOAD;
        }
        else
        {
-           CFE_ES_SysLogWrite_Unsync ("CFE_ES_ReloadApp: Cannot Reload Application %s, File %s does not exist.\n",
-                                  CFE_ES_Global.AppTable[AppID].StartParams.Name,
-                                  AppFileName);
+           CFE_ES_SysLogWrite ("CFE_ES_ReloadApp: Cannot Reload Application %s, File %s does not exist.\n",
+                               CFE_ES_Global.AppTable[AppID].StartParams.Name,
+                               AppFileName);
            ReturnCode = CFE_ES_FILE_IO_ERR;
        }
     }
@@ -279,20 +279,20 @@ int32 CFE_ES_DeleteApp(uint32 AppID)
     */
     if ( CFE_ES_Global.AppTable[AppID].Type == CFE_ES_AppType_CORE )
     {
-       CFE_ES_SysLogWrite_Unsync ("CFE_ES_DeleteApp: Cannot Delete a CORE Application: %s.\n",
-       CFE_ES_Global.AppTable[AppID].StartParams.Name );
+       CFE_ES_SysLogWrite ("CFE_ES_DeleteApp: Cannot Delete a CORE Application: %s.\n",
+                           CFE_ES_Global.AppTable[AppID].StartParams.Name );
        ReturnCode = CFE_ES_ERR_APPID;
     }
     else if ( CFE_ES_Global.AppTable[AppID].AppState != CFE_ES_AppState_RUNNING )
     {
-       CFE_ES_SysLogWrite_Unsync ("CFE_ES_DeleteApp: Cannot Delete Application %s, It is not running.\n",
-                              CFE_ES_Global.AppTable[AppID].StartParams.Name);
+       CFE_ES_SysLogWrite ("CFE_ES_DeleteApp: Cannot Delete Application %s, It is not running.\n",
+                           CFE_ES_Global.AppTable[AppID].StartParams.Name);
        ReturnCode = CFE_ES_ERR_APPID;
     }
     else
     {
-       CFE_ES_SysLogWrite_Unsync("CFE_ES_DeleteApp: Delete Application %s Initiated\n",
-                             CFE_ES_Global.AppTable[AppID].StartParams.Name);
+       CFE_ES_SysLogWrite("CFE_ES_DeleteApp: Delete Application %s Initiated\n",
+                          CFE_ES_Global.AppTable[AppID].StartParams.Name);
        CFE_ES_Global.AppTable[AppID].ControlReq.AppControlRequest = CFE_ES_RunStatus_SYS_DELETE;
     }
 
@@ -320,8 +320,8 @@ void CFE_ES_ExitApp(uint32 ExitStatus)
     if (ExitStatus == CFE_ES_RunStatus_UNDEFINED || 
             ExitStatus >= CFE_ES_RunStatus_MAX)
     {
-        CFE_ES_SysLogWrite_Unsync ("CFE_ES_ExitApp: Called with invalid status (%u).\n",
-                (unsigned int)ExitStatus);
+        CFE_ES_SysLogWrite ("CFE_ES_ExitApp: Called with invalid status (%u).\n",
+                            (unsigned int)ExitStatus);
 
         /* revert to the ERROR status */
         ExitStatus = CFE_ES_RunStatus_APP_ERROR;
@@ -355,8 +355,8 @@ void CFE_ES_ExitApp(uint32 ExitStatus)
           */
           if ( ExitStatus == CFE_ES_RunStatus_CORE_APP_INIT_ERROR )
           {
-              CFE_ES_SysLogWrite_Unsync ("CFE_ES_ExitApp: CORE Application %s Had an Init Error.\n",
-                                     CFE_ES_Global.AppTable[AppID].StartParams.Name );
+              CFE_ES_SysLogWrite ("CFE_ES_ExitApp: CORE Application %s Had an Init Error.\n",
+                                  CFE_ES_Global.AppTable[AppID].StartParams.Name );
 
               /*
               ** Unlock the ES Shared data before calling ResetCFE
@@ -382,8 +382,8 @@ void CFE_ES_ExitApp(uint32 ExitStatus)
           }
           else if ( ExitStatus == CFE_ES_RunStatus_CORE_APP_RUNTIME_ERROR )
           {
-              CFE_ES_SysLogWrite_Unsync ("CFE_ES_ExitApp: CORE Application %s Had a Runtime Error.\n",
-                                     CFE_ES_Global.AppTable[AppID].StartParams.Name );
+              CFE_ES_SysLogWrite ("CFE_ES_ExitApp: CORE Application %s Had a Runtime Error.\n",
+                                  CFE_ES_Global.AppTable[AppID].StartParams.Name );
 
               /*
               ** Unlock the ES Shared data before killing the main task
@@ -402,18 +402,18 @@ void CFE_ES_ExitApp(uint32 ExitStatus)
           }
           else
           {
-              CFE_ES_SysLogWrite_Unsync ("CFE_ES_ExitApp, Cannot Exit CORE Application %s\n",
-                                    CFE_ES_Global.AppTable[AppID].StartParams.Name );
+              CFE_ES_SysLogWrite ("CFE_ES_ExitApp, Cannot Exit CORE Application %s\n",
+                                  CFE_ES_Global.AppTable[AppID].StartParams.Name );
           }
 
        }
        else /* It is an external App */
        {
 
-          CFE_ES_SysLogWrite_Unsync ("Application %s called CFE_ES_ExitApp\n",
-                                 CFE_ES_Global.AppTable[AppID].StartParams.Name);
+          CFE_ES_SysLogWrite ("Application %s called CFE_ES_ExitApp\n",
+                              CFE_ES_Global.AppTable[AppID].StartParams.Name);
 
-          CFE_ES_Global.AppTable[AppID].AppState = CFE_ES_AppState_STOPPED;
+          CFE_ES_RaiseAppState_Unsync(&CFE_ES_Global.AppTable[AppID], CFE_ES_AppState_STOPPED);
 
           /*
           ** Unlock the ES Shared data before suspending the app
@@ -488,10 +488,13 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
         /*
          ** App state must be RUNNING (no-op if already set to running)
          */
-        if (AppRecPtr->AppState < CFE_ES_AppState_RUNNING)
-        {
-            AppRecPtr->AppState = CFE_ES_AppState_RUNNING;
-        }
+        CFE_ES_RaiseAppState_Unsync(AppRecPtr, CFE_ES_AppState_RUNNING);
+
+        /*
+         * Between loop iterations the app holds no table addresses,
+         * so any epoch table buffers it was reading can be reclaimed.
+         */
+        CFE_TBL_QuiescentPoint(AppID);
 
         /*
          * Check if the control request is also set to "RUN"
@@ -518,7 +521,7 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
         /*
          * Cannot do anything without the AppID
          */
-        CFE_ES_SysLogWrite_Unsync("CFE_ES_RunLoop Error: Cannot get AppID for the caller: RC = %08X\n",(unsigned int)Status);
+        CFE_ES_SysLogWrite("CFE_ES_RunLoop Error: Cannot get AppID for the caller: RC = %08X\n",(unsigned int)Status);
         ReturnCode = false;
 
     } /* end if Status == CFE_SUCCESS */
@@ -585,10 +588,7 @@ int32 CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMillisecond
          * apps to add an explicit state change call, but it makes sense because if this was not done an app could
          * be waiting for itself (which will always time out).
          */
-        if (CFE_ES_Global.AppTable[AppID].AppState < RequiredAppState)
-        {
-            CFE_ES_Global.AppTable[AppID].AppState = RequiredAppState;
-        }
+        CFE_ES_RaiseAppState_Unsync(&CFE_ES_Global.AppTable[AppID], RequiredAppState);
 
     }
     CFE_ES_UnlockSharedData(__func__,__LINE__);
@@ -597,13 +597,13 @@ int32 CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMillisecond
      * Do the actual delay loop.
      *
      * This is only dependent on the main (startup) task updating the global variable
-     * to be at least the state requested.
+     * to be at least the state requested.  The main task signals the startup sync
+     * semaphore on every system state change, so the wait ends as soon as that happens;
+     * the poll interval is only an upper bound on each wait.
      */
     WaitRemaining = TimeOutMilliseconds;
     while (CFE_ES_Global.SystemState < MinSystemState)
     {
-        /* TBD: Very Crude timing here, but not sure if it matters,
-         * as this is only done during startup, not real work */
         if (WaitRemaining > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
         {
             WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
@@ -618,8 +618,7 @@ int32 CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMillisecond
             break;
         }
 
-        OS_TaskDelay(WaitTime);
-        WaitRemaining -= WaitTime;
+        WaitRemaining -= CFE_ES_StartupSyncWait(WaitTime);
     }
 
     return Status;
@@ -679,25 +678,20 @@ int32 CFE_ES_RegisterApp(void)
 int32 CFE_ES_GetAppIDByName(uint32 *AppIdPtr, const char *AppName)
 {
    int32 Result = CFE_ES_ERR_APPNAME;
-   uint32 i;
+   int32 i;
 
    CFE_ES_LockSharedData(__func__,__LINE__);
 
    /*
-   ** Search the ES Application table for an app with a matching name.
+   ** Look up the app name in the ES Application table name index.
    */
-   for ( i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; i++ )
+   i = CFE_ES_NameIndexFind(&CFE_ES_AppNameIndex, AppName);
+   if ( i != CFE_ES_NAMEINDEX_NOT_FOUND &&
+        CFE_ES_Global.AppTable[i].AppState != CFE_ES_AppState_UNDEFINED )
    {
-      if ( CFE_ES_Global.AppTable[i].AppState != CFE_ES_AppState_UNDEFINED )
-      {
-         if ( strncmp(AppName, (char *)CFE_ES_Global.AppTable[i].StartParams.Name, OS_MAX_API_NAME) == 0 )
-         {
-            *AppIdPtr = i;
-            Result = CFE_SUCCESS;
-            break;
-         }
-      }
-   } /* end for */
+      *AppIdPtr = i;
+      Result = CFE_SUCCESS;
+   }
 
    CFE_ES_UnlockSharedData(__func__,__LINE__);
 
@@ -712,6 +706,28 @@ int32 CFE_ES_GetAppIDByName(uint32 *AppIdPtr, const char *AppName)
 int32 CFE_ES_GetAppID(uint32 *AppIdPtr)
 {
    int32  Result;
+   uint32 TaskId;
+   uint32 TaskIndex;
+
+   /*
+   ** Fast path without the shared data lock.
+   **
+   ** The task table record of the calling task is filled in (under the lock)
+   ** before the task registers itself with CFE_ES_RegisterApp() or
+   ** CFE_ES_RegisterChildTask(), both of which take the lock, and it is only
+   ** cleared when the task is deleted.  So if the record is in use and still
+   ** names this exact task (the OSAL ID includes a serial number, so a slot
+   ** reused by an earlier task will not match) the AppId in it is stable.
+   ** Anything else falls through to the locked lookup below.
+   */
+   TaskId = OS_TaskGetId();
+   if (OS_ConvertToArrayIndex(TaskId, &TaskIndex) == OS_SUCCESS &&
+       CFE_ES_Global.TaskTable[TaskIndex].RecordUsed == true &&
+       CFE_ES_Global.TaskTable[TaskIndex].TaskId == TaskId)
+   {
+      *AppIdPtr = CFE_ES_Global.TaskTable[TaskIndex].AppId;
+      return(CFE_SUCCESS);
+   }
 
    CFE_ES_LockSharedData(__func__,__LINE__);
 
@@ -819,7 +835,7 @@ int32 CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, uint32 OSTaskId)
 
    if (OS_ConvertToArrayIndex(OSTaskId, &TaskId) != OS_SUCCESS || TaskId >= OS_MAX_TASKS)
    {
-      CFE_ES_SysLogWrite_Unsync("CFE_ES_GetTaskInfo: Task ID Not Valid: %u\n",(unsigned int)OSTaskId);
+      CFE_ES_SysLogWrite("CFE_ES_GetTaskInfo: Task ID Not Valid: %u\n",(unsigned int)OSTaskId);
       ReturnCode = CFE_ES_ERR_TASKID;
    }
    else if (  CFE_ES_Global.TaskTable[TaskId].RecordUsed == true )
@@ -859,14 +875,14 @@ int32 CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, uint32 OSTaskId)
       }
       else
       {
-         CFE_ES_SysLogWrite_Unsync("CFE_ES_GetTaskInfo: Task ID:%u Parent App ID:%d not Active.\n",
-                 (unsigned int)OSTaskId,(int)TaskInfo->AppId);
+         CFE_ES_SysLogWrite("CFE_ES_GetTaskInfo: Task ID:%u Parent App ID:%d not Active.\n",
+                            (unsigned int)OSTaskId,(int)TaskInfo->AppId);
          ReturnCode = CFE_ES_ERR_TASKID;
       }
    }
    else
    {
-      CFE_ES_SysLogWrite_Unsync("CFE_ES_GetTaskInfo: Task ID Not Active: %u\n",(unsigned int)OSTaskId);
+      CFE_ES_SysLogWrite("CFE_ES_GetTaskInfo: Task ID Not Active: %u\n",(unsigned int)OSTaskId);
       ReturnCode = CFE_ES_ERR_TASKID;
    }
 
@@ -932,7 +948,7 @@ int32 CFE_ES_CreateChildTask(uint32 *TaskIdPtr,
       Result = CFE_ES_GetAppIDInternal(&AppId);
       if (Result != CFE_SUCCESS)
       {
-          CFE_ES_SysLogWrite_Unsync("CFE_ES_CreateChildTask: Error calling CFE_ES_GetAppID for Task '%s'. RC = 0x%08X\n",TaskName,(unsigned int)Result);
+          CFE_ES_SysLogWrite("CFE_ES_CreateChildTask: Error calling CFE_ES_GetAppID for Task '%s'. RC = 0x%08X\n",TaskName,(unsigned int)Result);
           ReturnCode = Result;
       }
       else  /* else AppId is valid */
@@ -973,17 +989,30 @@ int32 CFE_ES_CreateChildTask(uint32 *TaskIdPtr,
                CFE_ES_Global.TaskTable[TaskId].TaskName[OS_MAX_API_NAME - 1] = '\0';
                CFE_ES_Global.RegisteredTasks++;
 
+               /*
+               ** Child tasks inherit the CPU affinity of their app
+               */
+               if ( CFE_ES_Global.AppTable[AppId].StartParams.CpuAffinityMask != 0 )
+               {
+                  Result = OS_TaskSetAffinity(*TaskIdPtr, CFE_ES_Global.AppTable[AppId].StartParams.CpuAffinityMask);
+                  if ( Result != OS_SUCCESS )
+                  {
+                     CFE_ES_SysLogWrite("CFE_ES_CreateChildTask: Could not set CPU affinity for Task '%s' RC = 0x%08X\n",
+                                        TaskName,(unsigned int)Result);
+                  }
+               }
+
                ReturnCode = CFE_SUCCESS;
             }
             else
             {
-               CFE_ES_SysLogWrite_Unsync("CFE_ES_CreateChildTask: Error calling OS_TaskCreate for Task '%s' RC = 0x%08X\n",TaskName,(unsigned int)Result);
+               CFE_ES_SysLogWrite("CFE_ES_CreateChildTask: Error calling OS_TaskCreate for Task '%s' RC = 0x%08X\n",TaskName,(unsigned int)Result);
                ReturnCode = CFE_ES_ERR_CHILD_TASK_CREATE;
             }
          }
          else
          {
-            CFE_ES_SysLogWrite_Unsync("CFE_ES_CreateChildTask: Error: Cannot call from a Child Task (for Task '%s').\n",TaskName);
+            CFE_ES_SysLogWrite("CFE_ES_CreateChildTask: Error: Cannot call from a Child Task (for Task '%s').\n",TaskName);
             ReturnCode = CFE_ES_ERR_CHILD_TASK_CREATE;
 
          } /* end if Calling task is a main task */
@@ -1115,13 +1144,13 @@ int32 CFE_ES_DeleteChildTask(uint32 OSTaskId)
                 /*
                 ** Report the task delete
                 */
-                CFE_ES_SysLogWrite_Unsync("CFE_ES_DeleteChildTask Task %u Deleted\n",(unsigned int)OSTaskId );
+                CFE_ES_SysLogWrite("CFE_ES_DeleteChildTask Task %u Deleted\n",(unsigned int)OSTaskId );
                 ReturnCode = CFE_SUCCESS;
              }
              else
              {
-                CFE_ES_SysLogWrite_Unsync("CFE_ES_DeleteChildTask Error: Error Calling OS_TaskDelete: Task %u, RC = 0x%08X\n",
-                        (unsigned int)OSTaskId, (unsigned int)OSReturnCode);
+                CFE_ES_SysLogWrite("CFE_ES_DeleteChildTask Error: Error Calling OS_TaskDelete: Task %u, RC = 0x%08X\n",
+                                   (unsigned int)OSTaskId, (unsigned int)OSReturnCode);
                 ReturnCode = CFE_ES_ERR_CHILD_TASK_DELETE;
              }
           }
@@ -1130,7 +1159,7 @@ int32 CFE_ES_DeleteChildTask(uint32 OSTaskId)
              /*
              ** Error: The task is a cFE Application Main task
              */
-             CFE_ES_SysLogWrite_Unsync("CFE_ES_DeleteChildTask Error: Task %u is a cFE Main Task.\n",(unsigned int)OSTaskId );
+             CFE_ES_SysLogWrite("CFE_ES_DeleteChildTask Error: Task %u is a cFE Main Task.\n",(unsigned int)OSTaskId );
              ReturnCode = CFE_ES_ERR_CHILD_TASK_DELETE_MAIN_TASK;
           } /* end if TaskMain == false */
        }
@@ -1139,7 +1168,7 @@ int32 CFE_ES_DeleteChildTask(uint32 OSTaskId)
           /*
           ** Task ID is not in use, so it is invalid
           */
-          CFE_ES_SysLogWrite_Unsync("CFE_ES_DeleteChildTask Error: Task ID is not active: %u\n",(unsigned int)OSTaskId );
+          CFE_ES_SysLogWrite("CFE_ES_DeleteChildTask Error: Task ID is not active: %u\n",(unsigned int)OSTaskId );
           ReturnCode = CFE_ES_ERR_TASKID;
 
        } /* end if */
@@ -1212,13 +1241,13 @@ void CFE_ES_ExitChildTask(void)
       }
       else
       {
-         CFE_ES_SysLogWrite_Unsync("CFE_ES_ExitChildTask Error: Cannot Call from a cFE App Main Task. ID = %d\n",(int)TaskId );
+         CFE_ES_SysLogWrite("CFE_ES_ExitChildTask Error: Cannot Call from a cFE App Main Task. ID = %d\n",(int)TaskId );
       }
    }
    else
    {
-      CFE_ES_SysLogWrite_Unsync("CFE_ES_ExitChildTask Error Calling CFE_ES_GetAppID. Task ID = %d, RC = 0x%08X\n",
-              (int)TaskId, (unsigned int)ReturnCode );
+      CFE_ES_SysLogWrite("CFE_ES_ExitChildTask Error Calling CFE_ES_GetAppID. Task ID = %d, RC = 0x%08X\n",
+                         (int)TaskId, (unsigned int)ReturnCode );
    } /* end if GetAppId */
 
    CFE_ES_UnlockSharedData(__func__,__LINE__);
@@ -1241,11 +1270,12 @@ int32 CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...)
 
     /*
      * Append to the syslog buffer, which must be done while locked.
-     * Only one thread can actively write into the buffer at time.
+     * Only one thread can actively write into the buffer at time, but
+     * this uses the syslog lock rather than the ES shared data lock.
      */
-    CFE_ES_LockSharedData(__func__, __LINE__);
+    CFE_ES_LockSysLog();
     ReturnCode = CFE_ES_SysLogAppend_Unsync(TmpString);
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+    CFE_ES_UnlockSysLog();
 
     /* Output the entry to the console */
     OS_printf("%s",TmpString);
@@ -1339,6 +1369,138 @@ uint32 CFE_ES_CalculateCRC(const void *DataPtr, uint32 DataLength, uint32 InputC
 } /* End of CFE_ES_CalculateCRC() */
 
 
+/*
+** Function: CFE_ES_ApplyCRCOperator
+**
+** Purpose:  Apply a linear operator, given as the image of each CRC bit,
+**           to a CRC-16 value.
+**
+*/
+static uint16 CFE_ES_ApplyCRCOperator(const uint16 *Operator, uint16 Crc)
+{
+    uint16 Result = 0;
+    uint32 i = 0;
+
+    while (Crc != 0)
+    {
+        if (Crc & 1)
+        {
+            Result ^= Operator[i];
+        }
+        Crc >>= 1;
+        ++i;
+    }
+
+    return Result;
+
+} /* End of CFE_ES_ApplyCRCOperator() */
+
+
+/*
+** Function: CFE_ES_CombineCRC
+**
+** Purpose:  Fold the CRC of the XOR of the old and new contents of a range
+**           into the CRC of the whole block.
+**
+*/
+uint32 CFE_ES_CombineCRC(uint32 BlockCRC, uint32 DeltaCRC, uint32 TrailingLength, uint32 TypeCRC)
+{
+    uint16 Operator[16];
+    uint16 Squared[16];
+    uint16 Crc;
+    uint8  Zero = 0;
+    uint32 i;
+    int16  Result = 0;
+
+    switch(TypeCRC)
+    {
+      case CFE_MISSION_ES_CRC_16:
+           /*
+           ** The CRC is linear in the data, so the new block CRC is the old one
+           ** XOR the CRC of (old XOR new).  That CRC is DeltaCRC carried across
+           ** the unchanged bytes after the range, which is done by squaring the
+           ** operator that carries a CRC across a single zero byte.
+           */
+           for (i = 0; i < 16; i++)
+           {
+               Operator[i] = 0xFFFF & CFE_ES_CalculateCRC(&Zero, 1, 1U << i, TypeCRC);
+           }
+
+           Crc = 0xFFFF & DeltaCRC;
+           while (TrailingLength != 0)
+           {
+               if (TrailingLength & 1)
+               {
+                   Crc = CFE_ES_ApplyCRCOperator(Operator, Crc);
+               }
+
+               TrailingLength >>= 1;
+               if (TrailingLength != 0)
+               {
+                   for (i = 0; i < 16; i++)
+                   {
+                       Squared[i] = CFE_ES_ApplyCRCOperator(Operator, Operator[i]);
+                   }
+                   memcpy(Operator, Squared, sizeof(Operator));
+               }
+           }
+
+           Result = (int16)(0xFFFF & (BlockCRC ^ Crc));
+           break;
+
+      default:
+           break;
+    }
+
+    return(Result);
+
+} /* End of CFE_ES_CombineCRC() */
+
+
+/*
+** Function: CFE_ES_RecalculateCRC - See API and header file for details
+*/
+uint32 CFE_ES_RecalculateCRC(const void *OldDataPtr, const void *NewDataPtr, uint32 DataLength,
+                             uint32 TrailingLength, uint32 InputCRC, uint32 TypeCRC)
+{
+    const uint8 *OldPtr = (const uint8 *)OldDataPtr;
+    const uint8 *NewPtr = (const uint8 *)NewDataPtr;
+    uint8   Delta[64];
+    uint32  ChunkSize;
+    uint32  DeltaCRC = 0;
+    uint32  i;
+
+    if (TypeCRC != CFE_MISSION_ES_CRC_16)
+    {
+        /* Report the unimplemented algorithm the same way a full calculation does */
+        return CFE_ES_CalculateCRC(NewDataPtr, 0, InputCRC, TypeCRC);
+    }
+
+    while (DataLength > 0)
+    {
+        ChunkSize = DataLength;
+        if (ChunkSize > sizeof(Delta))
+        {
+            ChunkSize = sizeof(Delta);
+        }
+
+        for (i = 0; i < ChunkSize; i++)
+        {
+            Delta[i] = OldPtr[i] ^ NewPtr[i];
+        }
+
+        DeltaCRC = CFE_ES_CalculateCRC(Delta, ChunkSize, DeltaCRC, TypeCRC);
+
+        OldPtr += ChunkSize;
+        NewPtr += ChunkSize;
+        DataLength -= ChunkSize;
+    }
+
+    return CFE_ES_CombineCRC(InputCRC, DeltaCRC, TrailingLength, TypeCRC);
+
+} /* End of CFE_ES_RecalculateCRC() */
+
+
 /*
 ** Function: CFE_ES_RegisterCDS
 **
@@ -1434,6 +1596,21 @@ int32 CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, void *DataToCopy)
     return Status;
 } /* End of CFE_ES_CopyToCDS() */
 
+/*
+** Function: CFE_ES_CopyToCDSRange
+**
+** Purpose:  Copies a range of a data block to a Critical Data Store.
+**
+*/
+int32 CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, uint32 Offset, uint32 NumBytes)
+{
+    int32 Status;
+
+    Status = CFE_ES_CDSBlockWriteRange(CFE_ES_Global.CDSVars.Registry[Handle].MemHandle, DataToCopy, Offset, NumBytes);
+
+    return Status;
+} /* End of CFE_ES_CopyToCDSRange() */
+
 /*
 ** Function: CFE_ES_RestoreFromCDS
 **
@@ -1459,7 +1636,9 @@ int32 CFE_ES_RegisterGenCounter(uint32 *CounterIdPtr, const char *CounterName)
    int32 Status;
    uint32 i;
 
-   Status = CFE_ES_GetGenCounterIDByName(&CheckPtr, CounterName);
+   CFE_ES_LockSharedData(__func__,__LINE__);
+
+   Status = CFE_ES_GetGenCounterIDByName_Unsync(&CheckPtr, CounterName);
 
    if ((CounterIdPtr != NULL) && (CounterName != NULL) && (Status != CFE_SUCCESS))
    {
@@ -1468,6 +1647,7 @@ int32 CFE_ES_RegisterGenCounter(uint32 *CounterIdPtr, const char *CounterName)
          if ( CFE_ES_Global.CounterTable[i].RecordUsed == false )
          {
             strncpy((char *)CFE_ES_Global.CounterTable[i].CounterName,CounterName,OS_MAX_API_NAME);
+            CFE_ES_NameIndexAdd(&CFE_ES_CounterNameIndex, i);
 
             CFE_ES_Global.CounterTable[i].RecordUsed = true;
             CFE_ES_Global.CounterTable[i].Counter = 0;
@@ -1481,6 +1661,8 @@ int32 CFE_ES_RegisterGenCounter(uint32 *CounterIdPtr, const char *CounterName)
       }
    }
 
+   CFE_ES_UnlockSharedData(__func__,__LINE__);
+
    return ReturnCode;
 
 }
@@ -1498,8 +1680,11 @@ int32 CFE_ES_DeleteGenCounter(uint32 CounterId)
 
    if(CounterId < CFE_PLATFORM_ES_MAX_GEN_COUNTERS)
    {
+      CFE_ES_LockSharedData(__func__,__LINE__);
+      CFE_ES_NameIndexRemove(&CFE_ES_CounterNameIndex, CounterId);
       CFE_ES_Global.CounterTable[CounterId].RecordUsed = false;
       CFE_ES_Global.CounterTable[CounterId].Counter = 0;
+      CFE_ES_UnlockSharedData(__func__,__LINE__);
       Status = CFE_SUCCESS;
    }
 
@@ -1568,28 +1753,11 @@ int32 CFE_ES_GetGenCount(uint32 CounterId, uint32 *Count)
 
 int32 CFE_ES_GetGenCounterIDByName(uint32 *CounterIdPtr, const char *CounterName)
 {
+   int32 Result;
 
-   int32 Result = CFE_ES_BAD_ARGUMENT;
-   uint32   i;
-
-   /*
-   ** Search the ES Generic Counter table for a counter with a matching name.
-   */
-   for ( i = 0; i < CFE_PLATFORM_ES_MAX_GEN_COUNTERS; i++ )
-   {
-      if ( CFE_ES_Global.CounterTable[i].RecordUsed == true )
-      {
-         if ( strncmp(CounterName, (char *)CFE_ES_Global.CounterTable[i].CounterName, OS_MAX_API_NAME) == 0 )
-         {
-            if(CounterIdPtr != NULL)
-            {
-               *CounterIdPtr = i;
-               Result = CFE_SUCCESS;
-            }
-            break;
-         }
-      }
-   } /* end for */
+   CFE_ES_LockSharedData(__func__,__LINE__);
+   Result = CFE_ES_GetGenCounterIDByName_Unsync(CounterIdPtr, CounterName);
+   CFE_ES_UnlockSharedData(__func__,__LINE__);
 
    return(Result);
 
@@ -1600,6 +1768,39 @@ int32 CFE_ES_GetGenCounterIDByName(uint32 *CounterIdPtr, const char *CounterName
 ** Private API functions
 */
 
+/*
+** Function: CFE_ES_GetGenCounterIDByName_Unsync
+**
+** Purpose:  Look up a Generic Counter by name.  The caller must hold the
+**           ES Shared Data lock.
+**
+*/
+int32 CFE_ES_GetGenCounterIDByName_Unsync(uint32 *CounterIdPtr, const char *CounterName)
+{
+   int32 Result = CFE_ES_BAD_ARGUMENT;
+   int32 i;
+
+   if (CounterName == NULL)
+   {
+      return(Result);
+   }
+
+   /*
+   ** Look up the counter name in the ES Generic Counter table name index.
+   */
+   i = CFE_ES_NameIndexFind(&CFE_ES_CounterNameIndex, CounterName);
+   if ( i != CFE_ES_NAMEINDEX_NOT_FOUND &&
+        CFE_ES_Global.CounterTable[i].RecordUsed == true &&
+        CounterIdPtr != NULL )
+   {
+      *CounterIdPtr = i;
+      Result = CFE_SUCCESS;
+   }
+
+   return(Result);
+
+} /* End of CFE_ES_GetGenCounterIDByName_Unsync() */
+
 /*
 ** Function: CFE_ES_GetAppIDInternal
 **
@@ -1639,6 +1840,40 @@ int32 CFE_ES_GetAppIDInternal(uint32 *AppIdPtr)
 
 } /* End of CFE_ES_GetAppIDInternal() */
 
+/*
+** Function: CFE_ES_GetMainTaskAppID
+**
+** Purpose:  Return the Caller's cFE Application ID, only if the caller is the
+**           main task of that Application.  Uses the same lock free lookup as
+**           the fast path of CFE_ES_GetAppID(), see there for why it is safe.
+**
+*/
+int32 CFE_ES_GetMainTaskAppID(uint32 *AppIdPtr)
+{
+   uint32 TaskId;
+   uint32 TaskIndex;
+   uint32 AppId;
+
+   TaskId = OS_TaskGetId();
+   if (OS_ConvertToArrayIndex(TaskId, &TaskIndex) != OS_SUCCESS ||
+       CFE_ES_Global.TaskTable[TaskIndex].RecordUsed != true ||
+       CFE_ES_Global.TaskTable[TaskIndex].TaskId != TaskId)
+   {
+      return(CFE_ES_ERR_APPID);
+   }
+
+   AppId = CFE_ES_Global.TaskTable[TaskIndex].AppId;
+   if (AppId >= CFE_PLATFORM_ES_MAX_APPLICATIONS ||
+       CFE_ES_Global.AppTable[AppId].TaskInfo.MainTaskId != TaskId)
+   {
+      return(CFE_ES_ERR_APPID);
+   }
+
+   *AppIdPtr = AppId;
+   return(CFE_SUCCESS);
+
+} /* End of CFE_ES_GetMainTaskAppID() */
+
 
 /******************************************************************************
 **  Function:  CFE_ES_LockSharedData()
@@ -1669,8 +1904,8 @@ void CFE_ES_LockSharedData(const char *FunctionName, int32 LineNumber)
          * NOTE: this is going to write into a buffer that itself
          * is _supposed_ to be protected by this same mutex.
          */
-        CFE_ES_SysLogWrite_Unsync("ES SharedData Mutex Take Err Stat=0x%x,App=%d,Func=%s,Line=%d\n",
-                (unsigned int)Status,(int)AppId,FunctionName,(int)LineNumber);
+        CFE_ES_SysLogWrite("ES SharedData Mutex Take Err Stat=0x%x,App=%d,Func=%s,Line=%d\n",
+                           (unsigned int)Status,(int)AppId,FunctionName,(int)LineNumber);
 
     }/* end if */
 
@@ -1707,8 +1942,8 @@ void CFE_ES_UnlockSharedData(const char *FunctionName, int32 LineNumber)
          * NOTE: this is going to write into a buffer that itself
          * is _supposed_ to be protected by this same mutex.
          */
-        CFE_ES_SysLogWrite_Unsync("ES SharedData Mutex Give Err Stat=0x%x,App=%d,Func=%s,Line=%d\n",
-                (unsigned int)Status,(int)AppId,FunctionName,(int)LineNumber);
+        CFE_ES_SysLogWrite("ES SharedData Mutex Give Err Stat=0x%x,App=%d,Func=%s,Line=%d\n",
+                           (unsigned int)Status,(int)AppId,FunctionName,(int)LineNumber);
 
     }/* end if */
 
@@ -52,6 +52,7 @@
 ** Defines
 */
 #define ES_START_BUFF_SIZE 128
+#define ES_START_READ_SIZE 512
 
 /*
 **
@@ -76,6 +77,9 @@
 void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath )
 {
    char ES_AppLoadBuffer[ES_START_BUFF_SIZE];  /* A buffer of for a line in a file */
+   char ES_ReadBuffer[ES_START_READ_SIZE];      /* A block of raw data read from the file */
+   uint32      ReadPos = 0;                     /* Next unparsed character in the read block */
+   uint32      ReadLen = 0;                     /* Number of valid characters in the read block */
    const char *TokenList[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];
    uint32      NumTokens;
    uint32      BuffLen = 0;                            /* Length of the current buffer */
@@ -151,20 +155,35 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath )
       */
       while(1)
       {
-         ReadStatus = OS_read(AppFile, &c, 1);
-         if ( ReadStatus == OS_ERROR )
-         {
-            CFE_ES_WriteToSysLog ("ES Startup: Error Reading Startup file. EC = 0x%08X\n",(unsigned int)ReadStatus);
-            break;
-         }
-         else if ( ReadStatus == 0 )
+         /*
+         ** Refill the read block when it is exhausted.  The file is read
+         ** in blocks rather than one character at a time, as each OS_read
+         ** call is a full trip through the OSAL and the underlying file system.
+         */
+         if ( ReadPos >= ReadLen )
          {
-            /*
-            ** EOF Reached
-            */
-            break;
+            ReadStatus = OS_read(AppFile, ES_ReadBuffer, sizeof(ES_ReadBuffer));
+            if ( ReadStatus < 0 )
+            {
+               CFE_ES_WriteToSysLog ("ES Startup: Error Reading Startup file. EC = 0x%08X\n",(unsigned int)ReadStatus);
+               break;
+            }
+            else if ( ReadStatus == 0 )
+            {
+               /*
+               ** EOF Reached
+               */
+               break;
+            }
+
+            ReadLen = ReadStatus;
+            ReadPos = 0;
          }
-         else if(c != '!')
+
+         c = ES_ReadBuffer[ReadPos];
+         ++ReadPos;
+
+         if(c != '!')
          {
              if ( c <= ' ')
              {
@@ -269,6 +288,7 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
    unsigned int Priority;
    unsigned int StackSize;
    unsigned int ExceptionAction;
+   unsigned int CpuAffinityMask;
    uint32 ApplicationId;
    int32  CreateStatus = CFE_ES_ERR_APP_CREATE;
 
@@ -302,6 +322,18 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
    StackSize = strtoul(TokenList[5], NULL, 0);
    ExceptionAction = strtoul(TokenList[7], NULL, 0);
 
+   /*
+   ** The CPU affinity mask is an optional trailing field
+   */
+   if ( NumTokens > 8 )
+   {
+      CpuAffinityMask = strtoul(TokenList[8], NULL, 0);
+   }
+   else
+   {
+      CpuAffinityMask = 0;
+   }
+
    if(strcmp(EntryType,"CFE_APP")==0)
    {
       CFE_ES_WriteToSysLog("ES Startup: Loading file: %s, APP: %s\n",
@@ -321,6 +353,16 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
       CreateStatus = CFE_ES_AppCreate(&ApplicationId, FileName,
                                EntryPoint, AppName, (uint32) Priority,
                                (uint32) StackSize, (uint32) ExceptionAction );
+
+      /*
+      ** An affinity failure is not fatal, the app just runs unrestricted
+      */
+      if ( CreateStatus == CFE_SUCCESS && CpuAffinityMask != 0 &&
+           CFE_ES_SetAppCpuAffinity(ApplicationId, (uint32) CpuAffinityMask) != CFE_SUCCESS )
+      {
+         CFE_ES_WriteToSysLog("ES Startup: Could not set CPU affinity 0x%08X for APP: %s\n",
+                              CpuAffinityMask, AppName);
+      }
    }
    else if(strcmp(EntryType,"CFE_LIB")==0)
    {
@@ -389,6 +431,7 @@ int32 CFE_ES_AppCreate(uint32 *ApplicationIdPtr,
          memset ( &(CFE_ES_Global.AppTable[i]), 0, sizeof(CFE_ES_AppRecord_t));
          /* set state EARLY_INIT for OS_TaskCreate below (indicates record is in use) */
          CFE_ES_Global.AppTable[i].AppState = CFE_ES_AppState_EARLY_INIT;
+         CFE_PSP_GetTime(&CFE_ES_Global.AppTable[i].Timeline.LoadStart);
          break;
       }
    }
@@ -456,6 +499,7 @@ int32 CFE_ES_AppCreate(uint32 *ApplicationIdPtr,
       */
       strncpy((char *)CFE_ES_Global.AppTable[i].StartParams.Name, AppName, OS_MAX_API_NAME);
       CFE_ES_Global.AppTable[i].StartParams.Name[OS_MAX_API_NAME - 1] = '\0';
+      CFE_ES_NameIndexAdd(&CFE_ES_AppNameIndex, i);
 
       strncpy((char *)CFE_ES_Global.AppTable[i].StartParams.EntryPoint, (const char *)EntryPointData, OS_MAX_API_NAME);
       CFE_ES_Global.AppTable[i].StartParams.EntryPoint[OS_MAX_API_NAME - 1] = '\0';
@@ -496,9 +540,10 @@ int32 CFE_ES_AppCreate(uint32 *ApplicationIdPtr,
 
       if(ReturnCode != OS_SUCCESS)
       {
-         CFE_ES_SysLogWrite_Unsync("ES Startup: AppCreate Error: TaskCreate %s Failed. EC = 0x%08X!\n",
-                       AppName,(unsigned int)ReturnCode);
+         CFE_ES_SysLogWrite("ES Startup: AppCreate Error: TaskCreate %s Failed. EC = 0x%08X!\n",
+                            AppName,(unsigned int)ReturnCode);
 
+         CFE_ES_NameIndexRemove(&CFE_ES_AppNameIndex, i);
          CFE_ES_Global.AppTable[i].AppState = CFE_ES_AppState_UNDEFINED;
          CFE_ES_UnlockSharedData(__func__,__LINE__);
 
@@ -506,6 +551,7 @@ int32 CFE_ES_AppCreate(uint32 *ApplicationIdPtr,
       }
       else
       {
+         CFE_PSP_GetTime(&CFE_ES_Global.AppTable[i].Timeline.LoadComplete);
 
          /*
          ** Record the ES_TaskTable entry
@@ -514,7 +560,7 @@ int32 CFE_ES_AppCreate(uint32 *ApplicationIdPtr,
 
          if ( CFE_ES_Global.TaskTable[TaskId].RecordUsed == true )
          {
-            CFE_ES_SysLogWrite_Unsync("ES Startup: Error: ES_TaskTable slot in use at task creation!\n");
+            CFE_ES_SysLogWrite("ES Startup: Error: ES_TaskTable slot in use at task creation!\n");
          }
          else
          {
@@ -525,7 +571,7 @@ int32 CFE_ES_AppCreate(uint32 *ApplicationIdPtr,
          strncpy((char *)CFE_ES_Global.TaskTable[TaskId].TaskName,
              (char *)CFE_ES_Global.AppTable[i].TaskInfo.MainTaskName,OS_MAX_API_NAME );
          CFE_ES_Global.TaskTable[TaskId].TaskName[OS_MAX_API_NAME - 1]='\0';
-         CFE_ES_SysLogWrite_Unsync("ES Startup: %s loaded and created\n", AppName);
+         CFE_ES_SysLogWrite("ES Startup: %s loaded and created\n", AppName);
          *ApplicationIdPtr = i;
 
          /*
@@ -547,6 +593,103 @@ int32 CFE_ES_AppCreate(uint32 *ApplicationIdPtr,
    }
 
 } /* End Function */
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_RaiseAppState_Unsync
+**
+**   Purpose: Moves an application forward to the given state, if it is not
+**            already there, and records the time it got there in the startup timeline.
+**            Any task waiting on startup sync is woken up to re-check its condition.
+**
+**   NOTE: The shared data lock must be held by the caller.
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_RaiseAppState_Unsync(CFE_ES_AppRecord_t *AppRecPtr, CFE_ES_AppState_Enum_t NewState)
+{
+   if (AppRecPtr->AppState >= NewState)
+   {
+      return;
+   }
+
+   if (AppRecPtr->AppState < CFE_ES_AppState_LATE_INIT &&
+         NewState >= CFE_ES_AppState_LATE_INIT)
+   {
+      CFE_PSP_GetTime(&AppRecPtr->Timeline.InitComplete);
+   }
+
+   if (AppRecPtr->AppState < CFE_ES_AppState_RUNNING &&
+         NewState >= CFE_ES_AppState_RUNNING)
+   {
+      CFE_PSP_GetTime(&AppRecPtr->Timeline.Ready);
+   }
+
+   AppRecPtr->AppState = NewState;
+
+   CFE_ES_StartupSyncSignal();
+
+} /* End Function */
+
+/*
+** Computes the number of milliseconds between two timeline entries.
+** An entry that was never recorded (or is out of order) reports zero.
+*/
+static uint32 CFE_ES_TimelineDeltaMsec(const OS_time_t *Start, const OS_time_t *End)
+{
+   uint32 ElapsedMsec;
+
+   if (End->seconds < Start->seconds ||
+         (End->seconds == Start->seconds && End->microsecs < Start->microsecs))
+   {
+      return 0;
+   }
+
+   ElapsedMsec = 1000 * (End->seconds - Start->seconds);
+   ElapsedMsec += End->microsecs / 1000;
+   ElapsedMsec -= Start->microsecs / 1000;
+
+   return ElapsedMsec;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_ReportStartupTimeline
+**
+**   Purpose: Writes the startup timeline of each application loaded from the startup
+**            script to the system log, broken out into the time taken to load the
+**            module and create the main task, the time from there until the app
+**            completed its own initialization, and the time until it was running.
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_ReportStartupTimeline(void)
+{
+   CFE_ES_AppRecord_t *AppRecPtr;
+   uint32 i;
+
+   CFE_ES_LockSharedData(__func__,__LINE__);
+
+   AppRecPtr = CFE_ES_Global.AppTable;
+   for ( i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; i++ )
+   {
+      if (AppRecPtr->AppState != CFE_ES_AppState_UNDEFINED &&
+            AppRecPtr->Type == CFE_ES_AppType_EXTERNAL)
+      {
+         CFE_ES_SysLogWrite("ES Startup: %s load %lu ms, init %lu ms, ready %lu ms\n",
+                            AppRecPtr->StartParams.Name,
+                            (unsigned long)CFE_ES_TimelineDeltaMsec(&AppRecPtr->Timeline.LoadStart,
+                                                                    &AppRecPtr->Timeline.LoadComplete),
+                            (unsigned long)CFE_ES_TimelineDeltaMsec(&AppRecPtr->Timeline.LoadComplete,
+                                                                    &AppRecPtr->Timeline.InitComplete),
+                            (unsigned long)CFE_ES_TimelineDeltaMsec(&AppRecPtr->Timeline.InitComplete,
+                                                                    &AppRecPtr->Timeline.Ready));
+      }
+      ++AppRecPtr;
+   }
+
+   CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+} /* End Function */
+
 /*
 **---------------------------------------------------------------------------------------
 ** Name: CFE_ES_LoadLibrary
@@ -976,6 +1119,16 @@ void CFE_ES_ProcessControlRequest(uint32 AppID)
                                            AppStartParams.StackSize,
                                            AppStartParams.ExceptionAction);
 
+            if ( Status == CFE_SUCCESS && AppStartParams.CpuAffinityMask != 0 )
+            {
+               /* Keep the affinity the app had before; failure is reported but not fatal */
+               if ( CFE_ES_SetAppCpuAffinity(NewAppId, AppStartParams.CpuAffinityMask) != CFE_SUCCESS )
+               {
+                  CFE_ES_WriteToSysLog("ES:Could not restore CPU affinity 0x%08X for %s\n",
+                                       (unsigned int)AppStartParams.CpuAffinityMask, AppStartParams.Name);
+               }
+            }
+
             if ( Status == CFE_SUCCESS )
             {
                CFE_EVS_SendEvent(CFE_ES_RESTART_APP_INF_EID, CFE_EVS_EventType_INFORMATION,
@@ -1011,6 +1164,16 @@ void CFE_ES_ProcessControlRequest(uint32 AppID)
                                            AppStartParams.Priority,
                                            AppStartParams.StackSize,
                                            AppStartParams.ExceptionAction);
+
+            if ( Status == CFE_SUCCESS && AppStartParams.CpuAffinityMask != 0 )
+            {
+               /* Keep the affinity the app had before; failure is reported but not fatal */
+               if ( CFE_ES_SetAppCpuAffinity(NewAppId, AppStartParams.CpuAffinityMask) != CFE_SUCCESS )
+               {
+                  CFE_ES_WriteToSysLog("ES:Could not restore CPU affinity 0x%08X for %s\n",
+                                       (unsigned int)AppStartParams.CpuAffinityMask, AppStartParams.Name);
+               }
+            }
             if ( Status == CFE_SUCCESS )
             {
                CFE_EVS_SendEvent(CFE_ES_RELOAD_APP_INF_EID, CFE_EVS_EventType_INFORMATION,
@@ -1077,6 +1240,21 @@ int32 CFE_ES_CleanUpApp(uint32 AppId)
    uint32 MainTaskId;
    int32  ReturnCode = CFE_SUCCESS;
 
+   /*
+   ** Drop any async jobs the app queued but that have not started, and
+   ** wait for the ones already running, as they may use the resources
+   ** released below
+   */
+   CFE_ES_LockSharedData(__func__,__LINE__);
+   CFE_ES_AsyncJobCancelApp_Unsync(AppId);
+   CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+   if ( !CFE_ES_AsyncJobWaitApp(AppId) )
+   {
+      CFE_ES_WriteToSysLog("CFE_ES_CleanUpApp: Async job of AppId %u still running\n",(unsigned int)AppId);
+      ReturnCode = CFE_ES_APP_CLEANUP_ERR;
+   }
+
    /*
    ** Call the Table Clean up function
    */
@@ -1127,8 +1305,8 @@ int32 CFE_ES_CleanUpApp(uint32 AppId)
          Status = CFE_ES_CleanupTaskResources(CFE_ES_Global.TaskTable[i].TaskId);
          if ( Status != CFE_SUCCESS )
          {
-            CFE_ES_SysLogWrite_Unsync("CFE_ES_CleanUpApp: CleanUpTaskResources for Task ID:%d returned Error: 0x%08X\n",
-                                  (int)i, (unsigned int)Status);
+            CFE_ES_SysLogWrite("CFE_ES_CleanUpApp: CleanUpTaskResources for Task ID:%d returned Error: 0x%08X\n",
+                               (int)i, (unsigned int)Status);
             ReturnCode = CFE_ES_APP_CLEANUP_ERR;
          }
       } /* end if */
@@ -1140,8 +1318,8 @@ int32 CFE_ES_CleanUpApp(uint32 AppId)
    Status = CFE_ES_CleanupTaskResources(MainTaskId);
    if ( Status != CFE_SUCCESS )
    {
-      CFE_ES_SysLogWrite_Unsync("CFE_ES_CleanUpApp: CleanUpTaskResources for Task ID:%d returned Error: 0x%08X\n",
-                               (int)MainTaskId, (unsigned int)Status);
+      CFE_ES_SysLogWrite("CFE_ES_CleanUpApp: CleanUpTaskResources for Task ID:%d returned Error: 0x%08X\n",
+                         (int)MainTaskId, (unsigned int)Status);
       ReturnCode = CFE_ES_APP_CLEANUP_ERR;
 
    }
@@ -1157,13 +1335,14 @@ int32 CFE_ES_CleanUpApp(uint32 AppId)
       Status = OS_ModuleUnload(CFE_ES_Global.AppTable[AppId].StartParams.ModuleId);
       if ( Status == OS_ERROR )
       {
-           CFE_ES_SysLogWrite_Unsync("CFE_ES_CleanUpApp: Module (ID:0x%08X) Unload failed. RC=0x%08X\n",
-                                 (unsigned int)CFE_ES_Global.AppTable[AppId].StartParams.ModuleId, (unsigned int)Status);
+           CFE_ES_SysLogWrite("CFE_ES_CleanUpApp: Module (ID:0x%08X) Unload failed. RC=0x%08X\n",
+                              (unsigned int)CFE_ES_Global.AppTable[AppId].StartParams.ModuleId, (unsigned int)Status);
            ReturnCode = CFE_ES_APP_CLEANUP_ERR;
       }
       CFE_ES_Global.RegisteredExternalApps--;
    }
 
+   CFE_ES_NameIndexRemove(&CFE_ES_AppNameIndex, AppId);
    CFE_ES_Global.AppTable[AppId].AppState = CFE_ES_AppState_UNDEFINED;
 
    CFE_ES_UnlockSharedData(__func__,__LINE__);
@@ -1248,8 +1427,8 @@ void CFE_ES_CleanupObjectCallback(uint32 ObjectId, void *arg)
         }
         else
         {
-            CFE_ES_SysLogWrite_Unsync("Call to OSAL Delete Object (ID:%d) failed. RC=0x%08X\n",
-                         (int)ObjectId, (unsigned int)Status);
+            CFE_ES_SysLogWrite("Call to OSAL Delete Object (ID:%d) failed. RC=0x%08X\n",
+                               (int)ObjectId, (unsigned int)Status);
             if (CleanState->OverallStatus == CFE_SUCCESS)
             {
                 /*
@@ -1355,6 +1534,66 @@ int32 CFE_ES_CleanupTaskResources(uint32 TaskId)
 
 }
 
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_SetAppCpuAffinity
+**
+**   Purpose: Restrict the main task and all child tasks of an app to the processor
+**            cores in CpuMask (0 = no restriction).  The mask is kept in the start
+**            parameters so that child tasks created later, and the app itself after
+**            a restart or reload, get the same affinity.
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_SetAppCpuAffinity(uint32 AppId, uint32 CpuMask)
+{
+    int32   ReturnCode;
+    int32   OsStatus;
+    uint32  i;
+
+    if ( AppId >= CFE_PLATFORM_ES_MAX_APPLICATIONS )
+    {
+        return CFE_ES_ERR_APPID;
+    }
+
+    CFE_ES_LockSharedData(__func__,__LINE__);
+
+    if ( CFE_ES_Global.AppTable[AppId].AppState == CFE_ES_AppState_UNDEFINED )
+    {
+        ReturnCode = CFE_ES_ERR_APPID;
+    }
+    else
+    {
+        ReturnCode = CFE_SUCCESS;
+        for ( i = 0; i < OS_MAX_TASKS; i++ )
+        {
+            if ( CFE_ES_Global.TaskTable[i].RecordUsed == true &&
+                 CFE_ES_Global.TaskTable[i].AppId == AppId )
+            {
+                OsStatus = OS_TaskSetAffinity(CFE_ES_Global.TaskTable[i].TaskId, CpuMask);
+                if ( OsStatus == OS_ERR_NOT_IMPLEMENTED )
+                {
+                    ReturnCode = CFE_ES_NOT_IMPLEMENTED;
+                    break;
+                }
+                else if ( OsStatus != OS_SUCCESS && ReturnCode == CFE_SUCCESS )
+                {
+                    ReturnCode = OsStatus;
+                }
+            }
+        }
+
+        if ( ReturnCode == CFE_SUCCESS )
+        {
+            CFE_ES_Global.AppTable[AppId].StartParams.CpuAffinityMask = CpuMask;
+        }
+    }
+
+    CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+    return ReturnCode;
+
+} /* End of CFE_ES_SetAppCpuAffinity() */
+
 /*
 **---------------------------------------------------------------------------------------
 **   Name: CFE_ES_GetAppInfoInternal
@@ -1394,6 +1633,7 @@ void CFE_ES_GetAppInfoInternal(uint32 AppId, CFE_ES_AppInfo_t *AppInfoPtr )
    CFE_SB_SET_MEMADDR(AppInfoPtr->StartAddress, CFE_ES_Global.AppTable[AppId].StartParams.StartAddress);
    AppInfoPtr->ExceptionAction = CFE_ES_Global.AppTable[AppId].StartParams.ExceptionAction;
    AppInfoPtr->Priority = CFE_ES_Global.AppTable[AppId].StartParams.Priority;
+   AppInfoPtr->CpuAffinityMask = CFE_ES_Global.AppTable[AppId].StartParams.CpuAffinityMask;
 
    AppInfoPtr->MainTaskId = CFE_ES_Global.AppTable[AppId].TaskInfo.MainTaskId;
    strncpy((char *)AppInfoPtr->MainTaskName, (char *)CFE_ES_Global.AppTable[AppId].TaskInfo.MainTaskName,
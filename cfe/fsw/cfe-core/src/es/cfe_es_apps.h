@@ -45,7 +45,7 @@
 /*
 ** Macro Definitions
 */
-#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE      8
+#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE      9
 
 /*
 ** Type Definitions
@@ -81,6 +81,8 @@ typedef struct
   uint16                ExceptionAction;
   uint16                Priority;
 
+  uint32                CpuAffinityMask;    /* Cores the app's tasks may run on, 0 = any */
+
 } CFE_ES_AppStartParams_t;
 
 /*
@@ -95,6 +97,20 @@ typedef struct
 } CFE_ES_MainTaskInfo_t;
 
 
+/*
+** CFE_ES_AppStartupTimeline_t records the time at which an application
+** reached each stage of startup.  This is used to report where the time
+** is spent when the system is brought up.
+*/
+typedef struct
+{
+   OS_time_t   LoadStart;       /* Time the app record was allocated and the module load started */
+   OS_time_t   LoadComplete;    /* Time the main task of the app was created */
+   OS_time_t   InitComplete;    /* Time the app reached the LATE_INIT state */
+   OS_time_t   Ready;           /* Time the app reached the RUNNING state */
+} CFE_ES_AppStartupTimeline_t;
+
+
 /*
 ** CFE_ES_AppRecord_t is an internal structure used to keep track of
 ** CFE Applications that are active in the system.
@@ -106,6 +122,7 @@ typedef struct
    CFE_ES_AppStartParams_t StartParams;                 /* The start parameters for an App */
    CFE_ES_ControlReq_t     ControlReq;                  /* The Control Request Record for External cFE Apps */
    CFE_ES_MainTaskInfo_t   TaskInfo;                    /* Information about the Tasks */
+   CFE_ES_AppStartupTimeline_t Timeline;                /* Startup timeline of the App */
 
 } CFE_ES_AppRecord_t;
 
@@ -163,6 +180,16 @@ void  CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath );
 */
 int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens);
 
+/*
+** Raise the state of an app, recording the startup timeline (shared data lock must be held)
+*/
+void CFE_ES_RaiseAppState_Unsync(CFE_ES_AppRecord_t *AppRecPtr, CFE_ES_AppState_Enum_t NewState);
+
+/*
+** Write the per-app startup timeline to the system log
+*/
+void CFE_ES_ReportStartupTimeline(void);
+
 /*
 ** Internal function to create/start a new cFE app
 ** based on the parameters passed in
@@ -174,6 +201,11 @@ int32 CFE_ES_AppCreate(uint32 *ApplicationIdPtr,
                        uint32  Priority,
                        uint32  StackSize,
                        uint32  ExceptionAction);
+/*
+** Internal function to restrict all tasks of an app to a set of processor cores
+*/
+int32 CFE_ES_SetAppCpuAffinity(uint32 AppId, uint32 CpuMask);
+
 /*
 ** Internal function to load a a new cFE shared Library
 */
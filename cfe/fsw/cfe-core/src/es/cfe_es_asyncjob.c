@@ -0,0 +1,391 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** File: cfe_es_asyncjob.c
+**
+** Purpose: This file contains the implementation of the ES async job workers
+**
+** Apps and core services submit one-shot jobs (file dumps and other long
+** operations) to a bounded, prioritized queue.  A small pool of ES child
+** tasks takes jobs from the queue and runs them, so the submitting task
+** does not block its command pipe while the job is in progress.
+**
+** This is separate from the ES background task, which runs a fixed set of
+** periodic maintenance jobs.
+**
+*/
+
+/*
+** Include Section
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "osapi.h"
+#include "private/cfe_private.h"
+#include "cfe_es_global.h"
+#include "cfe_es_task.h"
+
+#define CFE_ES_ASYNC_JOB_SEM_NAME          "ES_AsyncJobSem"
+#define CFE_ES_ASYNC_JOB_CHILD_NAME        "ES_AsyncJob"
+#define CFE_ES_ASYNC_JOB_CHILD_STACK_PTR   NULL
+#define CFE_ES_ASYNC_JOB_CHILD_FLAGS       0
+#define CFE_ES_ASYNC_JOB_WAIT_DELAY_MSEC   10
+#define CFE_ES_ASYNC_JOB_WAIT_LIMIT_MSEC   5000
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_SubmitAsyncJob                                                   */
+/*                                                                               */
+/* Purpose: Queue a job for the async job workers                                */
+/*          See API and header file for details                                  */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 CFE_ES_SubmitAsyncJob(CFE_ES_AsyncJobFuncPtr_t JobFunc, CFE_ES_AsyncJobDoneFuncPtr_t DoneFunc,
+                            const void *JobArg, uint32 ArgSize, uint16 Priority)
+{
+    CFE_ES_AsyncJobEntry_t *JobPtr;
+    uint32 AppId;
+    uint32 i;
+
+    if (JobFunc == NULL || ArgSize > sizeof(JobPtr->ArgData.Bytes) ||
+            (JobArg == NULL && ArgSize > 0))
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    CFE_ES_LockSharedData(__func__,__LINE__);
+
+    JobPtr = NULL;
+    for (i = 0; i < CFE_PLATFORM_ES_ASYNC_JOB_QUEUE_DEPTH; ++i)
+    {
+        if (CFE_ES_Global.AsyncJob.Queue[i].State == CFE_ES_ASYNC_JOB_FREE)
+        {
+            JobPtr = &CFE_ES_Global.AsyncJob.Queue[i];
+            break;
+        }
+    }
+
+    if (JobPtr == NULL)
+    {
+        ++CFE_ES_Global.AsyncJob.JobsRejected;
+        CFE_ES_UnlockSharedData(__func__,__LINE__);
+        return CFE_ES_ASYNC_JOB_QUEUE_FULL;
+    }
+
+    /*
+     * Jobs submitted by a task that is not registered (which should
+     * not happen) are still run, they just cannot be cancelled by app.
+     */
+    if (CFE_ES_GetAppIDInternal(&AppId) != CFE_SUCCESS)
+    {
+        AppId = CFE_PLATFORM_ES_MAX_APPLICATIONS;
+    }
+
+    memset(JobPtr, 0, sizeof(*JobPtr));
+    JobPtr->AppId = AppId;
+    JobPtr->Sequence = CFE_ES_Global.AsyncJob.NextSequence;
+    JobPtr->Priority = Priority;
+    JobPtr->JobFunc = JobFunc;
+    JobPtr->DoneFunc = DoneFunc;
+    CFE_PSP_GetTime(&JobPtr->SubmitTime);
+    if (ArgSize > 0)
+    {
+        memcpy(JobPtr->ArgData.Bytes, JobArg, ArgSize);
+    }
+    JobPtr->State = CFE_ES_ASYNC_JOB_PENDING;
+
+    ++CFE_ES_Global.AsyncJob.NextSequence;
+    ++CFE_ES_Global.AsyncJob.QueueDepth;
+
+    CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+    /* wake up a worker to take the job */
+    OS_CountSemGive(CFE_ES_Global.AsyncJob.JobSem);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_AsyncJobRunNext                                                  */
+/*                                                                               */
+/* Purpose: Take the highest priority pending job from the queue and run it.     */
+/*                                                                               */
+/* Assumptions and Notes: Jobs of equal priority are run in the order they       */
+/* were submitted.  Returns false if there was no pending job.                   */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CFE_ES_AsyncJobRunNext(void)
+{
+    CFE_ES_AsyncJobEntry_t *JobPtr;
+    CFE_ES_AsyncJobEntry_t *CheckPtr;
+    OS_time_t CurrTime;
+    uint32 Latency;
+    uint32 i;
+    int32 Status;
+
+    CFE_ES_LockSharedData(__func__,__LINE__);
+
+    JobPtr = NULL;
+    CheckPtr = CFE_ES_Global.AsyncJob.Queue;
+    for (i = 0; i < CFE_PLATFORM_ES_ASYNC_JOB_QUEUE_DEPTH; ++i)
+    {
+        /*
+         * The sequence comparison is done as a difference so that it
+         * remains correct when the sequence number wraps around.
+         */
+        if (CheckPtr->State == CFE_ES_ASYNC_JOB_PENDING &&
+                (JobPtr == NULL ||
+                 CheckPtr->Priority < JobPtr->Priority ||
+                 (CheckPtr->Priority == JobPtr->Priority &&
+                  (int32)(CheckPtr->Sequence - JobPtr->Sequence) < 0)))
+        {
+            JobPtr = CheckPtr;
+        }
+        ++CheckPtr;
+    }
+
+    if (JobPtr != NULL)
+    {
+        JobPtr->State = CFE_ES_ASYNC_JOB_RUNNING;
+    }
+
+    CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+    if (JobPtr == NULL)
+    {
+        return false;
+    }
+
+    /*
+     * The entry is owned by this worker while it is in the RUNNING state,
+     * so the job and completion functions run without holding the lock.
+     */
+    Status = JobPtr->JobFunc(JobPtr->ArgData.Bytes);
+    if (JobPtr->DoneFunc != NULL)
+    {
+        JobPtr->DoneFunc(JobPtr->ArgData.Bytes, Status);
+    }
+
+    CFE_PSP_GetTime(&CurrTime);
+    Latency = 1000 * (CurrTime.seconds - JobPtr->SubmitTime.seconds);
+    Latency += CurrTime.microsecs / 1000;
+    Latency -= JobPtr->SubmitTime.microsecs / 1000;
+
+    CFE_ES_LockSharedData(__func__,__LINE__);
+
+    CFE_ES_Global.AsyncJob.LastLatency = Latency;
+    if (Latency > CFE_ES_Global.AsyncJob.MaxLatency)
+    {
+        CFE_ES_Global.AsyncJob.MaxLatency = Latency;
+    }
+    ++CFE_ES_Global.AsyncJob.JobsCompleted;
+    --CFE_ES_Global.AsyncJob.QueueDepth;
+    JobPtr->State = CFE_ES_ASYNC_JOB_FREE;
+
+    CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_AsyncJobWorker                                                   */
+/*                                                                               */
+/* Purpose: Main function of the async job worker tasks.                         */
+/*                                                                               */
+/* Assumptions and Notes: Each worker pends on the job semaphore, which is       */
+/* given once for every job submitted.  It may be given for a job that was       */
+/* since cancelled, in which case there is nothing to run and the worker         */
+/* simply waits again.                                                           */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CFE_ES_AsyncJobWorker(void)
+{
+    int32 status;
+
+    status = CFE_ES_RegisterChildTask();
+    if (status != CFE_SUCCESS)
+    {
+        /* should never occur */
+        CFE_ES_WriteToSysLog("CFE_ES: Async Job Worker Failed to register: %08lx\n", (unsigned long)status);
+        return;
+    }
+
+    while (true)
+    {
+        status = OS_CountSemTake(CFE_ES_Global.AsyncJob.JobSem);
+        if (status != OS_SUCCESS)
+        {
+            /* should never occur */
+            CFE_ES_WriteToSysLog("CFE_ES: Failed to take async job sem: %08lx\n", (unsigned long)status);
+            break;
+        }
+
+        CFE_ES_AsyncJobRunNext();
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_AsyncJobInit                                                     */
+/*                                                                               */
+/* Purpose: Initialize the async job queue and spawn the worker tasks            */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 CFE_ES_AsyncJobInit(void)
+{
+    char TaskName[OS_MAX_API_NAME];
+    int32 status;
+    uint32 i;
+
+    memset(&CFE_ES_Global.AsyncJob, 0, sizeof(CFE_ES_Global.AsyncJob));
+
+    status = OS_CountSemCreate(&CFE_ES_Global.AsyncJob.JobSem, CFE_ES_ASYNC_JOB_SEM_NAME, 0, 0);
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("CFE_ES: Failed to create async job sem: %08lx\n", (unsigned long)status);
+        return status;
+    }
+
+    for (i = 0; i < CFE_PLATFORM_ES_ASYNC_JOB_WORKERS; ++i)
+    {
+        snprintf(TaskName, sizeof(TaskName), "%s%lu", CFE_ES_ASYNC_JOB_CHILD_NAME, (unsigned long)i);
+
+        status = CFE_ES_CreateChildTask(&CFE_ES_Global.AsyncJob.TaskID[i],
+                TaskName,
+                CFE_ES_AsyncJobWorker,
+                CFE_ES_ASYNC_JOB_CHILD_STACK_PTR,
+                CFE_PLATFORM_ES_ASYNC_JOB_STACK_SIZE,
+                CFE_PLATFORM_ES_ASYNC_JOB_PRIORITY,
+                CFE_ES_ASYNC_JOB_CHILD_FLAGS);
+
+        if (status != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("CFE_ES: Failed to create async job worker: %08lx\n", (unsigned long)status);
+            return status;
+        }
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_AsyncJobCleanup                                                  */
+/*                                                                               */
+/* Purpose: Exit/Stop the async job workers                                      */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CFE_ES_AsyncJobCleanup(void)
+{
+    uint32 i;
+
+    for (i = 0; i < CFE_PLATFORM_ES_ASYNC_JOB_WORKERS; ++i)
+    {
+        if (CFE_ES_Global.AsyncJob.TaskID[i] != 0)
+        {
+            CFE_ES_DeleteChildTask(CFE_ES_Global.AsyncJob.TaskID[i]);
+            CFE_ES_Global.AsyncJob.TaskID[i] = 0;
+        }
+    }
+
+    OS_CountSemDelete(CFE_ES_Global.AsyncJob.JobSem);
+    CFE_ES_Global.AsyncJob.JobSem = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_AsyncJobCancelApp_Unsync                                         */
+/*                                                                               */
+/* Purpose: Remove all pending jobs submitted by the given app from the queue.   */
+/*                                                                               */
+/* Assumptions and Notes: This is called when the app is cleaned up, as the      */
+/* job functions of an external app are unloaded along with it.  The completion  */
+/* function of a cancelled job is not called.  A job that is already running     */
+/* is not affected.  The ES shared data lock must be held by the caller.         */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CFE_ES_AsyncJobCancelApp_Unsync(uint32 AppId)
+{
+    CFE_ES_AsyncJobEntry_t *JobPtr;
+    uint32 i;
+
+    JobPtr = CFE_ES_Global.AsyncJob.Queue;
+    for (i = 0; i < CFE_PLATFORM_ES_ASYNC_JOB_QUEUE_DEPTH; ++i)
+    {
+        if (JobPtr->State == CFE_ES_ASYNC_JOB_PENDING && JobPtr->AppId == AppId)
+        {
+            JobPtr->State = CFE_ES_ASYNC_JOB_FREE;
+            --CFE_ES_Global.AsyncJob.QueueDepth;
+        }
+        ++JobPtr;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_AsyncJobWaitApp                                                  */
+/*                                                                               */
+/* Purpose: Wait for the running jobs submitted by the given app to complete.    */
+/*                                                                               */
+/* Assumptions and Notes: This is called when the app is cleaned up, after its   */
+/* pending jobs have been cancelled, so that no job or completion function of    */
+/* the app is still executing when its resources are released.  A job cannot    */
+/* be stopped once started, so this polls the queue for up to                    */
+/* CFE_ES_ASYNC_JOB_WAIT_LIMIT_MSEC and returns false if a job of the app was    */
+/* still running at that point.  The ES shared data lock must not be held.       */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CFE_ES_AsyncJobWaitApp(uint32 AppId)
+{
+    CFE_ES_AsyncJobEntry_t *JobPtr;
+    uint32 WaitTime;
+    uint32 i;
+    bool IsRunning;
+
+    WaitTime = 0;
+    while (true)
+    {
+        IsRunning = false;
+
+        CFE_ES_LockSharedData(__func__,__LINE__);
+
+        JobPtr = CFE_ES_Global.AsyncJob.Queue;
+        for (i = 0; i < CFE_PLATFORM_ES_ASYNC_JOB_QUEUE_DEPTH; ++i)
+        {
+            if (JobPtr->State == CFE_ES_ASYNC_JOB_RUNNING && JobPtr->AppId == AppId)
+            {
+                IsRunning = true;
+                break;
+            }
+            ++JobPtr;
+        }
+
+        CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+        if (!IsRunning || WaitTime >= CFE_ES_ASYNC_JOB_WAIT_LIMIT_MSEC)
+        {
+            break;
+        }
+
+        OS_TaskDelay(CFE_ES_ASYNC_JOB_WAIT_DELAY_MSEC);
+        WaitTime += CFE_ES_ASYNC_JOB_WAIT_DELAY_MSEC;
+    }
+
+    return !IsRunning;
+}
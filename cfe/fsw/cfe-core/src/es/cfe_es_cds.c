@@ -298,6 +298,7 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, int32 BlockSize, const
            /* Save CDS Name in Registry */
            strncpy(RegRecPtr->Name, Name, sizeof(RegRecPtr->Name)-1);
            RegRecPtr->Name[sizeof(RegRecPtr->Name)-1] = 0;
+           CFE_ES_NameIndexAdd(&CFE_ES_CDSNameIndex, RegIndx);
                
            /* Return the index into the registry as the handle to the CDS */
            *HandlePtr = RegIndx;
@@ -486,6 +487,7 @@ int32 CFE_ES_InitCDSRegistry(void)
         CFE_ES_Global.CDSVars.Registry[i].Taken = false;
         CFE_ES_Global.CDSVars.Registry[i].Table = false;
     }
+    CFE_ES_NameIndexClear(&CFE_ES_CDSNameIndex);
     
     /* Copy the number of registry entries to the CDS */
     Status = CFE_PSP_WriteToCDS(&CFE_ES_Global.CDSVars.MaxNumRegEntries, 
@@ -636,25 +638,17 @@ int32 CFE_ES_UnlockCDSRegistry(void)
 
 int32 CFE_ES_FindCDSInRegistry(const char *CDSName)
 {
-    int32 RegIndx = CFE_ES_CDS_NOT_FOUND;
-    int32 i = -1;
+    int32 RegIndx;
 
-    do
-    {
-        /* Point to next record in the CDS Registry */
-        i++;
+    /* Perform a case sensitive lookup of the name in the registry name index */
+    RegIndx = CFE_ES_NameIndexFind(&CFE_ES_CDSNameIndex, CDSName);
 
-        /* Check to see if the record is currently being used */
-        if (CFE_ES_Global.CDSVars.Registry[i].Taken == true)
-        {
-            /* Perform a case sensitive name comparison */
-            if (strcmp(CDSName, CFE_ES_Global.CDSVars.Registry[i].Name) == 0)
-            {
-                /* If the names match, then return the index */
-                RegIndx = i;
-            }
-        }
-    } while ( (RegIndx == CFE_ES_CDS_NOT_FOUND) && (i < (CFE_ES_Global.CDSVars.MaxNumRegEntries-1)) );
+    /* Check to see if the record is currently being used */
+    if ((RegIndx == CFE_ES_NAMEINDEX_NOT_FOUND) ||
+        (CFE_ES_Global.CDSVars.Registry[RegIndx].Taken == false))
+    {
+        RegIndx = CFE_ES_CDS_NOT_FOUND;
+    }
 
     return RegIndx;
 }   /* End of CFE_ES_FindCDSInRegistry() */
@@ -699,6 +693,7 @@ int32 CFE_ES_RebuildCDS(void)
 {
     int32 Status;
     int32 PoolOffset;
+    uint32 i;
     
     /* First, determine if the CDS registry stored in the CDS is smaller or equal */
     /* in size to the CDS registry we are currently configured for                */
@@ -716,6 +711,16 @@ int32 CFE_ES_RebuildCDS(void)
                             
         if (Status == CFE_PSP_SUCCESS)
         {
+            /* Index the names of the recovered registry entries */
+            CFE_ES_NameIndexClear(&CFE_ES_CDSNameIndex);
+            for (i=0; i<CFE_ES_Global.CDSVars.MaxNumRegEntries; i++)
+            {
+                if (CFE_ES_Global.CDSVars.Registry[i].Taken == true)
+                {
+                    CFE_ES_NameIndexAdd(&CFE_ES_CDSNameIndex, i);
+                }
+            }
+
             /* Calculate the starting offset of the memory pool */
             PoolOffset = (CDS_REG_OFFSET + (CFE_ES_Global.CDSVars.MaxNumRegEntries * sizeof(CFE_ES_CDS_RegRec_t)) + 3) & 0xfffffffc;;
 
@@ -814,6 +819,7 @@ int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices)
                 else
                 {
                     /* Remove entry from the CDS Registry */
+                    CFE_ES_NameIndexRemove(&CFE_ES_CDSNameIndex, RegIndx);
                     RegRecPtr->Taken = false;
         
                     Status = CFE_ES_UpdateCDSRegistry();
@@ -47,6 +47,7 @@
 #include "cfe_platform_cfg.h"
 #include "cfe_es.h"
 #include "cfe_es_cds_mempool.h"
+#include "private/cfe_es_nameindex.h"
 
 /*
 ** Macro Definitions
@@ -81,6 +82,7 @@ typedef struct
     uint32               MaxNumRegEntries;                      /**< \brief Maximum number of Registry entries */
     CFE_ES_CDS_RegRec_t  Registry[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES];  /**< \brief CDS Registry (Local Copy) */
     char                 ValidityField[8];
+    CFE_ES_NameIndexSlot_t RegistryNameSlots[CFE_ES_NAMEINDEX_SIZE(CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES)]; /**< \brief Registry name index */
 } CFE_ES_CDSVariables_t;
 
 /*****************************************************************************/
@@ -166,7 +168,8 @@ void CFE_ES_FormCDSName(char *FullCDSName, const char *CDSName, uint32 ThisAppId
 **        returns the appropriate Registry Index.
 **
 ** \par Assumptions, External Events, and Notes:
-**          None
+**          The CDS Registry must be locked, as the name is looked up
+**          in the CDS Registry name index.
 **
 ** \param[in]  CDSName - Pointer to character string containing complete
 **                       CDS Name (of the format "AppName.CDSName").
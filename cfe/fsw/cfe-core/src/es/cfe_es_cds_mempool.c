@@ -101,7 +101,7 @@ int32 CFE_ES_CDSGetBinIndex(uint32 DesiredSize);
 ** NOTE:
 **  This function is only ever called during "Early Init" phase,
 **  where it is not possible to have contention writing into the syslog.
-**  Therefore the use of CFE_ES_SysLogWrite_Unsync() is acceptable
+**  Logging is done with CFE_ES_SysLogWrite(), which needs no other ES lock.
 */
 int32 CFE_ES_CreateCDSPool(uint32  CDSPoolSize, uint32  StartOffset)
 {
@@ -134,8 +134,8 @@ int32 CFE_ES_CreateCDSPool(uint32  CDSPoolSize, uint32  StartOffset)
     if (CDSPoolSize < (CFE_ES_CDSMemPool.MinBlockSize + sizeof(CFE_ES_CDSBlockDesc_t)))
     {
         /* Must be able make Pool verification, block descriptor and at least one of the smallest blocks  */
-        CFE_ES_SysLogWrite_Unsync("CFE_ES:CreateCDSPool-Pool size(%u) too small for one CDS Block, need >=%u\n",
-                             (unsigned int)CDSPoolSize, (unsigned int)(CFE_ES_CDSMemPool.MinBlockSize + sizeof(CFE_ES_CDSBlockDesc_t)));
+        CFE_ES_SysLogWrite("CFE_ES:CreateCDSPool-Pool size(%u) too small for one CDS Block, need >=%u\n",
+                           (unsigned int)CDSPoolSize, (unsigned int)(CFE_ES_CDSMemPool.MinBlockSize + sizeof(CFE_ES_CDSBlockDesc_t)));
                         
         /* Give and delete semaphore since CDS Pool creation failed */     
         OS_MutSemGive(CFE_ES_CDSMemPool.MutexId);
@@ -158,7 +158,7 @@ int32 CFE_ES_CreateCDSPool(uint32  CDSPoolSize, uint32  StartOffset)
 ** NOTE:
 **  This function is only ever called during "Early Init" phase,
 **  where it is not possible to have contention writing into the syslog.
-**  Therefore the use of CFE_ES_SysLogWrite_Unsync() is acceptable
+**  Logging is done with CFE_ES_SysLogWrite(), which needs no other ES lock.
 */
 int32 CFE_ES_RebuildCDSPool(uint32 CDSPoolSize, uint32 StartOffset)
 {
@@ -194,8 +194,8 @@ int32 CFE_ES_RebuildCDSPool(uint32 CDSPoolSize, uint32 StartOffset)
     if (CDSPoolSize < (CFE_ES_CDSMemPool.MinBlockSize + sizeof(CFE_ES_CDSBlockDesc_t)))
     {
         /* Must be able make Pool verification, block descriptor and at least one of the smallest blocks  */
-        CFE_ES_SysLogWrite_Unsync("CFE_ES:RebuildCDSPool-Pool size(%u) too small for one CDS Block, need >=%u\n",
-                             (unsigned int)CDSPoolSize, (unsigned int)(CFE_ES_CDSMemPool.MinBlockSize + sizeof(CFE_ES_CDSBlockDesc_t)));
+        CFE_ES_SysLogWrite("CFE_ES:RebuildCDSPool-Pool size(%u) too small for one CDS Block, need >=%u\n",
+                           (unsigned int)CDSPoolSize, (unsigned int)(CFE_ES_CDSMemPool.MinBlockSize + sizeof(CFE_ES_CDSBlockDesc_t)));
 
         /* Give and delete semaphore since CDS Pool rebuild failed */     
         OS_MutSemGive(CFE_ES_CDSMemPool.MutexId);
@@ -235,14 +235,14 @@ int32 CFE_ES_RebuildCDSPool(uint32 CDSPoolSize, uint32 StartOffset)
 
                         if (Status != CFE_PSP_SUCCESS)
                         {
-                            CFE_ES_SysLogWrite_Unsync("CFE_ES:RebuildCDS-Err writing to CDS (Stat=0x%08x)\n", (unsigned int)Status);
+                            CFE_ES_SysLogWrite("CFE_ES:RebuildCDS-Err writing to CDS (Stat=0x%08x)\n", (unsigned int)Status);
                             Status = CFE_ES_CDS_ACCESS_ERROR;
                         }
                     }
                     else
                     {
                         CFE_ES_CDSMemPool.CheckErrCntr++;
-                        CFE_ES_SysLogWrite_Unsync("CFE_ES:RebuildCDS-Invalid Block Descriptor \n");
+                        CFE_ES_SysLogWrite("CFE_ES:RebuildCDS-Invalid Block Descriptor \n");
                         Status = CFE_ES_CDS_ACCESS_ERROR;
                     }
                 }
@@ -259,7 +259,7 @@ int32 CFE_ES_RebuildCDSPool(uint32 CDSPoolSize, uint32 StartOffset)
         }
         else
         {
-            CFE_ES_SysLogWrite_Unsync("CFE_ES:RebuildCDS-Err reading from CDS (Stat=0x%08x)\n", (unsigned int)Status);
+            CFE_ES_SysLogWrite("CFE_ES:RebuildCDS-Err reading from CDS (Stat=0x%08x)\n", (unsigned int)Status);
             Status = CFE_ES_CDS_ACCESS_ERROR;
         }
     }  /* end while */
@@ -571,6 +571,155 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSBlockHandle_t BlockHandle, void *DataToWrit
 }
 
 
+/*
+** Function:
+**   CFE_ES_CDSBlockWriteRange
+**
+** Purpose:
+**   Write only the bytes [Offset, Offset+NumBytes) of DataToWrite to the block.
+**   The block CRC is updated from the old and new contents of the range rather
+**   than recomputed over the whole block.
+**
+*/
+int32 CFE_ES_CDSBlockWriteRange(CFE_ES_CDSBlockHandle_t BlockHandle, const void *DataToWrite, uint32 Offset, uint32 NumBytes)
+{
+    char   LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
+    int32  Status = CFE_SUCCESS;
+    int32  BinIndex = 0;
+    const uint8 *NewData = (const uint8 *)DataToWrite;
+    uint8  Delta[64];
+    uint32 DeltaCRC;
+    uint32 Position;
+    uint32 ChunkSize;
+    uint32 i;
+
+    /* Ensure the the log message is an empty string in case it is never written to */
+    LogMessage[0] = 0;
+
+    /* Validate the handle before doing anything */
+    if ((BlockHandle < sizeof(CFE_ES_Global.CDSVars.ValidityField)) || 
+        (BlockHandle > (CFE_ES_CDSMemPool.End - sizeof(CFE_ES_CDSBlockDesc_t) - 
+                        CFE_ES_CDSMemPool.MinBlockSize - sizeof(CFE_ES_Global.CDSVars.ValidityField))))
+    {
+        CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
+                "CFE_ES:CDSBlkWrite-Invalid Memory Handle.\n");
+        Status = CFE_ES_ERR_MEM_HANDLE;
+    }
+    else
+    {
+        OS_MutSemTake(CFE_ES_CDSMemPool.MutexId);
+
+        /* Get a copy of the block descriptor associated with the specified handle */
+        Status = CFE_PSP_ReadFromCDS(&CFE_ES_CDSBlockDesc, BlockHandle, sizeof(CFE_ES_CDSBlockDesc_t));
+
+        if (Status != CFE_PSP_SUCCESS)
+        {
+            CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
+                    "CFE_ES:CDSBlkWrite-Err reading from CDS (Stat=0x%08x)\n", (unsigned int)Status);
+        }
+        /* Validate the block to make sure it is still active and not corrupted */
+        else if ((CFE_ES_CDSBlockDesc.CheckBits != CFE_ES_CDS_CHECK_PATTERN) ||
+                (CFE_ES_CDSBlockDesc.AllocatedFlag != CFE_ES_CDS_BLOCK_USED))
+        {
+            CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
+                    "CFE_ES:CDSBlkWrite-Invalid Handle or Block Descriptor.\n");
+            Status = CFE_ES_ERR_MEM_HANDLE;
+        }
+        else
+        {
+            BinIndex = CFE_ES_CDSGetBinIndex(CFE_ES_CDSBlockDesc.ActualSize);
+
+            /* Final sanity check on block descriptor, is the Actual size reasonable */
+            if (BinIndex < 0)
+            {
+                CFE_ES_CDSMemPool.CheckErrCntr++;
+                CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
+                        "CFE_ES:CDSBlkWrite-Invalid Block Descriptor\n");
+                Status = CFE_ES_ERR_MEM_HANDLE;
+            }
+            else if ((Offset > CFE_ES_CDSBlockDesc.SizeUsed) ||
+                     (NumBytes > (CFE_ES_CDSBlockDesc.SizeUsed - Offset)))
+            {
+                CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
+                        "CFE_ES:CDSBlkWrite-Range exceeds block (Offset=%lu, Size=%lu, Used=%lu)\n",
+                        (unsigned long)Offset, (unsigned long)NumBytes,
+                        (unsigned long)CFE_ES_CDSBlockDesc.SizeUsed);
+                Status = CFE_ES_CDS_INVALID_SIZE;
+            }
+            else
+            {
+                /* Accumulate the CRC of (old XOR new) over the range, reading the */
+                /* old contents back from the CDS a chunk at a time               */
+                DeltaCRC = 0;
+                Position = Offset;
+                while ((Position < (Offset + NumBytes)) && (Status == CFE_PSP_SUCCESS))
+                {
+                    ChunkSize = (Offset + NumBytes) - Position;
+                    if (ChunkSize > sizeof(Delta))
+                    {
+                        ChunkSize = sizeof(Delta);
+                    }
+
+                    Status = CFE_PSP_ReadFromCDS(Delta, (BlockHandle + sizeof(CFE_ES_CDSBlockDesc_t) + Position), ChunkSize);
+
+                    for (i = 0; i < ChunkSize; i++)
+                    {
+                        Delta[i] ^= NewData[Position + i];
+                    }
+
+                    DeltaCRC = CFE_ES_CalculateCRC(Delta, ChunkSize, DeltaCRC, CFE_MISSION_ES_DEFAULT_CRC);
+                    Position += ChunkSize;
+                }
+
+                if (Status != CFE_PSP_SUCCESS)
+                {
+                    CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
+                            "CFE_ES:CDSBlkWrite-Err reading from CDS (Stat=0x%08x)\n", (unsigned int)Status);
+                }
+                else
+                {
+                    CFE_ES_CDSBlockDesc.CRC = CFE_ES_CombineCRC(CFE_ES_CDSBlockDesc.CRC, DeltaCRC,
+                            CFE_ES_CDSBlockDesc.SizeUsed - (Offset + NumBytes), CFE_MISSION_ES_DEFAULT_CRC);
+
+                    /* Write the new block descriptor for the data coming from the Application */
+                    Status = CFE_PSP_WriteToCDS(&CFE_ES_CDSBlockDesc, BlockHandle, sizeof(CFE_ES_CDSBlockDesc_t));
+
+                    if (Status == CFE_PSP_SUCCESS)
+                    {
+                        /* Write only the changed range of the new data to the CDS */
+                        Status = CFE_PSP_WriteToCDS(&NewData[Offset],
+                                (BlockHandle + sizeof(CFE_ES_CDSBlockDesc_t) + Offset), NumBytes);
+
+                        if (Status != CFE_PSP_SUCCESS)
+                        {
+                            CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
+                                    "CFE_ES:CDSBlkWrite-Err writing data to CDS (Stat=0x%08x) @Offset=0x%08x\n",
+                                    (unsigned int)Status, (unsigned int)(BlockHandle + sizeof(CFE_ES_CDSBlockDesc_t) + Offset));
+                        }
+                    }
+                    else
+                    {
+                        CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
+                                "CFE_ES:CDSBlkWrite-Err writing BlockDesc to CDS (Stat=0x%08x) @Offset=0x%08x\n",
+                                (unsigned int)Status, (unsigned int)BlockHandle);
+                    }
+                }
+            }
+        }
+
+        OS_MutSemGive(CFE_ES_CDSMemPool.MutexId);
+    }
+
+    /* Do the actual syslog if something went wrong */
+    if (LogMessage[0] != 0)
+    {
+        CFE_ES_SYSLOG_APPEND(LogMessage);
+    }
+
+    return Status;
+}
+
+
 /*
 ** Function:
 **   CFE_ES_CDSBlockRead
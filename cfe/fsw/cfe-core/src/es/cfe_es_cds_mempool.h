@@ -126,6 +126,8 @@ int32 CFE_ES_PutCDSBlock(CFE_ES_CDSBlockHandle_t BlockHandle);
 
 int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSBlockHandle_t BlockHandle, void *DataToWrite);
 
+int32 CFE_ES_CDSBlockWriteRange(CFE_ES_CDSBlockHandle_t BlockHandle, const void *DataToWrite, uint32 Offset, uint32 NumBytes);
+
 int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSBlockHandle_t BlockHandle);
 
 uint32 CFE_ES_CDSReqdMinSize(uint32 MaxNumBlocksToSupport);
@@ -198,7 +198,10 @@ bool CFE_ES_RunERLogDump(uint32 ElapsedTime, void *Arg)
     CFE_ES_ERLog_MetaData_t *EntryPtr;
     uint32              FileSize;
     uint32              i;
+    uint32              Staged;
     int32   fd;
+    CFE_FS_BufferedWriter_t Writer;
+    static uint32       WriteBuffer[CFE_ES_LOG_DUMP_BUFFER_SIZE / sizeof(uint32)];
 
 
     if (!State->IsPending)
@@ -228,6 +231,9 @@ bool CFE_ES_RunERLogDump(uint32 ElapsedTime, void *Arg)
         {
             FileSize += WriteStat;
 
+            /* entries are staged and written out a buffer at a time */
+            CFE_FS_BufferedWriterInit(&Writer, fd, WriteBuffer, sizeof(WriteBuffer));
+
             /* write a single ER log entry on each pass */
             for(i=0;i<CFE_PLATFORM_ES_ER_LOG_ENTRIES;i++)
             {
@@ -269,7 +275,7 @@ bool CFE_ES_RunERLogDump(uint32 ElapsedTime, void *Arg)
                 /*
                  * Now write to file
                  */
-                WriteStat = OS_write(fd,&FileEntry,sizeof(FileEntry));
+                WriteStat = CFE_FS_BufferedWrite(&Writer,&FileEntry,sizeof(FileEntry));
 
                 if(WriteStat != sizeof(FileEntry))
                 {
@@ -281,6 +287,16 @@ bool CFE_ES_RunERLogDump(uint32 ElapsedTime, void *Arg)
 
             } /* end for */
 
+            if (i == CFE_PLATFORM_ES_ER_LOG_ENTRIES)
+            {
+                Staged = Writer.Used;
+                WriteStat = CFE_FS_BufferedWriterFlush(&Writer);
+                if (WriteStat != CFE_SUCCESS)
+                {
+                    CFE_ES_FileWriteByteCntErr(State->DataFileName,Staged,WriteStat);
+                }/* end if */
+            }/* end if */
+
         } /* end if */
 
         OS_close(fd);
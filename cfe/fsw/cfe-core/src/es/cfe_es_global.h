@@ -40,6 +40,7 @@
 #include "osapi.h"
 #include "private/cfe_private.h"
 #include "private/cfe_es_resetdata_typedef.h"
+#include "private/cfe_es_nameindex.h"
 #include "cfe_es.h"
 #include "cfe_es_apps.h"
 #include "cfe_es_cds.h"
@@ -79,6 +80,60 @@ typedef struct
     uint32 NumJobsRunning;  /**< Current Number of active jobs (updated by background task) */
 } CFE_ES_BackgroundTaskState_t;
 
+/*
+ * Async job queue entry states
+ */
+enum
+{
+    CFE_ES_ASYNC_JOB_FREE = 0,  /**< Entry is unused */
+    CFE_ES_ASYNC_JOB_PENDING,   /**< Job is queued and waiting for a worker */
+    CFE_ES_ASYNC_JOB_RUNNING    /**< Job is being run by a worker */
+};
+
+/*
+ * Storage for the copy of a job argument held in the queue
+ *
+ * The pointer and 64 bit members are never accessed, they only align the
+ * storage so job functions can use the argument in place as their own struct.
+ */
+typedef union
+{
+    uint8   Bytes[CFE_PLATFORM_ES_ASYNC_JOB_ARG_SIZE];
+    uint64  AlignU64;
+    void   *AlignPtr;
+} CFE_ES_AsyncJobArgData_t;
+
+/*
+ * An entry in the async job queue
+ */
+typedef struct
+{
+    uint32                       State;       /**< One of the CFE_ES_ASYNC_JOB_ states */
+    uint32                       AppId;       /**< App that submitted the job */
+    uint32                       Sequence;    /**< Submission order, for FIFO among equal priority */
+    uint16                       Priority;    /**< Job priority, lower number is higher priority */
+    CFE_ES_AsyncJobFuncPtr_t     JobFunc;
+    CFE_ES_AsyncJobDoneFuncPtr_t DoneFunc;
+    OS_time_t                    SubmitTime;  /**< Used to compute the job latency */
+    CFE_ES_AsyncJobArgData_t     ArgData;     /**< Copy of the job argument */
+} CFE_ES_AsyncJobEntry_t;
+
+/*
+ * Encapsulates the state of the ES async job workers
+ */
+typedef struct
+{
+    uint32 TaskID[CFE_PLATFORM_ES_ASYNC_JOB_WORKERS];  /**< OSAL IDs of the worker tasks */
+    uint32 JobSem;          /**< Counting semaphore given once for every job submitted */
+    uint32 NextSequence;    /**< Sequence number for the next job submitted */
+    uint32 QueueDepth;      /**< Number of jobs pending or running */
+    uint32 JobsCompleted;   /**< Number of jobs completed */
+    uint32 JobsRejected;    /**< Number of jobs rejected due to a full queue */
+    uint32 LastLatency;     /**< Milliseconds from submission to completion of the last job */
+    uint32 MaxLatency;      /**< Largest latency of any job */
+    CFE_ES_AsyncJobEntry_t Queue[CFE_PLATFORM_ES_ASYNC_JOB_QUEUE_DEPTH];
+} CFE_ES_AsyncJobState_t;
+
 
 /*
 ** Executive Services Global Memory Data
@@ -97,6 +152,14 @@ typedef struct
    */
    uint32 SharedDataMutex;
 
+   /*
+   ** System Log Mutex
+   ** Guards only the syslog buffer in the reset area, so that logging never
+   ** contends with lookups in the app/task tables.  It is always taken last
+   ** (nothing else is locked while holding it).
+   */
+   uint32 SysLogMutex;
+
    /*
    ** Performance Data Mutex
    */
@@ -104,8 +167,12 @@ typedef struct
 
    /*
    ** Startup Sync
+   **
+   ** The semaphore is flushed whenever the system state or the state of an
+   ** app changes during startup, waking any task waiting on a sync condition.
    */
    uint32  SystemState;
+   uint32  StartupSyncSem;
 
    /*
    ** ES Task Table
@@ -119,6 +186,7 @@ typedef struct
    uint32             RegisteredCoreApps;
    uint32             RegisteredExternalApps;
    CFE_ES_AppRecord_t AppTable[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+   CFE_ES_NameIndexSlot_t AppNameSlots[CFE_ES_NAMEINDEX_SIZE(CFE_PLATFORM_ES_MAX_APPLICATIONS)];
 
    /*
    ** ES Shared Library Table
@@ -130,6 +198,7 @@ typedef struct
    ** ES Generic Counters Table
    */
    CFE_ES_GenCounterRecord_t CounterTable[CFE_PLATFORM_ES_MAX_GEN_COUNTERS];
+   CFE_ES_NameIndexSlot_t CounterNameSlots[CFE_ES_NAMEINDEX_SIZE(CFE_PLATFORM_ES_MAX_GEN_COUNTERS)];
 
    /*
    ** Critical Data Store Management Variables
@@ -142,6 +211,11 @@ typedef struct
     */
    CFE_ES_BackgroundTaskState_t BackgroundTask;
 
+   /*
+    * Queue and workers for jobs submitted with CFE_ES_SubmitAsyncJob()
+    */
+   CFE_ES_AsyncJobState_t AsyncJob;
+
 
 } CFE_ES_Global_t;
 
@@ -150,6 +224,15 @@ typedef struct
 */
 extern CFE_ES_Global_t CFE_ES_Global;
 
+/*
+** Name indexes of the ES App Table, Generic Counter Table and CDS Registry.
+** The App Table and Generic Counter Table indexes are protected by the ES
+** shared data lock and the CDS Registry index by the CDS registry mutex.
+*/
+extern const CFE_ES_NameIndex_t CFE_ES_AppNameIndex;
+extern const CFE_ES_NameIndex_t CFE_ES_CounterNameIndex;
+extern const CFE_ES_NameIndex_t CFE_ES_CDSNameIndex;
+
 /*
 ** The Executive Services Nonvolatile Data declaration
 */
@@ -163,5 +246,21 @@ extern int32 CFE_ES_GetAppIDInternal(uint32 *AppIdPtr);
 extern void  CFE_ES_LockSharedData(const char *FunctionName, int32 LineNumber);
 extern void  CFE_ES_UnlockSharedData(const char *FunctionName, int32 LineNumber);
 
+/*
+** Generic counter lookup for callers already holding the shared data lock
+*/
+extern int32 CFE_ES_GetGenCounterIDByName_Unsync(uint32 *CounterIdPtr, const char *CounterName);
+
+/*
+** Functions used to signal/wait for startup state changes
+*/
+extern void   CFE_ES_StartupSyncSignal(void);
+extern uint32 CFE_ES_StartupSyncWait(uint32 MaxWaitMsec);
+
+/*
+** Function used to update a block CRC after a range of the block changed
+*/
+extern uint32 CFE_ES_CombineCRC(uint32 BlockCRC, uint32 DeltaCRC, uint32 TrailingLength, uint32 TypeCRC);
+
 
 #endif
@@ -92,19 +92,15 @@
  * \brief Self-synchronized macro to call CFE_ES_SysLogAppend_Unsync
  *
  * Calls CFE_ES_SysLogAppend_Unsync() with appropriate synchronization.
- * It will acquire the shared data lock and release it after appending the log.
- *
- * This is implemented as a macro such that the "__func__" and "__LINE__" directives
- * will reflect the actual place that the append was done, rather than where this
- * wrapper was defined.
+ * It will acquire the syslog lock and release it after appending the log.
  *
  * \sa CFE_ES_SysLogAppend_Unsync()
  */
 #define CFE_ES_SYSLOG_APPEND(LogString)                     \
         {                                                   \
-            CFE_ES_LockSharedData(__func__, __LINE__);      \
+            CFE_ES_LockSysLog();                            \
             CFE_ES_SysLogAppend_Unsync(LogString);          \
-            CFE_ES_UnlockSharedData(__func__, __LINE__);    \
+            CFE_ES_UnlockSysLog();                          \
         }
 
 
@@ -152,6 +148,24 @@ typedef struct
 */
 
 
+/**
+ * \brief Acquire the system log lock
+ *
+ * This is the external synchronization required by the "Unsync" syslog
+ * functions.  It is separate from the ES shared data lock and may be taken
+ * while that lock is held, but not the other way around.
+ *
+ * Before the lock has been created during ES startup this does nothing.
+ */
+void CFE_ES_LockSysLog(void);
+
+/**
+ * \brief Release the system log lock
+ *
+ * \sa CFE_ES_LockSysLog()
+ */
+void CFE_ES_UnlockSysLog(void);
+
 /**
  * \brief Clear system log
  *
@@ -186,14 +200,12 @@ void CFE_ES_SysLogReadStart_Unsync(CFE_ES_SysLogReadBuffer_t *Buffer);
 /**
  * \brief Write a printf-style formatted string to the system log
  *
- * This is a drop-in replacement for the existing CFE_ES_WriteToSysLog() API
- * that does _not_ perform any synchronization or locking.  It is intended for
- * logging from within the ES subsystem where the appropriate lock is
- * already held for other reasons.
- *
- * \note This function requires external thread synchronization
+ * This is the ES-internal equivalent of the public CFE_ES_WriteToSysLog() API.
+ * It acquires and releases the syslog lock itself, and since that lock is
+ * always the innermost one it may be called while the ES shared data lock is
+ * held.
  */
-int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...);
+int32 CFE_ES_SysLogWrite(const char *SpecStringPtr, ...);
 
 
 /**
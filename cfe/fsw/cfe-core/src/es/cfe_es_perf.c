@@ -274,6 +274,7 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
     int32               WriteStat;
     CFE_FS_Header_t     FileHdr;
     uint32              BlockSize;
+    uint32              BlockCount;
 
     /*
      * each time this background job is re-entered after a time delay,
@@ -419,6 +420,7 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
              */
             WriteStat = 0;
             BlockSize = 0;
+            BlockCount = 1;
             switch(State->CurrentState)
             {
             case CFE_ES_PerfDumpState_WRITE_FS_HDR:
@@ -440,12 +442,28 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
                 break;
 
             case CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES:
-                BlockSize = sizeof(CFE_ES_PerfDataEntry_t);
+                /*
+                 * Write as many entries as the remaining work credit allows in
+                 * one call, limited to the contiguous run before the end of
+                 * the circular buffer.  Each entry still consumes one credit.
+                 */
+                BlockCount = State->StateCounter;
+                if (BlockCount > (State->WorkCredit + 1))
+                {
+                    BlockCount = State->WorkCredit + 1;
+                }
+                if (BlockCount > (CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - State->DataPos))
+                {
+                    BlockCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - State->DataPos;
+                }
+                State->WorkCredit -= BlockCount - 1;
+
+                BlockSize = BlockCount * sizeof(CFE_ES_PerfDataEntry_t);
                 WriteStat = OS_write (State->FileDesc,
                         &Perf->DataBuffer[State->DataPos],
                         BlockSize);
 
-                ++State->DataPos;
+                State->DataPos += BlockCount;
                 if (State->DataPos >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
                 {
                     State->DataPos = 0;
@@ -474,7 +492,7 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
                 }
             }
 
-            --State->StateCounter;
+            State->StateCounter -= BlockCount;
         }
 
     }
@@ -67,6 +67,33 @@ static int32 CFE_ES_MainTaskSyncDelay(uint32 AppStateId, uint32 TimeOutMilliseco
 */
 CFE_ES_Global_t     CFE_ES_Global;
 
+const CFE_ES_NameIndex_t CFE_ES_AppNameIndex =
+{
+    .Slots = CFE_ES_Global.AppNameSlots,
+    .NumSlots = CFE_ES_NAMEINDEX_SIZE(CFE_PLATFORM_ES_MAX_APPLICATIONS),
+    .NameBase = (const char *)CFE_ES_Global.AppTable[0].StartParams.Name,
+    .NameStride = sizeof(CFE_ES_AppRecord_t),
+    .NameLength = sizeof(CFE_ES_Global.AppTable[0].StartParams.Name)
+};
+
+const CFE_ES_NameIndex_t CFE_ES_CounterNameIndex =
+{
+    .Slots = CFE_ES_Global.CounterNameSlots,
+    .NumSlots = CFE_ES_NAMEINDEX_SIZE(CFE_PLATFORM_ES_MAX_GEN_COUNTERS),
+    .NameBase = (const char *)CFE_ES_Global.CounterTable[0].CounterName,
+    .NameStride = sizeof(CFE_ES_GenCounterRecord_t),
+    .NameLength = sizeof(CFE_ES_Global.CounterTable[0].CounterName)
+};
+
+const CFE_ES_NameIndex_t CFE_ES_CDSNameIndex =
+{
+    .Slots = CFE_ES_Global.CDSVars.RegistryNameSlots,
+    .NumSlots = CFE_ES_NAMEINDEX_SIZE(CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES),
+    .NameBase = CFE_ES_Global.CDSVars.Registry[0].Name,
+    .NameStride = sizeof(CFE_ES_CDS_RegRec_t),
+    .NameLength = sizeof(CFE_ES_Global.CDSVars.Registry[0].Name)
+};
+
 /*
 ** Pointer to the Reset data that is preserved on a processor reset
 */
@@ -98,8 +125,35 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
    ReturnCode = OS_MutSemCreate(&(CFE_ES_Global.SharedDataMutex), "ES_DATA_MUTEX", 0 );
    if(ReturnCode != OS_SUCCESS)
    {
-      CFE_ES_SysLogWrite_Unsync("ES Startup: Error: ES Shared Data Mutex could not be created. RC=0x%08X\n",
-              (unsigned int)ReturnCode);
+      CFE_ES_SysLogWrite("ES Startup: Error: ES Shared Data Mutex could not be created. RC=0x%08X\n",
+                         (unsigned int)ReturnCode);
+
+      /*
+      ** Delay to allow the message to be read
+      */
+      OS_TaskDelay(CFE_ES_PANIC_DELAY);
+
+      /*
+      ** cFE Cannot continue to start up.
+      */
+      CFE_PSP_Panic(CFE_PSP_PANIC_STARTUP_SEM);
+
+      /*
+       * Normally CFE_PSP_Panic() will not return but it will under UT
+       */
+      return;
+   } /* end if */
+
+   /*
+   ** Create the ES System Log Mutex
+   ** Until this exists, syslog writes proceed without locking, which
+   ** is fine as only this task is running.
+   */
+   ReturnCode = OS_MutSemCreate(&(CFE_ES_Global.SysLogMutex), "ES_SYSLOG_MUTEX", 0 );
+   if(ReturnCode != OS_SUCCESS)
+   {
+      CFE_ES_SysLogWrite("ES Startup: Error: ES System Log Mutex could not be created. RC=0x%08X\n",
+                         (unsigned int)ReturnCode);
 
       /*
       ** Delay to allow the message to be read
@@ -138,8 +192,8 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
    ReturnCode = OS_MutSemCreate(&CFE_ES_Global.PerfDataMutex, "ES_PERF_MUTEX", 0);
    if (ReturnCode != OS_SUCCESS)
    {
-       CFE_ES_SysLogWrite_Unsync("ES Startup: Error: ES Performance Data Mutex could not be created. RC=0x%08X\n",
-               (unsigned int)ReturnCode);
+       CFE_ES_SysLogWrite("ES Startup: Error: ES Performance Data Mutex could not be created. RC=0x%08X\n",
+                          (unsigned int)ReturnCode);
 
        /*
        ** Delay to allow the message to be read
@@ -157,6 +211,19 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
        return;
    }
 
+   /*
+   ** Create the Startup Sync semaphore
+   ** Tasks waiting for a startup condition block on this, and it is flushed whenever
+   ** the system or an app changes state.  This is not fatal if it fails, the waiting
+   ** tasks will fall back to polling.
+   */
+   ReturnCode = OS_BinSemCreate(&CFE_ES_Global.StartupSyncSem, "ES_STARTUP_SYNC", 0, 0);
+   if (ReturnCode != OS_SUCCESS)
+   {
+       CFE_ES_SysLogWrite("ES Startup: Startup Sync semaphore could not be created. RC=0x%08X\n",
+                          (unsigned int)ReturnCode);
+   }
+
    /*
    ** Announce the startup
    */
@@ -180,6 +247,7 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
    {
       CFE_ES_Global.AppTable[i].AppState = CFE_ES_AppState_UNDEFINED;
    }
+   CFE_ES_NameIndexClear(&CFE_ES_AppNameIndex);
    
    /*
    ** Initialize the ES Task Table
@@ -198,12 +266,14 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
    {
       CFE_ES_Global.CounterTable[i].RecordUsed = false;
    }
+   CFE_ES_NameIndexClear(&CFE_ES_CounterNameIndex);
 
    /*
    ** Indicate that the CFE core is now starting up / going multi-threaded
    */
    CFE_ES_WriteToSysLog("ES Startup: CFE_ES_Main entering CORE_STARTUP state\n");
    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_STARTUP;
+   CFE_ES_StartupSyncSignal();
 
    /*
    ** Create the tasks, OS objects, and initialize hardware
@@ -215,6 +285,7 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
    */
    CFE_ES_WriteToSysLog("ES Startup: CFE_ES_Main entering CORE_READY state\n");
    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
+   CFE_ES_StartupSyncSignal();
 
    /*
    ** Start the cFE Applications from the disk using the file
@@ -238,6 +309,7 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
 
    CFE_ES_WriteToSysLog("ES Startup: CFE_ES_Main entering APPS_INIT state\n");
    CFE_ES_Global.SystemState = CFE_ES_SystemState_APPS_INIT;
+   CFE_ES_StartupSyncSignal();
 
    /*
     * Wait for applications to be "RUNNING" before moving to operational system state.
@@ -257,6 +329,12 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
    */
    CFE_ES_WriteToSysLog("ES Startup: CFE_ES_Main entering OPERATIONAL state\n");
    CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+   CFE_ES_StartupSyncSignal();
+
+   /*
+   ** Record where the startup time went
+   */
+   CFE_ES_ReportStartupTimeline();
 }
 
 /*
@@ -266,8 +344,9 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
 **          It will also initiate a power on reset when too many processor resets
 **           have happened.
 **
-** SYSLOGGING NOTE: Any logging in here must use CFE_ES_SysLogWrite_Unsync() as the necessary
-** primitives are not even initialized yet.  There is no chance for log contention here.
+** SYSLOGGING NOTE: Any logging in here must use CFE_ES_SysLogWrite() as the necessary
+** primitives are not even initialized yet.  The syslog lock is skipped until it has been
+** created, and there is no chance for log contention here.
 **
 */
 void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 BootSource )
@@ -364,19 +443,19 @@ void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 Bo
       */
       if ( StartSubtype == CFE_PSP_RST_SUBTYPE_POWER_CYCLE )
       {
-         CFE_ES_SysLogWrite_Unsync("POWER ON RESET due to Power Cycle (Power Cycle).\n");
+         CFE_ES_SysLogWrite("POWER ON RESET due to Power Cycle (Power Cycle).\n");
          CFE_ES_WriteToERLog(CFE_ES_LogEntryType_CORE, CFE_PSP_RST_TYPE_POWERON, StartSubtype,
                              "POWER ON RESET due to Power Cycle (Power Cycle)");
       }
       else if ( StartSubtype == CFE_PSP_RST_SUBTYPE_HW_SPECIAL_COMMAND )
       {
-         CFE_ES_SysLogWrite_Unsync("POWER ON RESET due to HW Special Cmd (Hw Spec Cmd).\n");
+         CFE_ES_SysLogWrite("POWER ON RESET due to HW Special Cmd (Hw Spec Cmd).\n");
          CFE_ES_WriteToERLog(CFE_ES_LogEntryType_CORE, CFE_PSP_RST_TYPE_POWERON, StartSubtype,
                              "POWER ON RESET due to HW Special Cmd (Hw Spec Cmd)");
       }
       else
       {
-         CFE_ES_SysLogWrite_Unsync("POWER ON RESET due to other cause (See Subtype).\n");
+         CFE_ES_SysLogWrite("POWER ON RESET due to other cause (See Subtype).\n");
          CFE_ES_WriteToERLog(CFE_ES_LogEntryType_CORE, CFE_PSP_RST_TYPE_POWERON, StartSubtype,
                              "POWER ON RESET due to other cause (See Subtype)");
       }
@@ -411,7 +490,7 @@ void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 Bo
              if ( StartSubtype == CFE_PSP_RST_SUBTYPE_HW_SPECIAL_COMMAND )
              {
                  CFE_ES_ResetDataPtr->ResetVars.ResetSubtype = CFE_PSP_RST_SUBTYPE_HW_SPECIAL_COMMAND;
-                 CFE_ES_SysLogWrite_Unsync("POWER ON RESET due to max proc resets (HW Spec Cmd).\n");
+                 CFE_ES_SysLogWrite("POWER ON RESET due to max proc resets (HW Spec Cmd).\n");
 
                  /*
                  ** Log the reset in the ER Log. The log will be wiped out, but it's good to have
@@ -423,7 +502,7 @@ void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 Bo
              else
              {
                  CFE_ES_ResetDataPtr->ResetVars.ResetSubtype = CFE_PSP_RST_SUBTYPE_HW_WATCHDOG;
-                 CFE_ES_SysLogWrite_Unsync("POWER ON RESET due to max proc resets (Watchdog).\n");
+                 CFE_ES_SysLogWrite("POWER ON RESET due to max proc resets (Watchdog).\n");
 
                  /*
                  ** Log the reset in the ER Log. The log will be wiped out, but it's good to have
@@ -440,7 +519,7 @@ void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 Bo
              /*
              ** Should not return here.
              */
-             CFE_ES_SysLogWrite_Unsync("ES Startup: Error: CFE_PSP_Restart returned.\n");
+             CFE_ES_SysLogWrite("ES Startup: Error: CFE_PSP_Restart returned.\n");
            
          }
          else /* Maximum processor reset not exceeded */
@@ -448,7 +527,7 @@ void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 Bo
              if ( StartSubtype == CFE_PSP_RST_SUBTYPE_HW_SPECIAL_COMMAND )
              {
                 CFE_ES_ResetDataPtr->ResetVars.ResetSubtype = CFE_PSP_RST_SUBTYPE_HW_SPECIAL_COMMAND;
-                CFE_ES_SysLogWrite_Unsync("PROCESSOR RESET due to Hardware Special Command (HW Spec Cmd).\n");
+                CFE_ES_SysLogWrite("PROCESSOR RESET due to Hardware Special Command (HW Spec Cmd).\n");
 
                 /*
                 ** Log the watchdog reset 
@@ -460,7 +539,7 @@ void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 Bo
              else
              {
                 CFE_ES_ResetDataPtr->ResetVars.ResetSubtype = CFE_PSP_RST_SUBTYPE_HW_WATCHDOG;
-                CFE_ES_SysLogWrite_Unsync("PROCESSOR RESET due to Watchdog (Watchdog).\n");
+                CFE_ES_SysLogWrite("PROCESSOR RESET due to Watchdog (Watchdog).\n");
 
                 /*
                 ** Log the watchdog reset 
@@ -816,6 +895,7 @@ void  CFE_ES_CreateObjects(void)
                */         
                strncpy((char *)CFE_ES_Global.AppTable[j].StartParams.Name, (char *)CFE_ES_ObjectTable[i].ObjectName, OS_MAX_API_NAME);
                CFE_ES_Global.AppTable[j].StartParams.Name[OS_MAX_API_NAME - 1] = '\0';
+               CFE_ES_NameIndexAdd(&CFE_ES_AppNameIndex, j);
                /* EntryPoint field is not valid here for base apps */
                /* FileName is not valid for base apps, either */
                CFE_ES_Global.AppTable[j].StartParams.StackSize = CFE_ES_ObjectTable[i].ObjectSize;
@@ -843,6 +923,7 @@ void  CFE_ES_CreateObjects(void)
 
                if(ReturnCode != OS_SUCCESS)
                {
+                  CFE_ES_NameIndexRemove(&CFE_ES_AppNameIndex, j);
                   CFE_ES_Global.AppTable[j].AppState = CFE_ES_AppState_UNDEFINED;
                   CFE_ES_UnlockSharedData(__func__,__LINE__);
 
@@ -869,8 +950,8 @@ void  CFE_ES_CreateObjects(void)
                   */
                   if ( CFE_ES_Global.TaskTable[TaskIndex].RecordUsed == true )
                   {
-                     CFE_ES_SysLogWrite_Unsync("ES Startup: CFE_ES_Global.TaskTable record used error for App: %s, continuing.\n",
-                                           CFE_ES_ObjectTable[i].ObjectName);
+                     CFE_ES_SysLogWrite("ES Startup: CFE_ES_Global.TaskTable record used error for App: %s, continuing.\n",
+                                        CFE_ES_ObjectTable[i].ObjectName);
                   }
                   else
                   {
@@ -881,8 +962,8 @@ void  CFE_ES_CreateObjects(void)
                   strncpy((char *)CFE_ES_Global.TaskTable[TaskIndex].TaskName, (char *)CFE_ES_Global.AppTable[j].TaskInfo.MainTaskName, OS_MAX_API_NAME);
                   CFE_ES_Global.TaskTable[TaskIndex].TaskName[OS_MAX_API_NAME - 1] = '\0';
 
-                  CFE_ES_SysLogWrite_Unsync("ES Startup: Core App: %s created. App ID: %d\n",
-                                       CFE_ES_ObjectTable[i].ObjectName,j);
+                  CFE_ES_SysLogWrite("ES Startup: Core App: %s created. App ID: %d\n",
+                                     CFE_ES_ObjectTable[i].ObjectName,j);
                                        
                   /*
                   ** Increment the registered App and Registered External Task variables.
@@ -978,7 +1059,8 @@ void  CFE_ES_CreateObjects(void)
 ** Function: CFE_ES_MainTaskSyncDelay
 **
 ** Purpose:  Waits for all of the applications that CFE has started thus far to
-**           reach the indicated state, by polling the app counters in a delay loop.
+**           reach the indicated state.  The app table is re-checked each time the
+**           startup sync semaphore is signaled, or at least once per poll interval.
 **
 */
 int32 CFE_ES_MainTaskSyncDelay(uint32 AppStateId, uint32 TimeOutMilliseconds)
@@ -1032,10 +1114,70 @@ int32 CFE_ES_MainTaskSyncDelay(uint32 AppStateId, uint32 TimeOutMilliseconds)
             break;
         }
 
-        OS_TaskDelay(WaitTime);
-        WaitRemaining -= WaitTime;
+        WaitRemaining -= CFE_ES_StartupSyncWait(WaitTime);
     }
 
     return Status;
 }
 
+/*
+** Function: CFE_ES_StartupSyncSignal
+**
+** Purpose:  Wakes up all tasks waiting in CFE_ES_StartupSyncWait(), so they
+**           re-check the startup condition they are waiting for.
+**
+*/
+void CFE_ES_StartupSyncSignal(void)
+{
+    OS_BinSemFlush(CFE_ES_Global.StartupSyncSem);
+}
+
+/*
+** Function: CFE_ES_StartupSyncWait
+**
+** Purpose:  Waits for the startup sync semaphore to be signaled, for at most
+**           the given number of milliseconds.  Returns the number of milliseconds
+**           actually spent waiting, which is at least 1 so that callers counting
+**           down a timeout always make progress.
+**
+*/
+uint32 CFE_ES_StartupSyncWait(uint32 MaxWaitMsec)
+{
+    OS_time_t StartTime;
+    OS_time_t EndTime;
+    uint32 ElapsedMsec;
+    int32 Status;
+
+    CFE_PSP_GetTime(&StartTime);
+    Status = OS_BinSemTimedWait(CFE_ES_Global.StartupSyncSem, MaxWaitMsec);
+    if (Status != OS_SUCCESS)
+    {
+        /*
+         * Either the full time elapsed, or the semaphore is not usable
+         * in which case this falls back to a plain delay.
+         */
+        if (Status != OS_SEM_TIMEOUT)
+        {
+            OS_TaskDelay(MaxWaitMsec);
+        }
+        return MaxWaitMsec;
+    }
+
+    CFE_PSP_GetTime(&EndTime);
+    ElapsedMsec = 1000 * (EndTime.seconds - StartTime.seconds);
+    ElapsedMsec += EndTime.microsecs / 1000;
+    ElapsedMsec -= StartTime.microsecs / 1000;
+
+    if (ElapsedMsec > MaxWaitMsec)
+    {
+        /* the clock was adjusted while waiting */
+        ElapsedMsec = MaxWaitMsec;
+    }
+    else if (ElapsedMsec == 0)
+    {
+        ElapsedMsec = 1;
+    }
+
+    return ElapsedMsec;
+}
+
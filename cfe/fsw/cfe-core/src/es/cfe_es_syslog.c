@@ -43,9 +43,12 @@
 **     to call B_Unsync() while A_Unsync() is executing or vice-versa.  The external
 **     lock must wait until A_Unsync() finishes before calling B_Unsync().
 **
-**     The expectation is that the required level of synchronization can be achieved
-**     using the existing ES shared data lock.  However, if it becomes necessary, this
-**     could be replaced with a finer grained syslog-specific lock.
+**     The required synchronization is provided by the syslog-specific lock,
+**     CFE_ES_LockSysLog().  This is deliberately separate from the ES shared data
+**     lock so that applications writing to the syslog do not contend with the
+**     app and task table lookups done throughout the system.  The syslog lock is
+**     always the innermost lock; it may be taken while holding the shared data
+**     lock, but nothing else may be locked while holding it.
 */
 
 /*
@@ -79,6 +82,51 @@
  *******************************************************************/
 
 
+/*
+ * -----------------------------------------------------------------
+ * CFE_ES_LockSysLog() --
+ * Acquire the syslog-specific lock
+ * -----------------------------------------------------------------
+ */
+void CFE_ES_LockSysLog(void)
+{
+    int32 Status;
+
+    /*
+     * Early in startup the mutex does not exist yet, and only the
+     * ES main task is running, so there is nothing to lock against.
+     */
+    if (CFE_ES_Global.SysLogMutex != 0)
+    {
+        Status = OS_MutSemTake(CFE_ES_Global.SysLogMutex);
+        if (Status != OS_SUCCESS)
+        {
+            /* Cannot report this in the syslog itself */
+            OS_printf("ES SysLog Mutex Take Err Stat=0x%x\n", (unsigned int)Status);
+        }
+    }
+} /* End of CFE_ES_LockSysLog() */
+
+/*
+ * -----------------------------------------------------------------
+ * CFE_ES_UnlockSysLog() --
+ * Release the syslog-specific lock
+ * -----------------------------------------------------------------
+ */
+void CFE_ES_UnlockSysLog(void)
+{
+    int32 Status;
+
+    if (CFE_ES_Global.SysLogMutex != 0)
+    {
+        Status = OS_MutSemGive(CFE_ES_Global.SysLogMutex);
+        if (Status != OS_SUCCESS)
+        {
+            OS_printf("ES SysLog Mutex Give Err Stat=0x%x\n", (unsigned int)Status);
+        }
+    }
+} /* End of CFE_ES_UnlockSysLog() */
+
 /*
  * -----------------------------------------------------------------
  * CFE_ES_SysLogClear --
@@ -256,17 +304,30 @@ int32 CFE_ES_SysLogAppend_Unsync(const char *LogString)
     return (ReturnCode);
 } /* End of CFE_ES_SysLogAppend_Unsync() */
 
+
+
+/*******************************************************************
+ *
+ * Additional helper functions
+ *
+ * These functions either perform all necessary synchronization internally,
+ * or they have no specific synchronization requirements
+ *
+ *******************************************************************/
+
+
 /*
  * -----------------------------------------------------------------
- * CFE_ES_SysLogWrite_Unsync() --
- * Identical to the public CFE_ES_WriteToSysLog() function, except
- * that it operates in an unsynchronized manner.  It can be used in
- * cases where the appropriate lock is already held for other reasons
+ * CFE_ES_SysLogWrite() --
+ * Write a formatted message to the syslog, taking the syslog lock.
+ * Used within ES in place of the public CFE_ES_WriteToSysLog(),
+ * including while the ES shared data lock is held.
  * -----------------------------------------------------------------
  */
-int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...)
+int32 CFE_ES_SysLogWrite(const char *SpecStringPtr, ...)
 {
     char          TmpString[CFE_ES_MAX_SYSLOG_MSG_SIZE];
+    int32         ReturnCode;
     va_list       ArgPtr;
 
     va_start(ArgPtr, SpecStringPtr);
@@ -279,19 +340,12 @@ int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...)
     /*
      * Append to the syslog buffer
      */
-    return CFE_ES_SysLogAppend_Unsync(TmpString);
-} /* End of CFE_ES_SysLogWrite_Unsync() */
-
-
-/*******************************************************************
- *
- * Additional helper functions
- *
- * These functions either perform all necessary synchronization internally,
- * or they have no specific synchronization requirements
- *
- *******************************************************************/
+    CFE_ES_LockSysLog();
+    ReturnCode = CFE_ES_SysLogAppend_Unsync(TmpString);
+    CFE_ES_UnlockSysLog();
 
+    return ReturnCode;
+} /* End of CFE_ES_SysLogWrite() */
 
 /*
  * -----------------------------------------------------------------
@@ -502,10 +556,10 @@ int32 CFE_ES_SysLogDump(const char *Filename)
          * data while locked - ensuring that nothing additional can be written
          * into the syslog buffer while getting the first block of log data.
          */
-        CFE_ES_LockSharedData(__func__, __LINE__);
+        CFE_ES_LockSysLog();
         CFE_ES_SysLogReadStart_Unsync(&Buffer.LogData);
         CFE_ES_SysLogReadData(&Buffer.LogData);
-        CFE_ES_UnlockSharedData(__func__,__LINE__);
+        CFE_ES_UnlockSysLog();
 
         while (Buffer.LogData.BlockSize > 0)
         {
@@ -108,6 +108,7 @@ static const CFE_ES_Application_Component_Telecommand_DispatchTable_t CFE_ES_TC_
                 .DeleteCDS_indication = CFE_ES_DeleteCDSCmd,
                 .SendMemPoolStats_indication = CFE_ES_SendMemPoolStatsCmd,
                 .DumpCDSRegistry_indication = CFE_ES_DumpCDSRegistryCmd,
+                .SetAppCpuAffinity_indication = CFE_ES_SetAppCpuAffinityCmd,
         },
         .SEND_HK =
         {
@@ -482,6 +483,17 @@ int32 CFE_ES_TaskInit(void)
        return(Status);
     }
 
+    /*
+     * Initialize the async job workers, which run long file operations
+     * and similar jobs on behalf of the core services and apps.
+     */
+    Status = CFE_ES_AsyncJobInit();
+    if ( Status != CFE_SUCCESS )
+    {
+       CFE_ES_WriteToSysLog("ES:Error initializing async job workers:RC=0x%08X\n", (unsigned int)Status);
+       return(Status);
+    }
+
    return(CFE_SUCCESS);
 
 } /* End of CFE_ES_TaskInit() */
@@ -623,6 +635,12 @@ int32 CFE_ES_HousekeepingCmd(const CFE_ES_SendHkCommand_t *data)
         CFE_ES_TaskData.HkPacket.Payload.HeapMaxBlockSize = 0;
     }
 
+    CFE_ES_TaskData.HkPacket.Payload.AsyncJobQueueDepth = CFE_ES_Global.AsyncJob.QueueDepth;
+    CFE_ES_TaskData.HkPacket.Payload.AsyncJobsCompleted = CFE_ES_Global.AsyncJob.JobsCompleted;
+    CFE_ES_TaskData.HkPacket.Payload.AsyncJobsRejected = CFE_ES_Global.AsyncJob.JobsRejected;
+    CFE_ES_TaskData.HkPacket.Payload.AsyncJobLastLatency = CFE_ES_Global.AsyncJob.LastLatency;
+    CFE_ES_TaskData.HkPacket.Payload.AsyncJobMaxLatency = CFE_ES_Global.AsyncJob.MaxLatency;
+
     /*
     ** Send housekeeping telemetry packet.
     */
@@ -985,6 +1003,46 @@ int32 CFE_ES_RestartAppCmd(const CFE_ES_RestartApp_t *data)
     return CFE_SUCCESS;
 } /* End of CFE_ES_ResetAppCmd() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_ES_SetAppCpuAffinityCmd() -- Set CPU affinity of an app     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 CFE_ES_SetAppCpuAffinityCmd(const CFE_ES_SetAppCpuAffinity_t *data)
+{
+    const CFE_ES_SetAppCpuAffinityCmd_Payload_t *cmd = &data->Payload;
+    char LocalApp[OS_MAX_API_NAME];
+    uint32 AppID;
+    int32 Result;
+
+    CFE_SB_MessageStringGet(LocalApp, (char *)cmd->Application, NULL, OS_MAX_API_NAME, sizeof(cmd->Application));
+
+    Result = CFE_ES_GetAppIDByName(&AppID, LocalApp);
+
+    if (Result == CFE_SUCCESS)
+    {
+        Result = CFE_ES_SetAppCpuAffinity(AppID, cmd->CpuMask);
+    }
+
+    if (Result == CFE_SUCCESS)
+    {
+        CFE_ES_TaskData.CommandCounter++;
+        CFE_EVS_SendEvent(CFE_ES_SET_AFFINITY_INF_EID, CFE_EVS_EventType_INFORMATION,
+                "Set CPU affinity of application %s to 0x%08X",
+                LocalApp, (unsigned int)cmd->CpuMask);
+    }
+    else
+    {
+        CFE_ES_TaskData.CommandErrorCounter++;
+        CFE_EVS_SendEvent(CFE_ES_SET_AFFINITY_ERR_EID, CFE_EVS_EventType_ERROR,
+                "Set CPU affinity of application %s Failed, RC = 0x%08X",
+                LocalApp, (unsigned int)Result);
+    }
+
+    return CFE_SUCCESS;
+} /* End of CFE_ES_SetAppCpuAffinityCmd() */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* CFE_ES_ReloadAppCmd() -- Reload a single application            */
@@ -1356,9 +1414,9 @@ int32 CFE_ES_ClearSyslogCmd(const CFE_ES_ClearSyslog_t *data)
     ** Clear syslog index and memory area
     */
 
-    CFE_ES_LockSharedData(__func__,__LINE__);
+    CFE_ES_LockSysLog();
     CFE_ES_SysLogClear_Unsync();
-    CFE_ES_UnlockSharedData(__func__,__LINE__);
+    CFE_ES_UnlockSysLog();
 
     /*
     ** This command will always succeed...
@@ -56,6 +56,12 @@
 #define CFE_ES_ER_LOG_DESC     "ES ERlog data file"
 #define CFE_ES_PERF_LOG_DESC   "ES Performance data file"
 
+/*
+** Size of the buffer used to stage log file records so that they
+** reach the file in a few large writes
+*/
+#define CFE_ES_LOG_DUMP_BUFFER_SIZE     4096
+
 /*************************************************************************/
 /*
 ** Type definitions
@@ -172,6 +178,16 @@ void  CFE_ES_BackgroundTask(void);
 void  CFE_ES_BackgroundWakeup(void);
 void  CFE_ES_BackgroundCleanup(void);
 
+/*
+ * Functions related to the ES async job workers
+ */
+int32 CFE_ES_AsyncJobInit(void);
+void  CFE_ES_AsyncJobWorker(void);
+bool  CFE_ES_AsyncJobRunNext(void);
+void  CFE_ES_AsyncJobCleanup(void);
+void  CFE_ES_AsyncJobCancelApp_Unsync(uint32 AppId);
+bool  CFE_ES_AsyncJobWaitApp(uint32 AppId);
+
 /*
 ** ES Task message dispatch functions
 */
@@ -189,6 +205,7 @@ int32 CFE_ES_ReloadAppCmd(const CFE_ES_ReloadApp_t *data);
 int32 CFE_ES_QueryOneCmd(const CFE_ES_QueryOne_t *data);
 int32 CFE_ES_QueryAllCmd(const CFE_ES_QueryAll_t *data);
 int32 CFE_ES_QueryAllTasksCmd(const CFE_ES_QueryAllTasks_t *data);
+int32 CFE_ES_SetAppCpuAffinityCmd(const CFE_ES_SetAppCpuAffinity_t *data);
 int32 CFE_ES_ClearSyslogCmd(const CFE_ES_ClearSyslog_t *data);
 int32 CFE_ES_OverWriteSyslogCmd(const CFE_ES_OverWriteSyslog_t *data);
 int32 CFE_ES_WriteSyslogCmd(const CFE_ES_WriteSyslog_t *data);
@@ -343,6 +343,27 @@
     #error CFE_PLATFORM_ES_START_TASK_STACK_SIZE must be greater than or equal to 2048
 #endif
 
+/*
+** Validate async job engine configuration
+*/
+#if CFE_PLATFORM_ES_ASYNC_JOB_QUEUE_DEPTH < 1
+    #error CFE_PLATFORM_ES_ASYNC_JOB_QUEUE_DEPTH cannot be less than 1!
+#endif
+#if CFE_PLATFORM_ES_ASYNC_JOB_WORKERS < 1
+    #error CFE_PLATFORM_ES_ASYNC_JOB_WORKERS cannot be less than 1!
+#elif CFE_PLATFORM_ES_ASYNC_JOB_WORKERS > 8
+    #error CFE_PLATFORM_ES_ASYNC_JOB_WORKERS cannot be greater than 8!
+#endif
+#if CFE_PLATFORM_ES_ASYNC_JOB_ARG_SIZE < (OS_MAX_PATH_LEN + 16)
+    #error CFE_PLATFORM_ES_ASYNC_JOB_ARG_SIZE cannot be less than OS_MAX_PATH_LEN + 16!
+#endif
+#if ((CFE_PLATFORM_ES_ASYNC_JOB_ARG_SIZE % 4) != 0)
+    #error CFE_PLATFORM_ES_ASYNC_JOB_ARG_SIZE must be a multiple of 4
+#endif
+#if CFE_PLATFORM_ES_ASYNC_JOB_STACK_SIZE < 2048
+    #error CFE_PLATFORM_ES_ASYNC_JOB_STACK_SIZE must be greater than or equal to 2048
+#endif
+
 
 #if ((CFE_MISSION_MAX_API_LEN % 4) != 0)
     #error CFE_MISSION_MAX_API_LEN must be a multiple of 4
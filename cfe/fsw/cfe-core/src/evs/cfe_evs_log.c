@@ -156,6 +156,8 @@ int32 CFE_EVS_WriteLogDataFileCmd(const CFE_EVS_WriteLogDataFile_t *data)
     int32           BytesWritten;
     int32           LogFileHandle;
     uint32          i;
+    uint32          BlockCount;
+    uint32          BlockSize;
     CFE_FS_Header_t LogFileHdr;
     char            LogFilename[OS_MAX_PATH_LEN];
 
@@ -210,16 +212,28 @@ int32 CFE_EVS_WriteLogDataFileCmd(const CFE_EVS_WriteLogDataFile_t *data)
                     LogIndex = 0;
                 }
 
-                /* Write all the "in-use" event log entries to the file */
-                for (i = 0; i < CFE_EVS_GlobalData.EVS_LogPtr->LogCount; i++)
+                /*
+                 * Write all the "in-use" event log entries to the file.  The
+                 * entries are contiguous up to the end of the log array, so
+                 * this takes at most two writes.
+                 */
+                i = 0;
+                while (i < CFE_EVS_GlobalData.EVS_LogPtr->LogCount)
                 {
+                    BlockCount = CFE_EVS_GlobalData.EVS_LogPtr->LogCount - i;
+                    if (BlockCount > (CFE_PLATFORM_EVS_LOG_MAX - LogIndex))
+                    {
+                        BlockCount = CFE_PLATFORM_EVS_LOG_MAX - LogIndex;
+                    }
+
+                    BlockSize = BlockCount * sizeof(CFE_EVS_GlobalData.EVS_LogPtr->LogEntry[0]);
                     BytesWritten = OS_write(LogFileHandle,
-                            &CFE_EVS_GlobalData.EVS_LogPtr->LogEntry[LogIndex],
-                            sizeof(CFE_EVS_GlobalData.EVS_LogPtr->LogEntry[LogIndex]));
+                            &CFE_EVS_GlobalData.EVS_LogPtr->LogEntry[LogIndex], BlockSize);
 
-                    if (BytesWritten == sizeof(CFE_EVS_GlobalData.EVS_LogPtr->LogEntry[LogIndex]))
+                    if (BytesWritten == BlockSize)
                     {
-                        LogIndex++;
+                        i += BlockCount;
+                        LogIndex += BlockCount;
 
                         if (LogIndex >= CFE_PLATFORM_EVS_LOG_MAX)
                         {
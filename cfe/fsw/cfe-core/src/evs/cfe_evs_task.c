@@ -1548,6 +1548,8 @@ int32 CFE_EVS_WriteAppDataFileCmd(const CFE_EVS_WriteAppDataFile_t *data)
    uint32                            EntryCount = 0;
    uint32                            i;
    static CFE_EVS_AppDataFile_t      AppDataFile;
+   static uint32                     WriteBuffer[CFE_EVS_FILE_WRITE_BUFFER_SIZE / sizeof(uint32)];
+   CFE_FS_BufferedWriter_t           Writer;
    CFE_FS_Header_t                   FileHdr;
    EVS_AppData_t                    *AppDataPtr;
    const CFE_EVS_AppDataCmd_Payload_t *CmdPtr = &data->Payload;
@@ -1581,6 +1583,9 @@ int32 CFE_EVS_WriteAppDataFileCmd(const CFE_EVS_WriteAppDataFile_t *data)
 
       if (BytesWritten == sizeof(CFE_FS_Header_t))
       {
+         /* Records are staged and reach the file in as few writes as possible */
+         CFE_FS_BufferedWriterInit(&Writer, FileHandle, WriteBuffer, sizeof(WriteBuffer));
+
          for (i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; i++)
          {
             /* Only have data for apps that are registered */
@@ -1602,7 +1607,7 @@ int32 CFE_EVS_WriteAppDataFileCmd(const CFE_EVS_WriteAppDataFile_t *data)
                               CFE_PLATFORM_EVS_MAX_EVENT_FILTERS * sizeof(EVS_BinFilter_t));
 
                /* Write application data record to file */
-               BytesWritten = OS_write(FileHandle, &AppDataFile, sizeof(CFE_EVS_AppDataFile_t));
+               BytesWritten = CFE_FS_BufferedWrite(&Writer, &AppDataFile, sizeof(CFE_EVS_AppDataFile_t));
 
                if (BytesWritten == sizeof(CFE_EVS_AppDataFile_t))
                {
@@ -1621,10 +1626,21 @@ int32 CFE_EVS_WriteAppDataFileCmd(const CFE_EVS_WriteAppDataFile_t *data)
          /* Process command handler success result */
          if (i == CFE_PLATFORM_ES_MAX_APPLICATIONS)
          {
-            EVS_SendEvent(CFE_EVS_WRDAT_EID, CFE_EVS_EventType_DEBUG,
-                         "Write App Data Command: %d application data entries written to %s",
-                          (int)EntryCount, LocalName);
-            Result = CFE_SUCCESS;
+            BytesWritten = CFE_FS_BufferedWriterFlush(&Writer);
+
+            if (BytesWritten == CFE_SUCCESS)
+            {
+               EVS_SendEvent(CFE_EVS_WRDAT_EID, CFE_EVS_EventType_DEBUG,
+                            "Write App Data Command: %d application data entries written to %s",
+                             (int)EntryCount, LocalName);
+               Result = CFE_SUCCESS;
+            }
+            else
+            {
+               EVS_SendEvent(CFE_EVS_ERR_WRDATFILE_EID, CFE_EVS_EventType_ERROR,
+                            "Write App Data Command Error: OS_write = 0x%08X, filename = %s",
+                             (unsigned int)BytesWritten, LocalName);
+            }
          }
       }
 
@@ -64,6 +64,7 @@
 #define CFE_EVS_MAX_FILTER_COUNT        65535
 #define CFE_EVS_PIPE_NAME               "EVS_CMD_PIPE"
 #define CFE_EVS_UNDEF_APPID             0xFFFFFFFF
+#define CFE_EVS_FILE_WRITE_BUFFER_SIZE  4096    /* staging buffer for EVS data file records */
 #define CFE_EVS_MAX_PORT_MSG_LENGTH     (CFE_MISSION_EVS_MAX_MESSAGE_LENGTH+OS_MAX_API_NAME+30)
 
 /* Since CFE_EVS_MAX_PORT_MSG_LENGTH is the size of the buffer that is sent to 
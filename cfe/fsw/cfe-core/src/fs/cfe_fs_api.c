@@ -109,6 +109,19 @@ void CFE_FS_InitHeader(CFE_FS_Header_t *Hdr, const char *Description, uint32 Sub
 ** CFE_FS_WriteHeader() - See API and header file for details
 */
 int32 CFE_FS_WriteHeader(int32 FileDes, CFE_FS_Header_t *Hdr)
+{
+    uint32 AppId;
+
+    CFE_ES_GetAppID(&AppId);
+
+    return CFE_FS_WriteHeaderWithAppID(FileDes, Hdr, AppId);
+
+} /* End of CFE_FS_WriteHeader() */
+
+/*
+** CFE_FS_WriteHeaderWithAppID() - See API and header file for details
+*/
+int32 CFE_FS_WriteHeaderWithAppID(int32 FileDes, CFE_FS_Header_t *Hdr, uint32 AppId)
 {
     CFE_TIME_SysTime_t Time;
     int32   Result;
@@ -133,7 +146,7 @@ int32 CFE_FS_WriteHeader(int32 FileDes, CFE_FS_Header_t *Hdr)
         */
         Hdr->SpacecraftID  = CFE_PSP_GetSpacecraftId();
         Hdr->ProcessorID   = CFE_PSP_GetProcessorId();
-        CFE_ES_GetAppID(&Hdr->ApplicationID);
+        Hdr->ApplicationID = AppId;
 
         /* Fill in length field */
 
@@ -177,7 +190,7 @@ int32 CFE_FS_WriteHeader(int32 FileDes, CFE_FS_Header_t *Hdr)
 
     return(Result);
 
-} /* End of CFE_FS_WriteHeader() */
+} /* End of CFE_FS_WriteHeaderWithAppID() */
 
 /*
 ** CFE_FS_SetTimestamp - See API and header file for details
@@ -238,6 +251,103 @@ int32 CFE_FS_SetTimestamp(int32 FileDes, CFE_TIME_SysTime_t NewTimestamp)
     return(Result);
 } /* End of CFE_FS_SetTimestamp() */
 
+
+/*
+** CFE_FS_BufferedWriterInit() - See API and header file for details
+*/
+void CFE_FS_BufferedWriterInit(CFE_FS_BufferedWriter_t *Writer, int32 FileDes, void *Buffer, uint32 BufferSize)
+{
+    memset(Writer, 0, sizeof(*Writer));
+    Writer->FileDes = FileDes;
+    Writer->Status = CFE_SUCCESS;
+
+    if (Buffer != NULL)
+    {
+        Writer->Buffer = Buffer;
+        Writer->BufferSize = BufferSize;
+    }
+
+} /* End of CFE_FS_BufferedWriterInit() */
+
+/*
+** CFE_FS_BufferedWriterSpace() - See API and header file for details
+*/
+uint32 CFE_FS_BufferedWriterSpace(const CFE_FS_BufferedWriter_t *Writer)
+{
+    return (Writer->BufferSize - Writer->Used);
+
+} /* End of CFE_FS_BufferedWriterSpace() */
+
+/*
+** CFE_FS_BufferedWriterFlush() - See API and header file for details
+*/
+int32 CFE_FS_BufferedWriterFlush(CFE_FS_BufferedWriter_t *Writer)
+{
+    int32 Result;
+
+    if (Writer->Status == CFE_SUCCESS && Writer->Used > 0)
+    {
+        Result = OS_write(Writer->FileDes, Writer->Buffer, Writer->Used);
+        if (Result < 0)
+        {
+            Writer->Status = Result;
+        }
+        else if (Result != Writer->Used)
+        {
+            Writer->Status = CFE_FS_SHORT_WRITE;
+        }
+
+        Writer->Used = 0;
+    }
+
+    return Writer->Status;
+
+} /* End of CFE_FS_BufferedWriterFlush() */
+
+/*
+** CFE_FS_BufferedWrite() - See API and header file for details
+*/
+int32 CFE_FS_BufferedWrite(CFE_FS_BufferedWriter_t *Writer, const void *Data, uint32 Size)
+{
+    int32 Result;
+
+    if (Size > (Writer->BufferSize - Writer->Used))
+    {
+        CFE_FS_BufferedWriterFlush(Writer);
+    }
+
+    if (Writer->Status != CFE_SUCCESS)
+    {
+        return Writer->Status;
+    }
+
+    if (Size >= Writer->BufferSize)
+    {
+        /* Too large to stage, the buffer is empty at this point so order is kept */
+        Result = OS_write(Writer->FileDes, Data, Size);
+        if (Result < 0)
+        {
+            Writer->Status = Result;
+            return Result;
+        }
+        if (Result != Size)
+        {
+            Writer->Status = CFE_FS_SHORT_WRITE;
+            return CFE_FS_SHORT_WRITE;
+        }
+    }
+    else
+    {
+        memcpy(&Writer->Buffer[Writer->Used], Data, Size);
+        Writer->Used += Size;
+    }
+
+    Writer->TotalBytes += Size;
+
+    return Size;
+
+} /* End of CFE_FS_BufferedWrite() */
+
 /*
 ** CFE_FS_ExtractFilenameFromPath - See API and header file for details
 */
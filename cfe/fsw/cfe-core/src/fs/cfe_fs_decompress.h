@@ -57,8 +57,12 @@
 #define DUMPBITS(n) { b>>=(n); k-=(n); }
 #define NEEDBITS(n) {								\
 	while(  k < (n)  )	{								\
-		b |= ( (uint32)NEXTBYTE() ) << k;				\
-		if ( State->Error != CFE_SUCCESS ) return State->Error;	\
+		if ( State->inptr < State->insize ) {			\
+			b |= ( (uint32)State->inbuf[State->inptr++] ) << k;	\
+		} else {									\
+			b |= ( (uint32)FS_gz_fill_inbuf_Reentrant(State) ) << k;	\
+			if ( State->Error != CFE_SUCCESS ) return State->Error;	\
+		}										\
 		k += 8;									\
 	}											\
 }
@@ -127,13 +131,17 @@ typedef struct
 
    HufTable   hufTable[ MAX_HUF_TABLES ];
 
+   uint32     crc;                       /* CRC-32 shift register contents       */
+   uint32     crc_slice[ 3 ][ 256 ];     /* tables for bytes 2-4 of a 4-byte step */
+
 } CFE_FS_Decompress_State_t;
 
 
 /*
 ** Function Prototypes
 */
-uint32 FS_gz_updcrc( uint8 * s, uint32 n );
+void   FS_gz_init_crc_Reentrant( CFE_FS_Decompress_State_t *State );
+uint32 FS_gz_updcrc_Reentrant( CFE_FS_Decompress_State_t *State, const uint8 * s, uint32 n );
 /*
  * Reentrant versions of all gz functions
  */
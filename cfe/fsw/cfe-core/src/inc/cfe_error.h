@@ -633,6 +633,15 @@
  */
 #define CFE_ES_ERR_SYS_LOG_TRUNCATED  ((int32)0x44000028)
 
+/**
+ * @brief Async Job Queue Full
+ *
+ *  Occurs if CFE_ES_SubmitAsyncJob is called while every
+ *  slot in the ES async job queue is already occupied.
+ *
+ */
+#define CFE_ES_ASYNC_JOB_QUEUE_FULL  ((int32)0xc4000029)
+
 /**
  * @brief Not Implemented
  *
@@ -674,6 +683,15 @@
  */
 #define CFE_FS_FNAME_TOO_LONG           ((int32)0xc6000003)
 
+/**
+ * @brief Short Write
+ *
+ *  FS wrote fewer bytes to a file than were requested, typically
+ *  because the underlying volume is full
+ *
+ */
+#define CFE_FS_SHORT_WRITE              ((int32)0xc6000010)
+
 #ifndef CFE_OMIT_DEPRECATED_6_7
 /**
  * @brief DEPRECATED: GZIP File Bad Data
@@ -1447,6 +1465,18 @@
 */
 #define CFE_TBL_ERR_ACCESS              ((int32)0xcc00002c)
 
+/**
+**  Error code indicating that a packed TBL image file has an
+**  unknown format or a damaged block record.
+*/
+#define CFE_TBL_ERR_BAD_PACKED_IMAGE    ((int32)0xcc00002d)
+
+/**
+**  Error code indicating that a delta TBL image file was made
+**  against different table contents than those now active.
+*/
+#define CFE_TBL_ERR_REFERENCE_MISMATCH  ((int32)0xcc00002e)
+
 
 /**
  * @brief Not Implemented
@@ -236,6 +236,12 @@ typedef struct
 typedef void (*CFE_ES_ChildTaskMainFuncPtr_t)(void); /**< \brief Required Prototype of Child Task Main Functions */
 typedef int32 (*CFE_ES_LibraryEntryFuncPtr_t)(uint32 LibId); /**< \brief Required Prototype of Library Initialization Functions */
 
+/*
+** Async Job Function Prototypes
+*/
+typedef int32 (*CFE_ES_AsyncJobFuncPtr_t)(void *JobArg); /**< \brief Required Prototype of Async Job Functions */
+typedef void (*CFE_ES_AsyncJobDoneFuncPtr_t)(void *JobArg, int32 Status); /**< \brief Required Prototype of Async Job Completion Functions */
+
 /**
  * \brief Pool Alignement
  *
@@ -830,6 +836,60 @@ int32 CFE_ES_DeleteChildTask(uint32 TaskId);
 void CFE_ES_ExitChildTask(void);
 /**@}*/
 
+/** @defgroup CFEAPIESAsyncJob cFE Async Job APIs
+ * @{
+ */
+
+/*****************************************************************************/
+/**
+** \brief Queues a job to be run by the ES async job workers
+**
+** \par Description
+**        This routine queues a long running operation, such as writing a
+**        file or computing a CRC over a large region, to be run by one of
+**        the ES async job worker tasks rather than in the calling task.
+**        This keeps the command pipe of the calling task serviced while
+**        the operation is in progress.
+**
+**        Jobs are started in priority order, and in submission order among
+**        jobs of equal priority.  When the job function returns, the
+**        completion function (if any) is called with the job argument and
+**        the status that the job function returned.
+**
+** \par Assumptions, External Events, and Notes:
+**        The job argument is copied into the queue, so the caller does not
+**        need to keep it valid after this call returns.  The job and completion
+**        functions are given a pointer to the queued copy, which is only valid
+**        until the completion function returns.  The copy is aligned for
+**        64 bit integer and pointer members, so it can be used in place as
+**        the caller's argument struct.
+**
+**        Both functions run in the context of an ES worker task.  Events sent
+**        from them should use #CFE_EVS_SendEventWithAppID with the ID of the
+**        submitting application, so they are attributed to it.
+**
+** \param[in]   JobFunc       The function that performs the job.
+**
+** \param[in]   DoneFunc      The function to call when the job has completed, may be NULL.
+**
+** \param[in]   JobArg        A pointer to the argument data for the job, may be NULL if ArgSize is 0.
+**
+** \param[in]   ArgSize       The size of the argument data.  This may be up to
+**                            #CFE_PLATFORM_ES_ASYNC_JOB_ARG_SIZE bytes.
+**
+** \param[in]   Priority      The priority of the job.  Lower numbers are higher priority,
+**                            with 0 being the highest priority.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                  \copybrief CFE_SUCCESS
+** \retval #CFE_ES_BAD_ARGUMENT          \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_ES_ASYNC_JOB_QUEUE_FULL  \copybrief CFE_ES_ASYNC_JOB_QUEUE_FULL
+**
+******************************************************************************/
+int32 CFE_ES_SubmitAsyncJob(CFE_ES_AsyncJobFuncPtr_t JobFunc, CFE_ES_AsyncJobDoneFuncPtr_t DoneFunc,
+                            const void *JobArg, uint32 ArgSize, uint16 Priority);
+/**@}*/
+
 /** @defgroup CFEAPIESMisc cFE Miscellaneous APIs
  * @{
  */
@@ -887,6 +947,42 @@ int32 CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1,2);
 ******************************************************************************/
 uint32 CFE_ES_CalculateCRC(const void *DataPtr, uint32 DataLength, uint32 InputCRC, uint32 TypeCRC);
 
+/*****************************************************************************/
+/**
+** \brief Recalculate a CRC after a range of a block of memory has changed
+**
+** \par Description
+**        This routine returns the CRC a block of memory would have after one range of it
+**        is changed from \c OldDataPtr to \c NewDataPtr, given the CRC of the whole block
+**        before the change.  Only the changed range is read, so the cost depends on the
+**        size of the change rather than the size of the block.
+**
+** \par Assumptions, External Events, and Notes:
+**        The result matches #CFE_ES_CalculateCRC over the whole updated block only if
+**        \c InputCRC was the CRC of the whole block with the same contents as \c OldDataPtr
+**        in the range.
+**
+** \param[in]   OldDataPtr      Pointer to the contents of the range before the change.
+**
+** \param[in]   NewDataPtr      Pointer to the contents of the range after the change.
+**
+** \param[in]   DataLength      The number of bytes in the range.
+**
+** \param[in]   TrailingLength  The number of bytes in the block after the end of the range.
+**
+** \param[in]   InputCRC        The CRC of the whole block before the change.
+**
+** \param[in]   TypeCRC         One of the CRC algorithm selections of #CFE_ES_CalculateCRC.
+**                              Only \c CFE_MISSION_ES_CRC_16 is currently implemented.
+**
+** \return The CRC of the whole block after the change
+**
+** \sa #CFE_ES_CalculateCRC
+**
+******************************************************************************/
+uint32 CFE_ES_RecalculateCRC(const void *OldDataPtr, const void *NewDataPtr, uint32 DataLength,
+                             uint32 TrailingLength, uint32 InputCRC, uint32 TypeCRC);
+
 /*****************************************************************************/
 /**
 ** \ingroup CFEAPIESMisc
@@ -970,6 +1066,39 @@ int32 CFE_ES_RegisterCDS(CFE_ES_CDSHandle_t *HandlePtr, int32 BlockSize, const c
 */
 int32 CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, void *DataToCopy);
 
+/*****************************************************************************/
+/**
+** \brief Save a range of a block of data in the Critical Data Store (CDS)
+**
+** \par Description
+**        This routine copies only the bytes from \c Offset to \c Offset + \c NumBytes of
+**        the specified block of memory into the Critical Data Store.  The rest of the CDS is
+**        left as it is, and its data integrity check is updated from the old and new contents
+**        of the range rather than recomputed over the whole block.
+**
+** \par Assumptions, External Events, and Notes:
+**        Use this when the CDS already holds the rest of the block, for example after a
+**        #CFE_ES_CopyToCDS of an earlier version that differs only in the range.
+**
+** \param[in]   Handle       The handle of the CDS block that was previously obtained from #CFE_ES_RegisterCDS.
+**
+** \param[in]   DataToCopy   A Pointer to the start of the block of memory, not of the range.
+**
+** \param[in]   Offset       Offset, in bytes, of the start of the range.
+**
+** \param[in]   NumBytes     The number of bytes in the range.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #OS_SUCCESS              \copybrief OS_SUCCESS
+** \retval #CFE_ES_ERR_MEM_HANDLE   \copybrief CFE_ES_ERR_MEM_HANDLE
+** \retval #CFE_ES_CDS_INVALID_SIZE The range does not fit in the CDS block
+** \retval #OS_ERROR                Problem with handle
+**
+** \sa #CFE_ES_RegisterCDS, #CFE_ES_CopyToCDS, #CFE_ES_RestoreFromCDS
+**
+*/
+int32 CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, uint32 Offset, uint32 NumBytes);
+
 /*****************************************************************************/
 /**
 ** \brief Recover a block of data from the Critical Data Store (CDS)
@@ -43,7 +43,7 @@
 ** and when you're done adding, set this to the highest EID you used. It may
 ** be worthwhile to, on occasion, re-number the EID's to put them back in order.
 */
-#define CFE_ES_MAX_EID            92
+#define CFE_ES_MAX_EID            95
 
 /*
 ** ES task event message ID's.
@@ -1516,6 +1516,38 @@
 **/
 #define CFE_ES_ERLOG_PENDING_ERR_EID    93
 
+/** \brief <tt> 'Set CPU affinity of application \%s to 0x\%08X' </tt>
+**  \event <tt> 'Set CPU affinity of application \%s to 0x\%08X' </tt>
+**
+**  \par Type: INFORMATION
+**
+**  \par Cause:
+**
+**  This event message is generated upon successful completion of an Executive Services
+**  \link #CFE_ES_SET_APP_CPU_AFFINITY_CC Set Application CPU Affinity Command \endlink
+**
+**  The \c 's' field identifies the name of the Application and the hex value is the
+**  new processor core mask.
+**/
+#define CFE_ES_SET_AFFINITY_INF_EID    94
+
+/** \brief <tt> 'Set CPU affinity of application \%s Failed, RC = 0x\%08X' </tt>
+**  \event <tt> 'Set CPU affinity of application \%s Failed, RC = 0x\%08X' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when an Executive Services
+**  \link #CFE_ES_SET_APP_CPU_AFFINITY_CC Set Application CPU Affinity Command \endlink
+**  fails, either because the application is not running or because the underlying
+**  OS does not support or rejects the requested mask.
+**
+**  The \c 's' field identifies the name of the Application and the \c rc field
+**  identifies the error code, in hex, that may identify the precise reason for the failure.
+**/
+#define CFE_ES_SET_AFFINITY_ERR_EID    95
+
 
 #endif /* _cfe_es_events_ */
 
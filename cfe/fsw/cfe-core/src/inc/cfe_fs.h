@@ -159,6 +159,38 @@ void CFE_FS_InitHeader(CFE_FS_Header_t *Hdr, const char *Description, uint32 Sub
 ******************************************************************************/
 int32 CFE_FS_WriteHeader(int32 FileDes, CFE_FS_Header_t *Hdr);
 
+/*****************************************************************************/
+/**
+** \brief Write the Standard cFE File Header on behalf of a given application
+**
+** \par Description
+**        This API is the same as #CFE_FS_WriteHeader, except that the
+**        \link #CFE_FS_Header_t::ApplicationID \c ApplicationID \endlink field
+**        is filled with the given Application ID instead of the ID of the
+**        calling task.  It is intended for files written by a helper task
+**        (such as an ES async job) on behalf of another application.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The File has already been successfully opened using #OS_open and
+**           the caller has a legitimate File Descriptor.
+**        -# The \c SubType field has been filled appropriately by the Application.
+**        -# The \c Description field has been filled appropriately by the Application.
+**
+** \param[in] FileDes File Descriptor obtained from a previous call to #OS_open
+**                    that is associated with the file whose header is to be read.
+**
+** \param[in, out] Hdr     Pointer to a variable of type #CFE_FS_Header_t that will be
+**                    filled with the contents of the Standard cFE File Header. *Hdr is the contents of the Standard cFE File Header for the specified file.
+**
+** \param[in] AppId   Application ID to record in the header
+**
+** \return Execution status, see \ref CFEReturnCodes
+**
+** \sa #CFE_FS_WriteHeader
+**
+******************************************************************************/
+int32 CFE_FS_WriteHeaderWithAppID(int32 FileDes, CFE_FS_Header_t *Hdr, uint32 AppId);
+
 /*****************************************************************************/
 /**
 ** \brief Modifies the Time Stamp field in the Standard cFE File Header for the specified file
@@ -185,6 +217,116 @@ int32 CFE_FS_WriteHeader(int32 FileDes, CFE_FS_Header_t *Hdr);
 int32 CFE_FS_SetTimestamp(int32 FileDes, CFE_TIME_SysTime_t NewTimestamp);
 /**@}*/
 
+/** @defgroup CFEAPIFSBufWrite cFE Buffered File Write APIs
+ * @{
+ */
+
+/**
+** \brief Buffered record writer state
+**
+** Stages small records in a caller-supplied buffer so they reach the
+** file in a few large writes instead of one write per record.  Members
+** are managed by the CFE_FS_BufferedWriter functions and should not be
+** modified directly.
+*/
+typedef struct
+{
+    int32   FileDes;        /**< \brief File descriptor being written */
+    uint8  *Buffer;         /**< \brief Caller-supplied staging buffer */
+    uint32  BufferSize;     /**< \brief Size of the staging buffer in bytes */
+    uint32  Used;           /**< \brief Bytes currently staged but not yet written */
+    uint32  TotalBytes;     /**< \brief Bytes accepted since initialization */
+    int32   Status;         /**< \brief First write error encountered, or #CFE_SUCCESS */
+} CFE_FS_BufferedWriter_t;
+
+/*****************************************************************************/
+/**
+** \brief Initializes a buffered record writer
+**
+** \par Description
+**        Associates the writer with an open file and a staging buffer.  All
+**        subsequent #CFE_FS_BufferedWrite calls are appended at the current
+**        file position.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The buffer must remain valid until #CFE_FS_BufferedWriterFlush
+**           has been called for the last time.
+**        -# A \c BufferSize of zero is permitted; every record is then
+**           written straight through.
+**
+** \param[in, out] Writer  Writer state to initialize
+** \param[in] FileDes      File descriptor obtained from #OS_creat or #OS_open
+** \param[in] Buffer       Staging buffer, may be NULL if \c BufferSize is zero
+** \param[in] BufferSize   Size of the staging buffer in bytes
+**
+** \sa #CFE_FS_BufferedWrite, #CFE_FS_BufferedWriterFlush
+**
+******************************************************************************/
+void CFE_FS_BufferedWriterInit(CFE_FS_BufferedWriter_t *Writer, int32 FileDes, void *Buffer, uint32 BufferSize);
+
+/*****************************************************************************/
+/**
+** \brief Appends a record through a buffered record writer
+**
+** \par Description
+**        Copies the record into the staging buffer, writing the buffer out
+**        first if the record does not fit.  Records at least as large as the
+**        buffer are written directly.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Errors are sticky: once a write fails, all later calls return
+**           the same error without touching the file.
+**        -# Because data is staged, an error may be reported on a later
+**           record than the one whose bytes failed to reach the file.
+**
+** \param[in, out] Writer  Writer state from #CFE_FS_BufferedWriterInit
+** \param[in] Data         Record to append
+** \param[in] Size         Size of the record in bytes
+**
+** \return \c Size on success, otherwise a negative error code from
+**         #OS_write or \ref CFEReturnCodes
+**
+** \sa #CFE_FS_BufferedWriterInit, #CFE_FS_BufferedWriterFlush
+**
+******************************************************************************/
+int32 CFE_FS_BufferedWrite(CFE_FS_BufferedWriter_t *Writer, const void *Data, uint32 Size);
+
+/*****************************************************************************/
+/**
+** \brief Returns the free staging space in a buffered record writer
+**
+** \par Description
+**        Callers that collect records under a lock can use this to stop
+**        before the next #CFE_FS_BufferedWrite would have to write to the
+**        file, release the lock and then flush.
+**
+** \param[in] Writer  Writer state from #CFE_FS_BufferedWriterInit
+**
+** \return Number of bytes that can be appended without a file write
+**
+******************************************************************************/
+uint32 CFE_FS_BufferedWriterSpace(const CFE_FS_BufferedWriter_t *Writer);
+
+/*****************************************************************************/
+/**
+** \brief Writes all staged records to the file
+**
+** \par Description
+**        Issues a single write for everything staged so far.  This must be
+**        called before the file is closed.
+**
+** \param[in, out] Writer  Writer state from #CFE_FS_BufferedWriterInit
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_FS_SHORT_WRITE  \copybrief CFE_FS_SHORT_WRITE
+**
+** \sa #CFE_FS_BufferedWriterInit, #CFE_FS_BufferedWrite
+**
+******************************************************************************/
+int32 CFE_FS_BufferedWriterFlush(CFE_FS_BufferedWriter_t *Writer);
+/**@}*/
+
 #ifndef CFE_OMIT_DEPRECATED_6_7
 
 /** @defgroup CFEAPIFSCompress cFE Compressed File Management APIs
@@ -141,6 +141,17 @@ enum CFE_FS_SubType
     */
    CFE_FS_SubType_TBL_IMG                             = 8,
 
+   /**
+    * @brief Table Services Packed Table Image File
+    *
+    *
+    * Table Services Table Image File holding a delta encoded and/or compressed image, which is
+    * generated in response to a \link #CFE_TBL_DUMP_CC \TBL_DUMP \endlink command that
+    * selects a packed dump format.
+    *
+    */
+   CFE_FS_SubType_TBL_PACKED_IMG                      = 10,
+
    /**
     * @brief Event Services Application Data Dump File
     *
@@ -141,6 +141,11 @@
 */
 #define CFE_SB_PIPEOPTS_IGNOREMINE 0x00000001 /**< \brief Messages sent by the app that owns this pipe will not be sent to this pipe. */
 
+/*
+** Subscription option bit fields.
+*/
+#define CFE_SB_SUBOPTS_LATEST      0x00000001 /**< \brief Only the newest message of this subscription is kept on the pipe. */
+
 /*
 ** Type Definitions
 */
@@ -390,7 +395,11 @@ int32  CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName);
 **
 ** \param[in]  Quality      The requested Quality of Service (QoS) required of
 **                          the messages. Most callers will use #CFE_SB_Default_Qos
-**                          for this parameter.
+**                          for this parameter.  A high Priority delivers the
+**                          messages through a separate high priority lane of the
+**                          pipe, which #CFE_SB_RcvMsg always drains first.  The
+**                          lane is created with the first such subscription and
+**                          has the same depth as the pipe.
 **
 ** \param[in]  MsgLim       The maximum number of messages with this Message ID to
 **                          allow in this pipe at the same time.
@@ -401,6 +410,7 @@ int32  CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName);
 ** \retval #CFE_SB_MAX_DESTS_MET \copybrief CFE_SB_MAX_DESTS_MET
 ** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
 ** \retval #CFE_SB_BUF_ALOC_ERR  \copybrief CFE_SB_BUF_ALOC_ERR
+** \retval #CFE_SB_PIPE_CR_ERR   \copybrief CFE_SB_PIPE_CR_ERR
 **
 ** \sa #CFE_SB_Subscribe, #CFE_SB_SubscribeLocal, #CFE_SB_Unsubscribe, #CFE_SB_UnsubscribeLocal
 **/
@@ -529,6 +539,68 @@ int32  CFE_SB_Unsubscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId);
 ** \sa #CFE_SB_Subscribe, #CFE_SB_SubscribeEx, #CFE_SB_SubscribeLocal, #CFE_SB_Unsubscribe
 **/
 int32 CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId);
+
+/*****************************************************************************/
+/**
+** \brief Check whether a message ID currently has any subscribers
+**
+** \par Description
+**          This routine reports whether at least one pipe is subscribed to
+**          the specified message ID.  An application that publishes packets
+**          which are only occasionally subscribed (e.g. diagnostics) can use
+**          this to skip building the packet when nobody would receive it.
+**
+** \par Assumptions, External Events, and Notes:
+**          - This does not take the software bus lock, so the result is only
+**            a snapshot; a subscription may be added or removed immediately
+**            afterwards.  Sending a message with no subscribers is still
+**            handled (and counted) by #CFE_SB_SendMsg as before.
+**
+** \param[in]  MsgId        The message ID to check.
+**
+** \return true if the message ID has at least one subscriber, false otherwise
+**         (including for an invalid message ID)
+**
+** \sa #CFE_SB_Subscribe, #CFE_SB_Unsubscribe, #CFE_SB_SendMsg
+**/
+bool CFE_SB_IsSubscribed(CFE_SB_MsgId_t MsgId);
+
+/*****************************************************************************/
+/**
+** \brief Set delivery options on an existing subscription
+**
+** \par Description
+**          This routine sets (or clears) options that alter how messages of
+**          one subscription are delivered to the pipe.  Options are (re)set
+**          every call to this routine.
+**
+**          With #CFE_SB_SUBOPTS_LATEST set, at most one message of this
+**          subscription waits on the pipe.  A message published while an
+**          older one is still waiting replaces it, and the receiver gets the
+**          newest one.  The message limit of the subscription is not applied.
+**
+**          With a Decimation of N greater than 1, only the first of every N
+**          published messages is delivered to the pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**          - Messages skipped by decimation or replaced while waiting are
+**            counted in the pipe depth statistics of the SB statistics packet.
+**
+** \param[in]  MsgId        The message ID of the subscription.
+**
+** \param[in]  PipeId       The pipe ID of the subscription.
+**
+** \param[in]  Opts         A bit field of options.
+**
+** \param[in]  Decimation   Deliver one of every Decimation messages (0 or 1 delivers all).
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_Subscribe, #CFE_SB_SubscribeEx, #CFE_SB_SetPipeOpts, #CFE_SB_SUBOPTS_LATEST
+**/
+int32 CFE_SB_SetSubscriptionOpts(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8 Opts, uint16 Decimation);
 /**@}*/
 
 /** @defgroup CFEAPISBMessage cFE Send/Receive Message APIs
@@ -614,6 +686,11 @@ int32  CFE_SB_PassMsg(CFE_SB_Msg_t   *MsgPtr);
 **          random. Therefore, it is recommended that the return code be tested
 **          for CFE_SUCCESS before processing the message.
 **
+**          Note - When called from an application's main task with a TimeOut other
+**          than #CFE_SB_POLL, this call is a quiescent point for tables registered
+**          with #CFE_TBL_OPT_EPOCH, just like #CFE_ES_RunLoop.  Addresses of such
+**          tables obtained before the call must not be used after it.
+**
 ** \param[in, out]  BufPtr       A pointer to a local variable of type #CFE_SB_MsgPtr_t.
 **                          Typically a caller declares a ptr of type CFE_SB_Msg_t
 **                          (i.e. CFE_SB_Msg_t *Ptr) then gives the address of that
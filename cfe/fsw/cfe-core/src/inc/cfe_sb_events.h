@@ -40,7 +40,7 @@
 ** and when you're done adding, set this to the highest EID you used. It may
 ** be worthwhile to, on occasion, re-number the EID's to put them back in order.
 */
-#define CFE_SB_MAX_EID                  67
+#define CFE_SB_MAX_EID                  70
 
 /*
 ** SB task event message ID's.
@@ -933,6 +933,44 @@
 **/
 #define CFE_SB_CR_PIPE_NO_FREE_EID      63
 
+/** \brief <tt> 'SetSubOptsErr:Bad Arg,MsgId 0x\%x,PipeId \%d,app \%s' </tt>
+**  \event <tt> 'SetSubOptsErr:Bad Arg,MsgId 0x\%x,PipeId \%d,app \%s' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This error event message is issued when the #CFE_SB_SetSubscriptionOpts API is
+**  called for a pipe that is invalid or owned by another app, or for a message ID
+**  that the pipe is not subscribed to.
+**/
+#define CFE_SB_SETSUBOPTS_ERR_EID       68
+
+/** \brief <tt> 'Subscription opts set:MsgId 0x\%x,pipe \%d,opts=0x\%02x,decimation \%d' </tt>
+**  \event <tt> 'Subscription opts set:MsgId 0x\%x,pipe \%d,opts=0x\%02x,decimation \%d' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This debug event is generated when the options of a subscription are set by
+**  the #CFE_SB_SetSubscriptionOpts API.
+**/
+#define CFE_SB_SETSUBOPTS_EID           69
+
+/** \brief <tt> 'Subscribe Err:High priority lane not created,MsgId 0x\%x,pipe \%s,stat \%d' </tt>
+**  \event <tt> 'Subscribe Err:High priority lane not created,MsgId 0x\%x,pipe \%s,stat \%d' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This error event message is issued when the first high priority subscription
+**  of a pipe is made and the OS queue for the pipe's high priority lane could
+**  not be created.
+**/
+#define CFE_SB_HIGH_LANE_ERR_EID        70
+
 
 #endif /* _cfe_sb_events_ */
 
@@ -66,6 +66,14 @@
 #define CFE_TBL_OPT_NOT_CRITICAL (0x0000) /**< \brief Not critical table */
 #define CFE_TBL_OPT_CRITICAL     (0x0008) /**< \brief Critical table */
 
+#define CFE_TBL_OPT_EPOCH_MSK    (0x0010) /**< \brief Table epoch reclamation mask */
+#define CFE_TBL_OPT_NOT_EPOCH    (0x0000) /**< \brief Inactive buffer is reused once all users release it */
+#define CFE_TBL_OPT_EPOCH        (0x0011) /**< \brief Inactive buffer is reused once all users pass a quiescent point, @note Automatically includes #CFE_TBL_OPT_DBL_BUFFER option */
+
+#define CFE_TBL_OPT_VALIDATE_MSK       (0x0020) /**< \brief Table validation context mask */
+#define CFE_TBL_OPT_OWNER_VALIDATE     (0x0000) /**< \brief Validation function is run by the owner in #CFE_TBL_Validate */
+#define CFE_TBL_OPT_ASYNC_VALIDATE     (0x0020) /**< \brief Validation function is run by Table Services on an ES async job worker */
+
 /** @brief Default table options */
 #define CFE_TBL_OPT_DEFAULT      (CFE_TBL_OPT_SNGL_BUFFER | CFE_TBL_OPT_LOAD_DUMP)
 /**@}*/
@@ -247,6 +255,32 @@ typedef struct
 **                                                                 the update of the double buffered table from being quick and
 **                                                                 it could be blocked.  Therefore, critical tables should not be
 **                                                                 updated by Interrupt Service Routines.
+**                                 \arg #CFE_TBL_OPT_EPOCH       - When this option is selected, the table is double
+**                                                                 buffered and #CFE_TBL_GetAddress does not lock the
+**                                                                 table.  An update makes the new buffer active at
+**                                                                 once, and the previous buffer is only reused for a
+**                                                                 later load after every application sharing the
+**                                                                 table has passed a quiescent point (a call to
+**                                                                 #CFE_ES_RunLoop or #CFE_TBL_Manage, or a
+**                                                                 #CFE_SB_RcvMsg that may block).  Users of such
+**                                                                 a table must not keep its address across one of
+**                                                                 those calls, and must only access it from their
+**                                                                 main task.  An application whose main task waits
+**                                                                 in any other blocking call (e.g. an OSAL queue or
+**                                                                 semaphore) without reaching a quiescent point
+**                                                                 holds up the next load of the table until it
+**                                                                 does.  This option implies
+**                                                                 #CFE_TBL_OPT_DBL_BUFFER and is therefore mutually
+**                                                                 exclusive of the #CFE_TBL_OPT_DUMP_ONLY and
+**                                                                 #CFE_TBL_OPT_USR_DEF_ADDR options.
+**                                 \arg #CFE_TBL_OPT_ASYNC_VALIDATE - When this option is selected, a validation
+**                                                                 requested by command is run by Table Services on one
+**                                                                 of the ES async job workers, alongside the CRC of the
+**                                                                 table, rather than by the owner's next call to
+**                                                                 #CFE_TBL_Validate or #CFE_TBL_Manage.  The validation
+**                                                                 function may then run concurrently with the owner, so
+**                                                                 it must only read the table data it is given and data
+**                                                                 which does not change.
 **
 ** \param[in] TblValidationFuncPtr is a pointer to a function that will be executed in the context of the Table 
 **                                 Management Service when the contents of a table need to be validated.  If set 
@@ -263,7 +297,8 @@ typedef struct
 **                                 considered invalid.  Validation functions \b must return either #CFE_SUCCESS or a negative
 **                                 number (whose value is at the developer's discretion).  The validation function 
 **                                 will be executed in the Application's context so that Event Messages describing the 
-**                                 validation failure are possible from within the function.
+**                                 validation failure are possible from within the function, unless the table is
+**                                 registered with the #CFE_TBL_OPT_ASYNC_VALIDATE option.
 **
 ** \return Execution status, see \ref CFEReturnCodes
 ** \retval #CFE_SUCCESS                      \copybrief CFE_SUCCESS
@@ -417,6 +452,53 @@ int32 CFE_TBL_Load( CFE_TBL_Handle_t TblHandle,
                     CFE_TBL_SrcEnum_t SrcType,
                     const void *SrcDataPtr );
 
+/*****************************************************************************/
+/**
+** \brief Load a range of a specified table from a block of memory
+**
+** \par Description
+**        Replaces \c NumBytes bytes of the table, starting \c Offset bytes
+**        into it, with the contents of \c SrcDataPtr.  The rest of the table
+**        keeps its active contents.  For a single buffered table without a
+**        validation function only the range is copied, in and out of the
+**        working buffer.  In all cases the table CRC is recomputed from the
+**        range alone, and a critical table only has the range written to
+**        its CDS.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The table must have been loaded at least once.
+**        -# A validation function, if any, is still given the whole table.
+**        -# This function call can block.  See #CFE_TBL_Load.
+**
+** \param[in] TblHandle  Handle, previously obtained from #CFE_TBL_Register or #CFE_TBL_Share, that
+**                       identifies the Table to be loaded.
+**
+** \param[in] Offset     Offset, in bytes, into the table of the range to be loaded.
+**
+** \param[in] NumBytes   Number of bytes to be loaded.
+**
+** \param[in] SrcDataPtr Pointer to the new contents of the range.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                   \copybrief CFE_SUCCESS
+** \retval #CFE_TBL_ERR_BAD_APP_ID        \copybrief CFE_TBL_ERR_BAD_APP_ID
+** \retval #CFE_TBL_ERR_NO_ACCESS         \copybrief CFE_TBL_ERR_NO_ACCESS
+** \retval #CFE_TBL_ERR_INVALID_HANDLE    \copybrief CFE_TBL_ERR_INVALID_HANDLE
+** \retval #CFE_TBL_ERR_DUMP_ONLY         \copybrief CFE_TBL_ERR_DUMP_ONLY
+** \retval #CFE_TBL_ERR_PARTIAL_LOAD      \copybrief CFE_TBL_ERR_PARTIAL_LOAD
+** \retval #CFE_TBL_ERR_INVALID_SIZE      \copybrief CFE_TBL_ERR_INVALID_SIZE
+** \retval #CFE_TBL_ERR_LOAD_IN_PROGRESS  \copybrief CFE_TBL_ERR_LOAD_IN_PROGRESS
+** \retval #CFE_TBL_ERR_NO_BUFFER_AVAIL   \copybrief CFE_TBL_ERR_NO_BUFFER_AVAIL
+** \retval #CFE_TBL_INFO_TABLE_LOCKED     \copybrief CFE_TBL_INFO_TABLE_LOCKED
+**
+** \sa #CFE_TBL_Load, #CFE_TBL_Update, #CFE_TBL_Manage
+**
+******************************************************************************/
+int32 CFE_TBL_LoadDelta( CFE_TBL_Handle_t TblHandle,
+                         uint32 Offset,
+                         uint32 NumBytes,
+                         const void *SrcDataPtr );
+
 /*****************************************************************************/
 /**
 ** \brief Update contents of a specified table, if an update is pending
@@ -603,6 +685,10 @@ int32   CFE_TBL_Modified( CFE_TBL_Handle_t TblHandle );
 **           will still return a valid table pointer to a table with all zero content.
 **           This pointer mush be released with the #CFE_TBL_ReleaseAddress API before
 **           the table can be loaded with data.
+**        -# Tables registered with #CFE_TBL_OPT_EPOCH are not locked by this call and
+**           do not need to be released.  The address remains valid until the caller's
+**           next call to #CFE_ES_RunLoop or #CFE_TBL_Manage, or to #CFE_SB_RcvMsg with
+**           a TimeOut other than #CFE_SB_POLL.
 **
 ** \param[in, out]  TblPtr     The address of a pointer that will be loaded with the address of 
 **                        the first byte of the table.  This pointer can then be typecast 
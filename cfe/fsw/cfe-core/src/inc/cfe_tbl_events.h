@@ -46,7 +46,7 @@
 ** and when you're done adding, set this to the highest EID you used. It may
 ** be worthwhile to, on occasion, re-number the EID's to put them back in order.
 */
-#define CFE_TBL_MAX_EID                         103
+#define CFE_TBL_MAX_EID                         108
 
 /******************* Macro Definitions ***********************/
 /*
@@ -1099,6 +1099,73 @@
 **/
 #define CFE_TBL_HANDLE_ACCESS_ERR_EID          103
 
+/** \brief <tt> Validation of '%s' abandoned, the table buffer changed or was released </tt>
+**  \event <tt> Validation of '%s' abandoned, the table buffer changed or was released </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when the table buffer selected by a
+**  \link #CFE_TBL_VALIDATE_CC Validate Table command \endlink was activated, aborted or
+**  unregistered while its CRC was being computed.  The validation result reports
+**  #CFE_TBL_ERR_UNREGISTERED, and the buffer must be validated again.
+**/
+#define CFE_TBL_VALIDATION_ABANDONED_ERR_EID   104
+
+/** \brief <tt> '\%s: Packed image in '\%s' is invalid at byte \%lu' </tt>
+**  \event <tt> '\%s: Packed image in '\%s' is invalid at byte \%lu' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when a #CFE_FS_SubType_TBL_PACKED_IMG table file
+**  has an unknown format, a block size other than the one used by this cFE, does
+**  not describe a whole table image, or has a damaged block record.  The byte
+**  reported is the table image offset of the block being decoded.
+**/
+#define CFE_TBL_PACKED_IMG_ERR_EID             105
+
+/** \brief <tt> '\%s: Delta image '\%s' does not apply, reference CRC 0x\%08X, active CRC 0x\%08X' </tt>
+**  \event <tt> '\%s: Delta image '\%s' does not apply, reference CRC 0x\%08X, active CRC 0x\%08X' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when a delta table image file is loaded but the
+**  active table contents are no longer those the file was dumped against.
+**/
+#define CFE_TBL_PACKED_REF_ERR_EID             106
+
+/** \brief <tt> 'Cmd for Table '\%s' had illegal dump format (0x\%04X)' </tt>
+**  \event <tt> 'Cmd for Table '\%s' had illegal dump format (0x\%04X)' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when a
+**  \link #CFE_TBL_DUMP_CC Dump Table command \endlink selects a dump format
+**  other than one of the #CFE_TBL_DumpFormat_Enum_t values, or a delta format
+**  for the active buffer, which the delta would be taken against.
+**/
+#define CFE_TBL_ILLEGAL_DUMP_FORMAT_ERR_EID    107
+
+/** \brief <tt> '\%s: Packed image in '\%s' has CRC 0x\%08X, expected 0x\%08X' </tt>
+**  \event <tt> '\%s: Packed image in '\%s' has CRC 0x\%08X, expected 0x\%08X' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when a #CFE_FS_SubType_TBL_PACKED_IMG table file
+**  decodes to an image whose CRC differs from the CRC recorded in the file when it
+**  was dumped.
+**/
+#define CFE_TBL_PACKED_CRC_ERR_EID             108
+
 /** \} */
 
 
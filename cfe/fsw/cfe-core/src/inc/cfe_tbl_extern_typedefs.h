@@ -59,6 +59,42 @@ enum CFE_TBL_BufferSelect
  */
 typedef uint16                                           CFE_TBL_BufferSelect_Enum_t;
 
+/**
+ * @brief Label definitions associated with CFE_TBL_DumpFormat_Enum_t
+ */
+enum CFE_TBL_DumpFormat
+{
+
+   /**
+    * @brief Write the table image as is
+    */
+   CFE_TBL_DumpFormat_RAW                             = 0,
+
+   /**
+    * @brief Compress the table image
+    */
+   CFE_TBL_DumpFormat_LZ                              = 1,
+
+   /**
+    * @brief Store only the blocks which differ from the active table image
+    */
+   CFE_TBL_DumpFormat_DELTA                           = 2,
+
+   /**
+    * @brief Store and compress only the blocks which differ from the active table image
+    */
+   CFE_TBL_DumpFormat_DELTA_LZ                        = 3
+};
+
+/**
+ * @brief Selects how a table image is stored in a dump file
+ *
+ * The LZ and DELTA values are bits, and DELTA_LZ combines both.
+ *
+ * @sa enum CFE_TBL_DumpFormat
+ */
+typedef uint16                                           CFE_TBL_DumpFormat_Enum_t;
+
 
 
 /**
@@ -74,6 +110,19 @@ typedef struct
     char                     TableName[CFE_MISSION_TBL_MAX_FULL_NAME_LEN]; /**< Fully qualified name of table to load */
 } CFE_TBL_File_Hdr_t;
 
+/**
+ * @brief The header which follows the CFE_TBL_File_Hdr_t in packed table image files.
+ *
+ * The header is followed by one record for each BlockSize bytes of the table image.
+ */
+typedef struct
+{
+    CFE_TBL_DumpFormat_Enum_t Format;                              /**< How the table image was encoded */
+    uint16                   BlockSize;                            /**< Bytes of table image in each record */
+    uint32                   ImageCrc;                             /**< CRC of the decoded table image */
+    uint32                   ReferenceCrc;                         /**< CRC of the active table contents a DELTA image applies to */
+} CFE_TBL_PackedImg_Hdr_t;
+
 
 
 
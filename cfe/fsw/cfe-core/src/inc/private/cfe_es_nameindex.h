@@ -0,0 +1,285 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/**
+ * \file cfe_es_nameindex.h
+ *
+ * Name index used by the cFE core registries (applications, generic counters,
+ * CDS blocks, tables and pipes) to look up an entry by its name.
+ *
+ * An index is an open-addressed hash table of entry numbers, keyed on the name
+ * which is already stored in each registry entry.  It does not hold a copy of
+ * the names, so the registry remains the only record of them.  Each registry
+ * describes its index with a constant CFE_ES_NameIndex_t that gives the slot
+ * storage and where the names live in the registry array.  Zeroed slot storage
+ * is an empty index, so the index is emptied along with its registry.
+ *
+ * The index does no locking of its own.  All of the functions below must be
+ * called with the lock which protects the registry held, and an entry must be
+ * added after its name is set and removed before the name is cleared.
+ *
+ * The functions are defined inline here rather than in one cFE module so that
+ * each module unit test exercises the real index against its own registry.
+ */
+
+#ifndef CFE_ES_NAMEINDEX_H_
+#define CFE_ES_NAMEINDEX_H_
+
+#ifndef _CFE_CORE_
+#error "cfe_es_nameindex.h is for use within the cFE core only"
+#endif
+
+#include <string.h>
+#include <common_types.h>
+
+/*
+ * An index is kept at most half full, so it is sized to the next power of two
+ * of twice the number of registry entries.  The power of two allows the probe
+ * sequence to wrap with a simple mask.
+ */
+#define CFE_ES_NAMEINDEX_ROUNDUP_1(x)   ((x) | ((x) >> 1))
+#define CFE_ES_NAMEINDEX_ROUNDUP_2(x)   (CFE_ES_NAMEINDEX_ROUNDUP_1(x) | (CFE_ES_NAMEINDEX_ROUNDUP_1(x) >> 2))
+#define CFE_ES_NAMEINDEX_ROUNDUP_4(x)   (CFE_ES_NAMEINDEX_ROUNDUP_2(x) | (CFE_ES_NAMEINDEX_ROUNDUP_2(x) >> 4))
+#define CFE_ES_NAMEINDEX_ROUNDUP_8(x)   (CFE_ES_NAMEINDEX_ROUNDUP_4(x) | (CFE_ES_NAMEINDEX_ROUNDUP_4(x) >> 8))
+#define CFE_ES_NAMEINDEX_ROUNDUP_16(x)  (CFE_ES_NAMEINDEX_ROUNDUP_8(x) | (CFE_ES_NAMEINDEX_ROUNDUP_8(x) >> 16))
+#define CFE_ES_NAMEINDEX_SIZE(n)        (1 + CFE_ES_NAMEINDEX_ROUNDUP_16((2 * (n)) - 1))
+
+/*
+ * Value returned by CFE_ES_NameIndexFind() when no entry has the name
+ */
+#define CFE_ES_NAMEINDEX_NOT_FOUND      (-1)
+
+/******************************************************************************
+**  Typedef:  CFE_ES_NameIndexSlot_t
+**
+**  Purpose:
+**     A single slot in a name index.  The full hash of the name is kept so that
+**     most non-matching slots are passed over without comparing names.
+*/
+typedef struct
+{
+    uint32  Hash;       /**< Hash of the entry name */
+    uint32  EntryRef;   /**< Registry entry number plus one, or zero if the slot is unused */
+} CFE_ES_NameIndexSlot_t;
+
+/******************************************************************************
+**  Typedef:  CFE_ES_NameIndex_t
+**
+**  Purpose:
+**     Describes the name index of one registry.  The name of registry entry N
+**     is found at NameBase + (N * NameStride), and is at most NameLength bytes
+**     including the terminator.
+*/
+typedef struct
+{
+    CFE_ES_NameIndexSlot_t  *Slots;         /**< Slot storage, must be CFE_ES_NAMEINDEX_SIZE() entries */
+    uint32                  NumSlots;       /**< Number of slots, a power of two */
+    const char              *NameBase;      /**< Name of the first registry entry */
+    uint32                  NameStride;     /**< Size of one registry entry */
+    uint32                  NameLength;     /**< Size of the name field in a registry entry */
+} CFE_ES_NameIndex_t;
+
+
+/**
+ * @brief Computes the hash of a name in a name index
+ *
+ * This is FNV-1a over the name, followed by a final mix so that names which
+ * differ only in their last character still land far apart in the index.
+ *
+ * @returns The hash of the name
+ */
+static inline uint32 CFE_ES_NameIndexHash(const CFE_ES_NameIndex_t *Index, const char *Name)
+{
+    uint32 Hash;
+    uint32 i;
+
+    Hash = 2166136261U;
+    for (i = 0; i < Index->NameLength && Name[i] != '\0'; ++i)
+    {
+        Hash ^= (uint8)Name[i];
+        Hash *= 16777619U;
+    }
+
+    Hash ^= Hash >> 15;
+    Hash *= 0x9E3779B1U;
+    Hash ^= Hash >> 16;
+
+    return Hash;
+}
+
+/**
+ * @brief Gets the name of a registry entry in a name index
+ *
+ * @returns Pointer to the name stored in the registry entry
+ */
+static inline const char *CFE_ES_NameIndexEntryName(const CFE_ES_NameIndex_t *Index, uint32 EntryIdx)
+{
+    return (Index->NameBase + (EntryIdx * Index->NameStride));
+}
+
+/**
+ * @brief Finds the registry entry with the given name
+ *
+ * Callers should still check that the entry is in use, as with a linear
+ * search of the registry.
+ *
+ * @returns The registry entry number, or CFE_ES_NAMEINDEX_NOT_FOUND
+ */
+static inline int32 CFE_ES_NameIndexFind(const CFE_ES_NameIndex_t *Index, const char *Name)
+{
+    const CFE_ES_NameIndexSlot_t *SlotPtr;
+    uint32 Hash;
+    uint32 Slot;
+    uint32 Probes;
+
+    Hash = CFE_ES_NameIndexHash(Index, Name);
+    Slot = Hash & (Index->NumSlots - 1);
+
+    for (Probes = 0; Probes < Index->NumSlots; ++Probes)
+    {
+        SlotPtr = &Index->Slots[Slot];
+        if (SlotPtr->EntryRef == 0)
+        {
+            break;
+        }
+
+        if (SlotPtr->Hash == Hash &&
+            strncmp(Name, CFE_ES_NameIndexEntryName(Index, SlotPtr->EntryRef - 1), Index->NameLength) == 0)
+        {
+            return (int32)(SlotPtr->EntryRef - 1);
+        }
+
+        Slot = (Slot + 1) & (Index->NumSlots - 1);
+    }
+
+    return CFE_ES_NAMEINDEX_NOT_FOUND;
+}
+
+/**
+ * @brief Adds a registry entry to a name index under its current name
+ *
+ * Adding an entry again under the same name has no effect.  To rename an
+ * entry, remove it from the index before changing the name and add it after.
+ */
+static inline void CFE_ES_NameIndexAdd(const CFE_ES_NameIndex_t *Index, uint32 EntryIdx)
+{
+    CFE_ES_NameIndexSlot_t *SlotPtr;
+    uint32 Hash;
+    uint32 Slot;
+    uint32 Probes;
+
+    Hash = CFE_ES_NameIndexHash(Index, CFE_ES_NameIndexEntryName(Index, EntryIdx));
+    Slot = Hash & (Index->NumSlots - 1);
+
+    for (Probes = 0; Probes < Index->NumSlots; ++Probes)
+    {
+        SlotPtr = &Index->Slots[Slot];
+        if (SlotPtr->EntryRef == 0 || SlotPtr->EntryRef == (EntryIdx + 1))
+        {
+            SlotPtr->Hash = Hash;
+            SlotPtr->EntryRef = EntryIdx + 1;
+            break;
+        }
+
+        Slot = (Slot + 1) & (Index->NumSlots - 1);
+    }
+}
+
+/**
+ * @brief Removes a registry entry from a name index
+ *
+ * The entry is located by its current name, or by scanning all slots if it
+ * has been renamed since it was added.  Entries after it in the same probe
+ * sequence are shifted back into the freed slot, so the index never holds
+ * deleted markers and searches for absent names stay short.
+ */
+static inline void CFE_ES_NameIndexRemove(const CFE_ES_NameIndex_t *Index, uint32 EntryIdx)
+{
+    uint32 Mask;
+    uint32 Slot;
+    uint32 Next;
+    uint32 Home;
+    uint32 Probes;
+
+    Mask = Index->NumSlots - 1;
+    Slot = CFE_ES_NameIndexHash(Index, CFE_ES_NameIndexEntryName(Index, EntryIdx)) & Mask;
+
+    for (Probes = 0; Probes < Index->NumSlots; ++Probes)
+    {
+        if (Index->Slots[Slot].EntryRef == 0 || Index->Slots[Slot].EntryRef == (EntryIdx + 1))
+        {
+            break;
+        }
+
+        Slot = (Slot + 1) & Mask;
+    }
+
+    if (Index->Slots[Slot].EntryRef != (EntryIdx + 1))
+    {
+        /* Not under its current name, so it was renamed or never added */
+        for (Slot = 0; Slot < Index->NumSlots; ++Slot)
+        {
+            if (Index->Slots[Slot].EntryRef == (EntryIdx + 1))
+            {
+                break;
+            }
+        }
+
+        if (Slot == Index->NumSlots)
+        {
+            return;
+        }
+    }
+
+    Next = Slot;
+    for (Probes = 0; Probes < Index->NumSlots; ++Probes)
+    {
+        Next = (Next + 1) & Mask;
+        if (Index->Slots[Next].EntryRef == 0)
+        {
+            break;
+        }
+
+        /*
+         * The entry at Next may fill the hole at Slot unless its home slot
+         * lies after the hole, in which case the hole is not on its probe path.
+         */
+        Home = Index->Slots[Next].Hash & Mask;
+        if (((Next - Home) & Mask) >= ((Next - Slot) & Mask))
+        {
+            Index->Slots[Slot] = Index->Slots[Next];
+            Slot = Next;
+        }
+    }
+
+    Index->Slots[Slot].Hash = 0;
+    Index->Slots[Slot].EntryRef = 0;
+}
+
+/**
+ * @brief Removes all entries from a name index
+ */
+static inline void CFE_ES_NameIndexClear(const CFE_ES_NameIndex_t *Index)
+{
+    memset(Index->Slots, 0, Index->NumSlots * sizeof(CFE_ES_NameIndexSlot_t));
+}
+
+
+#endif /* CFE_ES_NAMEINDEX_H_ */
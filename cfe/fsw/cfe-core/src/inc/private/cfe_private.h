@@ -228,6 +228,58 @@ extern int32 CFE_FS_EarlyInit(void);
 ******************************************************************************/
 extern int32 CFE_TBL_CleanUpApp(uint32 AppId);
 
+/*****************************************************************************/
+/**
+** \brief Records a table quiescent point for the specified Application
+**
+** \par Description
+**        This function is called by cFE Executive Services from #CFE_ES_RunLoop,
+**        by #CFE_TBL_Manage and by #CFE_TBL_BlockingCallEnd, to record that the
+**        Application no longer holds any address obtained from a #CFE_TBL_OPT_EPOCH
+**        table.  Buffers retired before this point may then be reused for the next
+**        table load.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This function does not take any locks and may be called from any
+**           context that knows the caller's Application ID.
+**
+******************************************************************************/
+extern void CFE_TBL_QuiescentPoint(uint32 AppId);
+
+/*****************************************************************************/
+/**
+** \brief Marks the main task of the specified Application as blocked
+**
+** \par Description
+**        This function is called by cFE Software Bus when the main task of an
+**        Application pends in #CFE_SB_RcvMsg.  Until the matching call to
+**        #CFE_TBL_BlockingCallEnd, the Application is treated as quiescent,
+**        so buffers of #CFE_TBL_OPT_EPOCH tables retired meanwhile are not
+**        held up by an Application that waits a long time (or forever) for
+**        its next message and so never reaches #CFE_ES_RunLoop.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This function does not take any locks.
+**        -# Calls do not nest; each Application has one main task.
+**
+******************************************************************************/
+extern void CFE_TBL_BlockingCallBegin(uint32 AppId);
+
+/*****************************************************************************/
+/**
+** \brief Marks the main task of the specified Application as running again
+**
+** \par Description
+**        This function is called by cFE Software Bus when a blocking
+**        #CFE_SB_RcvMsg of an Application's main task returns.  It records a
+**        quiescent point and ends the period started by #CFE_TBL_BlockingCallBegin.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This function does not take any locks.
+**
+******************************************************************************/
+extern void CFE_TBL_BlockingCallEnd(uint32 AppId);
+
 /*****************************************************************************/
 /**
 ** \brief Removes SB resources associated with specified Application
@@ -276,6 +328,28 @@ extern int32 CFE_TIME_CleanUpApp(uint32 AppId);
  * without redefining it at the point of use.
  */
 
+/*****************************************************************************/
+/**
+** \brief Get the Application ID of the calling task if it is a main task
+**
+** \par Description
+**        Looks up the Application of the calling task, as #CFE_ES_GetAppID
+**        does, but only succeeds when the calling task is the main task of
+**        that Application rather than one of its child tasks.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This function does not take the ES shared data lock, so it may be
+**           called on the message receive path.
+**
+** \param[out]  AppIdPtr  Pointer to variable that is to receive the Application ID.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS        \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_APPID   \copybrief CFE_ES_ERR_APPID
+**
+******************************************************************************/
+extern int32 CFE_ES_GetMainTaskAppID(uint32 *AppIdPtr);
+
 /*****************************************************************************/
 /**
 ** \brief Reserve space (or re-obtain previously reserved space) in the Critical Data Store (CDS)
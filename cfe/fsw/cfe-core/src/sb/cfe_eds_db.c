@@ -129,6 +129,7 @@ static void CFE_SB_EDS_DoRegister(uint32 RegTag, CFE_SB_EDS_AppDbPtr_t AppDictio
     if (Status == EDSLIB_SUCCESS)
     {
         CFE_EDS_Global.RegAppId[DictionaryIdx] = RegTag;
+        CFE_SB_EDS_InvalidateDispatchCache_Unsync();
     }
 
     CFE_SB_UnlockSharedData(__func__,__LINE__);
@@ -177,6 +178,12 @@ static void CFE_SB_EDS_DoUnregister(uint32 RegTag)
         }
     }
 
+    /*
+     * The app/lib being removed may have owned a dispatch table
+     * referenced by the cache, so always flush it here.
+     */
+    CFE_SB_EDS_InvalidateDispatchCache_Unsync();
+
     CFE_SB_UnlockSharedData(__func__,__LINE__);
 }
 
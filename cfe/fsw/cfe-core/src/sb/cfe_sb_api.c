@@ -67,6 +67,7 @@
 #include "cfe_es.h"
 #include "cfe_psp.h"
 #include "cfe_error.h"
+#include <stdio.h>
 #include <string.h>
 
 /* 
@@ -164,6 +165,8 @@ int32  CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16  Depth, const char *
     /* fill in the pipe table fields */
     CFE_SB.PipeTbl[PipeTblIdx].InUse       = CFE_SB_IN_USE;
     CFE_SB.PipeTbl[PipeTblIdx].SysQueueId  = SysQueueId;
+    CFE_SB.PipeTbl[PipeTblIdx].HighQueueId = CFE_SB_UNUSED_QUEUE;
+    CFE_SB.PipeTbl[PipeTblIdx].WakeSemId   = CFE_SB_UNUSED_QUEUE;
     CFE_SB.PipeTbl[PipeTblIdx].PipeId      = PipeTblIdx;
     CFE_SB.PipeTbl[PipeTblIdx].QueueDepth  = Depth;
     CFE_SB.PipeTbl[PipeTblIdx].AppId       = AppId;
@@ -172,6 +175,15 @@ int32  CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16  Depth, const char *
     CFE_SB.PipeTbl[PipeTblIdx].ToTrashBuff = NULL;
     strcpy(&CFE_SB.PipeTbl[PipeTblIdx].AppName[0],&AppName[0]);
 
+    /* index the pipe under the name of its queue for CFE_SB_GetPipeIdByName */
+    CFE_SB.PipeTbl[PipeTblIdx].PipeName[0] = '\0';
+    if (PipeName != NULL)
+    {
+        strncpy(CFE_SB.PipeTbl[PipeTblIdx].PipeName, PipeName, OS_MAX_API_NAME - 1);
+        CFE_SB.PipeTbl[PipeTblIdx].PipeName[OS_MAX_API_NAME - 1] = '\0';
+    }
+    CFE_ES_NameIndexAdd(&CFE_SB_PipeNameIndex, PipeTblIdx);
+
     /* Increment the Pipes in use ctr and if it's > the high water mark,*/
     /* adjust the high water mark */
     CFE_SB.StatTlmMsg.Payload.PipesInUse++;
@@ -186,6 +198,12 @@ int32  CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16  Depth, const char *
     CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].Depth = Depth;
     CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].InUse = 0;
     CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].PeakInUse = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].OverwrittenCount = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].DecimatedCount = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].HighPriorityInUse = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].HighPriorityPeakInUse = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].PeakLatency = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].HighPriorityPeakLatency = 0;
     }
 
     /* give the pipe handle to the caller */
@@ -269,7 +287,7 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId,uint32 AppId)
     uint32        Owner,i;
     uint32        TskId = 0;
     CFE_SB_Msg_t  *PipeMsgPtr;
-    CFE_SB_DestinationD_t *DestPtr = NULL;
+    uint16        DestIdx;
     char          FullName[(OS_MAX_API_NAME * 2)];
 
     /* take semaphore to prevent a task switch during this call */
@@ -309,21 +327,20 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId,uint32 AppId)
     {
         if(CFE_SB_IsValidMsgId(CFE_SB.RoutingTbl[i].MsgId))
         {
-            DestPtr = CFE_SB.RoutingTbl[i].ListHeadPtr;
+            for(DestIdx = 0; DestIdx < CFE_SB.RoutingTbl[i].Destinations; DestIdx++){
 
-            while(DestPtr != NULL){
-
-                if(DestPtr -> PipeId == PipeId){
+                if(CFE_SB.RoutingTbl[i].DestArray[DestIdx].PipeId == PipeId){
                     /* release the semaphore, unsubscribe will need to take it */
                     CFE_SB_UnlockSharedData(__func__,__LINE__);
                     CFE_SB_UnsubscribeWithAppId(CFE_SB.RoutingTbl[i].MsgId,
                                        PipeId,AppId);
                     CFE_SB_LockSharedData(__func__,__LINE__);
-                }/* end if */
 
-                DestPtr = DestPtr -> Next;
+                    /* a pipe is only ever subscribed once per message id */
+                    break;
+                }/* end if */
 
-            }/* end while */
+            }/* end for */
 
         }/* end if */
     }/* end for */
@@ -345,12 +362,20 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId,uint32 AppId)
       CFE_SB_LockSharedData(__func__,__LINE__);
     }while(Stat == CFE_SUCCESS);
 
-    /* Delete the underlying OS queue */
+    /* Delete the underlying OS queue(s) */
     OS_QueueDelete(CFE_SB.PipeTbl[PipeTblIdx].SysQueueId);
+    if (CFE_SB.PipeTbl[PipeTblIdx].HighQueueId != CFE_SB_UNUSED_QUEUE)
+    {
+        OS_QueueDelete(CFE_SB.PipeTbl[PipeTblIdx].HighQueueId);
+        OS_CountSemDelete(CFE_SB.PipeTbl[PipeTblIdx].WakeSemId);
+    }
 
     /* remove the pipe from the pipe table */
+    CFE_ES_NameIndexRemove(&CFE_SB_PipeNameIndex, PipeTblIdx);
     CFE_SB.PipeTbl[PipeTblIdx].InUse         = CFE_SB_NOT_IN_USE;
     CFE_SB.PipeTbl[PipeTblIdx].SysQueueId    = CFE_SB_UNUSED_QUEUE;
+    CFE_SB.PipeTbl[PipeTblIdx].HighQueueId   = CFE_SB_UNUSED_QUEUE;
+    CFE_SB.PipeTbl[PipeTblIdx].WakeSemId     = CFE_SB_UNUSED_QUEUE;
     CFE_SB.PipeTbl[PipeTblIdx].PipeId        = CFE_SB_INVALID_PIPE;
     CFE_SB.PipeTbl[PipeTblIdx].CurrentBuff   = NULL;
 
@@ -361,6 +386,12 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId,uint32 AppId)
     CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].Depth = 0;
     CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].InUse = 0;
     CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].PeakInUse = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].OverwrittenCount = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].DecimatedCount = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].HighPriorityInUse = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].HighPriorityPeakInUse = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].PeakLatency = 0;
+    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeTblIdx].HighPriorityPeakLatency = 0;
     }
 
     CFE_SB.StatTlmMsg.Payload.PipesInUse--;
@@ -496,6 +527,58 @@ int32 CFE_SB_GetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 *OptsPtr)
     return CFE_SUCCESS;
 }/* end CFE_SB_GetPipeOpts */
 
+/*
+ *  Function:  CFE_SB_SetSubscriptionOpts - See API and header file for details
+ */
+int32 CFE_SB_SetSubscriptionOpts(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8 Opts, uint16 Decimation)
+{
+    uint8                  PipeTblIdx;
+    uint32                 AppId = 0xFFFFFFFF;
+    uint32                 TskId = 0;
+    CFE_SB_DestinationD_t *DestPtr = NULL;
+    char                   FullName[(OS_MAX_API_NAME * 2)];
+
+    /* get the callers Application Id */
+    CFE_ES_GetAppID(&AppId);
+
+    /* take semaphore to prevent a task switch during this call */
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    /* get TaskId of caller for events */
+    TskId = OS_TaskGetId();
+
+    /* the pipe must exist, belong to the caller and be subscribed to MsgId */
+    PipeTblIdx = CFE_SB_GetPipeIdx(PipeId);
+    if((PipeTblIdx != CFE_SB_INVALID_PIPE) &&
+       (CFE_SB.PipeTbl[PipeTblIdx].AppId == AppId) &&
+       CFE_SB_IsValidMsgId(MsgId))
+    {
+        DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId);
+    }/* end if */
+
+    if(DestPtr == NULL)
+    {
+        CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter++;
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_SETSUBOPTS_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+          "SetSubOptsErr:Bad Arg,MsgId 0x%x,PipeId %d,app %s",
+          (unsigned int)CFE_SB_MsgIdToValue(MsgId),(int)PipeId,CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    DestPtr->Opts = Opts;
+    DestPtr->Decimation = Decimation;
+    DestPtr->DecimateCnt = 0;
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    CFE_EVS_SendEventWithAppID(CFE_SB_SETSUBOPTS_EID,CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
+          "Subscription opts set:MsgId 0x%x,pipe %d,opts=0x%02x,decimation %d",
+          (unsigned int)CFE_SB_MsgIdToValue(MsgId),(int)PipeId,(unsigned int)Opts,(int)Decimation);
+
+    return CFE_SUCCESS;
+}/* end CFE_SB_SetSubscriptionOpts */
+
 /*
  *  Function:  CFE_SB_GetPipeName - See API and header file for details
  */
@@ -549,11 +632,9 @@ int32 CFE_SB_GetPipeName(char *PipeNameBuf, size_t PipeNameSize, CFE_SB_PipeId_t
  */
 int32 CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName)
 {
-    uint8         PipeTblIdx = 0;
+    int32         PipeTblIdx;
     int32         Status = CFE_SUCCESS;
-    int32         RtnFromVal = 0;
     uint32        TskId = 0;
-    uint32        QueueId = 0;
     char          FullName[(OS_MAX_API_NAME * 2)];
 
     if(PipeName == NULL || PipeIdPtr == NULL)
@@ -571,53 +652,33 @@ int32 CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName)
         /* get TaskId of caller for events */
         TskId = OS_TaskGetId();
 
-        RtnFromVal = OS_QueueGetIdByName(&QueueId, PipeName);
+        /* take semaphore to prevent a task switch while looking up
+         * the name in the pipe table name index.
+         */
+        CFE_SB_LockSharedData(__func__,__LINE__);
 
-        if(RtnFromVal == OS_SUCCESS)
+        PipeTblIdx = CFE_ES_NameIndexFind(&CFE_SB_PipeNameIndex, PipeName);
+        if(PipeTblIdx != CFE_ES_NAMEINDEX_NOT_FOUND
+            && CFE_SB.PipeTbl[PipeTblIdx].InUse != 0)
         {
-            /* take semaphore to prevent a task switch while iterating
-             * through the PipeTbl.
-             */
-            CFE_SB_LockSharedData(__func__,__LINE__);
-
-            for(PipeTblIdx = 0;
-                PipeTblIdx < CFE_PLATFORM_SB_MAX_PIPES;
-                PipeTblIdx++)
-            {
-                if(CFE_SB.PipeTbl[PipeTblIdx].InUse != 0
-                    && CFE_SB.PipeTbl[PipeTblIdx].SysQueueId == QueueId)
-                {
-                    /* grab the ID before we release the lock */
-                    *PipeIdPtr = CFE_SB.PipeTbl[PipeTblIdx].PipeId;
-
-                    break;
-                }/* end if */
-
-            }/* end for */
-
-            CFE_SB_UnlockSharedData(__func__,__LINE__);
-
-            if(PipeTblIdx == CFE_PLATFORM_SB_MAX_PIPES)
-            {
-                /* should never get here! */
-                CFE_SB.HKTlmMsg.Payload.GetPipeIdByNameErrorCounter++;
+            /* grab the ID before we release the lock */
+            *PipeIdPtr = CFE_SB.PipeTbl[PipeTblIdx].PipeId;
+        }
+        else
+        {
+            PipeTblIdx = CFE_ES_NAMEINDEX_NOT_FOUND;
+        }/* end if */
 
-                CFE_EVS_SendEventWithAppID(CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID,
-                    CFE_EVS_EventType_ERROR, CFE_SB.AppId,
-                    "Pipe ID By Name Error:Bad Argument,Requestor %s",
-                    CFE_SB_GetAppTskName(TskId,FullName));
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
 
-                Status = CFE_SB_BAD_ARGUMENT;
-            }
-            else
-            {
-                CFE_EVS_SendEventWithAppID(CFE_SB_GETPIPEIDBYNAME_EID,
-                    CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
-                    "PipeIdByName name=%s id=%d",
-                    PipeName, *PipeIdPtr);
+        if(PipeTblIdx != CFE_ES_NAMEINDEX_NOT_FOUND)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_SB_GETPIPEIDBYNAME_EID,
+                CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
+                "PipeIdByName name=%s id=%d",
+                PipeName, *PipeIdPtr);
 
-                Status = CFE_SUCCESS;
-            }
+            Status = CFE_SUCCESS;
         }
         else
         {
@@ -720,9 +781,13 @@ int32  CFE_SB_SubscribeFull(CFE_SB_MsgId_t   MsgId,
     uint32 TskId = 0;
     uint32 AppId = 0xFFFFFFFF;
     uint8  PipeIdx;
-    CFE_SB_DestinationD_t *DestBlkPtr = NULL;
+    CFE_SB_DestinationD_t DestBlk;
     char   FullName[(OS_MAX_API_NAME * 2)];
     char   PipeName[OS_MAX_API_NAME] = {'\0'};
+    char   LaneName[OS_MAX_API_NAME];
+    uint32 LaneQueueId;
+    uint32 LaneSemId;
+    CFE_SB_BufferD_t *Wakeup = NULL;
 
     CFE_SB_GetPipeName(PipeName, sizeof(PipeName), PipeId);
 
@@ -782,6 +847,42 @@ int32  CFE_SB_SubscribeFull(CFE_SB_MsgId_t   MsgId,
         return CFE_SUCCESS;
     }/* end if */
 
+    /*
+    ** The first high priority subscription of a pipe creates its high priority
+    ** lane and the semaphore the receiver pends on from then on.  The lane is
+    ** published last, as CFE_SB_ReadQueue checks it without the lock.  One
+    ** NULL entry on the queue moves a receiver already pending there over to
+    ** the semaphore; if the queue is full no receiver is pending.
+    */
+    if((Quality.Priority == CFE_SB_QosPriority_HIGH) &&
+       (CFE_SB.PipeTbl[PipeIdx].HighQueueId == CFE_SB_UNUSED_QUEUE))
+    {
+        snprintf(LaneName, sizeof(LaneName), "SB_HI_LANE_%d", (int)PipeId);
+        Stat = OS_QueueCreate(&LaneQueueId, LaneName,
+                              CFE_SB.PipeTbl[PipeIdx].QueueDepth, sizeof(CFE_SB_BufferD_t *), 0);
+        if(Stat == OS_SUCCESS){
+            snprintf(LaneName, sizeof(LaneName), "SB_WAKE_%d", (int)PipeId);
+            Stat = OS_CountSemCreate(&LaneSemId, LaneName, 0, 0);
+            if(Stat != OS_SUCCESS){
+                OS_QueueDelete(LaneQueueId);
+            }/* end if */
+        }/* end if */
+
+        if(Stat == OS_SUCCESS){
+            CFE_SB.PipeTbl[PipeIdx].WakeSemId = LaneSemId;
+            __atomic_store_n(&CFE_SB.PipeTbl[PipeIdx].HighQueueId, LaneQueueId, __ATOMIC_RELEASE);
+            OS_QueuePut(CFE_SB.PipeTbl[PipeIdx].SysQueueId,(void *)&Wakeup,
+                        sizeof(CFE_SB_BufferD_t *),0);
+        }else{
+            CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter++;
+            CFE_SB_UnlockSharedData(__func__,__LINE__);
+            CFE_EVS_SendEventWithAppID(CFE_SB_HIGH_LANE_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
+              "Subscribe Err:High priority lane not created,MsgId 0x%x,pipe %s,stat %d",
+              (unsigned int)CFE_SB_MsgIdToValue(MsgId),PipeName,(int)Stat);
+            return CFE_SB_PIPE_CR_ERR;
+        }/* end if */
+    }/* end if */
+
     /*
     ** If there has been a subscription for this message id earlier,
     ** get the element number in the routing table.
@@ -846,8 +947,22 @@ int32  CFE_SB_SubscribeFull(CFE_SB_MsgId_t   MsgId,
         return CFE_SB_MAX_DESTS_MET;
     }/* end if */
 
-    DestBlkPtr = CFE_SB_GetDestinationBlk();
-    if(DestBlkPtr == NULL){
+    /* initialize destination block */
+    memset(&DestBlk, 0, sizeof(DestBlk));
+    DestBlk.PipeId = PipeId;
+    DestBlk.MsgId2PipeLim = (uint16)MsgLim;
+    DestBlk.Active = CFE_SB_ACTIVE;
+    DestBlk.BuffCount = 0;
+    DestBlk.DestCnt = 0;
+    DestBlk.Scope = Scope;
+    if(Quality.Priority == CFE_SB_QosPriority_HIGH){
+        DestBlk.Priority = CFE_SB_QosPriority_HIGH;
+    }else{
+        DestBlk.Priority = CFE_SB_QosPriority_LOW;
+    }/* end if */
+
+    /* add destination block to head of the route's destination array */
+    if(CFE_SB_AddDest(RoutePtr, &DestBlk) != CFE_SUCCESS){
         CFE_SB_UnlockSharedData(__func__,__LINE__);
         CFE_EVS_SendEventWithAppID(CFE_SB_DEST_BLK_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
             "Subscribe Err:Request for Destination Blk failed for Msg 0x%x", 
@@ -855,21 +970,6 @@ int32  CFE_SB_SubscribeFull(CFE_SB_MsgId_t   MsgId,
         return CFE_SB_BUF_ALOC_ERR;
     }/* end if */
 
-    /* initialize destination block */
-    DestBlkPtr -> PipeId = PipeId;
-    DestBlkPtr -> MsgId2PipeLim = (uint16)MsgLim;
-    DestBlkPtr -> Active = CFE_SB_ACTIVE;
-    DestBlkPtr -> BuffCount = 0;
-    DestBlkPtr -> DestCnt = 0;
-    DestBlkPtr -> Scope = Scope;
-    DestBlkPtr -> Prev = NULL;
-    DestBlkPtr -> Next = NULL;
-
-    /* add destination block to head of list */
-    CFE_SB_AddDest(RoutePtr, DestBlkPtr);
-
-    RoutePtr->Destinations++;
-
     CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse++;
     if(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse > CFE_SB.StatTlmMsg.Payload.PeakSubscriptionsInUse)
     {
@@ -1011,7 +1111,6 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId,CFE_SB_PipeId_t PipeId,
     CFE_SB_RouteEntry_t* RoutePtr;
     uint32  PipeIdx;
     uint32  TskId = 0;
-    bool    MatchFound = false;
     CFE_SB_DestinationD_t   *DestPtr = NULL;
     char    FullName[(OS_MAX_API_NAME * 2)];
 
@@ -1075,32 +1174,18 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId,CFE_SB_PipeId_t PipeId,
         return CFE_SUCCESS;
     }/* end if */
 
-    /* At this point, there must be at least one destination. */
-    /* So the value of 'ListHeadPtr' will not be NULL by design */
     RoutePtr = CFE_SB_GetRoutePtrFromIdx(RouteIdx);
 
-    /* search the list for a matching pipe id */
-    DestPtr = RoutePtr->ListHeadPtr;
-
-    do{
-
-        if(DestPtr->PipeId == PipeId){
-            /* match found, remove node from list */
-            CFE_SB_RemoveDest(RoutePtr,DestPtr);
-
-            /* return node to memory pool */
-            CFE_SB_PutDestinationBlk(DestPtr);
-
-            RoutePtr->Destinations--;
-            CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse--;
-
-            MatchFound = true;
+    /* search the destinations for a matching pipe id */
+    DestPtr = CFE_SB_GetDestPtr(MsgKey, PipeId);
 
-        }/* end if */
+    if(DestPtr != NULL){
+        /* match found, remove it from the destination array */
+        CFE_SB_RemoveDest(RoutePtr,DestPtr);
 
-        DestPtr = DestPtr->Next;
+        CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse--;
 
-    }while((MatchFound == false)&&(DestPtr != NULL));
+    }/* end if */
 
     CFE_SB_UnlockSharedData(__func__,__LINE__);
 
@@ -1113,6 +1198,29 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId,CFE_SB_PipeId_t PipeId,
 
 }/* end CFE_SB_UnsubscribeFull */
 
+/*
+ * Function: CFE_SB_IsSubscribed - See API and header file for details
+ */
+bool CFE_SB_IsSubscribed(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgRouteIdx_t RtgTblIdx;
+
+    if(!CFE_SB_IsValidMsgId(MsgId))
+    {
+        return false;
+    }
+
+    /*
+    ** No lock is taken here: the map entry and destination count are single
+    ** aligned reads and the answer is only advisory anyway (see cfe_sb.h).
+    */
+    RtgTblIdx = CFE_SB_GetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(MsgId));
+
+    return (CFE_SB_IsValidRouteIdx(RtgTblIdx) &&
+            CFE_SB_GetRoutePtrFromIdx(RtgTblIdx)->Destinations != 0);
+
+}/* end CFE_SB_IsSubscribed */
+
 /*
  * Function: CFE_SB_SendMsg - See API and header file for details
  */
@@ -1179,6 +1287,7 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
     CFE_SB_PipeD_t          *PipeDscPtr;
     CFE_SB_RouteEntry_t     *RtgTblPtr;
     CFE_SB_BufferD_t        *BufDscPtr;
+    bool                    TimeStamped = false;
     uint16                  TotalMsgSize;
     CFE_SB_MsgRouteIdx_t    RtgTblIdx;
     uint32                  TskId = 0;
@@ -1330,16 +1439,9 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
     /* At this point there must be at least one destination for pkt */
 
     /* Send the packet to all destinations  */
-    for (i=0, DestPtr = RtgTblPtr -> ListHeadPtr;
-            i < RtgTblPtr -> Destinations; i++, DestPtr = DestPtr -> Next)
+    for (i=0, DestPtr = RtgTblPtr -> DestArray;
+            i < RtgTblPtr -> Destinations; i++, DestPtr++)
     {
-        /* The DestPtr should never be NULL in this loop, this is just extra
-           protection in case of the unforseen */
-        if(DestPtr == NULL)
-        {
-          break;
-        }
-
         if (DestPtr->Active == CFE_SB_INACTIVE)    /* destination is active */
         {
             continue;
@@ -1359,6 +1461,41 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
             }
         }/* end if */
 
+        /* decimating subscriptions only take the first of every N messages */
+        if(DestPtr->Decimation > 1)
+        {
+            uint16 Phase = DestPtr->DecimateCnt;
+
+            DestPtr->DecimateCnt = (Phase + 1) % DestPtr->Decimation;
+            if(Phase != 0)
+            {
+                if (DestPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE)
+                {
+                    CFE_SB.StatTlmMsg.Payload.PipeDepthStats[DestPtr->PipeId].DecimatedCount++;
+                }
+                continue;
+            }
+        }/* end if */
+
+        /*
+        ** A latest value subscription with a message already on the pipe
+        ** keeps this one aside instead; the receiver is handed the newest.
+        */
+        if((DestPtr->Opts & CFE_SB_SUBOPTS_LATEST) && (DestPtr->BuffCount > 0))
+        {
+            BufDscPtr->UseCount++;
+            if(DestPtr->LatestBuff != NULL)
+            {
+                CFE_SB_DecrBufUseCnt(DestPtr->LatestBuff);
+            }
+            DestPtr->LatestBuff = BufDscPtr;
+            if (DestPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE)
+            {
+                CFE_SB.StatTlmMsg.Payload.PipeDepthStats[DestPtr->PipeId].OverwrittenCount++;
+            }
+            continue;
+        }/* end if */
+
         /* if Msg limit exceeded, log event, increment counter */
         /* and go to next destination */
         if(DestPtr->BuffCount >= DestPtr->MsgId2PipeLim){
@@ -1372,12 +1509,34 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
             continue;
         }/* end if */
 
+        /* pipes with a high priority lane report the latency of both lanes */
+        if((PipeDscPtr->HighQueueId != CFE_SB_UNUSED_QUEUE) && !TimeStamped)
+        {
+            CFE_PSP_GetTime(&BufDscPtr->SendTime);
+            TimeStamped = true;
+        }/* end if */
+
         /*
-        ** Write the buffer descriptor to the queue of the pipe.  If the write
-        ** failed, log info and increment the pipe's error counter.
+        ** Write the buffer descriptor to the queue of the pipe, or to its high
+        ** priority lane.  A pipe with a lane has its receiver pending on the
+        ** wake semaphore, which is given for each message on either queue.
+        ** If the write failed, log info and increment the pipe's error counter.
         */
-                Status = OS_QueuePut(PipeDscPtr->SysQueueId,(void *)&BufDscPtr,
-                                     sizeof(CFE_SB_BufferD_t *),0);
+        if(DestPtr->Priority == CFE_SB_QosPriority_HIGH)
+        {
+            Status = OS_QueuePut(PipeDscPtr->HighQueueId,(void *)&BufDscPtr,
+                                 sizeof(CFE_SB_BufferD_t *),0);
+        }
+        else
+        {
+            Status = OS_QueuePut(PipeDscPtr->SysQueueId,(void *)&BufDscPtr,
+                                 sizeof(CFE_SB_BufferD_t *),0);
+        }/* end if */
+
+        if((Status == OS_SUCCESS) && (PipeDscPtr->HighQueueId != CFE_SB_UNUSED_QUEUE))
+        {
+            OS_CountSemGive(PipeDscPtr->WakeSemId);
+        }/* end if */
 
         if (Status == OS_SUCCESS) {
             BufDscPtr->UseCount++;    /* used for releasing buffer  */
@@ -1391,6 +1550,12 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
                 if(StatObj->InUse > StatObj->PeakInUse){
                     StatObj->PeakInUse = StatObj->InUse;
                 }/* end if */
+                if(DestPtr->Priority == CFE_SB_QosPriority_HIGH){
+                    StatObj->HighPriorityInUse++;
+                    if(StatObj->HighPriorityInUse > StatObj->HighPriorityPeakInUse){
+                        StatObj->HighPriorityPeakInUse = StatObj->HighPriorityInUse;
+                    }/* end if */
+                }/* end if */
             }
 
         }else if(Status == OS_QUEUE_FULL) {
@@ -1509,6 +1674,8 @@ int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t    *BufPtr,
     CFE_SB_PipeD_t         *PipeDscPtr;
     CFE_SB_DestinationD_t  *DestPtr = NULL;
     uint32                 TskId = 0;
+    uint32                 BlockedAppId;
+    CFE_SB_QosPriority_Enum_t Lane = CFE_SB_QosPriority_LOW;
     char                   FullName[(OS_MAX_API_NAME * 2)];
 
     /* get task id for events */
@@ -1551,7 +1718,21 @@ int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t    *BufPtr,
     ** packet to the task according to mode.  Otherwise, return a status
     ** code indicating that no buffer was read.
     */
-    Status = CFE_SB_ReadQueue(PipeDscPtr, TskId, TimeOut, &Message);
+    BlockedAppId = CFE_PLATFORM_ES_MAX_APPLICATIONS;
+    if ((TimeOut != CFE_SB_POLL) && (CFE_ES_GetMainTaskAppID(&BlockedAppId) == CFE_SUCCESS)) {
+        /*
+        ** An app waiting for its next message holds no table addresses,
+        ** so it must not hold up the reclaiming of epoch table buffers
+        ** for as long as it waits.
+        */
+        CFE_TBL_BlockingCallBegin(BlockedAppId);
+    }/* end if */
+
+    Status = CFE_SB_ReadQueue(PipeDscPtr, TskId, TimeOut, &Message, &Lane);
+
+    if (BlockedAppId < CFE_PLATFORM_ES_MAX_APPLICATIONS) {
+        CFE_TBL_BlockingCallEnd(BlockedAppId);
+    }/* end if */
 
     /* take semaphore again to protect the remaining code in this call */
     CFE_SB_LockSharedData(__func__,__LINE__);
@@ -1568,6 +1749,19 @@ int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t    *BufPtr,
 
     if (Status == CFE_SUCCESS) {
 
+        /* get pointer to destination to be used in decrementing msg limit cnt*/
+        DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(Message->MsgId), PipeDscPtr->PipeId);
+
+        /*
+        ** If a newer message was kept aside for a latest value subscription,
+        ** deliver it in place of the one read from the queue.
+        */
+        if((DestPtr != NULL) && (DestPtr->LatestBuff != NULL)){
+            CFE_SB_DecrBufUseCnt(Message);
+            Message = DestPtr->LatestBuff;
+            DestPtr->LatestBuff = NULL;
+        }/* end if */
+
         /*
         ** Load the pipe tables 'CurrentBuff' with the buffer descriptor
         ** ptr corresponding to the message just read. This is done so that
@@ -1578,9 +1772,6 @@ int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t    *BufPtr,
         /* Set the Receivers pointer to the address of the actual message */
         *BufPtr = (CFE_SB_MsgPtr_t) Message->Buffer;
 
-        /* get pointer to destination to be used in decrementing msg limit cnt*/
-        DestPtr = CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(PipeDscPtr->CurrentBuff->MsgId), PipeDscPtr->PipeId);
-
         /*
         ** DestPtr would be NULL if the msg is unsubscribed to while it is on
         ** the pipe. The BuffCount may be zero if the msg is unsubscribed to and
@@ -1597,7 +1788,38 @@ int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t    *BufPtr,
 
         if (PipeDscPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE)
         {
-        CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeDscPtr->PipeId].InUse--;
+        CFE_SB_PipeDepthStats_t *StatObj =
+                &CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeDscPtr->PipeId];
+
+        StatObj->InUse--;
+        if (Lane == CFE_SB_QosPriority_HIGH)
+        {
+            StatObj->HighPriorityInUse--;
+        }
+
+        /*
+        ** Messages sent to a pipe with a high priority lane carry their send
+        ** time.  The same buffer may also go to pipes without a lane, which
+        ** do not report latency.
+        */
+        if ((PipeDscPtr->HighQueueId != CFE_SB_UNUSED_QUEUE) &&
+            ((Message->SendTime.seconds != 0) || (Message->SendTime.microsecs != 0)))
+        {
+            OS_time_t Now;
+            uint32    Latency;
+
+            CFE_PSP_GetTime(&Now);
+            Latency = ((Now.seconds - Message->SendTime.seconds) * 1000000) +
+                    Now.microsecs - Message->SendTime.microsecs;
+            if ((Lane == CFE_SB_QosPriority_HIGH) && (Latency > StatObj->HighPriorityPeakLatency))
+            {
+                StatObj->HighPriorityPeakLatency = Latency;
+            }
+            else if ((Lane != CFE_SB_QosPriority_HIGH) && (Latency > StatObj->PeakLatency))
+            {
+                StatObj->PeakLatency = Latency;
+            }
+        }
         }
 
     }else{
@@ -1770,6 +1992,8 @@ CFE_SB_Msg_t  *CFE_SB_ZeroCopyGetPtr(uint16 MsgSize,
     bd->UseCount  = 1;
     bd->Size      = MsgSize;
     bd->Buffer    = (void *)address;
+    bd->SendTime.seconds   = 0;
+    bd->SendTime.microsecs = 0;
 
     return (CFE_SB_Msg_t *)address;
 
@@ -1909,6 +2133,126 @@ int32 CFE_SB_ZeroCopyPass(CFE_SB_Msg_t   *MsgPtr,
 }/* end CFE_SB_ZeroCopyPass */
 
 
+/******************************************************************************
+**  Function:  CFE_SB_PollLanes()
+**
+**  Purpose:
+**    Take the next message from a pipe with a high priority lane without
+**    waiting, from the high priority lane if there is one and from the
+**    queue otherwise.  NULL entries on the queue are skipped.
+**
+**  Arguments:
+**    PipeDscPtr: Pointer to pipe descriptor.
+**    Message   : Pointer to a variable that will receive the buffer
+**                descriptor of the message.
+**    LanePtr   : Pointer to a variable that will receive the lane the
+**                message was read from.
+**
+**  Return:
+**    OSAL queue status of the read, OS_QUEUE_EMPTY if both are empty
+*/
+static int32 CFE_SB_PollLanes(CFE_SB_PipeD_t            *PipeDscPtr,
+                              CFE_SB_BufferD_t          **Message,
+                              CFE_SB_QosPriority_Enum_t *LanePtr)
+{
+    int32              Status;
+    uint32             Nbytes;
+
+    /* Drain the high priority lane first */
+    *LanePtr = CFE_SB_QosPriority_HIGH;
+    Status = OS_QueueGet(PipeDscPtr->HighQueueId,
+                        (void *)Message,
+                        sizeof(CFE_SB_BufferD_t *),
+                        &Nbytes,
+                        OS_CHECK);
+
+    /* The queue may still hold the NULL entry that announced the lane */
+    if (Status == OS_QUEUE_EMPTY)
+    {
+        *LanePtr = CFE_SB_QosPriority_LOW;
+        do
+        {
+            Status = OS_QueueGet(PipeDscPtr->SysQueueId,
+                                (void *)Message,
+                                sizeof(CFE_SB_BufferD_t *),
+                                &Nbytes,
+                                OS_CHECK);
+        } while ((Status == OS_SUCCESS) && (*Message == NULL));
+    }
+
+    return (Status);
+}/* end CFE_SB_PollLanes */
+
+/******************************************************************************
+**  Function:  CFE_SB_ReadLanes()
+**
+**  Purpose:
+**    Read an SB message from a pipe with a high priority lane.  The receiver
+**    pends on the wake semaphore of the pipe, which is given once for every
+**    message put on either queue after the lane was created, then takes the
+**    message from the high priority lane if there is one and from the queue
+**    otherwise.
+**
+**    Messages already on the queue when the lane was created were never
+**    counted on the semaphore, so both queues are checked before pending.
+**    A message read that way leaves its count behind if it had one; the
+**    wakeup that then finds both queues empty ends a poll, and is otherwise
+**    returned as a NULL message so the caller waits again for the rest of
+**    its timeout.
+**
+**  Arguments:
+**    PipeDscPtr: Pointer to pipe descriptor.
+**    TimeOut   : OS_PEND, OS_CHECK or a timeout in milliseconds
+**    Message   : Pointer to a variable that will receive the buffer
+**                descriptor of the message.
+**    LanePtr   : Pointer to a variable that will receive the lane the
+**                message was read from.
+**
+**  Return:
+**    OSAL queue status of the read
+*/
+static int32 CFE_SB_ReadLanes(CFE_SB_PipeD_t            *PipeDscPtr,
+                              int32                     TimeOut,
+                              CFE_SB_BufferD_t          **Message,
+                              CFE_SB_QosPriority_Enum_t *LanePtr)
+{
+    int32              Status;
+
+    Status = CFE_SB_PollLanes(PipeDscPtr, Message, LanePtr);
+    if (Status != OS_QUEUE_EMPTY)
+    {
+        return Status;
+    }
+
+    if (TimeOut == OS_PEND)
+    {
+        Status = OS_CountSemTake(PipeDscPtr->WakeSemId);
+    }
+    else
+    {
+        Status = OS_CountSemTimedWait(PipeDscPtr->WakeSemId, TimeOut);
+    }
+
+    if (Status == OS_SEM_TIMEOUT)
+    {
+        return (TimeOut == OS_CHECK) ? OS_QUEUE_EMPTY : OS_QUEUE_TIMEOUT;
+    }
+    else if (Status != OS_SUCCESS)
+    {
+        return Status;
+    }
+
+    Status = CFE_SB_PollLanes(PipeDscPtr, Message, LanePtr);
+    if ((Status == OS_QUEUE_EMPTY) && (TimeOut != OS_CHECK))
+    {
+        /* the count of a message that was read without waiting */
+        *Message = NULL;
+        Status = OS_SUCCESS;
+    }
+
+    return (Status);
+}/* end CFE_SB_ReadLanes */
+
 /******************************************************************************
 **  Function:  CFE_SB_ReadQueue()
 **
@@ -1926,6 +2270,16 @@ int32 CFE_SB_ZeroCopyPass(CFE_SB_Msg_t   *MsgPtr,
 **                  value in milliseconds = wait up to a specified time
 **    Message   : Pointer to a variable that will receive the buffer
 **                descriptor of the message.
+**    LanePtr   : Pointer to a variable that will receive the lane the
+**                message was read from (CFE_SB_QosPriority_HIGH or
+**                CFE_SB_QosPriority_LOW).
+**
+**  Notes:
+**    A pipe with a high priority lane is read with CFE_SB_ReadLanes().  A
+**    NULL entry read from the queue of a pipe without one means the lane was
+**    created while the receiver was pending, and a NULL message from
+**    CFE_SB_ReadLanes() a wakeup for a message that was already read; the
+**    read is then repeated for the remainder of the timeout.
 **
 **  Return:
 **    CFE_SB status code indicating the result of the operation:
@@ -1935,13 +2289,17 @@ int32 CFE_SB_ZeroCopyPass(CFE_SB_Msg_t   *MsgPtr,
 **      CFE_SB_PIPE_RD_ERR  = an unexpected queue read error occurred
 */
 
-int32  CFE_SB_ReadQueue (CFE_SB_PipeD_t         *PipeDscPtr,
-                         uint32                 TskId,
-                         CFE_SB_TimeOut_t       Time_Out,
-                         CFE_SB_BufferD_t       **Message)
+int32  CFE_SB_ReadQueue (CFE_SB_PipeD_t            *PipeDscPtr,
+                         uint32                    TskId,
+                         CFE_SB_TimeOut_t          Time_Out,
+                         CFE_SB_BufferD_t          **Message,
+                         CFE_SB_QosPriority_Enum_t *LanePtr)
 {
     int32              Status,TimeOut;
     uint32             Nbytes;
+    uint32             Elapsed;
+    OS_time_t          StartTime = {0, 0};
+    OS_time_t          CurrTime;
     char               FullName[(OS_MAX_API_NAME * 2)];
     char               PipeName[OS_MAX_API_NAME] = {'\0'};
 
@@ -1958,16 +2316,48 @@ int32  CFE_SB_ReadQueue (CFE_SB_PipeD_t         *PipeDscPtr,
 
       default:
           TimeOut = Time_Out;
+          CFE_PSP_GetTime(&StartTime);
           break;
 
     }/* end switch */
 
-    /* Read the buffer descriptor address from the queue.  */
-    Status = OS_QueueGet(PipeDscPtr->SysQueueId,
-                        (void *)Message,
-                        sizeof(CFE_SB_BufferD_t *),
-                        &Nbytes,
-                        TimeOut);
+    while (true)
+    {
+        if (__atomic_load_n(&PipeDscPtr->HighQueueId, __ATOMIC_ACQUIRE) != CFE_SB_UNUSED_QUEUE)
+        {
+            Status = CFE_SB_ReadLanes(PipeDscPtr, TimeOut, Message, LanePtr);
+        }
+        else
+        {
+            /* Read the buffer descriptor address from the queue.  */
+            *LanePtr = CFE_SB_QosPriority_LOW;
+            Status = OS_QueueGet(PipeDscPtr->SysQueueId,
+                                (void *)Message,
+                                sizeof(CFE_SB_BufferD_t *),
+                                &Nbytes,
+                                TimeOut);
+        }
+
+        if ((Status != OS_SUCCESS) || (*Message != NULL))
+        {
+            break;
+        }
+
+        /* the pipe gained a high priority lane, wait only for the time left */
+        if (TimeOut > 0)
+        {
+            CFE_PSP_GetTime(&CurrTime);
+            Elapsed = 1000 * (CurrTime.seconds - StartTime.seconds);
+            Elapsed += CurrTime.microsecs / 1000;
+            Elapsed -= StartTime.microsecs / 1000;
+            if (Elapsed >= Time_Out)
+            {
+                Status = OS_QUEUE_TIMEOUT;
+                break;
+            }
+            TimeOut = Time_Out - Elapsed;
+        }
+    }
 
     /* translate the return value */
     switch(Status){
@@ -92,6 +92,8 @@ CFE_SB_BufferD_t * CFE_SB_GetBufferFromPool(CFE_SB_MsgId_t MsgId, uint16 Size) {
     bd->UseCount  = 1;
     bd->Size      = Size;
     bd->Buffer    = (void *)address;
+    bd->SendTime.seconds   = 0;
+    bd->SendTime.microsecs = 0;
 
     return bd;
 
@@ -198,21 +200,23 @@ int32 CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd){
 **  Function:   CFE_SB_GetDestinationBlk()
 **
 **  Purpose:
-**    This function gets a destination descriptor from the SB memory pool.
+**    This function gets an array of destination descriptors from the SB
+**    memory pool.
 **
 **  Arguments:
-**    None
+**    NumDests - number of destination descriptors in the array
 **
 **  Return:
-**    Pointer to the destination descriptor
+**    Pointer to the first destination descriptor, or NULL on failure
 */
-CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
+CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(uint16 NumDests)
 {
     int32 Stat;
     CFE_SB_DestinationD_t *Dest = NULL;
 
-    /* Allocate a new destination descriptor from the SB memory pool.*/
-    Stat = CFE_ES_GetPoolBuf((uint32 **)&Dest, CFE_SB.Mem.PoolHdl,  sizeof(CFE_SB_DestinationD_t));
+    /* Allocate a new destination descriptor array from the SB memory pool.*/
+    Stat = CFE_ES_GetPoolBuf((uint32 **)&Dest, CFE_SB.Mem.PoolHdl,
+                             NumDests * sizeof(CFE_SB_DestinationD_t));
     if(Stat < 0){
         return NULL;
     }
@@ -233,13 +237,13 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
 **  Function:   CFE_SB_PutDestinationBlk()
 **
 **  Purpose:
-**    This function returns a destination descriptor to the SB memory pool.
+**    This function returns a destination descriptor array to the SB memory pool.
 **
 **  Arguments:
-**    None
+**    Dest - Pointer to the first destination descriptor of the array
 **
 **  Return:
-**    Pointer to the destination descriptor
+**    CFE_SUCCESS, or CFE_SB_BAD_ARGUMENT if Dest is NULL
 */
 int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest)
 {
@@ -217,47 +217,126 @@ int32 CFE_SB_EDS_PackOutputMessage(uint16 InterfaceId, void *DestBuffer, const C
     return CFE_SUCCESS;
 }
 
-int32 CFE_SB_EDS_Dispatch(
-        uint16 InterfaceId,
-        uint16 IndicationIndex,
-        uint16 DispatchTableID,
-        const CFE_SB_Msg_t *Message,
-        const void* DispatchTable
-)
+/*
+ * Store an entry into the dispatch cache.  Caller must hold the SB shared data lock,
+ * which serializes writers; readers do not take the lock and instead check the
+ * entry sequence number (see CFE_SB_EDS_ReadDispatchCache).
+ */
+static void CFE_SB_EDS_WriteDispatchCache_Unsync(CFE_SB_EdsDispatchCacheEntry_t *CachePtr,
+        const CFE_SB_EdsDispatchCacheEntry_t *Entry)
+{
+    CFE_SB_EdsDispatchCacheEntry_t Update;
+    uint32 Sequence;
+
+    Sequence = CachePtr->Sequence;
+    Update = *Entry;
+    Update.Sequence = Sequence + 1;
+
+    __atomic_store_n(&CachePtr->Sequence, Sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    *CachePtr = Update;
+    __atomic_store_n(&CachePtr->Sequence, Sequence + 2, __ATOMIC_RELEASE);
+}
+
+/*
+ * Look up a key in the dispatch cache without taking the SB lock.
+ * Returns true and fills in the cached result if the entry matches the key in "Entry".
+ * An entry that is being updated at the same time is treated as a miss.
+ */
+static bool CFE_SB_EDS_ReadDispatchCache(const CFE_SB_EdsDispatchCacheEntry_t *CachePtr,
+        CFE_SB_EdsDispatchCacheEntry_t *Entry)
+{
+    CFE_SB_EdsDispatchCacheEntry_t Copy;
+    uint32 Sequence;
+
+    Sequence = __atomic_load_n(&CachePtr->Sequence, __ATOMIC_ACQUIRE);
+    if ((Sequence & 1) != 0)
+    {
+        return false;
+    }
+
+    Copy = *CachePtr;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&CachePtr->Sequence, __ATOMIC_RELAXED) != Sequence)
+    {
+        return false;
+    }
+
+    if (Copy.DispatchTable != Entry->DispatchTable ||
+            !CFE_SB_MsgId_Equal(Copy.MsgId, Entry->MsgId) ||
+            Copy.InterfaceId != Entry->InterfaceId ||
+            Copy.IndicationIndex != Entry->IndicationIndex ||
+            Copy.DispatchTableID != Entry->DispatchTableID)
+    {
+        return false;
+    }
+
+    Entry->TopicId = Copy.TopicId;
+    Entry->ArgumentType = Copy.ArgumentType;
+    Entry->HandlerOffset = Copy.HandlerOffset;
+    Entry->MinMsgSize = Copy.MinMsgSize;
+    Entry->IsDerived = Copy.IsDerived;
+
+    return true;
+}
+
+/******************************************************************************
+**  Function:  CFE_SB_EDS_InvalidateDispatchCache_Unsync()
+**
+**  Purpose:
+**    Discard all entries in the EDS dispatch cache.  This must be done
+**    whenever the EDS registrations change, since the cached results may
+**    no longer be valid.  Caller must hold the SB shared data lock.
+**
+**  Arguments:
+**    None
+**
+**  Return:
+**    None
+*/
+void CFE_SB_EDS_InvalidateDispatchCache_Unsync(void)
+{
+    CFE_SB_EdsDispatchCacheEntry_t Empty;
+    uint32 i;
+
+    memset(&Empty, 0, sizeof(Empty));
+    for (i = 0; i < CFE_SB_EDS_DISPATCH_CACHE_SIZE; ++i)
+    {
+        CFE_SB_EDS_WriteDispatchCache_Unsync(&CFE_SB.EdsDispatchCache[i], &Empty);
+    }
+    __atomic_add_fetch(&CFE_SB.EdsDispatchCacheGeneration, 1, __ATOMIC_RELEASE);
+}
+
+/*
+ * Resolve a message topic to its entry in the dispatch table, via the EDS lookups.
+ * On success, fills in the topic level result in the cache entry.  This depends only
+ * on the key fields of the entry, so it is safe to cache.
+ */
+static int32 CFE_SB_EDS_ResolveTopic(
+        const CFE_SB_SoftwareBus_PubSub_Interface_t *PubSubParams,
+        CFE_SB_EdsDispatchCacheEntry_t *Entry)
 {
     const EdsLib_DatabaseObject_t *GD = CFE_SB_GetEds();
     CFE_MissionLib_TopicInfo_t TopicInfo;
     CFE_MissionLib_IndicationInfo_t IndicationInfo;
     EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
-    CFE_SB_SoftwareBus_PubSub_Interface_t PubSubParams;
     EdsLib_Id_t ArgumentType;
     int32_t Status;
     uint16_t TopicId;
-    uint16_t DispatchOffset;
-    union
-    {
-        cpuaddr MemAddr;
-        const void* GenericPtr;
-        int32 (**DispatchFunc)(const CFE_SB_Msg_t *);
-    } HandlerPtr;
-
-    HandlerPtr.GenericPtr = DispatchTable;
-    DispatchOffset = 0;
-    CFE_SB_Get_PubSub_Parameters(&PubSubParams, &Message->SpacePacket);
 
-    switch(InterfaceId)
+    switch(Entry->InterfaceId)
     {
     case CFE_SB_Telemetry_Interface_ID:
     {
         CFE_SB_Publisher_Component_t PublisherParams;
-        CFE_SB_UnmapPublisherComponent(&PublisherParams, &PubSubParams);
+        CFE_SB_UnmapPublisherComponent(&PublisherParams, PubSubParams);
         TopicId = PublisherParams.Telemetry.TopicId;
         break;
     }
     case CFE_SB_Telecommand_Interface_ID:
     {
         CFE_SB_Listener_Component_t ListenerParams;
-        CFE_SB_UnmapListenerComponent(&ListenerParams, &PubSubParams);
+        CFE_SB_UnmapListenerComponent(&ListenerParams, PubSubParams);
         TopicId = ListenerParams.Telecommand.TopicId;
         break;
     }
@@ -266,18 +345,19 @@ int32 CFE_SB_EDS_Dispatch(
         break;
     }
 
-    Status = CFE_MissionLib_GetTopicInfo(&CFE_SOFTWAREBUS_INTERFACE, InterfaceId, TopicId, &TopicInfo);
+    Status = CFE_MissionLib_GetTopicInfo(&CFE_SOFTWAREBUS_INTERFACE, Entry->InterfaceId, TopicId, &TopicInfo);
     if (Status != CFE_MISSIONLIB_SUCCESS)
     {
         return CFE_STATUS_UNKNOWN_MSG_ID;
     }
 
-    if (TopicInfo.DispatchTableId != DispatchTableID)
+    if (TopicInfo.DispatchTableId != Entry->DispatchTableID)
     {
         return CFE_SB_NO_SUBSCRIBERS;
     }
 
-    Status = CFE_MissionLib_GetIndicationInfo(&CFE_SOFTWAREBUS_INTERFACE, InterfaceId, TopicId, IndicationIndex, &IndicationInfo);
+    Status = CFE_MissionLib_GetIndicationInfo(&CFE_SOFTWAREBUS_INTERFACE, Entry->InterfaceId, TopicId,
+            Entry->IndicationIndex, &IndicationInfo);
     if (Status != CFE_MISSIONLIB_SUCCESS || IndicationInfo.NumArguments != 1)
     {
         /*
@@ -287,48 +367,159 @@ int32 CFE_SB_EDS_Dispatch(
         return CFE_SB_NOT_IMPLEMENTED;
     }
 
-    Status = CFE_MissionLib_GetArgumentType(&CFE_SOFTWAREBUS_INTERFACE, InterfaceId, TopicId, IndicationIndex, 1, &ArgumentType);
+    Status = CFE_MissionLib_GetArgumentType(&CFE_SOFTWAREBUS_INTERFACE, Entry->InterfaceId, TopicId,
+            Entry->IndicationIndex, 1, &ArgumentType);
     if (Status != CFE_MISSIONLIB_SUCCESS)
     {
         return CFE_SB_INTERNAL_ERR;
     }
 
-    if (IndicationInfo.SubcommandArgumentId == 1 && IndicationInfo.NumSubcommands > 0)
-    {
-        /* Derived command case -- the indication corresponds to a multiple entries in the dispatch table.
-         * The actual type of the argument must be determined to figure out which one to invoke. */
-        EdsLib_DataTypeDB_DerivativeObjectInfo_t DerivObjInfo;
+    Entry->TopicId = TopicId;
+    Entry->ArgumentType = ArgumentType;
+    Entry->HandlerOffset = TopicInfo.DispatchStartOffset;
+    Entry->IsDerived = (IndicationInfo.SubcommandArgumentId == 1 && IndicationInfo.NumSubcommands > 0);
+    Entry->MinMsgSize = 0;
 
-        Status = EdsLib_DataTypeDB_IdentifyBuffer(GD, ArgumentType, Message->Byte, &DerivObjInfo);
+    if (!Entry->IsDerived)
+    {
+        Status = EdsLib_DataTypeDB_GetTypeInfo(GD, ArgumentType, &TypeInfo);
         if (Status != EDSLIB_SUCCESS)
         {
-            return CFE_STATUS_UNKNOWN_MSG_ID;
+            return CFE_SB_INTERNAL_ERR;
         }
 
-        /* NOTE: The "IdentifyBuffer" outputs a 0-based index, but the Subcommand is a 1-based index */
-        Status = CFE_MissionLib_GetSubcommandOffset(&CFE_SOFTWAREBUS_INTERFACE, InterfaceId, TopicId, IndicationIndex,
-                1+ DerivObjInfo.DerivativeTableIndex, &DispatchOffset);
-        if (Status != EDSLIB_SUCCESS)
-        {
-            return CFE_STATUS_BAD_COMMAND_CODE;
-        }
+        Entry->MinMsgSize = TypeInfo.Size.Bytes;
+    }
 
-        ArgumentType = DerivObjInfo.EdsId;
+    return CFE_SUCCESS;
+}
+
+/*
+ * Derived command case -- the indication corresponds to a multiple entries in the dispatch table.
+ * The actual type of the argument must be determined from the message to figure out which one to invoke.
+ */
+static int32 CFE_SB_EDS_ResolveDerived(
+        const CFE_SB_EdsDispatchCacheEntry_t *Entry,
+        const CFE_SB_Msg_t *Message,
+        uint32 *HandlerOffset,
+        uint32 *MinMsgSize)
+{
+    const EdsLib_DatabaseObject_t *GD = CFE_SB_GetEds();
+    EdsLib_DataTypeDB_DerivativeObjectInfo_t DerivObjInfo;
+    EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
+    int32_t Status;
+    uint16_t DispatchOffset;
+
+    Status = EdsLib_DataTypeDB_IdentifyBuffer(GD, Entry->ArgumentType, Message->Byte, &DerivObjInfo);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        return CFE_STATUS_UNKNOWN_MSG_ID;
+    }
+
+    /* NOTE: The "IdentifyBuffer" outputs a 0-based index, but the Subcommand is a 1-based index */
+    Status = CFE_MissionLib_GetSubcommandOffset(&CFE_SOFTWAREBUS_INTERFACE, Entry->InterfaceId, Entry->TopicId,
+            Entry->IndicationIndex, 1 + DerivObjInfo.DerivativeTableIndex, &DispatchOffset);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        return CFE_STATUS_BAD_COMMAND_CODE;
     }
 
-    Status = EdsLib_DataTypeDB_GetTypeInfo(GD, ArgumentType, &TypeInfo);
+    Status = EdsLib_DataTypeDB_GetTypeInfo(GD, DerivObjInfo.EdsId, &TypeInfo);
     if (Status != EDSLIB_SUCCESS)
     {
         return CFE_SB_INTERNAL_ERR;
     }
 
-    if (TypeInfo.Size.Bytes > CFE_SB_GetTotalMsgLength((CFE_SB_MsgPtr_t)Message))
+    *HandlerOffset = Entry->HandlerOffset + DispatchOffset;
+    *MinMsgSize = TypeInfo.Size.Bytes;
+
+    return CFE_SUCCESS;
+}
+
+int32 CFE_SB_EDS_Dispatch(
+        uint16 InterfaceId,
+        uint16 IndicationIndex,
+        uint16 DispatchTableID,
+        const CFE_SB_Msg_t *Message,
+        const void* DispatchTable
+)
+{
+    CFE_SB_SoftwareBus_PubSub_Interface_t PubSubParams;
+    CFE_SB_EdsDispatchCacheEntry_t Entry;
+    CFE_SB_EdsDispatchCacheEntry_t *CachePtr;
+    uint32 CacheGeneration;
+    uint32 HandlerOffset;
+    uint32 MinMsgSize;
+    uint32 Hash;
+    int32 Status;
+    union
+    {
+        cpuaddr MemAddr;
+        const void* GenericPtr;
+        int32 (**DispatchFunc)(const CFE_SB_Msg_t *);
+    } HandlerPtr;
+
+    CFE_SB_Get_PubSub_Parameters(&PubSubParams, &Message->SpacePacket);
+
+    /*
+     * The cache key is everything the topic resolution depends on.  The dispatch
+     * table address is included in the key so entries from different apps never
+     * alias one another.
+     */
+    memset(&Entry, 0, sizeof(Entry));
+    Entry.DispatchTable = DispatchTable;
+    Entry.MsgId = PubSubParams;
+    Entry.InterfaceId = InterfaceId;
+    Entry.IndicationIndex = IndicationIndex;
+    Entry.DispatchTableID = DispatchTableID;
+
+    Hash = CFE_SB_MsgIdToValue(Entry.MsgId);
+    Hash = (Hash << 8) ^ (IndicationIndex << 4) ^ (uint32)((cpuaddr)DispatchTable >> 4);
+    Hash *= 0x9E3779B1;
+    CachePtr = &CFE_SB.EdsDispatchCache[(Hash >> 16) % CFE_SB_EDS_DISPATCH_CACHE_SIZE];
+
+    if (CFE_SB_EDS_ReadDispatchCache(CachePtr, &Entry))
+    {
+        __atomic_add_fetch(&CFE_SB.StatTlmMsg.Payload.EdsDispatchCacheHits, 1, __ATOMIC_RELAXED);
+    }
+    else
+    {
+        __atomic_add_fetch(&CFE_SB.StatTlmMsg.Payload.EdsDispatchCacheMisses, 1, __ATOMIC_RELAXED);
+
+        CacheGeneration = __atomic_load_n(&CFE_SB.EdsDispatchCacheGeneration, __ATOMIC_ACQUIRE);
+        Status = CFE_SB_EDS_ResolveTopic(&PubSubParams, &Entry);
+        if (Status != CFE_SUCCESS)
+        {
+            return Status;
+        }
+
+        /* Only store the result if the registrations did not change in the meantime */
+        CFE_SB_LockSharedData(__func__, __LINE__);
+        if (CacheGeneration == CFE_SB.EdsDispatchCacheGeneration)
+        {
+            CFE_SB_EDS_WriteDispatchCache_Unsync(CachePtr, &Entry);
+        }
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    HandlerOffset = Entry.HandlerOffset;
+    MinMsgSize = Entry.MinMsgSize;
+    if (Entry.IsDerived)
+    {
+        Status = CFE_SB_EDS_ResolveDerived(&Entry, Message, &HandlerOffset, &MinMsgSize);
+        if (Status != CFE_SUCCESS)
+        {
+            return Status;
+        }
+    }
+
+    if (MinMsgSize > CFE_SB_GetTotalMsgLength((CFE_SB_MsgPtr_t)Message))
     {
         return CFE_STATUS_WRONG_MSG_LENGTH;
     }
 
-    HandlerPtr.MemAddr += TopicInfo.DispatchStartOffset;
-    HandlerPtr.MemAddr += DispatchOffset;
+    HandlerPtr.GenericPtr = DispatchTable;
+    HandlerPtr.MemAddr += HandlerOffset;
     if (*HandlerPtr.DispatchFunc == NULL)
     {
         return CFE_SB_NO_SUBSCRIBERS;
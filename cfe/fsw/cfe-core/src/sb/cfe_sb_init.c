@@ -133,6 +133,9 @@ int32 CFE_SB_EarlyInit (void) {
 
     CFE_SB.ZeroCopyTail = NULL;
 
+    /* Start with an empty EDS dispatch cache */
+    CFE_SB_EDS_InvalidateDispatchCache_Unsync();
+
     /*
      * Use this early-init to register the base type
      * EDS DB objects that all other types will be based on.
@@ -208,10 +211,13 @@ void CFE_SB_InitPipeTbl(void){
     for(i=0;i<CFE_PLATFORM_SB_MAX_PIPES;i++){
         CFE_SB.PipeTbl[i].InUse         = CFE_SB_NOT_IN_USE;
         CFE_SB.PipeTbl[i].SysQueueId    = CFE_SB_UNUSED_QUEUE;
+        CFE_SB.PipeTbl[i].HighQueueId   = CFE_SB_UNUSED_QUEUE;
         CFE_SB.PipeTbl[i].PipeId        = CFE_SB_INVALID_PIPE;
         CFE_SB.PipeTbl[i].CurrentBuff   = NULL;
     }/* end for */
 
+    CFE_ES_NameIndexClear(&CFE_SB_PipeNameIndex);
+
 }/* end CFE_SB_InitPipeTbl */
 
 
@@ -232,11 +238,14 @@ void CFE_SB_InitPipeTbl(void){
 */
 void CFE_SB_InitMsgMap(void){
 
-    CFE_SB_MsgKey_Atom_t   KeyVal;
+    uint32   MapSlot;
 
-    for (KeyVal=0; KeyVal < CFE_SB_MAX_NUMBER_OF_MSG_KEYS; KeyVal++)
+    for (MapSlot=0; MapSlot < CFE_SB_MSG_MAP_SIZE; MapSlot++)
     {
-        CFE_SB.MsgMap[KeyVal] = CFE_SB_INVALID_ROUTE_IDX;
+#if (CFE_PLATFORM_SB_HASHED_MSG_MAP == true)
+        CFE_SB.MsgMap[MapSlot].MsgKey = CFE_SB_INVALID_MSG_KEY;
+#endif
+        CFE_SB.MsgMap[MapSlot].RouteIdx = CFE_SB_INVALID_ROUTE_IDX;
     }
 
 }/* end CFE_SB_InitMsgMap */
@@ -267,7 +276,8 @@ void CFE_SB_InitRoutingTbl(void){
         CFE_SB.RoutingTbl[i].MsgId = CFE_SB_INVALID_MSG_ID;
         CFE_SB.RoutingTbl[i].SeqCnt = 0;
         CFE_SB.RoutingTbl[i].Destinations = 0;
-        CFE_SB.RoutingTbl[i].ListHeadPtr = NULL;
+        CFE_SB.RoutingTbl[i].DestCapacity = 0;
+        CFE_SB.RoutingTbl[i].DestArray = NULL;
 
     }/* end for */
 
@@ -389,7 +389,8 @@ CFE_SB_DestinationD_t  *CFE_SB_GetDestPtr(CFE_SB_MsgKey_t MsgKey,
                                           CFE_SB_PipeId_t PipeId){
 
     CFE_SB_MsgRouteIdx_t    Idx;
-    CFE_SB_DestinationD_t   *DestPtr;
+    CFE_SB_RouteEntry_t     *RoutePtr;
+    uint16                  i;
 
     Idx = CFE_SB_GetRoutingTblIdx(MsgKey);
 
@@ -398,17 +399,15 @@ CFE_SB_DestinationD_t  *CFE_SB_GetDestPtr(CFE_SB_MsgKey_t MsgKey,
         return NULL;
     }/* end if */
 
-    DestPtr = CFE_SB_GetRoutePtrFromIdx(Idx)->ListHeadPtr;
+    RoutePtr = CFE_SB_GetRoutePtrFromIdx(Idx);
 
-    while(DestPtr != NULL){
+    for(i = 0; i < RoutePtr->Destinations; i++){
 
-        if(DestPtr -> PipeId == PipeId){
-            return DestPtr;
+        if(RoutePtr->DestArray[i].PipeId == PipeId){
+            return &RoutePtr->DestArray[i];
         }/* end if */
 
-        DestPtr = DestPtr->Next;
-
-    }/* end while */
+    }/* end for */
 
     return NULL;
 
@@ -436,11 +435,76 @@ CFE_SB_DestinationD_t  *CFE_SB_GetDestPtr(CFE_SB_MsgKey_t MsgKey,
 */
 CFE_SB_MsgRouteIdx_t CFE_SB_GetRoutingTblIdx(CFE_SB_MsgKey_t MsgKey){
 
-    return CFE_SB.MsgMap[CFE_SB_MsgKeyToValue(MsgKey)];
+#if (CFE_PLATFORM_SB_HASHED_MSG_MAP == true)
+
+    const CFE_SB_MsgMapEntry_t *MapPtr;
+    CFE_SB_MsgKey_t SlotKey;
+    CFE_SB_MsgRouteIdx_t RouteIdx;
+    uint32 Slot;
+    uint32 Probes;
+
+    /*
+    ** Slots are only ever claimed (never released, an unsubscribe only clears
+    ** the route index in place), and a slot's route index is stored before its
+    ** key is published with release ordering, so this probe is safe without
+    ** the SB lock: the acquire load of the key makes the route index visible,
+    ** and a reader racing with a subscription sees either nothing or a valid
+    ** entry.
+    */
+    Slot = CFE_SB_MsgMapHash(MsgKey);
+    for(Probes = 0; Probes < CFE_SB_MSG_MAP_SIZE; ++Probes){
+        MapPtr = &CFE_SB.MsgMap[Slot];
+        SlotKey.KeyIdx = __atomic_load_n(&MapPtr->MsgKey.KeyIdx, __ATOMIC_ACQUIRE);
+        if(SlotKey.KeyIdx == MsgKey.KeyIdx){
+            RouteIdx.RouteIdx = __atomic_load_n(&MapPtr->RouteIdx.RouteIdx, __ATOMIC_ACQUIRE);
+            return RouteIdx;
+        }/* end if */
+        if(!CFE_SB_IsValidMsgKey(SlotKey)){
+            break;
+        }/* end if */
+        Slot = (Slot + 1) & (CFE_SB_MSG_MAP_SIZE - 1);
+    }/* end for */
+
+    return CFE_SB_INVALID_ROUTE_IDX;
+
+#else
+
+    return CFE_SB.MsgMap[CFE_SB_MsgKeyToValue(MsgKey)].RouteIdx;
+
+#endif
 
 }/* end CFE_SB_GetRoutingTblIdx */
 
 
+/******************************************************************************
+**  Function:  CFE_SB_GetRoutingTblIdxFromSlot()
+**
+**  Purpose:
+**    SB internal function to get the routing table index stored in a given
+**    slot of the message map.  This is used to walk the entire message map,
+**    e.g. for the routing and map information files.
+**
+**  Arguments:
+**    MapSlot : slot number, 0 through CFE_SB_MSG_MAP_SIZE - 1
+**
+**  Return:
+**    The routing table index in that slot, or CFE_SB_INVALID_ROUTE_IDX if unused
+*/
+CFE_SB_MsgRouteIdx_t CFE_SB_GetRoutingTblIdxFromSlot(uint32 MapSlot){
+
+    CFE_SB_MsgRouteIdx_t RouteIdx;
+
+    if(MapSlot >= CFE_SB_MSG_MAP_SIZE){
+        return CFE_SB_INVALID_ROUTE_IDX;
+    }/* end if */
+
+    RouteIdx.RouteIdx = __atomic_load_n(&CFE_SB.MsgMap[MapSlot].RouteIdx.RouteIdx, __ATOMIC_ACQUIRE);
+
+    return RouteIdx;
+
+}/* end CFE_SB_GetRoutingTblIdxFromSlot */
+
+
 
 /******************************************************************************
 **  Function:  CFE_SB_SetRoutingTblIdx()
@@ -464,7 +528,42 @@ CFE_SB_MsgRouteIdx_t CFE_SB_GetRoutingTblIdx(CFE_SB_MsgKey_t MsgKey){
 */
 void CFE_SB_SetRoutingTblIdx(CFE_SB_MsgKey_t MsgKey, CFE_SB_MsgRouteIdx_t Value){
 
-    CFE_SB.MsgMap[CFE_SB_MsgKeyToValue(MsgKey)] = Value;
+#if (CFE_PLATFORM_SB_HASHED_MSG_MAP == true)
+
+    CFE_SB_MsgMapEntry_t *MapPtr;
+    uint32 Slot;
+    uint32 Probes;
+
+    Slot = CFE_SB_MsgMapHash(MsgKey);
+    for(Probes = 0; Probes < CFE_SB_MSG_MAP_SIZE; ++Probes){
+        MapPtr = &CFE_SB.MsgMap[Slot];
+        if(MapPtr->MsgKey.KeyIdx == MsgKey.KeyIdx){
+            /* in-place update or clear, seen by lock-free readers of this slot */
+            __atomic_store_n(&MapPtr->RouteIdx.RouteIdx, Value.RouteIdx, __ATOMIC_RELEASE);
+            return;
+        }/* end if */
+        if(!CFE_SB_IsValidMsgKey(MapPtr->MsgKey)){
+            /* nothing to do when clearing a key that was never mapped */
+            if(CFE_SB_IsValidRouteIdx(Value)){
+                /* route index first, then the key which publishes the slot */
+                __atomic_store_n(&MapPtr->RouteIdx.RouteIdx, Value.RouteIdx, __ATOMIC_RELAXED);
+                __atomic_store_n(&MapPtr->MsgKey.KeyIdx, MsgKey.KeyIdx, __ATOMIC_RELEASE);
+            }/* end if */
+            return;
+        }/* end if */
+        Slot = (Slot + 1) & (CFE_SB_MSG_MAP_SIZE - 1);
+    }/* end for */
+
+    /*
+    ** Not reachable in practice: there are never more keys than routes, and
+    ** the map has at least twice as many slots as there are routes.
+    */
+
+#else
+
+    CFE_SB.MsgMap[CFE_SB_MsgKeyToValue(MsgKey)].RouteIdx = Value;
+
+#endif
 
 }/* end CFE_SB_SetRoutingTblIdx */
 
@@ -510,28 +609,25 @@ int32 CFE_SB_DuplicateSubscribeCheck(CFE_SB_MsgKey_t MsgKey,
                                        CFE_SB_PipeId_t PipeId){
 
     CFE_SB_MsgRouteIdx_t    Idx;
-    CFE_SB_DestinationD_t   *DestPtr;
+    CFE_SB_RouteEntry_t     *RoutePtr;
+    uint16                  i;
 
     Idx = CFE_SB_GetRoutingTblIdx(MsgKey);
 
     if(!CFE_SB_IsValidRouteIdx(Idx))
     {
-        DestPtr = NULL;
-    }
-    else
-    {
-        DestPtr = CFE_SB_GetRoutePtrFromIdx(Idx)->ListHeadPtr;
+        return CFE_SB_NO_DUPLICATE;
     }/* end if */
 
-    while(DestPtr != NULL){
+    RoutePtr = CFE_SB_GetRoutePtrFromIdx(Idx);
+
+    for(i = 0; i < RoutePtr->Destinations; i++){
 
-        if(DestPtr -> PipeId == PipeId){
+        if(RoutePtr->DestArray[i].PipeId == PipeId){
             return CFE_SB_DUPLICATE;
         }/* end if */
 
-        DestPtr = DestPtr->Next;
-
-    }/* end while */
+    }/* end for */
 
     return CFE_SB_NO_DUPLICATE;
 
@@ -722,43 +818,65 @@ void CFE_SB_FinishSendEvent(uint32 TaskId, uint32 Bit){
 **  Function:  CFE_SB_AddDest()
 **
 **  Purpose:
-**      This function will add the given node to the head of the list.
+**      This function will add a copy of the given destination to the head of
+**      the route's destination array, growing the array if it is full.  This
+**      (and CFE_SB_RemoveDest) does all the rearranging of the array so that
+**      sending a message only ever walks it in order.
+**
+**  Assumptions, External Events, and Notes:
+**      Calls to this function assumed to be protected by a semaphore.  The
+**      caller has already checked that there is room for another destination
+**      under CFE_PLATFORM_SB_MAX_DEST_PER_PKT.
 **
 **  Arguments:
-**      RtgTblIdx - Routing table index
-**      Dest - Pointer to the destination block to add to the list
+**      RouteEntry - Pointer to the routing table entry
+**      NewDest - Destination descriptor to add
 **
 **  Return:
-**
+**      CFE_SUCCESS, or CFE_SB_BUF_ALOC_ERR if the array could not be grown
 */
-int32 CFE_SB_AddDest(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_DestinationD_t *NewNode){
+int32 CFE_SB_AddDest(CFE_SB_RouteEntry_t *RouteEntry, const CFE_SB_DestinationD_t *NewDest){
 
-    CFE_SB_DestinationD_t *WBS;/* Will Be Second (WBS) node */
+    CFE_SB_DestinationD_t *NewArray;
+    uint16 NewCapacity;
 
-    /* if first node in list */
-    if(RouteEntry->ListHeadPtr == NULL){
+    /* if the array is full (or not allocated yet), move it into a bigger one */
+    if(RouteEntry->Destinations >= RouteEntry->DestCapacity){
 
-        /* initialize the new node */
-        NewNode->Next = NULL;
-        NewNode->Prev = NULL;
+        if(RouteEntry->DestCapacity == 0){
+            NewCapacity = CFE_SB_MIN_DESTS_PER_ROUTE;
+        }else{
+            NewCapacity = 2 * RouteEntry->DestCapacity;
+        }/* end if */
 
-        /* insert the new node */
-        RouteEntry->ListHeadPtr = NewNode;
+        if(NewCapacity > CFE_PLATFORM_SB_MAX_DEST_PER_PKT){
+            NewCapacity = CFE_PLATFORM_SB_MAX_DEST_PER_PKT;
+        }/* end if */
 
-    }else{
+        NewArray = CFE_SB_GetDestinationBlk(NewCapacity);
+        if(NewArray == NULL){
+            return CFE_SB_BUF_ALOC_ERR;
+        }/* end if */
+
+        if(RouteEntry->DestArray != NULL){
+            memcpy(&NewArray[1], RouteEntry->DestArray,
+                   RouteEntry->Destinations * sizeof(CFE_SB_DestinationD_t));
+            CFE_SB_PutDestinationBlk(RouteEntry->DestArray);
+        }/* end if */
 
-        WBS = RouteEntry->ListHeadPtr;
+        RouteEntry->DestArray = NewArray;
+        RouteEntry->DestCapacity = NewCapacity;
 
-        /* initialize the new node */
-        NewNode->Next = WBS;
-        NewNode->Prev = NULL;
+    }else{
 
-        /* insert the new node */
-        WBS -> Prev = NewNode;
-        RouteEntry->ListHeadPtr = NewNode;
+        memmove(&RouteEntry->DestArray[1], &RouteEntry->DestArray[0],
+                RouteEntry->Destinations * sizeof(CFE_SB_DestinationD_t));
 
     }/* end if */
 
+    RouteEntry->DestArray[0] = *NewDest;
+    RouteEntry->Destinations++;
+
     return CFE_SUCCESS;
 
 }/* CFE_SB_AddDest */
@@ -769,58 +887,43 @@ int32 CFE_SB_AddDest(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_DestinationD_t *New
 **  Function:  CFE_SB_RemoveDest()
 **
 **  Purpose:
-**      This function will remove the given node from the list.
-**      This function assumes there is at least one node in the list.
+**      This function will remove the given destination from the route's
+**      destination array, keeping the remaining entries in order.  The array
+**      is returned to the memory pool when its last destination is removed.
+**
+**  Assumptions, External Events, and Notes:
+**      Calls to this function assumed to be protected by a semaphore
 **
 **  Arguments:
-**      RtgTblIdx - Routing table index
-**      Dest - Pointer to the destination block to remove from the list
+**      RouteEntry - Pointer to the routing table entry
+**      DestToRemove - Pointer to an entry within the route's destination array
 **
 **  Return:
 **
 */
-int32 CFE_SB_RemoveDest(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_DestinationD_t *NodeToRemove){
-
-    CFE_SB_DestinationD_t *PrevNode;
-    CFE_SB_DestinationD_t *NextNode;
-
-    /* if this is the only node in the list */
-    if((NodeToRemove->Prev == NULL) && (NodeToRemove->Next == NULL)){
-
-        RouteEntry->ListHeadPtr = NULL;
-
-    /* if first node in the list and list has more than one */
-    }else if(NodeToRemove->Prev == NULL){
+int32 CFE_SB_RemoveDest(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_DestinationD_t *DestToRemove){
 
-        NextNode = NodeToRemove->Next;
+    uint16 Idx;
 
-        NextNode -> Prev = NULL;
+    Idx = DestToRemove - RouteEntry->DestArray;
 
-        RouteEntry->ListHeadPtr = NextNode;
-
-    /* if last node in the list and list has more than one */
-    }else if(NodeToRemove->Next == NULL){
-
-        PrevNode = NodeToRemove->Prev;
-
-        PrevNode -> Next = NULL;
-
-    /* NodeToRemove has node(s) before and node(s) after */
-    }else{
+    /* drop the reference held for a latest value subscription */
+    if(DestToRemove->LatestBuff != NULL){
+        CFE_SB_DecrBufUseCnt(DestToRemove->LatestBuff);
+        DestToRemove->LatestBuff = NULL;
+    }/* end if */
 
-        PrevNode = NodeToRemove->Prev;
-        NextNode = NodeToRemove->Next;
+    RouteEntry->Destinations--;
 
-        PrevNode -> Next = NextNode;
-        NextNode -> Prev = PrevNode;
+    memmove(&RouteEntry->DestArray[Idx], &RouteEntry->DestArray[Idx + 1],
+            (RouteEntry->Destinations - Idx) * sizeof(CFE_SB_DestinationD_t));
 
+    if(RouteEntry->Destinations == 0){
+        CFE_SB_PutDestinationBlk(RouteEntry->DestArray);
+        RouteEntry->DestArray = NULL;
+        RouteEntry->DestCapacity = 0;
     }/* end if */
 
-
-    /* initialize the node before returning it to the heap */
-    NodeToRemove -> Next = NULL;
-    NodeToRemove -> Prev = NULL;
-
     return CFE_SUCCESS;
 
 }/* CFE_SB_RemoveDest */
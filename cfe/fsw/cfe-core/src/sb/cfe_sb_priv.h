@@ -37,6 +37,7 @@
 */
 #include "common_types.h"
 #include "private/cfe_private.h"
+#include "private/cfe_es_nameindex.h"
 #include "cfe_sb.h"
 #include "cfe_sb_msg.h"
 #include "cfe_time.h"
@@ -91,6 +92,9 @@
 #define CFE_SB_USECNT_ERR               (-3)
 #define CFE_SB_FILE_IO_ERR              (-5)
 
+/* priority of the ES async jobs that write the SB information files */
+#define CFE_SB_FILE_DUMP_JOB_PRIORITY   100
+
 /* bit map for stopping recursive event problem */
 #define CFE_SB_SEND_NO_SUBS_EID_BIT     0
 #define CFE_SB_GET_BUF_ERR_EID_BIT      1
@@ -105,6 +109,37 @@
  * If using an alternative key function / hash, this may change.
  */
 #define CFE_SB_MAX_NUMBER_OF_MSG_KEYS   (1+CFE_PLATFORM_SB_HIGHEST_VALID_MSGID)
+
+#if (CFE_PLATFORM_SB_HASHED_MSG_MAP == true)
+/*
+ * The hashed message map is an open-addressed table which is kept at most half
+ * full, so it is sized to the next power of two of twice the number of routes.
+ * The power of two allows the probe sequence to wrap with a simple mask.
+ */
+#define CFE_SB_MSG_MAP_ROUNDUP_1(x)     ((x) | ((x) >> 1))
+#define CFE_SB_MSG_MAP_ROUNDUP_2(x)     (CFE_SB_MSG_MAP_ROUNDUP_1(x) | (CFE_SB_MSG_MAP_ROUNDUP_1(x) >> 2))
+#define CFE_SB_MSG_MAP_ROUNDUP_4(x)     (CFE_SB_MSG_MAP_ROUNDUP_2(x) | (CFE_SB_MSG_MAP_ROUNDUP_2(x) >> 4))
+#define CFE_SB_MSG_MAP_ROUNDUP_8(x)     (CFE_SB_MSG_MAP_ROUNDUP_4(x) | (CFE_SB_MSG_MAP_ROUNDUP_4(x) >> 8))
+#define CFE_SB_MSG_MAP_ROUNDUP_16(x)    (CFE_SB_MSG_MAP_ROUNDUP_8(x) | (CFE_SB_MSG_MAP_ROUNDUP_8(x) >> 16))
+#define CFE_SB_MSG_MAP_SIZE             (1 + CFE_SB_MSG_MAP_ROUNDUP_16((2 * CFE_PLATFORM_SB_MAX_MSG_IDS) - 1))
+#else
+/*
+ * The dense message map has one slot per message key
+ */
+#define CFE_SB_MSG_MAP_SIZE             CFE_SB_MAX_NUMBER_OF_MSG_KEYS
+#endif
+
+/*
+ * Number of destinations allocated for a route on its first subscription.
+ * The array doubles (up to CFE_PLATFORM_SB_MAX_DEST_PER_PKT) when it fills.
+ */
+#define CFE_SB_MIN_DESTS_PER_ROUTE      4
+
+/*
+ * Number of entries in the EDS dispatch cache.  This is direct-mapped,
+ * so collisions simply evict the previous entry.
+ */
+#define CFE_SB_EDS_DISPATCH_CACHE_SIZE  64
 /*
 ** Type Definitions
 */
@@ -156,6 +191,25 @@ typedef struct
 } CFE_SB_MsgRouteIdx_t;
 
 
+/******************************************************************************
+**  Typedef:  CFE_SB_MsgMapEntry_t
+**
+**  Purpose:
+**     This structure defines a single slot in the SB message map.
+**
+**     With the dense map the slot position is the message key, so only the
+**     routing table index is stored.  With the hashed map the slot also holds
+**     the message key which it belongs to, which is invalid for an unused slot.
+*/
+typedef struct
+{
+#if (CFE_PLATFORM_SB_HASHED_MSG_MAP == true)
+    CFE_SB_MsgKey_t         MsgKey;
+#endif
+    CFE_SB_MsgRouteIdx_t    RouteIdx;
+} CFE_SB_MsgMapEntry_t;
+
+
 /******************************************************************************
 **  Typedef:  CFE_SB_BufferD_t
 **
@@ -173,6 +227,7 @@ typedef struct {
      uint32            Size;
      void              *Buffer;
      CFE_SB_SenderId_t Sender;
+     OS_time_t         SendTime;   /**< Only set when sent to a pipe with a high priority lane */
 } CFE_SB_BufferD_t;
 
 
@@ -183,20 +238,31 @@ typedef struct {
 **     This structure defines a DESTINATION DESCRIPTOR used to specify
 **     each destination pipe for a message.
 **
+**     The destinations of a route are kept in one contiguous array (see
+**     CFE_SB_RouteEntry_t), so this descriptor has no links.  The fields
+**     checked and updated for every delivery are grouped at the start.
+**
+**     LatestBuff is only used by "latest value" subscriptions: it holds the
+**     newest message published while an older one is still on the pipe, and
+**     is handed to the receiver in place of the older one.
+**
 **     Note: Changing the size of this structure may require the memory pool
 **     block sizes to change.
 */
 
 typedef struct {
-     CFE_SB_PipeId_t PipeId;
-     uint8           Active;
-     uint16          MsgId2PipeLim;
-     uint16          BuffCount;
-     uint16          DestCnt;
-     uint8           Scope;
-     uint8           Spare[3];
-     void            *Prev;
-     void            *Next;
+     CFE_SB_PipeId_t   PipeId;
+     uint8             Active;
+     uint16            MsgId2PipeLim;
+     uint16            BuffCount;
+     uint16            DestCnt;
+     uint8             Scope;
+     uint8             Opts;           /**< Subscription options, see #CFE_SB_SUBOPTS_LATEST */
+     uint16            Decimation;     /**< Forward one of every Decimation messages (0 or 1 = all) */
+     uint16            DecimateCnt;    /**< Position within the current decimation cycle */
+     CFE_SB_QosPriority_Enum_t Priority; /**< Pipe lane, from the Priority of the subscription QoS */
+     uint8             Spare;
+     CFE_SB_BufferD_t *LatestBuff;     /**< Newest undelivered message of a latest value subscription */
 } CFE_SB_DestinationD_t;
 
 
@@ -229,9 +295,10 @@ typedef struct {
 
 typedef struct {
      CFE_SB_MsgId_t        MsgId;    /**< Original Message Id when the subscription was created */
-     uint16                Destinations;
+     uint16                Destinations;   /**< Number of entries in use in DestArray */
+     uint16                DestCapacity;   /**< Number of entries allocated in DestArray */
      uint32                SeqCnt;
-     CFE_SB_DestinationD_t *ListHeadPtr;
+     CFE_SB_DestinationD_t *DestArray;     /**< Destinations, most recent subscription first */
 } CFE_SB_RouteEntry_t;
 
 
@@ -241,6 +308,11 @@ typedef struct {
 **  Purpose:
 **     This structure defines a pipe descriptor used to specify the
 **     characteristics and status of a pipe.
+**
+**     A pipe gets a high priority lane, a second queue, with its first high
+**     priority subscription.  From then on the receiver pends on WakeSemId,
+**     which is given once for every message put on either queue, and
+**     CFE_SB_ReadQueue always drains the high priority lane first.
 */
 
 typedef struct {
@@ -251,14 +323,50 @@ typedef struct {
      uint8              Spare;
      uint32             AppId;
      uint32             SysQueueId;
+     uint32             HighQueueId;
+     uint32             WakeSemId;      /**< Counts the messages on both queues, only with a high priority lane */
      CFE_SB_MsgId_t     LastSender;
      uint16             QueueDepth;
      uint16             SendErrors;
      CFE_SB_BufferD_t  *CurrentBuff;
      CFE_SB_BufferD_t  *ToTrashBuff;
+     char               PipeName[OS_MAX_API_NAME];
 } CFE_SB_PipeD_t;
 
 
+/******************************************************************************
+**  Typedef:  CFE_SB_EdsDispatchCacheEntry_t
+**
+**  Purpose:
+**     This structure defines an entry in the EDS dispatch cache.  It holds the
+**     result of resolving a message topic to its place in an application
+**     dispatch table, so that repeated messages do not need the full EDS lookup.
+**
+**     Where the indication argument has derived types (e.g. commands selected
+**     by function code), only the topic level result is cached and the derived
+**     type is identified from each message, since the MsgId alone does not
+**     determine the handler.
+**
+**     Entries are read without the SB lock.  Sequence is odd while an entry is
+**     being updated (with the SB lock held), and a reader only uses an entry if
+**     Sequence is even and unchanged across its copy of the entry.
+*/
+
+typedef struct {
+     uint32             Sequence;          /**< Update count, odd while the entry is being written */
+     const void         *DispatchTable;     /**< Dispatch table passed in by the app, NULL if entry unused */
+     CFE_SB_MsgId_t     MsgId;
+     uint16             InterfaceId;
+     uint16             IndicationIndex;
+     uint16             DispatchTableID;
+     uint16             TopicId;           /**< Topic the MsgId resolved to */
+     uint32             ArgumentType;      /**< EdsLib_Id_t of the indication argument (base type if derived) */
+     uint32             HandlerOffset;     /**< Byte offset of the handler (or first subcommand handler) in the dispatch table */
+     uint32             MinMsgSize;        /**< Native size of the argument type, not used if IsDerived */
+     bool               IsDerived;         /**< Argument has derived types, identified per message */
+} CFE_SB_EdsDispatchCacheEntry_t;
+
+
 
 /******************************************************************************
 **  Typedef:  CFE_SB_BufParams_t
@@ -288,12 +396,13 @@ typedef struct {
     uint32              StopRecurseFlags[CFE_PLATFORM_ES_MAX_APPLICATIONS];
     void               *ZeroCopyTail;
     CFE_SB_PipeD_t      PipeTbl[CFE_PLATFORM_SB_MAX_PIPES];
+    CFE_ES_NameIndexSlot_t PipeNameSlots[CFE_ES_NAMEINDEX_SIZE(CFE_PLATFORM_SB_MAX_PIPES)];
     CFE_SB_HousekeepingTlm_t        HKTlmMsg;
     CFE_SB_StatsTlm_t               StatTlmMsg;
     CFE_SB_PipeId_t     CmdPipe;
     CFE_SB_Msg_t        *CmdPipePktPtr;
     CFE_SB_MemParams_t  Mem;
-    CFE_SB_MsgRouteIdx_t      MsgMap[CFE_SB_MAX_NUMBER_OF_MSG_KEYS];
+    CFE_SB_MsgMapEntry_t      MsgMap[CFE_SB_MSG_MAP_SIZE];
     CFE_SB_RouteEntry_t RoutingTbl[CFE_PLATFORM_SB_MAX_MSG_IDS];
     CFE_SB_AllSubscriptionsTlm_t    PrevSubMsg;
     CFE_SB_SingleSubscriptionTlm_t  SubRprtMsg;
@@ -302,6 +411,12 @@ typedef struct {
     uint16 RouteIdxTop;
     CFE_SB_MsgRouteIdx_t RouteIdxStack[CFE_PLATFORM_SB_MAX_MSG_IDS];
 
+    uint32 FileDumpCmdCount;    /**< File dumps completed by the ES async workers, not yet counted */
+    uint32 FileDumpErrCount;    /**< File dumps failed in the ES async workers, not yet counted */
+
+    uint32 EdsDispatchCacheGeneration;
+    CFE_SB_EdsDispatchCacheEntry_t EdsDispatchCache[CFE_SB_EDS_DISPATCH_CACHE_SIZE];
+
 }cfe_sb_t;
 
 
@@ -348,10 +463,12 @@ void   CFE_SB_LockSharedData(const char *FuncName, int32 LineNumber);
 void   CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber);
 void   CFE_SB_ReleaseBuffer (CFE_SB_BufferD_t *bd, CFE_SB_DestinationD_t *dest);
 int32  CFE_SB_ReadQueue(CFE_SB_PipeD_t *PipeDscPtr,uint32 TskId,
-                        CFE_SB_TimeOut_t Time_Out,CFE_SB_BufferD_t **Message );
+                        CFE_SB_TimeOut_t Time_Out,CFE_SB_BufferD_t **Message,
+                        CFE_SB_QosPriority_Enum_t *LanePtr );
 int32  CFE_SB_WriteQueue(CFE_SB_PipeD_t *pd,uint32 TskId,
                          const CFE_SB_BufferD_t *bd,CFE_SB_MsgId_t MsgId );
 CFE_SB_MsgRouteIdx_t CFE_SB_GetRoutingTblIdx(CFE_SB_MsgKey_t MsgKey);
+CFE_SB_MsgRouteIdx_t CFE_SB_GetRoutingTblIdxFromSlot(uint32 MapSlot);
 uint8  CFE_SB_GetPipeIdx(CFE_SB_PipeId_t PipeId);
 int32  CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
 void   CFE_SB_ProcessCmdPipePkt(void);
@@ -380,9 +497,10 @@ int32 CFE_SB_UnsubscribeWithAppId(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
 int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
                               uint8 Scope, uint32 AppId);
 int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t   *MsgPtr, uint32 TlmCntIncrements, uint32 CopyMode);
-int32 CFE_SB_SendRtgInfo(const char *Filename);
-int32 CFE_SB_SendPipeInfo(const char *Filename);
-int32 CFE_SB_SendMapInfo(const char *Filename);
+int32 CFE_SB_SendRtgInfo(const char *Filename, uint32 AppId);
+int32 CFE_SB_SendPipeInfo(const char *Filename, uint32 AppId);
+int32 CFE_SB_SendMapInfo(const char *Filename, uint32 AppId);
+void  CFE_SB_CollectFileDumpCounters(void);
 int32 CFE_SB_ZeroCopyReleaseDesc(CFE_SB_Msg_t *Ptr2Release, CFE_SB_ZeroCopyHandle_t BufferHandle);
 int32 CFE_SB_ZeroCopyReleaseAppId(uint32         AppId);
 int32 CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd);
@@ -394,10 +512,11 @@ void CFE_SB_SetSubscriptionReporting(uint32 state);
 uint32 CFE_SB_FindGlobalMsgIdCnt(void);
 uint32 CFE_SB_RequestToSendEvent(uint32 TaskId, uint32 Bit);
 void CFE_SB_FinishSendEvent(uint32 TaskId, uint32 Bit);
-CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void);
+CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(uint16 NumDests);
 int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest);
-int32 CFE_SB_AddDest(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_DestinationD_t *NewNode);
-int32 CFE_SB_RemoveDest(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_DestinationD_t *NodeToRemove);
+int32 CFE_SB_AddDest(CFE_SB_RouteEntry_t *RouteEntry, const CFE_SB_DestinationD_t *NewDest);
+int32 CFE_SB_RemoveDest(CFE_SB_RouteEntry_t *RouteEntry, CFE_SB_DestinationD_t *DestToRemove);
+void CFE_SB_EDS_InvalidateDispatchCache_Unsync(void);
 
 
 /*****************************************************************************/
@@ -453,6 +572,11 @@ int32 CFE_SB_SendPrevSubsCmd(const CFE_SB_SendPrevSubs_t *data);
 
 extern cfe_sb_t CFE_SB;
 
+/*
+ * Name index of the pipe table, protected by the SB shared data lock
+ */
+extern const CFE_ES_NameIndex_t CFE_SB_PipeNameIndex;
+
 
 
 /* ---------------------------------------------------------
@@ -475,7 +599,11 @@ extern cfe_sb_t CFE_SB;
  */
 static inline bool CFE_SB_IsValidMsgKey(CFE_SB_MsgKey_t MsgKey)
 {
+#if (CFE_PLATFORM_SB_HASHED_MSG_MAP == true)
+    return (MsgKey.KeyIdx != 0);
+#else
     return (MsgKey.KeyIdx != 0 && MsgKey.KeyIdx <= CFE_SB_MAX_NUMBER_OF_MSG_KEYS);
+#endif
 }
 
 /**
@@ -519,6 +647,27 @@ static inline CFE_SB_MsgKey_t CFE_SB_ValueToMsgKey(CFE_SB_MsgKey_Atom_t KeyIdx)
     return ((CFE_SB_MsgKey_t){ .KeyIdx = 1 + KeyIdx });
 }
 
+#if (CFE_PLATFORM_SB_HASHED_MSG_MAP == true)
+/**
+ * @brief Computes the home slot of a CFE_SB_MsgKey_t in the hashed message map
+ *
+ * Message IDs tend to differ in only a few bit positions (APID, command/telemetry
+ * bit, instance number) so the key is scrambled with a multiplicative hash before
+ * being masked down to the table size.
+ *
+ * @returns The first slot to probe for the key
+ */
+static inline uint32 CFE_SB_MsgMapHash(CFE_SB_MsgKey_t MsgKey)
+{
+    uint32 Hash;
+
+    Hash = MsgKey.KeyIdx * 0x9E3779B1;
+    Hash ^= Hash >> 16;
+
+    return (Hash & (CFE_SB_MSG_MAP_SIZE - 1));
+}
+#endif
+
 /**
  * @brief Converts between a CFE_SB_MsgRouteIdx_t and a raw value
  *
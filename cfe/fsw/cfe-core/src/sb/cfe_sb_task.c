@@ -50,6 +50,15 @@
 cfe_sb_t                CFE_SB;
 CFE_SB_Qos_t            CFE_SB_Default_Qos;
 
+const CFE_ES_NameIndex_t CFE_SB_PipeNameIndex =
+{
+    .Slots = CFE_SB.PipeNameSlots,
+    .NumSlots = CFE_ES_NAMEINDEX_SIZE(CFE_PLATFORM_SB_MAX_PIPES),
+    .NameBase = CFE_SB.PipeTbl[0].PipeName,
+    .NameStride = sizeof(CFE_SB_PipeD_t),
+    .NameLength = sizeof(CFE_SB.PipeTbl[0].PipeName)
+};
+
 /* Include the EDS for CFE SB */
 #include "cfe_sb_eds_dictionary.h"
 #include "cfe_sb_eds_dispatcher.h"
@@ -460,6 +469,8 @@ int32 CFE_SB_DisableSubReportingCmd(const CFE_SB_DisableSubReporting_t *data)
 */
 int32 CFE_SB_SendHKTlmCmd(const CFE_SB_SendHkCommand_t *data)
 {
+    CFE_SB_CollectFileDumpCounters();
+
     CFE_SB.HKTlmMsg.Payload.MemInUse        = CFE_SB.StatTlmMsg.Payload.MemInUse;
     CFE_SB.HKTlmMsg.Payload.UnmarkedMem     = CFE_PLATFORM_SB_BUF_MEMORY_BYTES - CFE_SB.StatTlmMsg.Payload.PeakMemInUse;
     
@@ -487,6 +498,10 @@ int32 CFE_SB_SendHKTlmCmd(const CFE_SB_SendHkCommand_t *data)
 */
 void CFE_SB_ResetCounters(void){
 
+   /* results of file dumps completed before the reset are not counted */
+   __atomic_store_n(&CFE_SB.FileDumpCmdCount, 0, __ATOMIC_RELAXED);
+   __atomic_store_n(&CFE_SB.FileDumpErrCount, 0, __ATOMIC_RELAXED);
+
    CFE_SB.HKTlmMsg.Payload.CommandCounter          = 0;
    CFE_SB.HKTlmMsg.Payload.CommandErrorCounter           = 0;
    CFE_SB.HKTlmMsg.Payload.NoSubscribersCounter    = 0;
@@ -657,6 +672,129 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStats_t *data)
 }/* CFE_SB_SendStatsCmd */
 
 
+/*
+** Argument of the async job that writes one of the SB information files
+*/
+typedef struct
+{
+    int32 (*WriteFunc)(const char *Filename, uint32 AppId);
+    uint32 AppId;                    /**< App that requested the file, recorded in its header */
+    char   Filename[OS_MAX_PATH_LEN];
+} CFE_SB_FileDumpJob_t;
+
+/*
+** The job argument is used in place from the ES queue, which only holds
+** CFE_PLATFORM_ES_ASYNC_JOB_ARG_SIZE bytes aligned for uint64 and pointers
+*/
+CompileTimeAssert(sizeof(CFE_SB_FileDumpJob_t) <= CFE_PLATFORM_ES_ASYNC_JOB_ARG_SIZE, SbFileDumpJobArgSizeError);
+CompileTimeAssert(__alignof__(CFE_SB_FileDumpJob_t) <= __alignof__(uint64) ||
+                  __alignof__(CFE_SB_FileDumpJob_t) <= __alignof__(void *), SbFileDumpJobArgAlignError);
+
+/******************************************************************************
+**  Function:  CFE_SB_FileDumpJob()
+**
+**  Purpose:
+**    ES async job function that writes one of the SB information files
+**
+**  Arguments:
+**    Pointer to the CFE_SB_FileDumpJob_t describing the file
+**
+**  Return:
+**    Status of the file write function
+*/
+static int32 CFE_SB_FileDumpJob(void *JobArg)
+{
+    const CFE_SB_FileDumpJob_t *Job = JobArg;
+
+    return Job->WriteFunc(Job->Filename, Job->AppId);
+}/* end CFE_SB_FileDumpJob */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_FileDumpDone()
+**
+**  Purpose:
+**    ES async job completion function for the SB information files.  The
+**    command counters reflect the result of the write, as they did when the
+**    files were written directly by the SB task.  This runs on the ES worker,
+**    so the result is only recorded here and added to the command counters
+**    by the SB task, see CFE_SB_CollectFileDumpCounters().
+**
+**  Arguments:
+**    Pointer to the CFE_SB_FileDumpJob_t describing the file, job status
+**
+**  Return:
+**    None
+*/
+static void CFE_SB_FileDumpDone(void *JobArg, int32 Status)
+{
+    if(Status == CFE_SUCCESS){
+        __atomic_add_fetch(&CFE_SB.FileDumpCmdCount, 1, __ATOMIC_RELAXED);
+    }else{
+        __atomic_add_fetch(&CFE_SB.FileDumpErrCount, 1, __ATOMIC_RELAXED);
+    }/* end if */
+}/* end CFE_SB_FileDumpDone */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_CollectFileDumpCounters()
+**
+**  Purpose:
+**    SB internal function to add the results of the file dumps completed by
+**    the ES async workers to the command counters.  Called by the SB task,
+**    so that the command counters are only ever updated by the SB task.
+**
+**  Arguments:
+**    None
+**
+**  Return:
+**    None
+*/
+void CFE_SB_CollectFileDumpCounters(void)
+{
+    CFE_SB.HKTlmMsg.Payload.CommandCounter +=
+            __atomic_exchange_n(&CFE_SB.FileDumpCmdCount, 0, __ATOMIC_RELAXED);
+    CFE_SB.HKTlmMsg.Payload.CommandErrorCounter +=
+            __atomic_exchange_n(&CFE_SB.FileDumpErrCount, 0, __ATOMIC_RELAXED);
+}/* end CFE_SB_CollectFileDumpCounters */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_SubmitFileDump()
+**
+**  Purpose:
+**    SB internal function to queue the write of one of the SB information
+**    files as an ES async job, so that the SB command pipe continues to be
+**    serviced while the file is written.
+**
+**  Arguments:
+**    File write function, pointer to a filename
+**
+**  Return:
+**    None
+*/
+static void CFE_SB_SubmitFileDump(int32 (*WriteFunc)(const char *Filename, uint32 AppId), const char *Filename)
+{
+    CFE_SB_FileDumpJob_t Job;
+    int32 Stat;
+
+    Job.WriteFunc = WriteFunc;
+    Job.AppId = CFE_SB.AppId;
+    strncpy(Job.Filename, Filename, sizeof(Job.Filename) - 1);
+    Job.Filename[sizeof(Job.Filename) - 1] = '\0';
+
+    Stat = CFE_ES_SubmitAsyncJob(CFE_SB_FileDumpJob, CFE_SB_FileDumpDone,
+            &Job, sizeof(Job), CFE_SB_FILE_DUMP_JOB_PRIORITY);
+    if(Stat != CFE_SUCCESS){
+        CFE_EVS_SendEvent(CFE_SB_SND_RTG_ERR1_EID,CFE_EVS_EventType_ERROR,
+                          "Error queuing write of file %s, stat=0x%x",
+                          Filename,(unsigned int)Stat);
+        CFE_SB_IncrCmdCtr(Stat);
+    }/* end if */
+
+}/* end CFE_SB_SubmitFileDump */
+
+
 /******************************************************************************
 **  Function:  CFE_SB_SendRoutingInfoCmd()
 **
@@ -673,15 +811,13 @@ int32 CFE_SB_SendRoutingInfoCmd(const CFE_SB_SendRoutingInfo_t *data)
 {
     const CFE_SB_WriteFileInfoCmd_Payload_t *ptr;
     char LocalFilename[OS_MAX_PATH_LEN];
-    int32 Stat;
 
     ptr = &data->Payload;
 
     CFE_SB_MessageStringGet(LocalFilename, ptr->Filename, CFE_PLATFORM_SB_DEFAULT_ROUTING_FILENAME,
             OS_MAX_PATH_LEN, sizeof(ptr->Filename));
 
-    Stat = CFE_SB_SendRtgInfo(LocalFilename);
-    CFE_SB_IncrCmdCtr(Stat);
+    CFE_SB_SubmitFileDump(CFE_SB_SendRtgInfo, LocalFilename);
 
     return CFE_SUCCESS;
 }/* end CFE_SB_SendRoutingInfoCmd */
@@ -703,15 +839,13 @@ int32 CFE_SB_SendPipeInfoCmd(const CFE_SB_SendPipeInfo_t *data)
 {
     const CFE_SB_WriteFileInfoCmd_Payload_t *ptr;
     char LocalFilename[OS_MAX_PATH_LEN];
-    int32 Stat;
 
     ptr = &data->Payload;
 
     CFE_SB_MessageStringGet(LocalFilename, ptr->Filename, CFE_PLATFORM_SB_DEFAULT_PIPE_FILENAME,
             OS_MAX_PATH_LEN, sizeof(ptr->Filename));
 
-    Stat = CFE_SB_SendPipeInfo(LocalFilename);
-    CFE_SB_IncrCmdCtr(Stat);
+    CFE_SB_SubmitFileDump(CFE_SB_SendPipeInfo, LocalFilename);
 
     return CFE_SUCCESS;
 }/* end CFE_SB_SendPipeInfoCmd */
@@ -733,131 +867,327 @@ int32 CFE_SB_SendMapInfoCmd(const CFE_SB_SendMapInfo_t *data)
 {
     const CFE_SB_WriteFileInfoCmd_Payload_t *ptr;
     char LocalFilename[OS_MAX_PATH_LEN];
-    int32 Stat;
 
     ptr = &data->Payload;
 
     CFE_SB_MessageStringGet(LocalFilename, ptr->Filename, CFE_PLATFORM_SB_DEFAULT_MAP_FILENAME,
             OS_MAX_PATH_LEN, sizeof(ptr->Filename));
 
-    Stat = CFE_SB_SendMapInfo(LocalFilename);
-
-    CFE_SB_IncrCmdCtr(Stat);
+    CFE_SB_SubmitFileDump(CFE_SB_SendMapInfo, LocalFilename);
 
     return CFE_SUCCESS;
 }/* end CFE_SB_SendMapInfoCmd */
 
 
+/*
+** State of one of the SB information files while it is being written
+*/
+typedef struct
+{
+    int32                    FileDes;
+    uint32                   FileSize;
+    uint32                   EntryCount;
+    uint32                  *BufPtr;
+    CFE_FS_BufferedWriter_t  Writer;
+    uint32                   ErrRequested;  /**< Size of the failed write, reported on close */
+    int32                    ErrActual;     /**< Result of the failed write, reported on close */
+} CFE_SB_FileDump_t;
+
 /******************************************************************************
-**  Function:  CFE_SB_SendRoutingInfo()
+**  Function:  CFE_SB_FileDumpPutBuf()
+**
+**  Purpose:
+**    SB internal function to return the staging buffer of an SB information
+**    file to the SB pool, if it has one.
+**
+**  Arguments:
+**    Dump state
+**
+**  Return:
+**    None
+*/
+static void CFE_SB_FileDumpPutBuf(CFE_SB_FileDump_t *Dump)
+{
+    if(Dump->BufPtr != NULL){
+        CFE_ES_PutPoolBuf(CFE_SB.Mem.PoolHdl, Dump->BufPtr);
+        Dump->BufPtr = NULL;
+    }/* end if */
+
+}/* end CFE_SB_FileDumpPutBuf */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_FileDumpOpen()
 **
 **  Purpose:
-**    SB internal function to write the routing information to a file
+**    SB internal function to create one of the SB information files, write
+**    its cFE file header and set up the staging buffer for its entries.  If
+**    no staging buffer can be obtained from the SB pool the entries are
+**    written unbuffered, one per SB lock cycle.
 **
 **  Arguments:
-**    Pointer to a filename
+**    Dump state, pointer to a filename, app to record in the file header,
+**    file header description and subtype
 **
 **  Return:
 **    CFE_SB_FILE_IO_ERR for file I/O errors or CFE_SUCCESS
 */
-int32 CFE_SB_SendRtgInfo(const char *Filename)
+static int32 CFE_SB_FileDumpOpen(CFE_SB_FileDump_t *Dump, const char *Filename, uint32 AppId,
+                                 const char *Description, uint32 SubType)
 {
-    CFE_SB_MsgRouteIdx_t        RtgTblIdx;
-    const CFE_SB_RouteEntry_t*  RtgTblPtr;
-    CFE_SB_MsgKey_Atom_t        MsgKeyVal;
-    int32                       fd = 0;
-    int32                       WriteStat;
-    uint32                      FileSize = 0;
-    uint32                      EntryCount = 0;
-    CFE_SB_RoutingFileEntry_t   Entry;
-    CFE_FS_Header_t             FileHdr;
-    CFE_SB_PipeD_t              *pd; 
-    CFE_SB_DestinationD_t       *DestPtr;
+    CFE_FS_Header_t FileHdr;
+    int32           WriteStat;
+    int32           Stat;
+
+    memset(Dump, 0, sizeof(*Dump));
+
+    Stat = CFE_ES_GetPoolBuf(&Dump->BufPtr, CFE_SB.Mem.PoolHdl,
+                             CFE_PLATFORM_SB_FILE_DUMP_BUFFER_SIZE);
+    if(Stat < 0){
+        CFE_EVS_SendEventWithAppID(CFE_SB_SND_RTG_EID,CFE_EVS_EventType_INFORMATION,CFE_SB.AppId,
+                      "No staging buffer for file %s, stat=0x%x, writing unbuffered",
+                      Filename,(unsigned int)Stat);
+        Dump->BufPtr = NULL;
+    }/* end if */
 
-    fd = OS_creat(Filename, OS_WRITE_ONLY);
-    if(fd < OS_SUCCESS){
-        CFE_EVS_SendEvent(CFE_SB_SND_RTG_ERR1_EID,CFE_EVS_EventType_ERROR,
+    Dump->FileDes = OS_creat(Filename, OS_WRITE_ONLY);
+    if(Dump->FileDes < OS_SUCCESS){
+        CFE_EVS_SendEventWithAppID(CFE_SB_SND_RTG_ERR1_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
                       "Error creating file %s, stat=0x%x",
-                      Filename,(unsigned int)fd);
+                      Filename,(unsigned int)Dump->FileDes);
+        CFE_SB_FileDumpPutBuf(Dump);
         return CFE_SB_FILE_IO_ERR;
     }/* end if */
 
     /* clear out the cfe file header fields, then populate description and subtype */
-    CFE_FS_InitHeader(&FileHdr, "SB Routing Information", CFE_FS_SubType_SB_ROUTEDATA);
+    CFE_FS_InitHeader(&FileHdr, Description, SubType);
 
-    WriteStat = CFE_FS_WriteHeader(fd, &FileHdr);
+    WriteStat = CFE_FS_WriteHeaderWithAppID(Dump->FileDes, &FileHdr, AppId);
     if(WriteStat != sizeof(CFE_FS_Header_t)){
         CFE_SB_FileWriteByteCntErr(Filename,sizeof(CFE_FS_Header_t),WriteStat);
-        OS_close(fd);
+        OS_close(Dump->FileDes);
+        CFE_SB_FileDumpPutBuf(Dump);
+        return CFE_SB_FILE_IO_ERR;
+    }/* end if */
+
+    Dump->FileSize = WriteStat;
+
+    /* without a buffer every entry is passed straight to OS_write */
+    CFE_FS_BufferedWriterInit(&Dump->Writer, Dump->FileDes, Dump->BufPtr,
+                              CFE_PLATFORM_SB_FILE_DUMP_BUFFER_SIZE);
+
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_FileDumpOpen */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_FileDumpAppend()
+**
+**  Purpose:
+**    SB internal function to add one entry to an SB information file.  This
+**    is called with the SB shared data lock held, so a write error is only
+**    recorded here and reported by CFE_SB_FileDumpClose().
+**
+**  Arguments:
+**    Dump state, entry and entry size
+**
+**  Return:
+**    CFE_SB_FILE_IO_ERR for file I/O errors or CFE_SUCCESS
+*/
+static int32 CFE_SB_FileDumpAppend(CFE_SB_FileDump_t *Dump, const void *Entry, uint32 EntrySize)
+{
+    int32 WriteStat;
+
+    WriteStat = CFE_FS_BufferedWrite(&Dump->Writer, Entry, EntrySize);
+    if(WriteStat != EntrySize){
+        Dump->ErrRequested = EntrySize;
+        Dump->ErrActual = WriteStat;
+        return CFE_SB_FILE_IO_ERR;
+    }/* end if */
+
+    Dump->EntryCount ++;
+
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_FileDumpAppend */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_FileDumpFlush()
+**
+**  Purpose:
+**    SB internal function to write the staged entries of an SB information
+**    file.  Must be called without the SB shared data lock held.  A write
+**    error is reported by CFE_SB_FileDumpClose().
+**
+**  Arguments:
+**    Dump state
+**
+**  Return:
+**    CFE_SB_FILE_IO_ERR for file I/O errors or CFE_SUCCESS
+*/
+static int32 CFE_SB_FileDumpFlush(CFE_SB_FileDump_t *Dump)
+{
+    uint32 Staged;
+    int32  WriteStat;
+
+    Staged = Dump->Writer.Used;
+    WriteStat = CFE_FS_BufferedWriterFlush(&Dump->Writer);
+    if(WriteStat != CFE_SUCCESS){
+        Dump->ErrRequested = Staged;
+        Dump->ErrActual = WriteStat;
         return CFE_SB_FILE_IO_ERR;
     }/* end if */
 
-    FileSize = WriteStat;
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_FileDumpFlush */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_FileDumpClose()
+**
+**  Purpose:
+**    SB internal function to close an SB information file, release its
+**    staging buffer and report the result.  Must be called without the SB
+**    shared data lock held.
+**
+**  Arguments:
+**    Dump state, pointer to a filename, status of the entry writes
+**
+**  Return:
+**    The status passed in
+*/
+static int32 CFE_SB_FileDumpClose(CFE_SB_FileDump_t *Dump, const char *Filename, int32 Status)
+{
+    OS_close(Dump->FileDes);
+
+    CFE_SB_FileDumpPutBuf(Dump);
+
+    if(Status == CFE_SB_FILE_IO_ERR){
+        CFE_SB_FileWriteByteCntErr(Filename,Dump->ErrRequested,Dump->ErrActual);
+    }/* end if */
+
+    if(Status == CFE_SUCCESS){
+        CFE_EVS_SendEventWithAppID(CFE_SB_SND_RTG_EID,CFE_EVS_EventType_DEBUG,CFE_SB.AppId,
+                      "%s written:Size=%d,Entries=%d",
+                      Filename,(int)(Dump->FileSize + Dump->Writer.TotalBytes),
+                      (int)Dump->EntryCount);
+    }/* end if */
+
+    return Status;
+
+}/* end CFE_SB_FileDumpClose */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_SendRoutingInfo()
+**
+**  Purpose:
+**    SB internal function to write the routing information to a file.
+**    Entries are collected under the SB lock until the staging buffer is
+**    full, then the lock is released while the buffer is written out.
+**
+**  Arguments:
+**    Pointer to a filename, app to record in the file header
+**
+**  Return:
+**    CFE_SB_FILE_IO_ERR for file I/O errors or CFE_SUCCESS
+*/
+int32 CFE_SB_SendRtgInfo(const char *Filename, uint32 AppId)
+{
+    CFE_SB_MsgRouteIdx_t        RtgTblIdx;
+    const CFE_SB_RouteEntry_t*  RtgTblPtr = NULL;
+    uint32                      MapSlot;
+    uint32                      DestIdx;
+    uint32                      NumDests;
+    uint32                      Staged;
+    int32                       Status;
+    CFE_SB_RoutingFileEntry_t   Entry;
+    CFE_SB_FileDump_t           Dump;
+    CFE_SB_PipeD_t              *pd; 
+    const CFE_SB_DestinationD_t *DestPtr;
+
+    Status = CFE_SB_FileDumpOpen(&Dump, Filename, AppId, "SB Routing Information",
+                                 CFE_FS_SubType_SB_ROUTEDATA);
+    if(Status != CFE_SUCCESS){
+        return Status;
+    }/* end if */
 
     /* loop through the entire MsgMap */
-    for(MsgKeyVal=0; MsgKeyVal < CFE_SB_MAX_NUMBER_OF_MSG_KEYS; ++MsgKeyVal)
+    MapSlot = 0;
+    DestIdx = 0;
+    while(Status == CFE_SUCCESS && MapSlot < CFE_SB_MSG_MAP_SIZE)
     {
-        RtgTblIdx = CFE_SB.MsgMap[MsgKeyVal];
+        CFE_SB_LockSharedData(__func__,__LINE__);
 
-        /* Only process table entry if it is used. */
-        if(!CFE_SB_IsValidRouteIdx(RtgTblIdx))
-        {
-            DestPtr = NULL;
-            RtgTblPtr = NULL;
-        } 
-        else 
+        Staged = 0;
+        while(Status == CFE_SUCCESS && MapSlot < CFE_SB_MSG_MAP_SIZE)
         {
-            RtgTblPtr = CFE_SB_GetRoutePtrFromIdx(RtgTblIdx);
-            DestPtr = RtgTblPtr->ListHeadPtr;
-        }
+            RtgTblIdx = CFE_SB_GetRoutingTblIdxFromSlot(MapSlot);
+
+            /* Only process table entry if it is used. */
+            NumDests = 0;
+            if(CFE_SB_IsValidRouteIdx(RtgTblIdx))
+            {
+                RtgTblPtr = CFE_SB_GetRoutePtrFromIdx(RtgTblIdx);
+                NumDests = RtgTblPtr->Destinations;
+            }
 
-        while(DestPtr != NULL){
+            /* DestIdx skips the destinations written before the lock was last released */
+            while(DestIdx < NumDests && Status == CFE_SUCCESS &&
+                  (Staged == 0 || CFE_FS_BufferedWriterSpace(&Dump.Writer) >= sizeof(Entry))){
 
-            pd = CFE_SB_GetPipePtr(DestPtr -> PipeId);
-            /* If invalid id, continue on to next entry */
-            if (pd != NULL) {
-            
-                Entry.MsgId     = CFE_SB_MsgIdToValue(RtgTblPtr->MsgId);
-                Entry.PipeId    = DestPtr -> PipeId;
-                Entry.State     = DestPtr -> Active;
-                Entry.MsgCnt    = DestPtr -> DestCnt;               
-            
-                Entry.AppName[0] = 0;
-                /* 
-                 * NOTE: as long as CFE_ES_GetAppName() returns success, then it 
-                 * guarantees null termination of the output.  Return code is not
-                 * checked here (bad) but in case of error it does not seem to touch
-                 * the buffer, therefore the initialization above will protect for now 
-                 */
-                CFE_ES_GetAppName(&Entry.AppName[0], pd->AppId, sizeof(Entry.AppName));
-                CFE_SB_GetPipeName(Entry.PipeName, sizeof(Entry.PipeName), Entry.PipeId);
-
-                WriteStat = OS_write (fd, &Entry, sizeof(CFE_SB_RoutingFileEntry_t));
-                if(WriteStat != sizeof(CFE_SB_RoutingFileEntry_t)){
-                    CFE_SB_FileWriteByteCntErr(Filename,
-                                           sizeof(CFE_SB_RoutingFileEntry_t),
-                                           WriteStat);
-                    OS_close(fd);
-                    return CFE_SB_FILE_IO_ERR;
-                }/* end if */
+                DestPtr = &RtgTblPtr->DestArray[DestIdx];
+
+                pd = CFE_SB_GetPipePtr(DestPtr -> PipeId);
+                /* If invalid id, continue on to next entry */
+                if (pd != NULL) {
+
+                    Entry.MsgId     = CFE_SB_MsgIdToValue(RtgTblPtr->MsgId);
+                    Entry.PipeId    = DestPtr -> PipeId;
+                    Entry.State     = DestPtr -> Active;
+                    Entry.MsgCnt    = DestPtr -> DestCnt;
+
+                    Entry.AppName[0] = 0;
+                    /* 
+                     * NOTE: as long as CFE_ES_GetAppName() returns success, then it 
+                     * guarantees null termination of the output.  Return code is not
+                     * checked here (bad) but in case of error it does not seem to touch
+                     * the buffer, therefore the initialization above will protect for now 
+                     */
+                    CFE_ES_GetAppName(&Entry.AppName[0], pd->AppId, sizeof(Entry.AppName));
+                    CFE_SB_GetPipeName(Entry.PipeName, sizeof(Entry.PipeName), Entry.PipeId);
+
+                    Status = CFE_SB_FileDumpAppend(&Dump, &Entry, sizeof(Entry));
+                    ++Staged;
+                }
 
-                FileSize += WriteStat;
-                EntryCount ++;
+                ++DestIdx;
+
+            }/* end while */
+
+            if(DestIdx < NumDests)
+            {
+                /* staging buffer is full, resume this route after it is written */
+                break;
             }
-            
-            DestPtr = DestPtr->Next;
+
+            ++MapSlot;
+            DestIdx = 0;
 
         }/* end while */
 
-    }/* end for */
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
 
-    OS_close(fd);
+        if(Status == CFE_SUCCESS){
+            Status = CFE_SB_FileDumpFlush(&Dump);
+        }/* end if */
 
-    CFE_EVS_SendEvent(CFE_SB_SND_RTG_EID,CFE_EVS_EventType_DEBUG,
-                      "%s written:Size=%d,Entries=%d",
-                      Filename,(int)FileSize,(int)EntryCount);
+    }/* end while */
 
-    return CFE_SUCCESS;
+    return CFE_SB_FileDumpClose(&Dump, Filename, Status);
 
 }/* end CFE_SB_SendRtgInfo */
 
@@ -866,70 +1196,57 @@ int32 CFE_SB_SendRtgInfo(const char *Filename)
 **  Function:  CFE_SB_SendPipeInfo()
 **
 **  Purpose:
-**    SB internal function to write the Pipe table to a file
+**    SB internal function to write the Pipe table to a file.  Entries are
+**    collected under the SB lock until the staging buffer is full, then the
+**    lock is released while the buffer is written out.
 **
 **  Arguments:
-**    Pointer to a filename
+**    Pointer to a filename, app to record in the file header
 **
 **  Return:
 **    CFE_SB_FILE_IO_ERR for file I/O errors or CFE_SUCCESS
 */
-int32 CFE_SB_SendPipeInfo(const char *Filename)
+int32 CFE_SB_SendPipeInfo(const char *Filename, uint32 AppId)
 {
     uint16 i;
-    int32  fd = 0;
-    int32  WriteStat;
-    uint32 FileSize = 0;
-    uint32 EntryCount = 0;
-    CFE_FS_Header_t FileHdr;
-
-    fd = OS_creat(Filename, OS_WRITE_ONLY);
-
-    if(fd < OS_SUCCESS){
-        CFE_EVS_SendEvent(CFE_SB_SND_RTG_ERR1_EID,CFE_EVS_EventType_ERROR,
-                          "Error creating file %s, stat=0x%x",
-                           Filename,(unsigned int)fd);
-        return CFE_SB_FILE_IO_ERR;
-    }/* end if */
+    uint32 Staged;
+    int32  Status;
+    CFE_SB_FileDump_t Dump;
 
-    /* clear out the cfe file header fields, then populate description and subtype */
-    CFE_FS_InitHeader(&FileHdr, "SB Pipe Information", CFE_FS_SubType_SB_PIPEDATA);
-    
-    WriteStat = CFE_FS_WriteHeader(fd, &FileHdr);
-    if(WriteStat != sizeof(CFE_FS_Header_t)){
-        CFE_SB_FileWriteByteCntErr(Filename,sizeof(CFE_FS_Header_t),WriteStat);
-        OS_close(fd);
-        return CFE_SB_FILE_IO_ERR;
+    Status = CFE_SB_FileDumpOpen(&Dump, Filename, AppId, "SB Pipe Information",
+                                 CFE_FS_SubType_SB_PIPEDATA);
+    if(Status != CFE_SUCCESS){
+        return Status;
     }/* end if */
 
-    FileSize = WriteStat;
-
     /* loop through the pipe table */
-    for(i=0;i<CFE_PLATFORM_SB_MAX_PIPES;i++){
+    i = 0;
+    while(Status == CFE_SUCCESS && i < CFE_PLATFORM_SB_MAX_PIPES){
+
+        CFE_SB_LockSharedData(__func__,__LINE__);
 
-        if(CFE_SB.PipeTbl[i].InUse==CFE_SB_IN_USE){
+        Staged = 0;
+        while(Status == CFE_SUCCESS && i < CFE_PLATFORM_SB_MAX_PIPES &&
+              (Staged == 0 || CFE_FS_BufferedWriterSpace(&Dump.Writer) >= sizeof(CFE_SB_PipeD_t))){
 
-            WriteStat = OS_write (fd, &(CFE_SB.PipeTbl[i]), sizeof(CFE_SB_PipeD_t));
-            if(WriteStat != sizeof(CFE_SB_PipeD_t)){
-                CFE_SB_FileWriteByteCntErr(Filename,sizeof(CFE_SB_PipeD_t),WriteStat);
-                OS_close(fd);
-                return CFE_SB_FILE_IO_ERR;
+            if(CFE_SB.PipeTbl[i].InUse==CFE_SB_IN_USE){
+                Status = CFE_SB_FileDumpAppend(&Dump, &(CFE_SB.PipeTbl[i]), sizeof(CFE_SB_PipeD_t));
+                ++Staged;
             }/* end if */
 
-            FileSize += WriteStat;
-            EntryCount ++;
+            ++i;
 
-        }/* end if */
+        }/* end while */
 
-    }/* end for */
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
 
-    OS_close(fd);
+        if(Status == CFE_SUCCESS){
+            Status = CFE_SB_FileDumpFlush(&Dump);
+        }/* end if */
 
-    CFE_EVS_SendEvent(CFE_SB_SND_RTG_EID,CFE_EVS_EventType_DEBUG,
-                      "%s written:Size=%d,Entries=%d",
-                       Filename,(int)FileSize,(int)EntryCount);
+    }/* end while */
 
-    return CFE_SUCCESS;
+    return CFE_SB_FileDumpClose(&Dump, Filename, Status);
 
 }/* end CFE_SB_SendPipeInfo */
 
@@ -938,79 +1255,68 @@ int32 CFE_SB_SendPipeInfo(const char *Filename)
 **  Function:  CFE_SB_SendMapInfo()
 **
 **  Purpose:
-**    SB internal function to write the Message Map to a file
+**    SB internal function to write the Message Map to a file.  Entries are
+**    collected under the SB lock until the staging buffer is full, then the
+**    lock is released while the buffer is written out.
 **
 **  Arguments:
-**    Pointer to a filename
+**    Pointer to a filename, app to record in the file header
 **
 **  Return:
 **    CFE_SB_FILE_IO_ERR for file I/O errors or CFE_SUCCESS
 */
-int32 CFE_SB_SendMapInfo(const char *Filename)
+int32 CFE_SB_SendMapInfo(const char *Filename, uint32 AppId)
 {
     const CFE_SB_RouteEntry_t*  RtgTblPtr;
     CFE_SB_MsgRouteIdx_t        RtgTblIdx;
-    CFE_SB_MsgKey_Atom_t        MsgKeyVal;
-    int32  fd = 0;
-    int32  WriteStat;
-    uint32 FileSize = 0;
-    uint32 EntryCount = 0;
+    uint32                      MapSlot;
+    uint32 Staged;
+    int32  Status;
     CFE_SB_MsgMapFileEntry_t Entry;
-    CFE_FS_Header_t FileHdr;
-
-    fd = OS_creat(Filename, OS_WRITE_ONLY);
-
-    if (fd < OS_SUCCESS){
-        CFE_EVS_SendEvent(CFE_SB_SND_RTG_ERR1_EID,CFE_EVS_EventType_ERROR,
-                          "Error creating file %s, stat=0x%x",
-                           Filename,(unsigned int)fd);
-        return CFE_SB_FILE_IO_ERR;
-    }/* end if */
-
-    /* clear out the cfe file header fields, then populate description and subtype */
-    CFE_FS_InitHeader(&FileHdr, "SB Message Map Information", CFE_FS_SubType_SB_MAPDATA);
+    CFE_SB_FileDump_t Dump;
 
-    WriteStat = CFE_FS_WriteHeader(fd, &FileHdr);
-    if(WriteStat != sizeof(CFE_FS_Header_t)){
-        CFE_SB_FileWriteByteCntErr(Filename,sizeof(CFE_FS_Header_t),WriteStat);
-        OS_close(fd);
-        return CFE_SB_FILE_IO_ERR;
+    Status = CFE_SB_FileDumpOpen(&Dump, Filename, AppId, "SB Message Map Information",
+                                 CFE_FS_SubType_SB_MAPDATA);
+    if(Status != CFE_SUCCESS){
+        return Status;
     }/* end if */
 
-    FileSize = WriteStat;
-
     /* loop through the entire MsgMap */
-    for(MsgKeyVal=0; MsgKeyVal < CFE_SB_MAX_NUMBER_OF_MSG_KEYS; ++MsgKeyVal)
+    MapSlot = 0;
+    while(Status == CFE_SUCCESS && MapSlot < CFE_SB_MSG_MAP_SIZE)
     {
-        RtgTblIdx = CFE_SB_GetRoutingTblIdx(CFE_SB_ValueToMsgKey(MsgKeyVal));
+        CFE_SB_LockSharedData(__func__,__LINE__);
 
-        if(CFE_SB_IsValidRouteIdx(RtgTblIdx))
+        Staged = 0;
+        while(Status == CFE_SUCCESS && MapSlot < CFE_SB_MSG_MAP_SIZE &&
+              (Staged == 0 || CFE_FS_BufferedWriterSpace(&Dump.Writer) >= sizeof(Entry)))
         {
-            RtgTblPtr = CFE_SB_GetRoutePtrFromIdx(RtgTblIdx);
+            RtgTblIdx = CFE_SB_GetRoutingTblIdxFromSlot(MapSlot);
 
-            Entry.MsgId = CFE_SB_MsgIdToValue(RtgTblPtr->MsgId);
-            Entry.Index = CFE_SB_RouteIdxToValue(RtgTblIdx);
+            if(CFE_SB_IsValidRouteIdx(RtgTblIdx))
+            {
+                RtgTblPtr = CFE_SB_GetRoutePtrFromIdx(RtgTblIdx);
 
-            WriteStat = OS_write (fd, &Entry, sizeof(CFE_SB_MsgMapFileEntry_t));
-            if(WriteStat != sizeof(CFE_SB_MsgMapFileEntry_t)){
-                CFE_SB_FileWriteByteCntErr(Filename,sizeof(CFE_SB_MsgMapFileEntry_t),WriteStat);
-                OS_close(fd);
-                return CFE_SB_FILE_IO_ERR;
+                Entry.MsgId = CFE_SB_MsgIdToValue(RtgTblPtr->MsgId);
+                Entry.Index = CFE_SB_RouteIdxToValue(RtgTblIdx);
+
+                Status = CFE_SB_FileDumpAppend(&Dump, &Entry, sizeof(Entry));
+                ++Staged;
             }/* end if */
 
-            FileSize += WriteStat;
-            EntryCount ++;
+            ++MapSlot;
 
-        }/* end for */
-    }/* end for */
+        }/* end while */
 
-    OS_close(fd);
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
 
-    CFE_EVS_SendEvent(CFE_SB_SND_RTG_EID,CFE_EVS_EventType_DEBUG,
-                      "%s written:Size=%d,Entries=%d",
-                      Filename,(int)FileSize,(int)EntryCount);
+        if(Status == CFE_SUCCESS){
+            Status = CFE_SB_FileDumpFlush(&Dump);
+        }/* end if */
 
-    return CFE_SUCCESS;
+    }/* end while */
+
+    return CFE_SB_FileDumpClose(&Dump, Filename, Status);
 
 }/* end CFE_SB_SendMapInfo */
 
@@ -1037,7 +1343,8 @@ int32 CFE_SB_SendPrevSubsCmd(const CFE_SB_SendPrevSubs_t *data)
   uint32 EntryNum = 0;
   uint32 SegNum = 1;
   int32  Stat;
-  CFE_SB_DestinationD_t *DestPtr = NULL;
+  uint16 NumDests;
+  uint16 DestIdx;
 
   /* Take semaphore to ensure data does not change during this function */
   CFE_SB_LockSharedData(__func__,__LINE__);
@@ -1048,16 +1355,16 @@ int32 CFE_SB_SendPrevSubsCmd(const CFE_SB_SendPrevSubs_t *data)
       RoutePtr = CFE_SB_GetRoutePtrFromIdx(CFE_SB_ValueToRouteIdx(i));
       if(!CFE_SB_IsValidMsgId(RoutePtr->MsgId))
       {
-          DestPtr = NULL;
+          NumDests = 0;
       }
       else
       {
-          DestPtr = CFE_SB.RoutingTbl[i].ListHeadPtr;
+          NumDests = RoutePtr->Destinations;
       }
         
-        while(DestPtr != NULL){
+        for(DestIdx = 0; DestIdx < NumDests; DestIdx++){
 
-            if(DestPtr->Scope == CFE_SB_GLOBAL){
+            if(RoutePtr->DestArray[DestIdx].Scope == CFE_SB_GLOBAL){
             
                 /* ...add entry into pkt */
                 CFE_SB.PrevSubMsg.Payload.Entry[EntryNum].MsgId = CFE_SB_MsgIdToValue(RoutePtr->MsgId);
@@ -1078,18 +1385,15 @@ int32 CFE_SB_SendPrevSubsCmd(const CFE_SB_SendPrevSubs_t *data)
                   SegNum++;
                 }/* end if */
         
-                /* break while loop through destinations, onto next CFE_SB.RoutingTbl index */
+                /* break loop through destinations, onto next CFE_SB.RoutingTbl index */
                 /* This is done because we want only one network subscription per msgid */
                 /* Later when Qos is used, we may want to take just the highest priority */
                 /* subscription if there are more than one */
                 break;
                 
             }/* end if */
-            
-            /* Check next destination (if another exists) for global scope */
-            DestPtr = DestPtr -> Next;
         
-        }/* end while */
+        }/* end for */
   
   }/* end for */ 
 
@@ -1132,33 +1436,31 @@ uint32 CFE_SB_FindGlobalMsgIdCnt(void){
     CFE_SB_MsgRouteIdx_Atom_t i;
     uint32 cnt = 0;
     const CFE_SB_RouteEntry_t* RoutePtr;
-    CFE_SB_DestinationD_t *DestPtr = NULL;
+    uint16 NumDests;
+    uint16 DestIdx;
     
     for(i=0;i<CFE_PLATFORM_SB_MAX_MSG_IDS;i++)
     {
         RoutePtr = CFE_SB_GetRoutePtrFromIdx(CFE_SB_ValueToRouteIdx(i));
         if(!CFE_SB_IsValidMsgId(RoutePtr->MsgId))
         {
-            DestPtr = NULL;
+            NumDests = 0;
         }
         else
         {
-            DestPtr = RoutePtr->ListHeadPtr;
+            NumDests = RoutePtr->Destinations;
         }
         
-        while(DestPtr != NULL){
+        for(DestIdx = 0; DestIdx < NumDests; DestIdx++){
     
-            if(DestPtr->Scope == CFE_SB_GLOBAL){
+            if(RoutePtr->DestArray[DestIdx].Scope == CFE_SB_GLOBAL){
 
                 cnt++;
                 break;
 
             }/* end if */
             
-            /* Check next destination (if another exists) for global scope */
-            DestPtr = DestPtr -> Next;
-            
-        }/* end while */
+        }/* end for */
 
     }/* end for */
 
@@ -1208,7 +1510,7 @@ void CFE_SB_IncrCmdCtr(int32 status){
 */
 void CFE_SB_FileWriteByteCntErr(const char *Filename,uint32 Requested,uint32 Actual){
 
-    CFE_EVS_SendEvent(CFE_SB_FILEWRITE_ERR_EID,CFE_EVS_EventType_ERROR,
+    CFE_EVS_SendEventWithAppID(CFE_SB_FILEWRITE_ERR_EID,CFE_EVS_EventType_ERROR,CFE_SB.AppId,
                       "File write,byte cnt err,file %s,request=%d,actual=%d",
                        Filename,(int)Requested,(int)Actual);
 
@@ -68,8 +68,8 @@
   #error CFE_PLATFORM_SB_HIGHEST_VALID_MSGID cannot be less than 1!
 #endif
 
-#if CFE_PLATFORM_SB_HIGHEST_VALID_MSGID > 0xFFFF
-  #error CFE_PLATFORM_SB_HIGHEST_VALID_MSGID cannot be greater than 0xFFFF!
+#if (CFE_PLATFORM_SB_HASHED_MSG_MAP != true) && (CFE_PLATFORM_SB_HIGHEST_VALID_MSGID > 0xFFFF)
+  #error CFE_PLATFORM_SB_HIGHEST_VALID_MSGID cannot be greater than 0xFFFF unless CFE_PLATFORM_SB_HASHED_MSG_MAP is true!
 #endif
 
 #if CFE_PLATFORM_SB_BUF_MEMORY_BYTES < 512
@@ -163,6 +163,14 @@
     #error CFE_PLATFORM_SB_MEM_BLOCK_SIZE_16 must be less than CFE_PLATFORM_SB_MAX_BLOCK_SIZE
 #endif
 
+#if CFE_PLATFORM_SB_FILE_DUMP_BUFFER_SIZE > CFE_PLATFORM_SB_MAX_BLOCK_SIZE
+    #error CFE_PLATFORM_SB_FILE_DUMP_BUFFER_SIZE cannot be greater than CFE_PLATFORM_SB_MAX_BLOCK_SIZE!
+#endif
+
+#if (CFE_PLATFORM_SB_FILE_DUMP_BUFFER_SIZE % 4) != 0
+    #error CFE_PLATFORM_SB_FILE_DUMP_BUFFER_SIZE must be a multiple of 4!
+#endif
+
 #if CFE_PLATFORM_SB_DEFAULT_REPORT_SENDER < 0
     #error CFE_PLATFORM_SB_DEFAULT_REPORT_SENDER cannot be less than 0!
 #endif
@@ -311,10 +311,13 @@ int32 CFE_TBL_Register( CFE_TBL_Handle_t *TblHandlePtr,
 
                     RegRecPtr->ActiveBufferIndex = 0;
                     RegRecPtr->DoubleBuffered = true;
+                    RegRecPtr->EpochReclaim = ((TblOptionFlags & CFE_TBL_OPT_EPOCH_MSK) ==
+                                               (CFE_TBL_OPT_EPOCH & CFE_TBL_OPT_EPOCH_MSK));
                 }
                 else  /* Single Buffered Table */
                 {
                     RegRecPtr->DoubleBuffered = false;
+                    RegRecPtr->EpochReclaim = false;
                     RegRecPtr->ActiveBufferIndex = 0;
                 }
             
@@ -325,11 +328,14 @@ int32 CFE_TBL_Register( CFE_TBL_Handle_t *TblHandlePtr,
                     RegRecPtr->EdsInfo = TypeInfo;
                     RegRecPtr->BinaryFileSize = (TypeInfo.Size.Bits + 7) / 8;
 
-                    /* Save the Callback function pointer */
+                    /* Save the Callback function pointer, and who is to call it */
                     RegRecPtr->ValidationFuncPtr = TblValidationFuncPtr;
+                    RegRecPtr->AsyncValidation = ((TblOptionFlags & CFE_TBL_OPT_VALIDATE_MSK) ==
+                                                  CFE_TBL_OPT_ASYNC_VALIDATE);
 
                     /* Save Table Name in Registry */
                     strncpy(RegRecPtr->Name, TblName, CFE_TBL_MAX_FULL_NAME_LEN);
+                    CFE_ES_NameIndexAdd(&CFE_TBL_RegistryNameIndex, RegIndx);
 
                     /* Set the "Dump Only" flag to value based upon selected option */
                     if ((TblOptionFlags & CFE_TBL_OPT_LD_DMP_MSK) == CFE_TBL_OPT_DUMP_ONLY)
@@ -641,6 +647,8 @@ int32 CFE_TBL_Unregister ( CFE_TBL_Handle_t TblHandle )
         /* Verify that the application unregistering the table owns the table */
         if (RegRecPtr->OwnerAppId == ThisAppId)
         {
+            CFE_TBL_LockRegistry();
+
             /* Mark table as free, although, technically, it isn't free until the */
             /* linked list of Access Descriptors has no links in it.              */
             /* NOTE: Allocated memory is freed when all Access Links have been    */
@@ -649,7 +657,10 @@ int32 CFE_TBL_Unregister ( CFE_TBL_Handle_t TblHandle )
             RegRecPtr->OwnerAppId = (uint32)CFE_TBL_NOT_OWNED;
 
             /* Remove Table Name */
+            CFE_ES_NameIndexRemove(&CFE_TBL_RegistryNameIndex, AccessDescPtr->RegIndex);
             RegRecPtr->Name[0] = '\0';
+
+            CFE_TBL_UnlockRegistry();
         }
 
         /* Remove the Access Descriptor Link from linked list */
@@ -763,8 +774,9 @@ int32 CFE_TBL_Load( CFE_TBL_Handle_t TblHandle,
         return CFE_TBL_ERR_LOAD_IN_PROGRESS;
     }
 
-    /* Obtain a working buffer (either the table's dedicated buffer or one of the shared buffers) */
-    Status = CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, true);
+    /* Obtain a working buffer (either the table's dedicated buffer or one of the shared buffers). */
+    /* A load from memory overwrites the whole buffer, so the active contents are not needed.     */
+    Status = CFE_TBL_AcquireWorkingBuffer(&WorkingBufferPtr, RegRecPtr, true, (SrcType != CFE_TBL_SRC_ADDRESS));
 
     if (Status != CFE_SUCCESS)
     {
@@ -822,30 +834,9 @@ int32 CFE_TBL_Load( CFE_TBL_Handle_t TblHandle,
     }
 
     /* If the data was successfully loaded, then validate its contents */
-    if ((Status >= CFE_SUCCESS) && (RegRecPtr->ValidationFuncPtr != NULL))
+    if (Status >= CFE_SUCCESS)
     {
-        Status = (RegRecPtr->ValidationFuncPtr)(WorkingBufferPtr->BufferPtr);
-
-        if (Status > CFE_SUCCESS)
-        {
-            CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_VAL_ERR_EID, CFE_EVS_EventType_ERROR,
-                CFE_TBL_TaskData.TableTaskAppId,
-                "%s: Validation func return code invalid (Stat=%u) for '%s'",
-                AppName, (unsigned int)Status, RegRecPtr->Name);
-
-            Status = -1;
-        }
-
-        if (Status < 0)
-        {
-            CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ERR_EID, CFE_EVS_EventType_ERROR,
-                CFE_TBL_TaskData.TableTaskAppId,
-                "%s: Validation func reports table invalid (Stat=%u) for '%s'",
-                AppName, (unsigned int)Status, RegRecPtr->Name);
-
-            /* Zero out the buffer to remove any bad data */
-            memset(WorkingBufferPtr->BufferPtr, 0, RegRecPtr->EdsInfo.Size.Bytes);
-        }
+        Status = CFE_TBL_ValidateLoad(AppName, WorkingBufferPtr, RegRecPtr, Status);
     }
 
     /* Perform the table update to complete the load */
@@ -918,6 +909,169 @@ int32 CFE_TBL_Load( CFE_TBL_Handle_t TblHandle,
 }   /* End of CFE_TBL_Load() */
 
 
+/*
+ * Function: CFE_TBL_LoadDelta - See API and header file for details
+ */
+int32 CFE_TBL_LoadDelta( CFE_TBL_Handle_t TblHandle,
+                         uint32 Offset,
+                         uint32 NumBytes,
+                         const void *SrcDataPtr )
+{
+    int32                       Status;
+    uint32                      ThisAppId;
+    CFE_TBL_LoadBuff_t         *WorkingBufferPtr;
+    CFE_TBL_LoadBuff_t         *ActiveBufferPtr;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+    CFE_TBL_RegistryRec_t      *RegRecPtr;
+    uint32                      TblSize;
+    bool                        CopyActive;
+    char                        AppName[OS_MAX_API_NAME] = {"UNKNOWN"};
+
+    /* Verify access rights and get a valid Application ID for calling App */
+    Status = CFE_TBL_ValidateAccess(TblHandle, &ThisAppId);
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_HANDLE_ACCESS_ERR_EID, CFE_EVS_EventType_ERROR,
+            CFE_TBL_TaskData.TableTaskAppId,
+            "%s: No access to Tbl Handle=%d", AppName, (int)TblHandle);
+
+        return Status;
+    }
+
+    AccessDescPtr = &CFE_TBL_TaskData.Handles[TblHandle];
+    RegRecPtr = &CFE_TBL_TaskData.Registry[AccessDescPtr->RegIndex];
+    TblSize = RegRecPtr->EdsInfo.Size.Bytes;
+
+    /* Translate AppID of caller into App Name */
+    CFE_ES_GetAppName(AppName, ThisAppId, OS_MAX_API_NAME);
+
+    if (RegRecPtr->DumpOnly)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_LOADING_A_DUMP_ONLY_ERR_EID,
+            CFE_EVS_EventType_ERROR, CFE_TBL_TaskData.TableTaskAppId,
+            "%s: Attempted to load Dump Only Tbl '%s'", AppName, RegRecPtr->Name);
+
+        return CFE_TBL_ERR_DUMP_ONLY;
+    }
+
+    /* A delta is applied on top of the active contents, so there must be some */
+    if (!RegRecPtr->TableLoadedOnce)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_PARTIAL_LOAD_ERR_EID, CFE_EVS_EventType_ERROR,
+            CFE_TBL_TaskData.TableTaskAppId,
+            "%s: Attempted delta load of uninitialized Tbl '%s'",
+            AppName, RegRecPtr->Name);
+
+        return CFE_TBL_ERR_PARTIAL_LOAD;
+    }
+
+    if ((NumBytes == 0) || (Offset > TblSize) || (NumBytes > (TblSize - Offset)))
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_EXCEEDS_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+            CFE_TBL_TaskData.TableTaskAppId,
+            "%s: Delta load range invalid for '%s' (offset=%lu, size=%lu, tbl=%lu)",
+            AppName, RegRecPtr->Name, (long unsigned int)Offset,
+            (long unsigned int)NumBytes, (long unsigned int)TblSize);
+
+        return CFE_TBL_ERR_INVALID_SIZE;
+    }
+
+    /* Loads by an Application are not allowed if a table load is already in progress */
+    if (RegRecPtr->LoadInProgress != CFE_TBL_NO_LOAD_IN_PROGRESS)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_IN_PROGRESS_ERR_EID, CFE_EVS_EventType_ERROR,
+            CFE_TBL_TaskData.TableTaskAppId,
+            "%s: Load already in progress for '%s'", AppName, RegRecPtr->Name);
+
+        return CFE_TBL_ERR_LOAD_IN_PROGRESS;
+    }
+
+    /* A single buffered table without a validation function only needs the range   */
+    /* in its shared working buffer.  A double buffered table's inactive buffer may  */
+    /* hold anything, and a validation function needs to see the whole table.        */
+    CopyActive = (RegRecPtr->DoubleBuffered || (RegRecPtr->ValidationFuncPtr != NULL));
+
+    Status = CFE_TBL_AcquireWorkingBuffer(&WorkingBufferPtr, RegRecPtr, true, CopyActive);
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_NO_WORK_BUFFERS_ERR_EID, CFE_EVS_EventType_ERROR,
+            CFE_TBL_TaskData.TableTaskAppId,
+            "%s: Failed to get Working Buffer (Stat=%u)", AppName, (unsigned int)Status);
+
+        return Status;
+    }
+
+    ActiveBufferPtr = &RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex];
+
+    /* Compute the CRC of the new contents from the active CRC and the changed range */
+    WorkingBufferPtr->Crc = CFE_ES_RecalculateCRC((const uint8 *)ActiveBufferPtr->BufferPtr + Offset,
+                                                  SrcDataPtr, NumBytes,
+                                                  TblSize - (Offset + NumBytes),
+                                                  ActiveBufferPtr->Crc,
+                                                  CFE_MISSION_ES_DEFAULT_CRC);
+
+    memcpy((uint8 *)WorkingBufferPtr->BufferPtr + Offset, SrcDataPtr, NumBytes);
+
+    snprintf(WorkingBufferPtr->DataSource, sizeof(WorkingBufferPtr->DataSource), "Addr 0x%08lX", (unsigned long)SrcDataPtr);
+    WorkingBufferPtr->FileCreateTimeSecs = 0;
+    WorkingBufferPtr->FileCreateTimeSubSecs = 0;
+
+    RegRecPtr->DeltaOffset = Offset;
+    RegRecPtr->DeltaSize = NumBytes;
+
+    Status = CFE_TBL_ValidateLoad(AppName, WorkingBufferPtr, RegRecPtr, CFE_SUCCESS);
+
+    if (Status < CFE_SUCCESS)
+    {
+        /* The load has had a problem, free the working buffer for another attempt */
+        if (!RegRecPtr->DoubleBuffered)
+        {
+            CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].Taken = false;
+        }
+
+        RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+
+        return Status;
+    }
+
+    /* Force the table update */
+    RegRecPtr->LoadPending = true;
+
+    Status = CFE_TBL_UpdateInternal(TblHandle, RegRecPtr, AccessDescPtr);
+
+    if (Status != CFE_SUCCESS)
+    {
+        if (!CopyActive && (RegRecPtr->LoadInProgress != CFE_TBL_NO_LOAD_IN_PROGRESS))
+        {
+            /* The load stays pending, and the working buffer may be dumped or */
+            /* validated before then, so fill in the rest of the table now     */
+            memcpy(WorkingBufferPtr->BufferPtr, ActiveBufferPtr->BufferPtr, Offset);
+            memcpy((uint8 *)WorkingBufferPtr->BufferPtr + Offset + NumBytes,
+                   (const uint8 *)ActiveBufferPtr->BufferPtr + Offset + NumBytes,
+                   TblSize - (Offset + NumBytes));
+        }
+
+        CFE_EVS_SendEventWithAppID(CFE_TBL_UPDATE_ERR_EID, CFE_EVS_EventType_ERROR,
+            CFE_TBL_TaskData.TableTaskAppId,
+            "%s: Failed to update '%s' (Stat=%u)",
+            AppName, RegRecPtr->Name, (unsigned int)Status);
+    }
+    else
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_SUCCESS_INF_EID, CFE_EVS_EventType_INFORMATION,
+            CFE_TBL_TaskData.TableTaskAppId, "Successfully loaded '%s' from '%s'",
+            RegRecPtr->Name, RegRecPtr->LastFileLoaded);
+
+        /* Save the index of the table for housekeeping telemetry */
+        CFE_TBL_TaskData.LastTblUpdated = AccessDescPtr->RegIndex;
+    }
+
+    return Status;
+}   /* End of CFE_TBL_LoadDelta() */
+
+
 /*
  * Function: CFE_TBL_Update - See API and header file for details
  */
@@ -1143,6 +1297,7 @@ int32 CFE_TBL_Validate( CFE_TBL_Handle_t TblHandle )
     CFE_TBL_RegistryRec_t      *RegRecPtr;
     CFE_TBL_AccessDescriptor_t *AccessDescPtr;
     char                        AppName[OS_MAX_API_NAME]={"UNKNWON"};
+    OS_time_t                   StartTime;
 
     /* Verify that this application has the right to perform operation */
     Status = CFE_TBL_ValidateAccess(TblHandle, &ThisAppId);
@@ -1154,6 +1309,7 @@ int32 CFE_TBL_Validate( CFE_TBL_Handle_t TblHandle )
         RegRecPtr = &CFE_TBL_TaskData.Registry[AccessDescPtr->RegIndex];
 
         CFE_ES_GetAppName(AppName, ThisAppId, OS_MAX_API_NAME);
+        CFE_PSP_GetTime(&StartTime);
 
         /* Identify the image to be validated, starting with the Inactive Buffer */
         if (RegRecPtr->ValidateInactiveIndex != CFE_TBL_NO_VALIDATION_PENDING)
@@ -1183,6 +1339,8 @@ int32 CFE_TBL_Validate( CFE_TBL_Handle_t TblHandle )
                 }
             }
 
+            RegRecPtr->ValidationTime = CFE_TBL_MicrosecsSince(&StartTime);
+
             if (Status == CFE_SUCCESS)
             {
                 CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_INF_EID,
@@ -1232,6 +1390,8 @@ int32 CFE_TBL_Validate( CFE_TBL_Handle_t TblHandle )
                 Status = (RegRecPtr->ValidationFuncPtr)(RegRecPtr->Buffers[0].BufferPtr);
             }
 
+            RegRecPtr->ValidationTime = CFE_TBL_MicrosecsSince(&StartTime);
+
             if (Status == CFE_SUCCESS)
             {
                 CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_INF_EID,
@@ -1288,6 +1448,7 @@ int32 CFE_TBL_Manage( CFE_TBL_Handle_t TblHandle )
 {
     int32   Status = CFE_SUCCESS;
     bool    FinishedManaging = false;
+    uint32  ThisAppId;
 
     while (!FinishedManaging)
     {
@@ -1333,6 +1494,12 @@ int32 CFE_TBL_Manage( CFE_TBL_Handle_t TblHandle )
         }
     }
 
+    /* The caller holds no epoch table addresses here, which lets their old buffers be reclaimed */
+    if (CFE_ES_GetAppID(&ThisAppId) == CFE_SUCCESS)
+    {
+        CFE_TBL_QuiescentPoint(ThisAppId);
+    }
+
     return Status;
 }   /* End of CFE_TBL_Manage() */
 
@@ -1392,7 +1559,9 @@ int32 CFE_TBL_GetInfo( CFE_TBL_Info_t *TblInfoPtr, const char *TblName )
     CFE_TBL_RegistryRec_t   *RegRecPtr;
     CFE_TBL_Handle_t         HandleIterator;
 
+    CFE_TBL_LockRegistry();
     RegIndx = CFE_TBL_FindTableInRegistry(TblName);
+    CFE_TBL_UnlockRegistry();
 
     /* If we found the table, then extract the information from the Registry */
     if (RegIndx != CFE_TBL_NOT_FOUND)
@@ -1505,6 +1674,9 @@ int32 CFE_TBL_Modified( CFE_TBL_Handle_t TblHandle )
         RegRecPtr->TimeOfLastUpdate = CFE_TIME_GetTime();
         RegRecPtr->LastFileLoaded[OS_MAX_PATH_LEN-1] = '\0';
         
+        /* The owner changed the contents in place */
+        RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].LoadGeneration++;
+
         /* Update CRC on contents of table */
         RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Crc = 
             CFE_ES_CalculateCRC(RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr,
@@ -77,7 +77,9 @@ int32 CFE_TBL_EarlyInit (void)
     for(i=0; i < CFE_PLATFORM_TBL_MAX_NUM_TABLES; i++)
     {
         CFE_TBL_InitRegistryRecord(&CFE_TBL_TaskData.Registry[i]);
+        CFE_TBL_TaskData.Registry[i].ValidationJobsRunning = 0;
     }
+    CFE_ES_NameIndexClear(&CFE_TBL_RegistryNameIndex);
 
     /* Initialize the Table Access Descriptors */
     for (i=0; i<CFE_PLATFORM_TBL_MAX_NUM_HANDLES; i++)
@@ -116,6 +118,14 @@ int32 CFE_TBL_EarlyInit (void)
 
     CFE_TBL_TaskData.ValidationCounter = 0;
 
+    /* No epoch table has switched buffers yet */
+    CFE_TBL_TaskData.Epoch = 0;
+    for (j=0; j<CFE_PLATFORM_ES_MAX_APPLICATIONS; j++)
+    {
+        CFE_TBL_TaskData.AppEpoch[j] = 0;
+        CFE_TBL_TaskData.AppBlocked[j] = false;
+    }
+
     CFE_TBL_TaskData.HkTlmTblRegIndex = CFE_TBL_NOT_FOUND;
     CFE_TBL_TaskData.LastTblUpdated = CFE_TBL_NOT_FOUND;
     
@@ -278,17 +288,21 @@ void CFE_TBL_InitRegistryRecord (CFE_TBL_RegistryRec_t *RegRecPtr)
     RegRecPtr->Buffers[0].Crc = 0;
     RegRecPtr->Buffers[0].Taken = false;
     RegRecPtr->Buffers[0].DataSource[0] = '\0';
+    RegRecPtr->Buffers[0].LoadGeneration++;
     RegRecPtr->Buffers[1].BufferPtr = NULL;
     RegRecPtr->Buffers[1].FileCreateTimeSecs = 0;
     RegRecPtr->Buffers[1].FileCreateTimeSubSecs = 0;
     RegRecPtr->Buffers[1].Crc = 0;
     RegRecPtr->Buffers[1].Taken = false;
     RegRecPtr->Buffers[1].DataSource[0] = '\0';
+    RegRecPtr->Buffers[1].LoadGeneration++;
     RegRecPtr->ValidationFuncPtr = NULL;
     RegRecPtr->TimeOfLastUpdate.Seconds = 0;
     RegRecPtr->TimeOfLastUpdate.Subseconds = 0;
     RegRecPtr->HeadOfAccessList = CFE_TBL_END_OF_LIST;
     RegRecPtr->LoadInProgress =  CFE_TBL_NO_LOAD_IN_PROGRESS;
+    RegRecPtr->DeltaOffset = 0;
+    RegRecPtr->DeltaSize = 0;
     RegRecPtr->ValidateActiveIndex = CFE_TBL_NO_VALIDATION_PENDING;
     RegRecPtr->ValidateInactiveIndex = CFE_TBL_NO_VALIDATION_PENDING;
     RegRecPtr->CDSHandle = CFE_ES_CDS_BAD_HANDLE;
@@ -299,8 +313,12 @@ void CFE_TBL_InitRegistryRecord (CFE_TBL_RegistryRec_t *RegRecPtr)
     RegRecPtr->DumpControlIndex = CFE_TBL_NO_DUMP_PENDING;
     RegRecPtr->UserDefAddr = false;
     RegRecPtr->DoubleBuffered = false;
+    RegRecPtr->EpochReclaim = false;
+    RegRecPtr->AsyncValidation = false;
     RegRecPtr->NotifyByMsg = false;
     RegRecPtr->ActiveBufferIndex = 0;
+    RegRecPtr->RetireEpoch = 0;
+    RegRecPtr->ValidationTime = 0;
     RegRecPtr->Name[0] = '\0';
     RegRecPtr->LastFileLoaded[0] = '\0';
 } /* End CFE_TBL_InitRegistryRecord */
@@ -541,6 +559,20 @@ int32 CFE_TBL_GetAddressInternal(void **TblPtr, CFE_TBL_Handle_t TblHandle, uint
                 CFE_ES_WriteToSysLog("CFE_TBL:GetAddressInternal-App(%d) attempt to access unowned Tbl Handle=%d\n",
                                      (int)ThisAppId, (int)TblHandle);
             }
+            else if (RegRecPtr->EpochReclaim)
+            {
+                /* Epoch tables are not locked, the buffer stays valid until */
+                /* this application's next quiescent point                   */
+                AccessDescPtr->BufferIndex = __atomic_load_n(&RegRecPtr->ActiveBufferIndex, __ATOMIC_ACQUIRE);
+
+                *TblPtr = RegRecPtr->Buffers[AccessDescPtr->BufferIndex].BufferPtr;
+
+                /* Return any pending warning or info status indicators */
+                Status = CFE_TBL_GetNextNotification(TblHandle);
+
+                /* Clear Table Updated Notify Bit so that caller only gets it once */
+                AccessDescPtr->Updated = false;
+            }
             else /* Table Registry Entry is valid */
             {
                 /* Lock the table and return the current pointer */
@@ -613,27 +645,19 @@ int32 CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle)
 
 int16 CFE_TBL_FindTableInRegistry(const char *TblName)
 {
-    int16 RegIndx = CFE_TBL_NOT_FOUND;
-    int16 i = -1;
+    int32 RegIndx;
 
-    do
-    {
-        /* Point to next record in the Table Registry */
-        i++;
+    /* Perform a case sensitive lookup of the name in the registry name index */
+    RegIndx = CFE_ES_NameIndexFind(&CFE_TBL_RegistryNameIndex, TblName);
 
-        /* Check to see if the record is currently being used */
-        if (CFE_TBL_TaskData.Registry[i].OwnerAppId != CFE_TBL_NOT_OWNED)
-        {
-            /* Perform a case sensitive name comparison */
-            if (strcmp(TblName, CFE_TBL_TaskData.Registry[i].Name) == 0)
-            {
-                /* If the names match, then return the index */
-                RegIndx = i;
-            }
-        }
-    } while ( (RegIndx == CFE_TBL_NOT_FOUND) && (i < (CFE_PLATFORM_TBL_MAX_NUM_TABLES-1)) );
+    /* Check to see if the record is currently being used */
+    if ((RegIndx == CFE_ES_NAMEINDEX_NOT_FOUND) ||
+        (CFE_TBL_TaskData.Registry[RegIndx].OwnerAppId == CFE_TBL_NOT_OWNED))
+    {
+        RegIndx = CFE_TBL_NOT_FOUND;
+    }
 
-    return RegIndx;
+    return (int16)RegIndx;
 }   /* End of CFE_TBL_FindTableInRegistry() */
 
 
@@ -777,6 +801,23 @@ int32 CFE_TBL_UnlockRegistry(void)
 int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
                                CFE_TBL_RegistryRec_t *RegRecPtr,
                                bool CalledByApp)
+{
+    return CFE_TBL_AcquireWorkingBuffer(WorkingBufferPtr, RegRecPtr, CalledByApp, true);
+
+}   /* End of CFE_TBL_GetWorkingBuffer() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_AcquireWorkingBuffer
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+int32 CFE_TBL_AcquireWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
+                                   CFE_TBL_RegistryRec_t *RegRecPtr,
+                                   bool CalledByApp,
+                                   bool CopyActive)
 {
     int32   Status = CFE_SUCCESS;
     int32   i;
@@ -828,7 +869,20 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
                 AccessIterator = RegRecPtr->HeadOfAccessList;
                 while ((AccessIterator != CFE_TBL_END_OF_LIST) && (Status == CFE_SUCCESS))
                 {
-                    if ((CFE_TBL_TaskData.Handles[AccessIterator].BufferIndex == InactiveBufferIndex) &&
+                    if (RegRecPtr->EpochReclaim)
+                    {
+                        /* Epoch tables are never locked; a user may still hold the old */
+                        /* buffer until it passes a quiescent point after the switch    */
+                        if (!CFE_TBL_AppPassedEpoch(CFE_TBL_TaskData.Handles[AccessIterator].AppId,
+                                                    RegRecPtr->RetireEpoch))
+                        {
+                            Status = CFE_TBL_ERR_NO_BUFFER_AVAIL;
+
+                            CFE_ES_WriteToSysLog("CFE_TBL:GetWorkingBuffer-Inactive Epoch Buff in use for '%s' by AppId=%d\n",
+                                                 RegRecPtr->Name, (int)CFE_TBL_TaskData.Handles[AccessIterator].AppId);
+                        }
+                    }
+                    else if ((CFE_TBL_TaskData.Handles[AccessIterator].BufferIndex == InactiveBufferIndex) &&
 		                (CFE_TBL_TaskData.Handles[AccessIterator].LockFlag))
                     {
                         Status = CFE_TBL_ERR_NO_BUFFER_AVAIL;
@@ -889,7 +943,11 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
                 OS_MutSemGive(CFE_TBL_TaskData.WorkBufMutex);
             }
 
-            if ((*WorkingBufferPtr) != NULL &&
+            /* Until told otherwise, a new load may change any part of the table */
+            RegRecPtr->DeltaOffset = 0;
+            RegRecPtr->DeltaSize = 0;
+
+            if (CopyActive && (*WorkingBufferPtr) != NULL &&
                     (*WorkingBufferPtr)->BufferPtr != RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr)
             {
                 /* In case the file contains a partial table load, get the active buffer contents first */
@@ -900,10 +958,16 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
         }
     }
 
+    /* The caller is about to write new contents, which voids any validation of the old ones */
+    if (*WorkingBufferPtr != NULL)
+    {
+        (*WorkingBufferPtr)->LoadGeneration++;
+    }
+
 
     return Status;
 
-}   /* End of CFE_TBL_GetWorkingBuffer() */
+}   /* End of CFE_TBL_AcquireWorkingBuffer() */
 
 
 /*******************************************************************
@@ -925,6 +989,7 @@ int32 CFE_TBL_LoadFromFile(const char *AppName,
     size_t               FilenameLen = strlen(Filename);
     uint32               NumBytes;
     uint8                ExtraByte;
+    uint32               ImageCrc = 0;
 
     if (FilenameLen > (OS_MAX_PATH_LEN-1))
     {
@@ -997,35 +1062,52 @@ int32 CFE_TBL_LoadFromFile(const char *AppName,
         Status = CFE_TBL_WARN_SHORT_FILE;
     }
 
-    NumBytes = OS_read(FileDescriptor,
-                       ((uint8*)WorkingBufferPtr->BufferPtr) + TblFileHeader.Offset,
-                       TblFileHeader.NumBytes);
-
-    if (NumBytes != TblFileHeader.NumBytes)
+    if (StdFileHeader.SubType == CFE_FS_SubType_TBL_PACKED_IMG)
     {
-       CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_INCOMPLETE_ERR_EID, CFE_EVS_EventType_ERROR,
-            CFE_TBL_TaskData.TableTaskAppId,
-            "%s: File load incomplete (exp=%lu, read=%lu)",
-            AppName, (long unsigned int)TblFileHeader.NumBytes,
-            (long unsigned int)NumBytes);
+        /* A packed image is read ahead, so its length checks are made while it is decoded */
+        Status = CFE_TBL_ReadPackedImage(FileDescriptor, WorkingBufferPtr, RegRecPtr, &TblFileHeader,
+                                         AppName, Filename, &ImageCrc);
 
-        OS_close(FileDescriptor);
-        return CFE_TBL_ERR_LOAD_INCOMPLETE;
+        if (Status != CFE_SUCCESS)
+        {
+            /* CFE_TBL_ReadPackedImage() generates its own events */
+
+            OS_close(FileDescriptor);
+            return Status;
+        }
     }
-    
-    /* Check to see if the file is too large (ie - more data than header claims) */
-    NumBytes = OS_read(FileDescriptor, &ExtraByte, 1);
-    
-    /* If successfully read another byte, then file must have too much data */
-    if (NumBytes == 1)
+    else
     {
-        CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_TOO_BIG_ERR_EID, CFE_EVS_EventType_ERROR,
-            CFE_TBL_TaskData.TableTaskAppId,
-            "%s: File load too long (file length > %lu)",
-            AppName, (long unsigned int)TblFileHeader.NumBytes);
+        NumBytes = OS_read(FileDescriptor,
+                           ((uint8*)WorkingBufferPtr->BufferPtr) + TblFileHeader.Offset,
+                           TblFileHeader.NumBytes);
 
-        OS_close(FileDescriptor);
-        return CFE_TBL_ERR_FILE_TOO_LARGE;
+        if (NumBytes != TblFileHeader.NumBytes)
+        {
+           CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_INCOMPLETE_ERR_EID, CFE_EVS_EventType_ERROR,
+                CFE_TBL_TaskData.TableTaskAppId,
+                "%s: File load incomplete (exp=%lu, read=%lu)",
+                AppName, (long unsigned int)TblFileHeader.NumBytes,
+                (long unsigned int)NumBytes);
+
+            OS_close(FileDescriptor);
+            return CFE_TBL_ERR_LOAD_INCOMPLETE;
+        }
+
+        /* Check to see if the file is too large (ie - more data than header claims) */
+        NumBytes = OS_read(FileDescriptor, &ExtraByte, 1);
+
+        /* If successfully read another byte, then file must have too much data */
+        if (NumBytes == 1)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_TOO_BIG_ERR_EID, CFE_EVS_EventType_ERROR,
+                CFE_TBL_TaskData.TableTaskAppId,
+                "%s: File load too long (file length > %lu)",
+                AppName, (long unsigned int)TblFileHeader.NumBytes);
+
+            OS_close(FileDescriptor);
+            return CFE_TBL_ERR_FILE_TOO_LARGE;
+        }
     }
 
     memset(WorkingBufferPtr->DataSource, 0, OS_MAX_PATH_LEN);
@@ -1041,12 +1123,459 @@ int32 CFE_TBL_LoadFromFile(const char *AppName,
                                                 0,
                                                 CFE_MISSION_ES_DEFAULT_CRC);
 
+    /* A packed image records the CRC of the image it was made from */
+    if (StdFileHeader.SubType == CFE_FS_SubType_TBL_PACKED_IMG && WorkingBufferPtr->Crc != ImageCrc)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_PACKED_CRC_ERR_EID, CFE_EVS_EventType_ERROR,
+            CFE_TBL_TaskData.TableTaskAppId,
+            "%s: Packed image in '%s' has CRC 0x%08X, expected 0x%08X",
+            AppName, Filename, (unsigned int)WorkingBufferPtr->Crc, (unsigned int)ImageCrc);
+
+        Status = CFE_TBL_ERR_BAD_PACKED_IMAGE;
+    }
+
     OS_close(FileDescriptor);
 
     return Status;
 } /* End of CFE_TBL_LoadFromFile() */
 
 
+/*
+** Staging buffer for reading the block records of a packed table image file
+*/
+typedef struct
+{
+    int32   FileDescriptor;     /* File being read */
+    uint32  Used;               /* Bytes of Buffer already consumed */
+    uint32  Size;               /* Bytes of Buffer filled from the file */
+    uint8   Buffer[512];
+} CFE_TBL_PackedReader_t;
+
+/*
+** Copies up to NumBytes from a packed table image file, returning the number copied
+*/
+static uint32 CFE_TBL_PackedRead(CFE_TBL_PackedReader_t *Reader, void *Dest, uint32 NumBytes)
+{
+    uint32  Copied = 0;
+    uint32  Chunk;
+    int32   Status;
+
+    while (Copied < NumBytes)
+    {
+        if (Reader->Used == Reader->Size)
+        {
+            Status = OS_read(Reader->FileDescriptor, Reader->Buffer, sizeof(Reader->Buffer));
+            if (Status <= 0)
+            {
+                break;
+            }
+
+            Reader->Used = 0;
+            Reader->Size = Status;
+        }
+
+        Chunk = Reader->Size - Reader->Used;
+        if (Chunk > (NumBytes - Copied))
+        {
+            Chunk = NumBytes - Copied;
+        }
+
+        memcpy((uint8 *)Dest + Copied, &Reader->Buffer[Reader->Used], Chunk);
+        Reader->Used += Chunk;
+        Copied += Chunk;
+    }
+
+    return Copied;
+}
+
+/*******************************************************************
+**
+** CFE_TBL_ReadPackedImage
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+int32 CFE_TBL_ReadPackedImage(int32 FileDescriptor, CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+                              CFE_TBL_RegistryRec_t *RegRecPtr, const CFE_TBL_File_Hdr_t *TblFileHeaderPtr,
+                              const char *AppName, const char *Filename, uint32 *ImageCrcPtr)
+{
+    CFE_TBL_PackedReader_t       Reader;
+    CFE_TBL_PackedImg_Hdr_t      PackedHeader;
+    uint8                        LocalBuffer[sizeof(CFE_TBL_PackedImg_Hdr_t)];
+    uint8                        Record[CFE_TBL_PACKED_BLOCK_SIZE + 1];
+    EdsLib_Id_t                  EdsId;
+    EdsLib_DataTypeDB_TypeInfo_t HdrInfo;
+    uint32                       ExpectedSize;
+    uint32                       ActiveCrc;
+    uint32                       Offset;
+    uint32                       Length;
+    uint32                       RecordSize;
+    uint32                       HeaderSize;
+    uint8                        ExtraByte;
+    int32                        Status;
+
+    memset(&Reader, 0, sizeof(Reader));
+    Reader.FileDescriptor = FileDescriptor;
+    memset(&PackedHeader, 0, sizeof(PackedHeader));
+    Offset = 0;
+
+    EdsId = EDSLIB_MAKE_ID(EDS_INDEX(CFE_TBL), CFE_TBL_PackedImg_Hdr_DATADICTIONARY);
+    EdsLib_DataTypeDB_GetTypeInfo(CFE_SB_GetEds(), EdsId, &HdrInfo);
+    ExpectedSize = (HdrInfo.Size.Bits + 7) / 8;
+
+    if (ExpectedSize > sizeof(LocalBuffer) ||
+        CFE_TBL_PackedRead(&Reader, LocalBuffer, ExpectedSize) != ExpectedSize ||
+        EdsLib_DataTypeDB_UnpackCompleteObject(CFE_SB_GetEds(), &EdsId, &PackedHeader, LocalBuffer,
+                sizeof(PackedHeader), 8 * ExpectedSize) != EDSLIB_SUCCESS)
+    {
+        Status = CFE_TBL_ERR_BAD_PACKED_IMAGE;
+    }
+    else if (PackedHeader.Format == CFE_TBL_DumpFormat_RAW ||
+             PackedHeader.Format > CFE_TBL_DumpFormat_DELTA_LZ ||
+             PackedHeader.BlockSize != CFE_TBL_PACKED_BLOCK_SIZE ||
+             TblFileHeaderPtr->Offset != 0 ||
+             TblFileHeaderPtr->NumBytes != RegRecPtr->BinaryFileSize)
+    {
+        Status = CFE_TBL_ERR_BAD_PACKED_IMAGE;
+    }
+    else
+    {
+        Status = CFE_SUCCESS;
+    }
+
+    if (Status == CFE_SUCCESS && (PackedHeader.Format & CFE_TBL_DumpFormat_DELTA) != 0)
+    {
+        ActiveCrc = CFE_ES_CalculateCRC(RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr,
+                                        RegRecPtr->EdsInfo.Size.Bytes,
+                                        0,
+                                        CFE_MISSION_ES_DEFAULT_CRC);
+
+        if (ActiveCrc != PackedHeader.ReferenceCrc)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_PACKED_REF_ERR_EID, CFE_EVS_EventType_ERROR,
+                CFE_TBL_TaskData.TableTaskAppId,
+                "%s: Delta image '%s' does not apply, reference CRC 0x%08X, active CRC 0x%08X",
+                AppName, Filename, (unsigned int)PackedHeader.ReferenceCrc, (unsigned int)ActiveCrc);
+
+            return CFE_TBL_ERR_REFERENCE_MISMATCH;
+        }
+
+        /* Unchanged blocks are not in the file, so start from the packed active contents */
+        EdsId = RegRecPtr->EdsId;
+        if (EdsLib_DataTypeDB_PackCompleteObject(CFE_SB_GetEds(), &EdsId, WorkingBufferPtr->BufferPtr,
+                RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr,
+                8 * RegRecPtr->BinaryFileSize, RegRecPtr->EdsInfo.Size.Bytes) != EDSLIB_SUCCESS)
+        {
+            Status = CFE_TBL_ERR_BAD_PACKED_IMAGE;
+        }
+    }
+
+    while (Status == CFE_SUCCESS && Offset < TblFileHeaderPtr->NumBytes)
+    {
+        Length = TblFileHeaderPtr->NumBytes - Offset;
+        if (Length > CFE_TBL_PACKED_BLOCK_SIZE)
+        {
+            Length = CFE_TBL_PACKED_BLOCK_SIZE;
+        }
+
+        /* The record type, and the length of an LZ record, give the size of the rest of it */
+        RecordSize = 0;
+        HeaderSize = 1;
+        if (CFE_TBL_PackedRead(&Reader, Record, 1) == 1)
+        {
+            if (Record[0] == CFE_TBL_PACKED_BLOCK_SAME &&
+                (PackedHeader.Format & CFE_TBL_DumpFormat_DELTA) != 0)
+            {
+                RecordSize = 1;
+            }
+            else if (Record[0] == CFE_TBL_PACKED_BLOCK_RAW)
+            {
+                RecordSize = Length + 1;
+            }
+            else if (Record[0] == CFE_TBL_PACKED_BLOCK_LZ &&
+                     CFE_TBL_PackedRead(&Reader, &Record[1], 2) == 2)
+            {
+                HeaderSize = 3;
+                RecordSize = ((uint32)Record[1] << 8) + Record[2] + HeaderSize;
+                if (RecordSize > sizeof(Record))
+                {
+                    RecordSize = 0;
+                }
+            }
+        }
+
+        if (RecordSize == 0 ||
+            CFE_TBL_PackedRead(&Reader, &Record[HeaderSize], RecordSize - HeaderSize) != (RecordSize - HeaderSize) ||
+            CFE_TBL_UnpackBlock(WorkingBufferPtr->BufferPtr, Offset, Length, Record, RecordSize) != CFE_SUCCESS)
+        {
+            Status = CFE_TBL_ERR_BAD_PACKED_IMAGE;
+        }
+        else
+        {
+            Offset += Length;
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* Check to see if the file holds more records than the table has blocks */
+        if (CFE_TBL_PackedRead(&Reader, &ExtraByte, 1) == 1)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_TOO_BIG_ERR_EID, CFE_EVS_EventType_ERROR,
+                CFE_TBL_TaskData.TableTaskAppId,
+                "%s: File load too long (file length > %lu)",
+                AppName, (long unsigned int)TblFileHeaderPtr->NumBytes);
+
+            Status = CFE_TBL_ERR_FILE_TOO_LARGE;
+        }
+    }
+    else
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_PACKED_IMG_ERR_EID, CFE_EVS_EventType_ERROR,
+            CFE_TBL_TaskData.TableTaskAppId,
+            "%s: Packed image in '%s' is invalid at byte %lu",
+            AppName, Filename, (long unsigned int)Offset);
+    }
+
+    *ImageCrcPtr = PackedHeader.ImageCrc;
+
+    return Status;
+} /* End of CFE_TBL_ReadPackedImage() */
+
+
+/*
+** Hash of the CFE_TBL_PACKED_MIN_MATCH bytes at the given position, used to index the match table
+*/
+static inline uint32 CFE_TBL_PackedHash(const uint8 *Bytes)
+{
+    uint32 Word;
+
+    Word = (uint32)Bytes[0] | ((uint32)Bytes[1] << 8) | ((uint32)Bytes[2] << 16) | ((uint32)Bytes[3] << 24);
+
+    return (Word * 2654435761U) >> (32 - CFE_TBL_PACKED_MATCH_BITS);
+}
+
+/*
+** Appends literal sequences for Count bytes, returning false if they would exceed Limit
+*/
+static bool CFE_TBL_PackLiterals(uint8 *Out, uint32 *OutSize, uint32 Limit, const uint8 *Literals, uint32 Count)
+{
+    uint32 Chunk;
+
+    while (Count > 0)
+    {
+        Chunk = Count;
+        if (Chunk > CFE_TBL_PACKED_MAX_LITERALS)
+        {
+            Chunk = CFE_TBL_PACKED_MAX_LITERALS;
+        }
+
+        if ((*OutSize + 1 + Chunk) > Limit)
+        {
+            return false;
+        }
+
+        Out[*OutSize] = Chunk - 1;
+        memcpy(&Out[*OutSize + 1], Literals, Chunk);
+        *OutSize += 1 + Chunk;
+        Literals += Chunk;
+        Count -= Chunk;
+    }
+
+    return true;
+}
+
+/*
+** Compresses one block into LZ sequences of less than Limit bytes, returning their size or zero
+**
+** This is a greedy single probe LZ77: each position is looked up in the match table by the hash
+** of its next few bytes, and the table then remembers the position for later ones.  A candidate
+** is always checked byte for byte, so collisions and stale entries only cost compression.
+*/
+static uint32 CFE_TBL_PackBlockLZ(uint8 *Out, uint32 Limit, const uint8 *Image, uint32 Offset, uint32 Length,
+                                  uint32 *MatchTable)
+{
+    uint32 Pos = Offset;
+    uint32 End = Offset + Length;
+    uint32 Literal = Offset;
+    uint32 OutSize = 0;
+    uint32 Hash;
+    uint32 Candidate;
+    uint32 MatchLen;
+
+    while ((Pos + CFE_TBL_PACKED_MIN_MATCH) <= End)
+    {
+        Hash = CFE_TBL_PackedHash(&Image[Pos]);
+        Candidate = MatchTable[Hash];
+        MatchTable[Hash] = Pos;
+
+        MatchLen = 0;
+        if (Candidate < Pos && (Pos - Candidate) <= CFE_TBL_PACKED_MAX_DISTANCE)
+        {
+            while (MatchLen < CFE_TBL_PACKED_MAX_MATCH && (Pos + MatchLen) < End &&
+                   Image[Candidate + MatchLen] == Image[Pos + MatchLen])
+            {
+                ++MatchLen;
+            }
+        }
+
+        if (MatchLen >= CFE_TBL_PACKED_MIN_MATCH)
+        {
+            if (!CFE_TBL_PackLiterals(Out, &OutSize, Limit, &Image[Literal], Pos - Literal) ||
+                (OutSize + 3) > Limit)
+            {
+                return 0;
+            }
+
+            Out[OutSize] = 0x80 | (MatchLen - CFE_TBL_PACKED_MIN_MATCH);
+            Out[OutSize + 1] = (Pos - Candidate) >> 8;
+            Out[OutSize + 2] = (Pos - Candidate) & 0xFF;
+            OutSize += 3;
+
+            Pos += MatchLen;
+            Literal = Pos;
+        }
+        else
+        {
+            ++Pos;
+        }
+    }
+
+    if (!CFE_TBL_PackLiterals(Out, &OutSize, Limit, &Image[Literal], End - Literal))
+    {
+        return 0;
+    }
+
+    return OutSize;
+}
+
+/*******************************************************************
+**
+** CFE_TBL_PackBlock
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+uint32 CFE_TBL_PackBlock(uint8 *Record, const uint8 *Image, uint32 Offset, uint32 Length,
+                         const uint8 *Reference, uint32 *MatchTable)
+{
+    uint32 RecordSize = 0;
+
+    if (Reference != NULL && memcmp(&Image[Offset], &Reference[Offset], Length) == 0)
+    {
+        Record[0] = CFE_TBL_PACKED_BLOCK_SAME;
+        return 1;
+    }
+
+    /* Only keep the compressed block if its record is smaller than a copy of the block */
+    if (MatchTable != NULL && Length > 3)
+    {
+        RecordSize = CFE_TBL_PackBlockLZ(&Record[3], Length - 3, Image, Offset, Length, MatchTable);
+    }
+
+    if (RecordSize != 0)
+    {
+        Record[0] = CFE_TBL_PACKED_BLOCK_LZ;
+        Record[1] = RecordSize >> 8;
+        Record[2] = RecordSize & 0xFF;
+        RecordSize += 3;
+    }
+    else
+    {
+        Record[0] = CFE_TBL_PACKED_BLOCK_RAW;
+        memcpy(&Record[1], &Image[Offset], Length);
+        RecordSize = Length + 1;
+    }
+
+    return RecordSize;
+} /* End of CFE_TBL_PackBlock() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_UnpackBlock
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+int32 CFE_TBL_UnpackBlock(uint8 *Image, uint32 Offset, uint32 Length,
+                          const uint8 *Record, uint32 RecordSize)
+{
+    uint32 Pos = Offset;
+    uint32 End = Offset + Length;
+    uint32 In;
+    uint32 Count;
+    uint32 Distance;
+
+    if (RecordSize == 1 && Record[0] == CFE_TBL_PACKED_BLOCK_SAME)
+    {
+        return CFE_SUCCESS;
+    }
+
+    if (RecordSize == (Length + 1) && Record[0] == CFE_TBL_PACKED_BLOCK_RAW)
+    {
+        memcpy(&Image[Offset], &Record[1], Length);
+        return CFE_SUCCESS;
+    }
+
+    if (RecordSize < 3 || Record[0] != CFE_TBL_PACKED_BLOCK_LZ ||
+        RecordSize != (((uint32)Record[1] << 8) + Record[2] + 3))
+    {
+        return CFE_TBL_ERR_BAD_PACKED_IMAGE;
+    }
+
+    In = 3;
+    while (In < RecordSize)
+    {
+        if ((Record[In] & 0x80) != 0)
+        {
+            if ((In + 3) > RecordSize)
+            {
+                return CFE_TBL_ERR_BAD_PACKED_IMAGE;
+            }
+
+            Count = (Record[In] & 0x7F) + CFE_TBL_PACKED_MIN_MATCH;
+            Distance = ((uint32)Record[In + 1] << 8) | Record[In + 2];
+            In += 3;
+
+            if (Distance == 0 || Distance > Pos || Count > (End - Pos))
+            {
+                return CFE_TBL_ERR_BAD_PACKED_IMAGE;
+            }
+
+            /* Copy forward a byte at a time, since the match may overlap what it produces */
+            while (Count > 0)
+            {
+                Image[Pos] = Image[Pos - Distance];
+                ++Pos;
+                --Count;
+            }
+        }
+        else
+        {
+            Count = Record[In] + 1;
+            ++In;
+
+            if (Count > (RecordSize - In) || Count > (End - Pos))
+            {
+                return CFE_TBL_ERR_BAD_PACKED_IMAGE;
+            }
+
+            memcpy(&Image[Pos], &Record[In], Count);
+            In += Count;
+            Pos += Count;
+        }
+    }
+
+    if (Pos != End)
+    {
+        return CFE_TBL_ERR_BAD_PACKED_IMAGE;
+    }
+
+    return CFE_SUCCESS;
+} /* End of CFE_TBL_UnpackBlock() */
+
+
 int32 CFE_TBL_DecodeFromMemory(const void *SourceBuffer, CFE_TBL_LoadBuff_t *WorkingBufferPtr,
         CFE_TBL_RegistryRec_t *RegRecPtr)
 {
@@ -1081,22 +1610,19 @@ int32 CFE_TBL_DecodeFromMemory(const void *SourceBuffer, CFE_TBL_LoadBuff_t *Wor
 }
 
 
-int32 CFE_TBL_LoadFromFileAndDecode(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBufferPtr,
-        CFE_TBL_RegistryRec_t *RegRecPtr,
-        const char *Filename)
+/*******************************************************************
+**
+** CFE_TBL_TakeScratchBuffer
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+CFE_TBL_LoadBuff_t *CFE_TBL_TakeScratchBuffer(void)
 {
-    CFE_TBL_LoadBuff_t *ScratchBufferPtr;
+    CFE_TBL_LoadBuff_t *ScratchBufferPtr = NULL;
     uint16      ScratchBuffId;
     int32       Status;
 
-    /*
-     * EDS INTEGRATION:
-     * In order to load from a file we need to first obtain a scratch buffer, which
-     * will temporarily hold the binary data.  The binary data is then de-serialized
-     * using EDS and the actual working buffer is populated.  The scratch buffer is then
-     * freed for other use.
-     */
-
     /* Take Mutex to make sure we are not trying to grab a working buffer that some */
     /* other application is also trying to grab. */
     Status = OS_MutSemTake(CFE_TBL_TaskData.WorkBufMutex);
@@ -1125,6 +1651,27 @@ int32 CFE_TBL_LoadFromFileAndDecode(const char *AppName, CFE_TBL_LoadBuff_t *Wor
         OS_MutSemGive(CFE_TBL_TaskData.WorkBufMutex);
     }
 
+    return ScratchBufferPtr;
+}
+
+
+int32 CFE_TBL_LoadFromFileAndDecode(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+        CFE_TBL_RegistryRec_t *RegRecPtr,
+        const char *Filename)
+{
+    CFE_TBL_LoadBuff_t *ScratchBufferPtr;
+    int32       Status;
+
+    /*
+     * EDS INTEGRATION:
+     * In order to load from a file we need to first obtain a scratch buffer, which
+     * will temporarily hold the binary data.  The binary data is then de-serialized
+     * using EDS and the actual working buffer is populated.  The scratch buffer is then
+     * freed for other use.
+     */
+
+    ScratchBufferPtr = CFE_TBL_TakeScratchBuffer();
+
     if (ScratchBufferPtr == NULL)
     {
         CFE_ES_WriteToSysLog("CFE_TBL:Load-Cannot obtain shared buffer\n");
@@ -1158,6 +1705,48 @@ int32 CFE_TBL_LoadFromFileAndDecode(const char *AppName, CFE_TBL_LoadBuff_t *Wor
     return Status;
 }
 
+/*******************************************************************
+**
+** CFE_TBL_ValidateLoad
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+int32 CFE_TBL_ValidateLoad(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+                           CFE_TBL_RegistryRec_t *RegRecPtr, int32 LoadStatus)
+{
+    int32 Status = LoadStatus;
+
+    if (RegRecPtr->ValidationFuncPtr != NULL)
+    {
+        Status = (RegRecPtr->ValidationFuncPtr)(WorkingBufferPtr->BufferPtr);
+
+        if (Status > CFE_SUCCESS)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_VAL_ERR_EID, CFE_EVS_EventType_ERROR,
+                CFE_TBL_TaskData.TableTaskAppId,
+                "%s: Validation func return code invalid (Stat=%u) for '%s'",
+                AppName, (unsigned int)Status, RegRecPtr->Name);
+
+            Status = -1;
+        }
+
+        if (Status < 0)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ERR_EID, CFE_EVS_EventType_ERROR,
+                CFE_TBL_TaskData.TableTaskAppId,
+                "%s: Validation func reports table invalid (Stat=%u) for '%s'",
+                AppName, (unsigned int)Status, RegRecPtr->Name);
+
+            /* Zero out the buffer to remove any bad data */
+            memset(WorkingBufferPtr->BufferPtr, 0, RegRecPtr->EdsInfo.Size.Bytes);
+        }
+    }
+
+    return Status;
+}   /* End of CFE_TBL_ValidateLoad() */
+
+
 /*******************************************************************
 **
 ** CFE_TBL_UpdateInternal
@@ -1181,7 +1770,25 @@ int32 CFE_TBL_UpdateInternal( CFE_TBL_Handle_t TblHandle,
     }
     else
     {
-        if (RegRecPtr->DoubleBuffered)
+        if (RegRecPtr->EpochReclaim)
+        {
+            /* Publish the new buffer, then open a new epoch.  Readers that see the new */
+            /* epoch at a quiescent point are guaranteed to see the new buffer as well  */
+            __atomic_store_n(&RegRecPtr->ActiveBufferIndex, (uint8)RegRecPtr->LoadInProgress, __ATOMIC_RELEASE);
+            RegRecPtr->RetireEpoch = __atomic_add_fetch(&CFE_TBL_TaskData.Epoch, 1, __ATOMIC_ACQ_REL);
+
+            strncpy(RegRecPtr->LastFileLoaded,
+                    RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].DataSource,
+                    OS_MAX_PATH_LEN);
+
+            CFE_TBL_NotifyTblUsersOfUpdate(RegRecPtr);
+
+            if (RegRecPtr->CriticalTable == true)
+            {
+                CFE_TBL_UpdateCriticalTblCDSRange(RegRecPtr, RegRecPtr->DeltaOffset, RegRecPtr->DeltaSize);
+            }
+        }
+        else if (RegRecPtr->DoubleBuffered)
         {
             /* To update a double buffered table only requires a pointer swap */
             RegRecPtr->ActiveBufferIndex = (uint8)RegRecPtr->LoadInProgress;
@@ -1198,7 +1805,7 @@ int32 CFE_TBL_UpdateInternal( CFE_TBL_Handle_t TblHandle,
             /* If the table is a critical table, update the appropriate CDS with the new data */
             if (RegRecPtr->CriticalTable == true)
             {
-                CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
+                CFE_TBL_UpdateCriticalTblCDSRange(RegRecPtr, RegRecPtr->DeltaOffset, RegRecPtr->DeltaSize);
             }
         }
         else
@@ -1224,9 +1831,21 @@ int32 CFE_TBL_UpdateInternal( CFE_TBL_Handle_t TblHandle,
                 if (RegRecPtr->Buffers[0].BufferPtr !=
                         CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr)
                 {
-                    memcpy(RegRecPtr->Buffers[0].BufferPtr,
-                              CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr,
-                              RegRecPtr->EdsInfo.Size.Bytes);
+                    RegRecPtr->Buffers[0].LoadGeneration++;
+
+                    if (RegRecPtr->DeltaSize != 0)
+                    {
+                        /* Only the range changed by a delta load differs from the active buffer */
+                        memcpy((uint8 *)RegRecPtr->Buffers[0].BufferPtr + RegRecPtr->DeltaOffset,
+                                  (uint8 *)CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr + RegRecPtr->DeltaOffset,
+                                  RegRecPtr->DeltaSize);
+                    }
+                    else
+                    {
+                        memcpy(RegRecPtr->Buffers[0].BufferPtr,
+                                  CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr,
+                                  RegRecPtr->EdsInfo.Size.Bytes);
+                    }
                 }
 
                 /* Save source description with active buffer */
@@ -1256,16 +1875,122 @@ int32 CFE_TBL_UpdateInternal( CFE_TBL_Handle_t TblHandle,
                 /* If the table is a critical table, update the appropriate CDS with the new data */
                 if (RegRecPtr->CriticalTable == true)
                 {
-                    CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
+                    CFE_TBL_UpdateCriticalTblCDSRange(RegRecPtr, RegRecPtr->DeltaOffset, RegRecPtr->DeltaSize);
                 }
             }
         }
     }
 
+    if (Status == CFE_SUCCESS)
+    {
+        /* The next load may change any part of the table unless it says otherwise */
+        RegRecPtr->DeltaOffset = 0;
+        RegRecPtr->DeltaSize = 0;
+    }
+
     return Status;
 }   /* End of CFE_TBL_UpdateInternal() */
 
 
+/*******************************************************************
+**
+** CFE_TBL_QuiescentPoint
+**
+** NOTE: For complete prolog information, see 'cfe_private.h'
+********************************************************************/
+
+void CFE_TBL_QuiescentPoint(uint32 AppId)
+{
+    if (AppId < CFE_PLATFORM_ES_MAX_APPLICATIONS)
+    {
+        __atomic_store_n(&CFE_TBL_TaskData.AppEpoch[AppId],
+                         __atomic_load_n(&CFE_TBL_TaskData.Epoch, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+    }
+} /* End of CFE_TBL_QuiescentPoint() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_BlockingCallBegin
+**
+** NOTE: For complete prolog information, see 'cfe_private.h'
+********************************************************************/
+
+void CFE_TBL_BlockingCallBegin(uint32 AppId)
+{
+    if (AppId < CFE_PLATFORM_ES_MAX_APPLICATIONS)
+    {
+        __atomic_store_n(&CFE_TBL_TaskData.AppBlocked[AppId], true, __ATOMIC_SEQ_CST);
+    }
+} /* End of CFE_TBL_BlockingCallBegin() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_BlockingCallEnd
+**
+** NOTE: For complete prolog information, see 'cfe_private.h'
+********************************************************************/
+
+void CFE_TBL_BlockingCallEnd(uint32 AppId)
+{
+    if (AppId < CFE_PLATFORM_ES_MAX_APPLICATIONS)
+    {
+        /* Catch up with the epochs that passed while blocked before any */
+        /* table address can be obtained again                           */
+        CFE_TBL_QuiescentPoint(AppId);
+        __atomic_store_n(&CFE_TBL_TaskData.AppBlocked[AppId], false, __ATOMIC_SEQ_CST);
+    }
+} /* End of CFE_TBL_BlockingCallEnd() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_AppPassedEpoch
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+bool CFE_TBL_AppPassedEpoch(uint32 AppId, uint32 Epoch)
+{
+    uint32 AppEpoch;
+
+    if (AppId >= CFE_PLATFORM_ES_MAX_APPLICATIONS)
+    {
+        return false;
+    }
+
+    /* An app blocked in a receive holds no table address, however long it waits */
+    if (__atomic_load_n(&CFE_TBL_TaskData.AppBlocked[AppId], __ATOMIC_SEQ_CST))
+    {
+        return true;
+    }
+
+    AppEpoch = __atomic_load_n(&CFE_TBL_TaskData.AppEpoch[AppId], __ATOMIC_ACQUIRE);
+
+    /* Signed difference so the comparison survives the counter wrapping */
+    return ((int32)(AppEpoch - Epoch) >= 0);
+} /* End of CFE_TBL_AppPassedEpoch() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_MicrosecsSince
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+uint32 CFE_TBL_MicrosecsSince(const OS_time_t *StartTime)
+{
+    OS_time_t CurrTime;
+
+    CFE_PSP_GetTime(&CurrTime);
+
+    return ((1000000 * (CurrTime.seconds - StartTime->seconds)) +
+            CurrTime.microsecs - StartTime->microsecs);
+} /* End of CFE_TBL_MicrosecsSince() */
+
+
 /*******************************************************************
 **
 ** CFE_TBL_NotifyTblUsersOfUpdate
@@ -1352,7 +2077,8 @@ int32 CFE_TBL_ReadHeaders( int32 FileDescriptor,
         else
         {
             /* Verify the SubType to ensure that it is a Table Image File */
-            if (StdFileHeaderPtr->SubType != CFE_FS_SubType_TBL_IMG)
+            if (StdFileHeaderPtr->SubType != CFE_FS_SubType_TBL_IMG &&
+                StdFileHeaderPtr->SubType != CFE_FS_SubType_TBL_PACKED_IMG)
             {
                 CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_SUBTYPE_ERR_EID,
                                            CFE_EVS_EventType_ERROR,
@@ -1464,6 +2190,42 @@ int32 CFE_TBL_ReadHeaders( int32 FileDescriptor,
 }   /* End of CFE_TBL_ReadHeaders() */
 
 
+/*******************************************************************
+**
+** CFE_TBL_WaitValidationJobs
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+bool CFE_TBL_WaitValidationJobs(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    uint32 WaitTime = 0;
+    bool   IsRunning;
+
+    while (true)
+    {
+        CFE_TBL_LockRegistry();
+        IsRunning = (RegRecPtr->ValidationJobsRunning != 0);
+        CFE_TBL_UnlockRegistry();
+
+        if (!IsRunning || WaitTime >= CFE_TBL_VALIDATION_WAIT_LIMIT_MSEC)
+        {
+            break;
+        }
+
+        OS_TaskDelay(CFE_TBL_VALIDATION_WAIT_DELAY_MSEC);
+        WaitTime += CFE_TBL_VALIDATION_WAIT_DELAY_MSEC;
+    }
+
+    if (IsRunning)
+    {
+        CFE_ES_WriteToSysLog("CFE_TBL:WaitValidationJobs-Validation job still running for released table\n");
+    }
+
+    return !IsRunning;
+} /* End of CFE_TBL_WaitValidationJobs() */
+
+
 /*******************************************************************
 **
 ** CFE_TBL_CleanUpApp
@@ -1477,6 +2239,13 @@ int32 CFE_TBL_CleanUpApp(uint32 AppId)
     CFE_TBL_RegistryRec_t *RegRecPtr = NULL;
     CFE_TBL_AccessDescriptor_t *AccessDescPtr = NULL;
 
+    /* The app may have been deleted while blocked in a receive; do not */
+    /* let the next app to get its ID start out as quiescent            */
+    if (AppId < CFE_PLATFORM_ES_MAX_APPLICATIONS)
+    {
+        __atomic_store_n(&CFE_TBL_TaskData.AppBlocked[AppId], false, __ATOMIC_SEQ_CST);
+    }
+
     /* Scan Dump Requests to determine if any of the tables that */
     /* were to be dumped will be deleted */
     for (i=0; i<CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS; i++)
@@ -1506,6 +2275,8 @@ int32 CFE_TBL_CleanUpApp(uint32 AppId)
             /* Determine if the Application owned this particular table */
             if (RegRecPtr->OwnerAppId == AppId)
             {
+                CFE_TBL_LockRegistry();
+
                 /* Mark table as free, although, technically, it isn't free until the */
                 /* linked list of Access Descriptors has no links in it.              */
                 /* NOTE: Allocated memory is freed when all Access Links have been    */
@@ -1514,7 +2285,15 @@ int32 CFE_TBL_CleanUpApp(uint32 AppId)
                 RegRecPtr->OwnerAppId = (uint32)CFE_TBL_NOT_OWNED;
 
                 /* Remove Table Name */
+                CFE_ES_NameIndexRemove(&CFE_TBL_RegistryNameIndex, AccessDescPtr->RegIndex);
                 RegRecPtr->Name[0] = '\0';
+
+                CFE_TBL_UnlockRegistry();
+
+                /* Validation jobs queued from now on are abandoned, but one that is */
+                /* already running may be executing the owner's validation function */
+                /* or reading the buffers released below, so let it finish first    */
+                CFE_TBL_WaitValidationJobs(RegRecPtr);
             }
             
             /* Remove the Access Descriptor Link from linked list */
@@ -1563,13 +2342,37 @@ void CFE_TBL_FindCriticalTblInfo(CFE_TBL_CritRegRec_t **CritRegRecPtr, CFE_ES_CD
 ********************************************************************/
 
 void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    CFE_TBL_UpdateCriticalTblCDSRange(RegRecPtr, 0, 0);
+
+}   /* End of CFE_TBL_UpdateCriticalTblCDS() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_UpdateCriticalTblCDSRange
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_UpdateCriticalTblCDSRange(CFE_TBL_RegistryRec_t *RegRecPtr, uint32 Offset, uint32 NumBytes)
 {
     CFE_TBL_CritRegRec_t *CritRegRecPtr = NULL;
     
     int32 Status;
     
     /* Copy an image of the updated table to the CDS for safekeeping */
-    Status = CFE_ES_CopyToCDS(RegRecPtr->CDSHandle, RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr);
+    if (NumBytes != 0)
+    {
+        /* The CDS already holds the rest of the table from the previous update */
+        Status = CFE_ES_CopyToCDSRange(RegRecPtr->CDSHandle,
+                                       RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr,
+                                       Offset, NumBytes);
+    }
+    else
+    {
+        Status = CFE_ES_CopyToCDS(RegRecPtr->CDSHandle, RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr);
+    }
     
     if (Status != CFE_SUCCESS)
     {
@@ -1606,7 +2409,7 @@ void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr)
     }
     
     /* Don't bother notifying the caller of the problem since the active table is still legitimate */
-}   /* End of CFE_TBL_UpdateCriticalTblCDS() */
+}   /* End of CFE_TBL_UpdateCriticalTblCDSRange() */
 
 
 /*******************************************************************
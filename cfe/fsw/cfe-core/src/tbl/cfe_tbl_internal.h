@@ -221,7 +221,8 @@ int32   CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle);
 **        returns the appropriate Registry Index.
 **
 ** \par Assumptions, External Events, and Notes:
-**          None
+**          The Table Registry must be locked, as the name is looked up
+**          in the Table Registry name index.
 **
 ** \param[in]  TblName - Pointer to character string containing complete
 **                       Table Name (of the format "AppName.TblName").
@@ -352,6 +353,44 @@ int32   CFE_TBL_UnlockRegistry(void);
 int32   CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
                                  CFE_TBL_RegistryRec_t *RegRecPtr,
                                  bool CalledByApp);
+
+
+/*****************************************************************************/
+/**
+** \brief Finds a working buffer, optionally without copying the active table into it
+**
+** \par Description
+**        Same as #CFE_TBL_GetWorkingBuffer, except that a newly obtained
+**        working buffer is only filled with the contents of the active
+**        buffer when \c CopyActive is true.  Loads that overwrite the
+**        whole table, or that track the range they change, pass false
+**        to skip copying the whole table.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This function assumes the TblHandle and MinBufferSize values
+**           are legitimate.
+**
+** \param[in, out]  WorkingBufferPtr  Pointer to variable that will contain the
+**                               address of the working buffer.
+**
+** \param[in]  RegRecPtr         Pointer to Table Registry Entry for Table for whom
+**                               a working buffer is to be obtained
+**
+** \param[in]  CalledByApp       Boolean that identifies whether this internal API
+**                               function is being called by a user Application (true)
+**                               or by the Table Services Application (false)
+**
+** \param[in]  CopyActive        Boolean that identifies whether a newly obtained
+**                               working buffer is filled from the active buffer
+**
+** \retval #CFE_SUCCESS                     \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_ERR_NO_BUFFER_AVAIL     \copydoc CFE_TBL_ERR_NO_BUFFER_AVAIL
+**
+******************************************************************************/
+int32   CFE_TBL_AcquireWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
+                                     CFE_TBL_RegistryRec_t *RegRecPtr,
+                                     bool CalledByApp,
+                                     bool CopyActive);
                                  
 
 /*****************************************************************************/
@@ -361,6 +400,8 @@ int32   CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
 ** \par Description
 **        Locates the specified filename in the onboard filesystem
 **        and loads its contents into the specified working buffer.
+**        Files of subtype #CFE_FS_SubType_TBL_PACKED_IMG are decoded
+**        with #CFE_TBL_ReadPackedImage.
 **
 ** \par Assumptions, External Events, and Notes:
 **        -# This function assumes parameters have been verified.
@@ -392,6 +433,8 @@ int32   CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
 ** \retval #CFE_TBL_ERR_NO_TBL_HEADER        \copydoc CFE_TBL_ERR_NO_TBL_HEADER       
 ** \retval #CFE_TBL_ERR_BAD_CONTENT_ID       \copydoc CFE_TBL_ERR_BAD_CONTENT_ID      
 ** \retval #CFE_TBL_ERR_BAD_SUBTYPE_ID       \copydoc CFE_TBL_ERR_BAD_SUBTYPE_ID      
+** \retval #CFE_TBL_ERR_BAD_PACKED_IMAGE     \copydoc CFE_TBL_ERR_BAD_PACKED_IMAGE
+** \retval #CFE_TBL_ERR_REFERENCE_MISMATCH   \copydoc CFE_TBL_ERR_REFERENCE_MISMATCH
 **                     
 ******************************************************************************/
 int32   CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBufferPtr, 
@@ -406,6 +449,148 @@ int32 CFE_TBL_DecodeFromMemory(const void *SourceBuffer, CFE_TBL_LoadBuff_t *Wor
         CFE_TBL_RegistryRec_t *RegRecPtr);
 
 
+/*****************************************************************************/
+/**
+** \brief Takes a free shared load buffer for use as scratch space
+**
+** \par Description
+**        Marks the first free entry of #CFE_TBL_TaskData_t::LoadBuffs as taken
+**        and returns it.  The caller releases it by clearing its Taken flag.
+**
+** \returns Pointer to the buffer, or NULL if none is free
+******************************************************************************/
+CFE_TBL_LoadBuff_t *CFE_TBL_TakeScratchBuffer(void);
+
+
+/*****************************************************************************/
+/**
+** \brief Decodes the body of a packed table image file into a table buffer
+**
+** \par Description
+**        Reads the #CFE_TBL_PackedImg_Hdr_t and the block records which follow
+**        the table file header of a #CFE_FS_SubType_TBL_PACKED_IMG file, and
+**        rebuilds the EDS packed table image in the working buffer.  For a delta
+**        image the working buffer first receives the packed active table contents,
+**        which must have the CRC the image was dumped against.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The file is positioned just after the table file header.
+**        -# Packed images always hold a whole table, starting at offset zero.
+**        -# This function sends its own events on failure.
+**
+** \param[in]  FileDescriptor    File Descriptor, as provided by OS_open
+**
+** \param[in]  WorkingBufferPtr  Pointer to the buffer to receive the packed table image
+**
+** \param[in]  RegRecPtr         Pointer to Table Registry record of the table being loaded
+**
+** \param[in]  TblFileHeaderPtr  Pointer to the table file header read from the file
+**
+** \param[in]  AppName           The name of the application loading the table
+**
+** \param[in]  Filename          Full path and filename of the table image file
+**
+** \param[out] ImageCrcPtr       CRC of the decoded image, as recorded in the file
+**
+** \retval #CFE_SUCCESS                      \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_ERR_BAD_PACKED_IMAGE     \copydoc CFE_TBL_ERR_BAD_PACKED_IMAGE
+** \retval #CFE_TBL_ERR_REFERENCE_MISMATCH   \copydoc CFE_TBL_ERR_REFERENCE_MISMATCH
+** \retval #CFE_TBL_ERR_FILE_TOO_LARGE       \copydoc CFE_TBL_ERR_FILE_TOO_LARGE
+******************************************************************************/
+int32 CFE_TBL_ReadPackedImage(int32 FileDescriptor, CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+                              CFE_TBL_RegistryRec_t *RegRecPtr, const CFE_TBL_File_Hdr_t *TblFileHeaderPtr,
+                              const char *AppName, const char *Filename, uint32 *ImageCrcPtr);
+
+
+/*****************************************************************************/
+/**
+** \brief Encodes one block of a table image as a packed image record
+**
+** \par Description
+**        Produces a #CFE_TBL_PACKED_BLOCK_SAME record if a reference image is
+**        given and the block matches it.  Otherwise, if a match table is given,
+**        the block is compressed into a #CFE_TBL_PACKED_BLOCK_LZ record, or else
+**        copied into a #CFE_TBL_PACKED_BLOCK_RAW record when compression does
+**        not make it smaller.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Blocks must be encoded in order, since LZ records may copy from
+**           any earlier part of the image.
+**        -# The match table must be zeroed before the first block of an image.
+**
+** \param[out] Record       Buffer of at least Length + 1 bytes to receive the record
+**
+** \param[in]  Image        EDS packed table image
+**
+** \param[in]  Offset       Offset of the block in the image
+**
+** \param[in]  Length       Size of the block, at most #CFE_TBL_PACKED_BLOCK_SIZE
+**
+** \param[in]  Reference    Reference image for a delta encoding, or NULL
+**
+** \param[in, out] MatchTable  Match table of 2^#CFE_TBL_PACKED_MATCH_BITS entries
+**                              for compression, or NULL
+**
+** \returns Size of the record in bytes
+******************************************************************************/
+uint32 CFE_TBL_PackBlock(uint8 *Record, const uint8 *Image, uint32 Offset, uint32 Length,
+                         const uint8 *Reference, uint32 *MatchTable);
+
+
+/*****************************************************************************/
+/**
+** \brief Decodes one packed image record into a block of a table image
+**
+** \par Assumptions, External Events, and Notes:
+**        -# A #CFE_TBL_PACKED_BLOCK_SAME record leaves the block unchanged, so
+**           the image must already hold the reference contents.
+**        -# Blocks must be decoded in order.
+**
+** \param[in, out] Image     Table image being decoded
+**
+** \param[in]  Offset       Offset of the block in the image
+**
+** \param[in]  Length       Size of the block, at most #CFE_TBL_PACKED_BLOCK_SIZE
+**
+** \param[in]  Record       Record produced by #CFE_TBL_PackBlock
+**
+** \param[in]  RecordSize   Size of the record in bytes
+**
+** \retval #CFE_SUCCESS                      \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_ERR_BAD_PACKED_IMAGE     \copydoc CFE_TBL_ERR_BAD_PACKED_IMAGE
+******************************************************************************/
+int32 CFE_TBL_UnpackBlock(uint8 *Image, uint32 Offset, uint32 Length,
+                          const uint8 *Record, uint32 RecordSize);
+
+
+/*****************************************************************************/
+/**
+** \brief Runs the table's validation function on a freshly loaded working buffer
+**
+** \par Description
+**        Calls the validation function registered for the table, if any, on
+**        the working buffer.  An invalid buffer is reported and zeroed.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This function assumes the working buffer was loaded successfully.
+**
+** \param[in]  AppName          The name of the application loading the table.
+**
+** \param[in]  WorkingBufferPtr Pointer to the loaded working buffer
+**
+** \param[in]  RegRecPtr        Pointer to Table Registry record for the table
+**
+** \param[in]  LoadStatus       Status of the load, returned when the table has
+**                              no validation function
+**
+** \retval #CFE_SUCCESS         \copydoc CFE_SUCCESS
+** \retval negative             The validation function reported the table invalid
+**
+******************************************************************************/
+int32 CFE_TBL_ValidateLoad(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+                           CFE_TBL_RegistryRec_t *RegRecPtr, int32 LoadStatus);
+
+
 /*****************************************************************************/
 /**
 ** \brief Updates the active table buffer with contents of inactive buffer
@@ -450,6 +635,46 @@ int32   CFE_TBL_UpdateInternal( CFE_TBL_Handle_t TblHandle,
 void   CFE_TBL_NotifyTblUsersOfUpdate( CFE_TBL_RegistryRec_t *RegRecPtr );
 
 
+/*****************************************************************************/
+/**
+** \brief Checks whether an application has passed a quiescent point since an epoch
+**
+** \par Description
+**        Returns true if the specified application has called #CFE_ES_RunLoop
+**        or #CFE_TBL_Manage after the table epoch reached the given value,
+**        meaning it can no longer hold an address obtained before that epoch.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# An out of range AppId is treated as not having passed the epoch.
+**        -# An application whose main task is blocked in #CFE_SB_RcvMsg is
+**           treated as having passed every epoch, see #CFE_TBL_BlockingCallBegin.
+**
+** \param[in]  AppId     Application ID to check
+**
+** \param[in]  Epoch     Epoch at which a buffer was retired
+**
+** \returns true if the application has passed a quiescent point in or after Epoch
+******************************************************************************/
+bool   CFE_TBL_AppPassedEpoch( uint32 AppId, uint32 Epoch );
+
+
+/*****************************************************************************/
+/**
+** \brief Computes the time elapsed since a previous reading of the PSP clock
+**
+** \par Description
+**        Used to measure how long a table validation takes.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Intervals of more than about an hour do not fit in the result.
+**
+** \param[in]  StartTime  Time read from #CFE_PSP_GetTime at the start of the interval
+**
+** \returns Microseconds elapsed since StartTime
+******************************************************************************/
+uint32 CFE_TBL_MicrosecsSince( const OS_time_t *StartTime );
+
+
 /*****************************************************************************/
 /**
 ** \brief Reads Table File Headers
@@ -505,6 +730,29 @@ int32 CFE_TBL_ReadHeaders( int32 FileDescriptor,
 void CFE_TBL_InitRegistryRecord (CFE_TBL_RegistryRec_t *RegRecPtr);
 
 
+/*****************************************************************************/
+/**
+** \brief Waits for the validation jobs running on a table to complete
+**
+** \par Description
+**        Polls the number of validation jobs using the buffers of the table
+**        until it drops to zero, or for at most #CFE_TBL_VALIDATION_WAIT_LIMIT_MSEC.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The table must already be marked as not owned, so that no further
+**           validation job starts on it.
+**        -# The registry lock must not be held by the caller.
+**        -# The count is deliberately not reset by #CFE_TBL_InitRegistryRecord,
+**           so a job that outlives the wait still balances it when it ends.
+**
+** \param[in]  RegRecPtr Pointer to the Registry Record of the table.
+**
+** \returns true if no validation job is running, false if the wait timed out.
+**
+******************************************************************************/
+bool CFE_TBL_WaitValidationJobs(CFE_TBL_RegistryRec_t *RegRecPtr);
+
+
 
 
 /*****************************************************************************/
@@ -555,6 +803,30 @@ void CFE_TBL_FindCriticalTblInfo(CFE_TBL_CritRegRec_t **CritRegRecPtr, CFE_ES_CD
 void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr);
 
 
+/*****************************************************************************/
+/**
+** \brief Updates a range of the CDS associated with a Critical Table
+**
+** \par Description
+**        Same as #CFE_TBL_UpdateCriticalTblCDS, except that only the
+**        given range of the active buffer is copied into the CDS.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The CDS must already hold the active buffer contents outside
+**           of the range.
+**
+** \param[in]  RegRecPtr Pointer to Registry Record of Critical Table whose CDS
+**                       needs to be updated.
+**
+** \param[in]  Offset    Offset, in bytes, of the range that changed.
+**
+** \param[in]  NumBytes  Size of the range that changed, or 0 to copy the
+**                       whole table.
+**
+******************************************************************************/
+void CFE_TBL_UpdateCriticalTblCDSRange(CFE_TBL_RegistryRec_t *RegRecPtr, uint32 Offset, uint32 NumBytes);
+
+
 /*****************************************************************************/
 /**
 ** \brief When enabled, will send a manage notification command message
@@ -580,6 +852,11 @@ int32 CFE_TBL_SendNotificationMsg(CFE_TBL_RegistryRec_t *RegRecPtr);
 */
 extern CFE_TBL_TaskData_t CFE_TBL_TaskData;
 
+/*
+** Name index of the Table Registry, protected by the registry mutex
+*/
+extern const CFE_ES_NameIndex_t CFE_TBL_RegistryNameIndex;
+
 
 
 #endif /* _cfe_tbl_internal_ */
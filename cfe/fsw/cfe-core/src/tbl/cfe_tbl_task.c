@@ -50,6 +50,15 @@
 */
 CFE_TBL_TaskData_t    CFE_TBL_TaskData;
 
+const CFE_ES_NameIndex_t CFE_TBL_RegistryNameIndex =
+{
+    .Slots = CFE_TBL_TaskData.RegistryNameSlots,
+    .NumSlots = CFE_ES_NAMEINDEX_SIZE(CFE_PLATFORM_TBL_MAX_NUM_TABLES),
+    .NameBase = CFE_TBL_TaskData.Registry[0].Name,
+    .NameStride = sizeof(CFE_TBL_RegistryRec_t),
+    .NameLength = sizeof(CFE_TBL_TaskData.Registry[0].Name)
+};
+
 
 /* CFE TABLE EDS - The content of this file is generated by the build scripts */
 #include "cfe_tbl_eds_dictionary.h"
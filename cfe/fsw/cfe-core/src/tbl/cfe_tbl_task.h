@@ -40,6 +40,7 @@
 ** Required header files
 */
 #include "private/cfe_private.h"
+#include "private/cfe_es_nameindex.h"
 #include "cfe_tbl_events.h"
 #include "cfe_tbl_msg.h"
 
@@ -85,6 +86,56 @@
 */ 
 #define CFE_TBL_NO_DUMP_PENDING (-1) 
 
+/** \brief Priority of Table Validation Jobs */
+/**
+**  Priority of the ES async jobs that compute the CRC of a table, and run its
+**  validation function when it was registered with #CFE_TBL_OPT_ASYNC_VALIDATE,
+**  in response to a Validate command.  These are ahead of the file dump jobs.
+*/
+#define CFE_TBL_VALIDATION_JOB_PRIORITY  50
+
+/** \brief Validation Job Wait Delay and Limit */
+/**
+**  When the owner of a table is cleaned up, the validation jobs running on
+**  its buffers are polled every CFE_TBL_VALIDATION_WAIT_DELAY_MSEC, for up to
+**  CFE_TBL_VALIDATION_WAIT_LIMIT_MSEC, before the table is released, as they
+**  may be executing the owner's validation function.
+*/
+#define CFE_TBL_VALIDATION_WAIT_DELAY_MSEC   10
+#define CFE_TBL_VALIDATION_WAIT_LIMIT_MSEC   5000
+
+/** \brief Packed Table Image Block Size */
+/**
+**  Number of bytes of table image covered by each record of a packed table
+**  image file.  A delta image skips whole blocks which match the reference,
+**  and each block is compressed on its own, falling back to a copy of the
+**  block when compression does not make it smaller.
+*/
+#define CFE_TBL_PACKED_BLOCK_SIZE       256
+
+/*
+** Packed table image block record types.  A SAME record is the type byte alone,
+** a RAW record is followed by the block bytes, and an LZ record by a big endian
+** 16 bit length and that many bytes of LZ sequences.
+*/
+#define CFE_TBL_PACKED_BLOCK_SAME       0   /**< \brief Block matches the reference image */
+#define CFE_TBL_PACKED_BLOCK_RAW        1   /**< \brief Block is stored as is */
+#define CFE_TBL_PACKED_BLOCK_LZ         2   /**< \brief Block is stored as LZ sequences */
+
+/*
+** An LZ sequence starts with a control byte.  If its top bit is clear it is
+** followed by (control + 1) literal bytes.  Otherwise it copies
+** ((control & 0x7F) + CFE_TBL_PACKED_MIN_MATCH) bytes from a big endian 16 bit
+** distance back in the table image, which may reach into earlier blocks.
+*/
+#define CFE_TBL_PACKED_MIN_MATCH        4
+#define CFE_TBL_PACKED_MAX_MATCH        (CFE_TBL_PACKED_MIN_MATCH + 0x7F)
+#define CFE_TBL_PACKED_MAX_LITERALS     0x80
+#define CFE_TBL_PACKED_MAX_DISTANCE     0xFFFF
+
+/** \brief Size of the Packed Table Image Match Table, as a power of two */
+#define CFE_TBL_PACKED_MATCH_BITS       10
+
 /************************  Internal Structure Definitions  *****************************/
 
 /*******************************************************************************/
@@ -152,6 +203,7 @@ typedef struct
     uint32         Crc;                         /**< \brief Last calculated CRC for this buffer's contents */
     bool           Taken;                       /**< \brief Flag indicating whether buffer is in use */
     bool           Validated;                   /**< \brief Flag indicating whether the buffer has been successfully validated */
+    uint32         LoadGeneration;              /**< \brief Incremented each time new contents are written to the buffer */
     char           DataSource[OS_MAX_PATH_LEN]; /**< \brief Source of data put into buffer (filename or memory address) */
 } CFE_TBL_LoadBuff_t;
 
@@ -196,6 +248,8 @@ typedef struct
     CFE_TIME_SysTime_t          TimeOfLastUpdate;   /**< \brief Time when Table was last updated */
     CFE_TBL_Handle_t            HeadOfAccessList;   /**< \brief Index into Handles Array that starts Access Linked List */
     int32                       LoadInProgress;     /**< \brief Flag identifies inactive buffer and whether load in progress */
+    uint32                      DeltaOffset;        /**< \brief Offset of the only range a pending load changes */
+    uint32                      DeltaSize;          /**< \brief Size of that range, or 0 when the whole table may change */
     int32                       ValidateActiveIndex;    /**< \brief Index to Validation Request on Active Table Result data */
     int32                       ValidateInactiveIndex;  /**< \brief Index to Validation Request on Inactive Table Result data */
     int32                       DumpControlIndex;       /**< \brief Index to Dump Control Block */
@@ -206,10 +260,15 @@ typedef struct
     bool                        LoadPending;        /**< \brief Flag indicating an inactive buffer is ready to be copied */
     bool                        DumpOnly;           /**< \brief Flag indicating Table is NOT to be loaded */
     bool                        DoubleBuffered;        /**< \brief Flag indicating Table has a dedicated inactive buffer */
+    bool                        EpochReclaim;       /**< \brief Flag indicating inactive buffer is reclaimed by epoch rather than by lock */
+    bool                        AsyncValidation;    /**< \brief Flag indicating Table Services runs the validation function */
     bool                        UserDefAddr;        /**< \brief Flag indicating Table address was defined by Owner Application */
     bool                        NotifyByMsg;        /**< \brief Flag indicating Table Services should notify owning App via message
                                                                 when table requires management */ 
     uint8                       ActiveBufferIndex;  /**< \brief Index identifying which buffer is the active buffer */
+    uint32                      RetireEpoch;        /**< \brief Epoch at which the inactive buffer was last made inactive */
+    uint32                      ValidationTime;     /**< \brief Microseconds taken by the last validation of the table */
+    uint32                      ValidationJobsRunning;  /**< \brief Number of validation jobs using the table buffers */
     char                        Name[CFE_TBL_MAX_FULL_NAME_LEN];   /**< \brief Processor specific table name */
     char                        LastFileLoaded[OS_MAX_PATH_LEN];   /**< \brief Filename of last file loaded into table */
 } CFE_TBL_RegistryRec_t;
@@ -244,6 +303,7 @@ typedef struct
     uint32                    Size;           /**< \brief Number of bytes to be dumped */
     CFE_TBL_LoadBuff_t       *DumpBufferPtr;  /**< \brief Address where dumped data is to be stored temporarily */
     CFE_TBL_RegistryRec_t    *RegRecPtr;      /**< \brief Ptr to dumped table's registry record */
+    CFE_TBL_DumpFormat_Enum_t DumpFormat;     /**< \brief Format of the dump file to be written */
     char                      TableName[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief Name of Table being Dumped */
 } CFE_TBL_DumpControl_t;
 
@@ -332,16 +392,29 @@ typedef struct
   CFE_ES_CDSHandle_t     CritRegHandle;                   /**< \brief Handle to Critical Table Registry in CDS */
   CFE_TBL_LoadBuff_t     LoadBuffs[CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS];  /**< \brief Working table buffers shared by single buffered tables */
 
+  /*
+  ** Epoch reclamation data for #CFE_TBL_OPT_EPOCH tables
+  */
+  uint32                 Epoch;                           /**< \brief Incremented each time an epoch table changes its active buffer */
+  uint32                 AppEpoch[CFE_PLATFORM_ES_MAX_APPLICATIONS];  /**< \brief Value of Epoch at each App's last quiescent point */
+  bool                   AppBlocked[CFE_PLATFORM_ES_MAX_APPLICATIONS]; /**< \brief Whether each App's main task is in a blocking receive */
+
   /*
   ** Registry Data
   */
   CFE_TBL_AccessDescriptor_t  Handles[CFE_PLATFORM_TBL_MAX_NUM_HANDLES];  /**< \brief Array of Access Descriptors */
   CFE_TBL_RegistryRec_t       Registry[CFE_PLATFORM_TBL_MAX_NUM_TABLES];  /**< \brief Array of Table Registry Records */
+  CFE_ES_NameIndexSlot_t      RegistryNameSlots[CFE_ES_NAMEINDEX_SIZE(CFE_PLATFORM_TBL_MAX_NUM_TABLES)]; /**< \brief Name index of the owned Table Registry Records */
   CFE_TBL_CritRegRec_t        CritReg[CFE_PLATFORM_TBL_MAX_CRITICAL_TABLES]; /**< \brief Array of Critical Table Registry Records */
   CFE_TBL_BufParams_t         Buf;                               /**< \brief Parameters associated with Table Task's Memory Pool */
   CFE_TBL_ValidationResult_t  ValidationResults[CFE_PLATFORM_TBL_MAX_NUM_VALIDATIONS]; /**< \brief Array of Table Validation Requests */
   CFE_TBL_DumpControl_t       DumpControlBlocks[CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS]; /**< \brief Array of Dump-Only Dump Control Blocks */
 
+  /*
+  ** Packed dump data, only used by the Table Task while it writes a packed dump file
+  */
+  uint32                      PackedMatchTable[1 << CFE_TBL_PACKED_MATCH_BITS]; /**< \brief Last image offset seen for each hash of #CFE_TBL_PACKED_MIN_MATCH bytes */
+
 } CFE_TBL_TaskData_t;
 
 
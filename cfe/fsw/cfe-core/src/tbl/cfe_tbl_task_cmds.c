@@ -103,10 +103,20 @@ int32 CFE_TBL_HousekeepingCmd(const CFE_TBL_SendHkCommand_t *data)
         if (CFE_TBL_TaskData.DumpControlBlocks[i].State == CFE_TBL_DUMP_PERFORMED)
         {
         	DumpCtrlPtr = &CFE_TBL_TaskData.DumpControlBlocks[i];
-            Status = CFE_TBL_DumpToFile(DumpCtrlPtr->DumpBufferPtr->DataSource,
-                                        DumpCtrlPtr->TableName,
-                                        DumpCtrlPtr->DumpBufferPtr->BufferPtr,
-                                        DumpCtrlPtr->Size);
+            if (DumpCtrlPtr->DumpFormat == CFE_TBL_DumpFormat_RAW)
+            {
+                Status = CFE_TBL_DumpToFile(DumpCtrlPtr->DumpBufferPtr->DataSource,
+                                            DumpCtrlPtr->TableName,
+                                            DumpCtrlPtr->DumpBufferPtr->BufferPtr,
+                                            DumpCtrlPtr->Size);
+            }
+            else
+            {
+                Status = CFE_TBL_DumpToPackedFile(DumpCtrlPtr->DumpBufferPtr->DataSource,
+                                                  DumpCtrlPtr->RegRecPtr,
+                                                  DumpCtrlPtr->DumpBufferPtr->BufferPtr,
+                                                  DumpCtrlPtr->DumpFormat);
+            }
                                 
             /* If dump file was successfully written, update the file header so that the timestamp */
             /* is the time of the actual capturing of the data, NOT the time when it was written to the file */        
@@ -196,6 +206,9 @@ void CFE_TBL_GetHkData(void)
         }
     }
 
+    /* Validation jobs complete on the ES workers, under the registry lock */
+    CFE_TBL_LockRegistry();
+
     /* Locate a completed, but unreported, validation request */
     i=0;
     while ((i < CFE_PLATFORM_TBL_MAX_NUM_VALIDATIONS) && (ValPtr == NULL))
@@ -242,6 +255,8 @@ void CFE_TBL_GetHkData(void)
     CFE_TBL_TaskData.HkPacket.Payload.SuccessValCounter  = CFE_TBL_TaskData.SuccessValCounter;
     CFE_TBL_TaskData.HkPacket.Payload.FailedValCounter   = CFE_TBL_TaskData.FailedValCounter;
     CFE_TBL_TaskData.HkPacket.Payload.NumValRequests = CFE_TBL_TaskData.NumValRequests;
+
+    CFE_TBL_UnlockRegistry();
     
     /* Validate the index of the last table updated before using it */
     if ((CFE_TBL_TaskData.LastTblUpdated >= 0) && 
@@ -310,6 +325,7 @@ void CFE_TBL_GetTblRegData(void)
     CFE_TBL_TaskData.TblRegPacket.Payload.FileCreateTime.Subseconds = RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].FileCreateTimeSubSecs;
     CFE_TBL_TaskData.TblRegPacket.Payload.Crc = RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Crc;
     CFE_TBL_TaskData.TblRegPacket.Payload.Critical = RegRecPtr->CriticalTable;
+    CFE_TBL_TaskData.TblRegPacket.Payload.LastValidationTime = RegRecPtr->ValidationTime;
 
     CFE_SB_MessageStringSet(CFE_TBL_TaskData.TblRegPacket.Payload.Name, RegRecPtr->Name,
             sizeof(CFE_TBL_TaskData.TblRegPacket.Payload.Name), sizeof(RegRecPtr->Name));
@@ -350,9 +366,12 @@ int32 CFE_TBL_ResetCountersCmd(const CFE_TBL_ResetCounters_t *data)
     CFE_TBL_TaskData.CommandErrorCounter = 0;
     CFE_TBL_TaskData.SuccessValCounter = 0;
     CFE_TBL_TaskData.FailedValCounter = 0;
-    CFE_TBL_TaskData.NumValRequests = 0;
     CFE_TBL_TaskData.ValidationCounter = 0;
 
+    CFE_TBL_LockRegistry();
+    CFE_TBL_TaskData.NumValRequests = 0;
+    CFE_TBL_UnlockRegistry();
+
     CFE_EVS_SendEvent(CFE_TBL_RESET_INF_EID,
                       CFE_EVS_EventType_DEBUG,
                       "Reset Counters command");
@@ -403,7 +422,9 @@ int32 CFE_TBL_LoadCmd(const CFE_TBL_Load_t *data)
         if (Status == CFE_SUCCESS)
         {
             /* Locate specified table in registry */
+            CFE_TBL_LockRegistry();
             Status = CFE_TBL_FindTableInRegistry(TblFileHeader.TableName);
+            CFE_TBL_UnlockRegistry();
 
             if (Status == CFE_TBL_NOT_FOUND)
             {
@@ -563,7 +584,9 @@ int32 CFE_TBL_DumpCmd(const CFE_TBL_Dump_t *data)
             CFE_TBL_MAX_FULL_NAME_LEN, sizeof(CmdPtr->TableName));
 
     /* Before doing anything, lets make sure the table that is to be dumped exists */
+    CFE_TBL_LockRegistry();
     RegIndex = CFE_TBL_FindTableInRegistry(TableName);
+    CFE_TBL_UnlockRegistry();
 
     if (RegIndex != CFE_TBL_NOT_FOUND)
     {
@@ -571,7 +594,23 @@ int32 CFE_TBL_DumpCmd(const CFE_TBL_Dump_t *data)
         RegRecPtr = &CFE_TBL_TaskData.Registry[RegIndex];
 
         /* Determine what data is to be dumped */
-        if (CmdPtr->ActiveTableFlag == CFE_TBL_BufferSelect_ACTIVE)
+        if (CmdPtr->DumpFormat > CFE_TBL_DumpFormat_DELTA_LZ)
+        {
+            CFE_EVS_SendEvent(CFE_TBL_ILLEGAL_DUMP_FORMAT_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Cmd for Table '%s' had illegal dump format (0x%04X)",
+                              TableName, (unsigned int)CmdPtr->DumpFormat);
+        }
+        else if (CmdPtr->ActiveTableFlag == CFE_TBL_BufferSelect_ACTIVE &&
+                 (CmdPtr->DumpFormat & CFE_TBL_DumpFormat_DELTA) != 0)
+        {
+            /* A delta is taken against the active contents, so it would only hold unchanged blocks */
+            CFE_EVS_SendEvent(CFE_TBL_ILLEGAL_DUMP_FORMAT_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Cmd for Table '%s' had illegal dump format (0x%04X) for the active buffer",
+                              TableName, (unsigned int)CmdPtr->DumpFormat);
+        }
+        else if (CmdPtr->ActiveTableFlag == CFE_TBL_BufferSelect_ACTIVE)
         {
             DumpDataAddr = RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr;
         }
@@ -613,7 +652,14 @@ int32 CFE_TBL_DumpCmd(const CFE_TBL_Dump_t *data)
             /* If this is not a dump only table, then we can perform the dump immediately */
             if (!RegRecPtr->DumpOnly)
             {
-                ReturnCode = CFE_TBL_DumpToFile(DumpFilename, TableName, DumpDataAddr, RegRecPtr->EdsInfo.Size.Bytes);
+                if (CmdPtr->DumpFormat == CFE_TBL_DumpFormat_RAW)
+                {
+                    ReturnCode = CFE_TBL_DumpToFile(DumpFilename, TableName, DumpDataAddr, RegRecPtr->EdsInfo.Size.Bytes);
+                }
+                else
+                {
+                    ReturnCode = CFE_TBL_DumpToPackedFile(DumpFilename, RegRecPtr, DumpDataAddr, CmdPtr->DumpFormat);
+                }
             }
             else /* Dump Only tables need to synchronize their dumps with the owner's execution */
             {
@@ -644,6 +690,7 @@ int32 CFE_TBL_DumpCmd(const CFE_TBL_Dump_t *data)
                             memcpy(DumpCtrlPtr->DumpBufferPtr->DataSource, DumpFilename, OS_MAX_PATH_LEN);
                             memcpy(DumpCtrlPtr->TableName, TableName, CFE_TBL_MAX_FULL_NAME_LEN);
                             DumpCtrlPtr->Size = RegRecPtr->EdsInfo.Size.Bytes;
+                            DumpCtrlPtr->DumpFormat = CmdPtr->DumpFormat;
                         
                             /* Notify the owning application that a dump is pending */
                             RegRecPtr->DumpControlIndex = DumpIndex;
@@ -692,6 +739,33 @@ int32 CFE_TBL_DumpCmd(const CFE_TBL_Dump_t *data)
 } /* End of CFE_TBL_DumpCmd() */
 
 
+/*
+** Reports a successfully written table dump file
+*/
+static void CFE_TBL_ReportDumpWritten(const char *DumpFilename, const char *TableName, bool FileExistedPrev)
+{
+    if (FileExistedPrev)
+    {
+        CFE_EVS_SendEvent(CFE_TBL_OVERWRITE_DUMP_INF_EID,
+                          CFE_EVS_EventType_INFORMATION,
+                          "Successfully overwrote '%s' with Table '%s'",
+                          DumpFilename, TableName);
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CFE_TBL_WRITE_DUMP_INF_EID,
+                          CFE_EVS_EventType_INFORMATION,
+                          "Successfully dumped Table '%s' to '%s'",
+                          TableName, DumpFilename);
+    }
+
+    /* Save file information statistics for housekeeping telemetry */
+    strncpy(CFE_TBL_TaskData.HkPacket.Payload.LastFileDumped, DumpFilename,
+            sizeof(CFE_TBL_TaskData.HkPacket.Payload.LastFileDumped)-1);
+    CFE_TBL_TaskData.HkPacket.Payload.LastFileDumped[sizeof(CFE_TBL_TaskData.HkPacket.Payload.LastFileDumped)-1] = 0;
+}
+
+
 /*******************************************************************
 **
 ** CFE_TBL_DumpToFile() -- Write table data to a file
@@ -768,25 +842,7 @@ CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile( const char *DumpFilename, const char *T
 
                 if (Status == (int32)TblSizeInBytes)
                 {
-                    if (FileExistedPrev)
-                    {
-                        CFE_EVS_SendEvent(CFE_TBL_OVERWRITE_DUMP_INF_EID,
-                                          CFE_EVS_EventType_INFORMATION,
-                                          "Successfully overwrote '%s' with Table '%s'",
-                                          DumpFilename, TableName);
-                    }
-                    else
-                    {
-                        CFE_EVS_SendEvent(CFE_TBL_WRITE_DUMP_INF_EID,
-                                          CFE_EVS_EventType_INFORMATION,
-                                          "Successfully dumped Table '%s' to '%s'",
-                                          TableName, DumpFilename);
-                    }
-
-                    /* Save file information statistics for housekeeping telemetry */
-                    strncpy(CFE_TBL_TaskData.HkPacket.Payload.LastFileDumped, DumpFilename,
-                            sizeof(CFE_TBL_TaskData.HkPacket.Payload.LastFileDumped)-1);
-                    CFE_TBL_TaskData.HkPacket.Payload.LastFileDumped[sizeof(CFE_TBL_TaskData.HkPacket.Payload.LastFileDumped)-1] = 0;
+                    CFE_TBL_ReportDumpWritten(DumpFilename, TableName, FileExistedPrev);
 
                     /* Increment Successful Command Counter */
                     ReturnCode = CFE_TBL_INC_CMD_CTR;
@@ -829,6 +885,471 @@ CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile( const char *DumpFilename, const char *T
     return ReturnCode;
 } /* End of CFE_TBL_DumpToFile() */
 
+
+/*******************************************************************
+**
+** CFE_TBL_DumpToPackedFile() -- Write a packed table image to a file
+**
+** NOTE: For complete prolog information, see prototype above
+********************************************************************/
+
+CFE_TBL_CmdProcRet_t CFE_TBL_DumpToPackedFile( const char *DumpFilename, CFE_TBL_RegistryRec_t *RegRecPtr,
+                                               const void *DumpDataAddr, CFE_TBL_DumpFormat_Enum_t DumpFormat)
+{
+    CFE_TBL_CmdProcRet_t        ReturnCode = CFE_TBL_INC_ERR_CTR;        /* Assume failure */
+    bool                        FileExistedPrev = false;
+    union
+    {
+        CFE_FS_Header_t             StdFile;
+        CFE_TBL_File_Hdr_t          TblFile;
+        CFE_TBL_PackedImg_Hdr_t     PackedImg;
+        uint8                       Bytes[1];
+    }                           NativeHeader;
+    uint8                       OutputHeader[sizeof(CFE_TBL_File_Hdr_t)];
+    uint8                       Record[CFE_TBL_PACKED_BLOCK_SIZE + 1];
+    uint8                       WriteBuffer[512];
+    CFE_FS_BufferedWriter_t     Writer;
+    CFE_TBL_LoadBuff_t         *ImageBufferPtr;
+    CFE_TBL_LoadBuff_t         *RefBufferPtr = NULL;
+    const void                 *ActiveDataAddr;
+    int32                       FileDescriptor;
+    int32                       Status;
+    EdsLib_Id_t                 EdsId;
+    EdsLib_DataTypeDB_TypeInfo_t HdrInfo;
+    uint32                      ExpectedSize;
+    uint32                      ImageCrc;
+    uint32                      ReferenceCrc = 0;
+    uint32                      Offset;
+    uint32                      Length;
+
+    /* The image is EDS packed first, so that the file loads back like any other table file */
+    ImageBufferPtr = CFE_TBL_TakeScratchBuffer();
+    if (ImageBufferPtr != NULL && (DumpFormat & CFE_TBL_DumpFormat_DELTA) != 0)
+    {
+        RefBufferPtr = CFE_TBL_TakeScratchBuffer();
+        if (RefBufferPtr == NULL)
+        {
+            ImageBufferPtr->Taken = false;
+            ImageBufferPtr = NULL;
+        }
+    }
+
+    if (ImageBufferPtr == NULL)
+    {
+        CFE_EVS_SendEvent(CFE_TBL_NO_WORK_BUFFERS_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "No working buffers available for table '%s'",
+                          RegRecPtr->Name);
+
+        return ReturnCode;
+    }
+
+    EdsId = RegRecPtr->EdsId;
+    Status = EdsLib_DataTypeDB_PackCompleteObject(CFE_SB_GetEds(), &EdsId, ImageBufferPtr->BufferPtr, DumpDataAddr,
+            8 * RegRecPtr->BinaryFileSize, RegRecPtr->EdsInfo.Size.Bytes);
+
+    ImageCrc = CFE_ES_CalculateCRC(ImageBufferPtr->BufferPtr,
+                                   RegRecPtr->BinaryFileSize,
+                                   0,
+                                   CFE_MISSION_ES_DEFAULT_CRC);
+
+    if (Status == EDSLIB_SUCCESS && RefBufferPtr != NULL)
+    {
+        /* A delta is taken against the active contents, which are identified by their CRC */
+        ActiveDataAddr = RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr;
+        ReferenceCrc = CFE_ES_CalculateCRC(ActiveDataAddr,
+                                           RegRecPtr->EdsInfo.Size.Bytes,
+                                           0,
+                                           CFE_MISSION_ES_DEFAULT_CRC);
+
+        EdsId = RegRecPtr->EdsId;
+        Status = EdsLib_DataTypeDB_PackCompleteObject(CFE_SB_GetEds(), &EdsId, RefBufferPtr->BufferPtr, ActiveDataAddr,
+                8 * RegRecPtr->BinaryFileSize, RegRecPtr->EdsInfo.Size.Bytes);
+    }
+
+    if (Status != EDSLIB_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CFE_TBL_WRITE_TBL_IMG_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Error writing Tbl image to '%s', Status=0x%08X",
+                          DumpFilename, (unsigned int)Status);
+
+        FileDescriptor = OS_ERROR;
+    }
+    else
+    {
+        /* Check to see if the dump file already exists */
+        FileDescriptor = OS_open(DumpFilename, OS_READ_ONLY, 0);
+
+        if (FileDescriptor >= 0)
+        {
+            FileExistedPrev = true;
+
+            OS_close(FileDescriptor);
+        }
+
+        /* Create a new dump file, overwriting anything that may have existed previously */
+        FileDescriptor = OS_creat(DumpFilename, OS_WRITE_ONLY);
+
+        if (FileDescriptor < OS_SUCCESS)
+        {
+            CFE_EVS_SendEvent(CFE_TBL_CREATING_DUMP_FILE_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Error creating dump file '%s', Status=0x%08X",
+                              DumpFilename, (unsigned int)FileDescriptor);
+        }
+    }
+
+    if (FileDescriptor >= OS_SUCCESS)
+    {
+        memset(&NativeHeader, 0, sizeof(NativeHeader));
+        CFE_FS_InitHeader(&NativeHeader.StdFile, "Packed Table Dump Image", CFE_FS_SubType_TBL_PACKED_IMG);
+
+        Status = CFE_FS_WriteHeader(FileDescriptor, &NativeHeader.StdFile);
+
+        if (Status == sizeof(CFE_FS_Header_t))
+        {
+            CFE_FS_BufferedWriterInit(&Writer, FileDescriptor, WriteBuffer, sizeof(WriteBuffer));
+
+            /* The Table Image Header describes the whole decoded image */
+            memset(&NativeHeader, 0, sizeof(NativeHeader));
+            strncpy(NativeHeader.TblFile.TableName, RegRecPtr->Name, sizeof(NativeHeader.TblFile.TableName)-1);
+            NativeHeader.TblFile.NumBytes = RegRecPtr->BinaryFileSize;
+
+            EdsId = EDSLIB_MAKE_ID(EDS_INDEX(CFE_TBL), CFE_TBL_File_Hdr_DATADICTIONARY);
+            EdsLib_DataTypeDB_PackCompleteObject(CFE_SB_GetEds(), &EdsId, OutputHeader, NativeHeader.Bytes,
+                    8 * sizeof(OutputHeader), sizeof(NativeHeader));
+            EdsLib_DataTypeDB_GetTypeInfo(CFE_SB_GetEds(), EdsId, &HdrInfo);
+            ExpectedSize = (HdrInfo.Size.Bits + 7) / 8;
+            CFE_FS_BufferedWrite(&Writer, OutputHeader, ExpectedSize);
+
+            memset(&NativeHeader, 0, sizeof(NativeHeader));
+            NativeHeader.PackedImg.Format = DumpFormat;
+            NativeHeader.PackedImg.BlockSize = CFE_TBL_PACKED_BLOCK_SIZE;
+            NativeHeader.PackedImg.ImageCrc = ImageCrc;
+            NativeHeader.PackedImg.ReferenceCrc = ReferenceCrc;
+
+            EdsId = EDSLIB_MAKE_ID(EDS_INDEX(CFE_TBL), CFE_TBL_PackedImg_Hdr_DATADICTIONARY);
+            EdsLib_DataTypeDB_PackCompleteObject(CFE_SB_GetEds(), &EdsId, OutputHeader, NativeHeader.Bytes,
+                    8 * sizeof(OutputHeader), sizeof(NativeHeader));
+            EdsLib_DataTypeDB_GetTypeInfo(CFE_SB_GetEds(), EdsId, &HdrInfo);
+            ExpectedSize = (HdrInfo.Size.Bits + 7) / 8;
+            CFE_FS_BufferedWrite(&Writer, OutputHeader, ExpectedSize);
+
+            if ((DumpFormat & CFE_TBL_DumpFormat_LZ) != 0)
+            {
+                memset(CFE_TBL_TaskData.PackedMatchTable, 0, sizeof(CFE_TBL_TaskData.PackedMatchTable));
+            }
+
+            for (Offset = 0; Offset < RegRecPtr->BinaryFileSize; Offset += Length)
+            {
+                Length = RegRecPtr->BinaryFileSize - Offset;
+                if (Length > CFE_TBL_PACKED_BLOCK_SIZE)
+                {
+                    Length = CFE_TBL_PACKED_BLOCK_SIZE;
+                }
+
+                CFE_FS_BufferedWrite(&Writer, Record,
+                        CFE_TBL_PackBlock(Record, ImageBufferPtr->BufferPtr, Offset, Length,
+                                (RefBufferPtr != NULL) ? RefBufferPtr->BufferPtr : NULL,
+                                ((DumpFormat & CFE_TBL_DumpFormat_LZ) != 0) ? CFE_TBL_TaskData.PackedMatchTable : NULL));
+            }
+
+            /* Write errors are sticky, so the flush reports any error from the records as well */
+            Status = CFE_FS_BufferedWriterFlush(&Writer);
+
+            if (Status == CFE_SUCCESS)
+            {
+                CFE_TBL_ReportDumpWritten(DumpFilename, RegRecPtr->Name, FileExistedPrev);
+
+                /* Increment Successful Command Counter */
+                ReturnCode = CFE_TBL_INC_CMD_CTR;
+            }
+            else
+            {
+                CFE_EVS_SendEvent(CFE_TBL_WRITE_TBL_IMG_ERR_EID,
+                                  CFE_EVS_EventType_ERROR,
+                                  "Error writing Tbl image to '%s', Status=0x%08X",
+                                  DumpFilename, (unsigned int)Status);
+            }
+        }
+        else
+        {
+            CFE_EVS_SendEvent(CFE_TBL_WRITE_CFE_HDR_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Error writing cFE File Header to '%s', Status=0x%08X",
+                              DumpFilename, (unsigned int)Status);
+        }
+
+        /* We are done outputting data to the dump file.  Close it. */
+        OS_close(FileDescriptor);
+    }
+
+    /* Free the scratch buffers */
+    ImageBufferPtr->Taken = false;
+    if (RefBufferPtr != NULL)
+    {
+        RefBufferPtr->Taken = false;
+    }
+
+    return ReturnCode;
+} /* End of CFE_TBL_DumpToPackedFile() */
+
+/*
+** Argument of the async job that validates a table in response to a Validate command
+*/
+typedef struct
+{
+    int16                     RegIndex;           /* Registry entry of the table */
+    int32                     ValIndex;           /* Validation Result Block to report in */
+    bool                      ActiveBuffer;       /* Whether the active or the inactive buffer is validated */
+    bool                      Abandoned;          /* Set by the job when the buffer was released before it started */
+    void                     *BufferPtr;          /* Table buffer to be validated */
+    uint32                    LoadGeneration;     /* Load generation of the buffer when the job was submitted */
+    uint32                    Size;               /* Size of the table buffer */
+    CFE_TBL_CallbackFuncPtr_t ValidationFuncPtr;  /* Validation function to run in the job, or NULL */
+    uint32                    CrcOfTable;         /* CRC computed by the job */
+    uint32                    ValidationTime;     /* Microseconds the job took */
+} CFE_TBL_ValidationJob_t;
+
+/*
+** The job argument is used in place from the ES queue, which only holds
+** CFE_PLATFORM_ES_ASYNC_JOB_ARG_SIZE bytes aligned for uint64 and pointers
+*/
+CompileTimeAssert(sizeof(CFE_TBL_ValidationJob_t) <= CFE_PLATFORM_ES_ASYNC_JOB_ARG_SIZE, TblValidationJobArgSizeError);
+CompileTimeAssert(__alignof__(CFE_TBL_ValidationJob_t) <= __alignof__(uint64) ||
+                  __alignof__(CFE_TBL_ValidationJob_t) <= __alignof__(void *), TblValidationJobArgAlignError);
+
+
+/*******************************************************************
+**
+** CFE_TBL_ValidationJobBuffer() -- Locate the buffer of a validation job
+**
+** Returns the table buffer selected by the Validate command if it is still
+** the one the job was given, or NULL if the table has been unregistered or
+** the buffer activated, aborted, replaced or reloaded since.  The caller must
+** hold the registry lock.
+********************************************************************/
+
+static CFE_TBL_LoadBuff_t *CFE_TBL_ValidationJobBuffer(const CFE_TBL_ValidationJob_t *Job)
+{
+    CFE_TBL_RegistryRec_t *RegRecPtr = &CFE_TBL_TaskData.Registry[Job->RegIndex];
+    CFE_TBL_LoadBuff_t    *LoadBuffPtr = NULL;
+
+    if ((RegRecPtr->OwnerAppId != CFE_TBL_NOT_OWNED) &&
+        (strncmp(RegRecPtr->Name, CFE_TBL_TaskData.ValidationResults[Job->ValIndex].TableName,
+                 CFE_TBL_MAX_FULL_NAME_LEN) == 0))
+    {
+        if (Job->ActiveBuffer)
+        {
+            LoadBuffPtr = &RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex];
+        }
+        else if (RegRecPtr->DoubleBuffered)
+        {
+            LoadBuffPtr = &RegRecPtr->Buffers[(1U-RegRecPtr->ActiveBufferIndex)];
+        }
+        else if (RegRecPtr->LoadInProgress != CFE_TBL_NO_LOAD_IN_PROGRESS)
+        {
+            LoadBuffPtr = &CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress];
+        }
+    }
+
+    if ((LoadBuffPtr != NULL) &&
+        ((LoadBuffPtr->BufferPtr != Job->BufferPtr) || (LoadBuffPtr->LoadGeneration != Job->LoadGeneration)))
+    {
+        LoadBuffPtr = NULL;
+    }
+
+    return LoadBuffPtr;
+} /* End of CFE_TBL_ValidationJobBuffer() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_ValidationJob() -- ES async job that validates a table
+**
+** Computes the CRC of the table buffer and, for tables registered with
+** CFE_TBL_OPT_ASYNC_VALIDATE, runs the validation function on it.  The
+** registry lock is not held while doing so, which lets the jobs of several
+** tables proceed at once on the ES workers.  The job is counted in the
+** registry entry meanwhile, so that cleaning up the table owner waits for
+** it before the buffers and the validation function go away.
+********************************************************************/
+
+static int32 CFE_TBL_ValidationJob(void *JobArg)
+{
+    CFE_TBL_ValidationJob_t *Job = JobArg;
+    CFE_TBL_RegistryRec_t   *RegRecPtr = &CFE_TBL_TaskData.Registry[Job->RegIndex];
+    OS_time_t                StartTime;
+    int32                    Status = CFE_SUCCESS;
+
+    /* Skip the work if the buffer was released while the job was queued */
+    CFE_TBL_LockRegistry();
+    Job->Abandoned = (CFE_TBL_ValidationJobBuffer(Job) == NULL);
+    if (!Job->Abandoned)
+    {
+        RegRecPtr->ValidationJobsRunning++;
+    }
+    CFE_TBL_UnlockRegistry();
+
+    if (!Job->Abandoned)
+    {
+        CFE_PSP_GetTime(&StartTime);
+
+        Job->CrcOfTable = CFE_ES_CalculateCRC(Job->BufferPtr, Job->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
+
+        if (Job->ValidationFuncPtr != NULL)
+        {
+            Status = (Job->ValidationFuncPtr)(Job->BufferPtr);
+        }
+
+        Job->ValidationTime = CFE_TBL_MicrosecsSince(&StartTime);
+
+        CFE_TBL_LockRegistry();
+        RegRecPtr->ValidationJobsRunning--;
+        CFE_TBL_UnlockRegistry();
+    }
+
+    return Status;
+} /* End of CFE_TBL_ValidationJob() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_ValidationDone() -- Completion function of a table validation job
+**
+** Records the outcome of the job in the Validation Result Block, in the
+** same way as when the TBL task computed the CRC itself.  When the table
+** owner is to run the validation function, the owner is only notified now,
+** once the CRC is known.
+********************************************************************/
+
+static void CFE_TBL_ValidationDone(void *JobArg, int32 Status)
+{
+    CFE_TBL_ValidationJob_t    *Job = JobArg;
+    CFE_TBL_ValidationResult_t *ResultPtr = &CFE_TBL_TaskData.ValidationResults[Job->ValIndex];
+    CFE_TBL_RegistryRec_t      *RegRecPtr = &CFE_TBL_TaskData.Registry[Job->RegIndex];
+    CFE_TBL_LoadBuff_t         *LoadBuffPtr = NULL;
+    bool                        NotifyOwner = false;
+    char                        TableName[CFE_TBL_MAX_FULL_NAME_LEN];
+
+    CFE_TBL_LockRegistry();
+
+    if (!Job->Abandoned)
+    {
+        LoadBuffPtr = CFE_TBL_ValidationJobBuffer(Job);
+    }
+
+    /* Housekeeping may free the block as soon as the result is recorded */
+    memcpy(TableName, ResultPtr->TableName, sizeof(TableName));
+
+    ResultPtr->CrcOfTable = Job->CrcOfTable;
+
+    if (LoadBuffPtr == NULL)
+    {
+        ResultPtr->Result = CFE_TBL_ERR_UNREGISTERED;
+        ResultPtr->State = CFE_TBL_VALIDATION_PERFORMED;
+    }
+    else
+    {
+        RegRecPtr->ValidationTime = Job->ValidationTime;
+
+        if (Job->ValidationFuncPtr != NULL)
+        {
+            /* Allow an inactive buffer to be activated after passing validation */
+            if ((Status == CFE_SUCCESS) && (!Job->ActiveBuffer))
+            {
+                LoadBuffPtr->Validated = true;
+            }
+
+            ResultPtr->Result = Status;
+            ResultPtr->State = CFE_TBL_VALIDATION_PERFORMED;
+        }
+        else if (RegRecPtr->ValidationFuncPtr != NULL)
+        {
+            /* Flag the request for the owner's next call to CFE_TBL_Validate */
+            if (Job->ActiveBuffer)
+            {
+                RegRecPtr->ValidateActiveIndex = Job->ValIndex;
+            }
+            else
+            {
+                RegRecPtr->ValidateInactiveIndex = Job->ValIndex;
+            }
+
+            /* Maintain statistic on number of validation requests given to applications */
+            CFE_TBL_TaskData.NumValRequests++;
+            NotifyOwner = true;
+        }
+        else
+        {
+            /* If there isn't a validation function pointer, then the process is complete  */
+            /* By setting this value, we are letting the Housekeeping process recognize it */
+            /* as data to be sent to the ground in telemetry.                              */
+            ResultPtr->State = CFE_TBL_VALIDATION_PERFORMED;
+        }
+    }
+
+    CFE_TBL_UnlockRegistry();
+
+    if (LoadBuffPtr == NULL)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ABANDONED_ERR_EID,
+                                   CFE_EVS_EventType_ERROR,
+                                   CFE_TBL_TaskData.TableTaskAppId,
+                                   "Validation of '%s' abandoned, the table buffer changed or was released",
+                                   TableName);
+    }
+    else if (Job->ValidationFuncPtr != NULL)
+    {
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_INF_EID,
+                                       CFE_EVS_EventType_INFORMATION,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "TBL validation successful for %s '%s'",
+                                       Job->ActiveBuffer ? "Active" : "Inactive", TableName);
+        }
+        else
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ERR_EID,
+                                       CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "TBL validation failed for %s '%s', Status=0x%08X",
+                                       Job->ActiveBuffer ? "Active" : "Inactive", TableName,
+                                       (unsigned int)Status);
+
+            if (Status > CFE_SUCCESS)
+            {
+                CFE_ES_WriteToSysLog("CFE_TBL:ValidationJob-Validation func return code invalid (Stat=0x%08X) for '%s'\n",
+                                     (unsigned int)Status, TableName);
+            }
+        }
+    }
+    else if (NotifyOwner)
+    {
+        /* If application requested notification by message, then do so */
+        if (CFE_TBL_SendNotificationMsg(RegRecPtr) == CFE_SUCCESS)
+        {
+            /* Notify ground that validation request has been made */
+            CFE_EVS_SendEventWithAppID(CFE_TBL_VAL_REQ_MADE_INF_EID,
+                                       CFE_EVS_EventType_DEBUG,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "Tbl Services issued validation request for '%s'",
+                                       TableName);
+        }
+    }
+    else
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_ASSUMED_VALID_INF_EID,
+                                   CFE_EVS_EventType_INFORMATION,
+                                   CFE_TBL_TaskData.TableTaskAppId,
+                                   "Tbl Services assumes '%s' is valid. No Validation Function has been registered",
+                                   TableName);
+    }
+} /* End of CFE_TBL_ValidationDone() */
+
+
 /*******************************************************************
 **
 ** CFE_TBL_ValidateCmd() -- Process Validate Table Command Message
@@ -842,17 +1363,21 @@ int32 CFE_TBL_ValidateCmd(const CFE_TBL_Validate_t *data)
     int16                        RegIndex;
     const CFE_TBL_ValidateCmd_Payload_t *CmdPtr = &data->Payload;
     CFE_TBL_RegistryRec_t       *RegRecPtr;
+    CFE_TBL_LoadBuff_t          *ValidationBuffPtr = NULL;
     void                        *ValidationDataPtr = NULL;
     char                         TableName[CFE_TBL_MAX_FULL_NAME_LEN];
-    uint32                       CrcOfTable;
     int32                        ValIndex;
+    int32                        Status;
+    CFE_TBL_ValidationJob_t      Job;
 
     /* Make sure all strings are null terminated before attempting to process them */
     CFE_SB_MessageStringGet(TableName, (char *)CmdPtr->TableName, NULL,
             CFE_TBL_MAX_FULL_NAME_LEN, sizeof(CmdPtr->TableName));
 
     /* Before doing anything, lets make sure the table that is to be dumped exists */
+    CFE_TBL_LockRegistry();
     RegIndex = CFE_TBL_FindTableInRegistry(TableName);
+    CFE_TBL_UnlockRegistry();
 
     if (RegIndex != CFE_TBL_NOT_FOUND)
     {
@@ -862,21 +1387,21 @@ int32 CFE_TBL_ValidateCmd(const CFE_TBL_Validate_t *data)
         /* Determine what data is to be validated */
         if (CmdPtr->ActiveTableFlag == CFE_TBL_BufferSelect_ACTIVE)
         {
-            ValidationDataPtr = RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr;
+            ValidationBuffPtr = &RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex];
         }
         else if (CmdPtr->ActiveTableFlag == CFE_TBL_BufferSelect_INACTIVE) /* Validating Inactive Buffer */
         {
             /* If this is a double buffered table, locating the inactive buffer is trivial */
             if (RegRecPtr->DoubleBuffered)
             {
-                ValidationDataPtr = RegRecPtr->Buffers[(1U-RegRecPtr->ActiveBufferIndex)].BufferPtr;
+                ValidationBuffPtr = &RegRecPtr->Buffers[(1U-RegRecPtr->ActiveBufferIndex)];
             }
             else
             {
                 /* For single buffered tables, the index to the inactive buffer is kept in 'LoadInProgress' */
                 if (RegRecPtr->LoadInProgress != CFE_TBL_NO_LOAD_IN_PROGRESS)
                 {
-                    ValidationDataPtr = CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr;
+                    ValidationBuffPtr = &CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress];
                 }
                 else
                 {
@@ -895,6 +1420,11 @@ int32 CFE_TBL_ValidateCmd(const CFE_TBL_Validate_t *data)
                               TableName, (unsigned int)CmdPtr->ActiveTableFlag);
         }
 
+        if (ValidationBuffPtr != NULL)
+        {
+            ValidationDataPtr = ValidationBuffPtr->BufferPtr;
+        }
+
         /* If we have located the data to be validated, then proceed with notifying the application, if */
         /* necessary, and computing the CRC value for the block of memory                               */
         if (ValidationDataPtr != NULL)
@@ -914,53 +1444,30 @@ int32 CFE_TBL_ValidateCmd(const CFE_TBL_Validate_t *data)
                 CFE_TBL_TaskData.ValidationResults[ValIndex].Result = 0;
                 memcpy(CFE_TBL_TaskData.ValidationResults[ValIndex].TableName,
                           TableName, CFE_TBL_MAX_FULL_NAME_LEN);
-
-                /* Compute the CRC on the specified table buffer */
-                CrcOfTable = CFE_ES_CalculateCRC(ValidationDataPtr,
-                                                 RegRecPtr->EdsInfo.Size.Bytes,
-                                                 0,
-                                                 CFE_MISSION_ES_DEFAULT_CRC);
-
-                CFE_TBL_TaskData.ValidationResults[ValIndex].CrcOfTable = CrcOfTable;
                 CFE_TBL_TaskData.ValidationResults[ValIndex].ActiveBuffer = (CmdPtr->ActiveTableFlag != 0);
 
-                /* If owner has a validation function, then notify the  */
-                /* table owner that there is data to be validated       */
-                if (RegRecPtr->ValidationFuncPtr != NULL)
+                /* The CRC, and the validation function when Table Services is to run it, are computed */
+                /* by an ES async job so that the validation of several tables can proceed at once     */
+                memset(&Job, 0, sizeof(Job));
+                Job.RegIndex = RegIndex;
+                Job.ValIndex = ValIndex;
+                Job.ActiveBuffer = (CmdPtr->ActiveTableFlag != 0);
+                Job.BufferPtr = ValidationDataPtr;
+                Job.LoadGeneration = ValidationBuffPtr->LoadGeneration;
+                Job.Size = RegRecPtr->EdsInfo.Size.Bytes;
+
+                if (RegRecPtr->AsyncValidation)
                 {
-                    if (CmdPtr->ActiveTableFlag)
-                    {
-                        RegRecPtr->ValidateActiveIndex = ValIndex;
-                    }
-                    else
-                    {
-                        RegRecPtr->ValidateInactiveIndex = ValIndex;
-                    }
-                    
-                    /* If application requested notification by message, then do so */
-                    if (CFE_TBL_SendNotificationMsg(RegRecPtr) == CFE_SUCCESS)
-                    {
-                        /* Notify ground that validation request has been made */
-                        CFE_EVS_SendEvent(CFE_TBL_VAL_REQ_MADE_INF_EID,
-                                          CFE_EVS_EventType_DEBUG,
-                                          "Tbl Services issued validation request for '%s'",
-                                          TableName);
-                    }
-
-                    /* Maintain statistic on number of validation requests given to applications */
-                    CFE_TBL_TaskData.NumValRequests++;
+                    Job.ValidationFuncPtr = RegRecPtr->ValidationFuncPtr;
                 }
-                else
+
+                Status = CFE_ES_SubmitAsyncJob(CFE_TBL_ValidationJob, CFE_TBL_ValidationDone,
+                                               &Job, sizeof(Job), CFE_TBL_VALIDATION_JOB_PRIORITY);
+
+                if (Status != CFE_SUCCESS)
                 {
-                    /* If there isn't a validation function pointer, then the process is complete  */
-                    /* By setting this value, we are letting the Housekeeping process recognize it */
-                    /* as data to be sent to the ground in telemetry.                              */
-                    CFE_TBL_TaskData.ValidationResults[ValIndex].State = CFE_TBL_VALIDATION_PERFORMED;
-                    
-                    CFE_EVS_SendEvent(CFE_TBL_ASSUMED_VALID_INF_EID,
-                                      CFE_EVS_EventType_INFORMATION,
-                                      "Tbl Services assumes '%s' is valid. No Validation Function has been registered",
-                                      TableName);
+                    /* The job could not be queued, so validate the table here instead */
+                    CFE_TBL_ValidationDone(&Job, CFE_TBL_ValidationJob(&Job));
                 }
 
                 /* Increment Successful Command Counter */
@@ -1008,7 +1515,9 @@ int32 CFE_TBL_ActivateCmd(const CFE_TBL_Activate_t *data)
             CFE_TBL_MAX_FULL_NAME_LEN, sizeof(CmdPtr->TableName));
 
     /* Before doing anything, lets make sure the table that is to be dumped exists */
+    CFE_TBL_LockRegistry();
     RegIndex = CFE_TBL_FindTableInRegistry(TableName);
+    CFE_TBL_UnlockRegistry();
 
     if (RegIndex != CFE_TBL_NOT_FOUND)
     {
@@ -1284,7 +1793,9 @@ int32 CFE_TBL_SendRegistryCmd(const CFE_TBL_SendRegistry_t *data)
             CFE_TBL_MAX_FULL_NAME_LEN, sizeof(CmdPtr->TableName));
 
     /* Before doing anything, lets make sure the table registry entry that is to be telemetered exists */
+    CFE_TBL_LockRegistry();
     RegIndex = CFE_TBL_FindTableInRegistry(TableName);
+    CFE_TBL_UnlockRegistry();
 
     if (RegIndex != CFE_TBL_NOT_FOUND)
     {
@@ -1336,7 +1847,9 @@ int32 CFE_TBL_DeleteCDSCmd(const CFE_TBL_DeleteCDS_t *data)
     /* Before doing anything, lets make sure the table is no longer in the registry */
     /* This would imply that the owning application has been terminated and that it */
     /* is safe to delete the associated critical table image in the CDS. */
+    CFE_TBL_LockRegistry();
     RegIndex = CFE_TBL_FindTableInRegistry(TableName);
+    CFE_TBL_UnlockRegistry();
 
     if (RegIndex == CFE_TBL_NOT_FOUND)
     {
@@ -1430,7 +1943,9 @@ int32 CFE_TBL_AbortLoadCmd(const CFE_TBL_AbortLoad_t *data)
             CFE_TBL_MAX_FULL_NAME_LEN, sizeof(CmdPtr->TableName));
 
     /* Before doing anything, lets make sure the table registry entry that is to be telemetered exists */
+    CFE_TBL_LockRegistry();
     RegIndex = CFE_TBL_FindTableInRegistry(TableName);
+    CFE_TBL_UnlockRegistry();
 
     if (RegIndex != CFE_TBL_NOT_FOUND)
     {
@@ -308,6 +308,37 @@ int32 CFE_TBL_AbortLoadCmd(const CFE_TBL_AbortLoad_t *data);
 extern CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile( const char *DumpFilename, const char *TableName,
                                          const void *DumpDataAddr, uint32 TblSizeInBytes);
 
+/*****************************************************************************/
+/**
+** \brief Output a table image to a packed table image file
+**
+** \par Description
+**        EDS packs the table image and writes it to the specified file as a
+**        #CFE_FS_SubType_TBL_PACKED_IMG file, compressing each block and/or
+**        leaving out the blocks which match the active table contents, as
+**        selected by the dump format.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Only the Table Task may call this, as it uses the match table in
+**           #CFE_TBL_TaskData_t.
+**        -# One shared load buffer, or two for a delta format, must be free.
+**
+** \param[in] DumpFilename    Character string containing the full path of the file
+**                            to which the contents of the table are to be written
+**
+** \param[in] RegRecPtr       Pointer to Table Registry record of the table being dumped
+**
+** \param[in] DumpDataAddr    Address of the table image to be written to the file
+**
+** \param[in] DumpFormat      Dump format, any #CFE_TBL_DumpFormat_Enum_t value other
+**                            than #CFE_TBL_DumpFormat_RAW
+**
+** \retval #CFE_TBL_INC_ERR_CTR  \copydoc CFE_TBL_INC_ERR_CTR
+** \retval #CFE_TBL_INC_CMD_CTR  \copydoc CFE_TBL_INC_CMD_CTR
+******************************************************************************/
+extern CFE_TBL_CmdProcRet_t CFE_TBL_DumpToPackedFile( const char *DumpFilename, CFE_TBL_RegistryRec_t *RegRecPtr,
+                                                      const void *DumpDataAddr, CFE_TBL_DumpFormat_Enum_t DumpFormat);
+
 /*****************************************************************************/
 /**
 ** \brief Aborts load by freeing associated inactive buffers and sending event message
@@ -167,6 +167,10 @@ static const UT_TaskPipeDispatchId_t  UT_TPID_CFE_ES_CMD_DUMP_CDS_REGISTRY_CC =
 {
         .DispatchOffset = offsetof(CFE_ES_Application_Component_Telecommand_DispatchTable_t, CMD.DumpCDSRegistry_indication)
 };
+static const UT_TaskPipeDispatchId_t  UT_TPID_CFE_ES_CMD_SET_APP_CPU_AFFINITY_CC =
+{
+        .DispatchOffset = offsetof(CFE_ES_Application_Component_Telecommand_DispatchTable_t, CMD.SetAppCpuAffinity_indication)
+};
 static const UT_TaskPipeDispatchId_t  UT_TPID_CFE_ES_CMD_INVALID_CC =
 {
         .DispatchOffset = -1,
@@ -270,6 +274,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(TestESMempool);
     UT_ADD_TEST(TestSysLog);
     UT_ADD_TEST(TestBackground);
+    UT_ADD_TEST(TestAsyncJob);
 }
 
 /*
@@ -295,6 +300,9 @@ void ES_ResetUnitTest(void)
     {
         CFE_ES_Global.LibTable[j].RecordUsed = false;
     }
+
+    /* Syslog writes only take the syslog lock in tests that create it */
+    CFE_ES_Global.SysLogMutex = 0;
 } /* end ES_ResetUnitTest() */
 
 void TestInit(void)
@@ -366,6 +374,19 @@ void TestStartupErrorPaths(void)
               "CFE_ES_Main",
               "Mutex create failure");
 
+    /* Perform ES main startup with a syslog mutex creation failure */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 2, OS_ERROR);
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_Panic), &PanicStatus, sizeof(PanicStatus), false);
+    CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, 1, 1,
+                CFE_PLATFORM_ES_NONVOL_STARTUP_FILE);
+    UT_Report(__FILE__, __LINE__,
+              PanicStatus == CFE_PSP_PANIC_STARTUP_SEM &&
+              UT_GetStubCount(UT_KEY(CFE_PSP_Panic)) == 1,
+              "CFE_ES_Main",
+              "SysLog mutex create failure");
+
     /* Perform ES main startup with a file open failure */
     ES_ResetUnitTest();
     UT_SetDummyFuncRtn(OS_SUCCESS);
@@ -784,6 +805,59 @@ void TestStartupErrorPaths(void)
                                         CFE_ES_AppState_LATE_INIT,
               "CFE_ES_WaitForSystemState",
               "Min System State is CFE_ES_SystemState_APPS_INIT");
+
+    /* Test startup sync wait where the full poll interval elapses */
+    ES_ResetUnitTest();
+    UT_SetForceFail(UT_KEY(OS_BinSemTimedWait), OS_SEM_TIMEOUT);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_StartupSyncWait(50) == 50 &&
+              UT_GetStubCount(UT_KEY(OS_TaskDelay)) == 0,
+              "CFE_ES_StartupSyncWait",
+              "Wait timed out");
+
+    /* Test startup sync wait where the semaphore is not usable */
+    ES_ResetUnitTest();
+    UT_SetForceFail(UT_KEY(OS_BinSemTimedWait), OS_ERR_INVALID_ID);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_StartupSyncWait(50) == 50 &&
+              UT_GetStubCount(UT_KEY(OS_TaskDelay)) == 1,
+              "CFE_ES_StartupSyncWait",
+              "Semaphore not usable, fall back to delay");
+
+    /* Test startup sync wait where the semaphore is signaled */
+    ES_ResetUnitTest();
+    Id = CFE_ES_StartupSyncWait(50);
+    UT_Report(__FILE__, __LINE__,
+              Id >= 1 && Id <= 50 &&
+              UT_GetStubCount(UT_KEY(OS_TaskDelay)) == 0,
+              "CFE_ES_StartupSyncWait",
+              "Wait signaled");
+
+    /* Test raising an app state directly to running, which must
+     * fill in the startup timeline and wake any sync waiters
+     */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.AppTable[0], 0, sizeof(CFE_ES_Global.AppTable[0]));
+    CFE_ES_Global.AppTable[0].AppState = CFE_ES_AppState_EARLY_INIT;
+    CFE_ES_RaiseAppState_Unsync(&CFE_ES_Global.AppTable[0], CFE_ES_AppState_RUNNING);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_Global.AppTable[0].AppState == CFE_ES_AppState_RUNNING &&
+              CFE_ES_Global.AppTable[0].Timeline.InitComplete.seconds ==
+                  CFE_ES_Global.AppTable[0].Timeline.Ready.seconds &&
+              UT_GetStubCount(UT_KEY(CFE_PSP_GetTime)) == 2 &&
+              UT_GetStubCount(UT_KEY(OS_BinSemFlush)) == 1,
+              "CFE_ES_RaiseAppState_Unsync",
+              "Raise from EARLY_INIT to RUNNING");
+
+    /* Test raising an app state to a lower state, which is a no-op */
+    ES_ResetUnitTest();
+    CFE_ES_Global.AppTable[0].AppState = CFE_ES_AppState_RUNNING;
+    CFE_ES_RaiseAppState_Unsync(&CFE_ES_Global.AppTable[0], CFE_ES_AppState_LATE_INIT);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_Global.AppTable[0].AppState == CFE_ES_AppState_RUNNING &&
+              UT_GetStubCount(UT_KEY(OS_BinSemFlush)) == 0,
+              "CFE_ES_RaiseAppState_Unsync",
+              "State already reached");
 }
 
 void TestApps(void)
@@ -1781,6 +1855,30 @@ void TestApps(void)
                   "CFE application; restart application on exception");
     }
 
+    /* Test parsing the startup script for a cFE application with the
+     * optional CPU affinity field
+     */
+    ES_ResetUnitTest();
+    {
+        const char *TokenList[] =
+        {
+                "CFE_APP",
+                "/cf/apps/tst_lib.bundle",
+                "TST_LIB_Init",
+                "TST_LIB",
+                "0",
+                "0",
+                "0x0",
+                "0",
+                "0x2"
+        };
+        UT_Report(__FILE__, __LINE__,
+                  CFE_ES_ParseFileEntry(TokenList, 9) == CFE_SUCCESS &&
+                  UT_GetStubCount(UT_KEY(OS_TaskSetAffinity)) == 1,
+                  "CFE_ES_ParseFileEntry",
+                  "CFE application; CPU affinity set");
+    }
+
     /* Test scanning and acting on the application table where the timer
      * expires for a waiting application
      */
@@ -1996,6 +2094,7 @@ void TestTask(void)
         CFE_ES_SendMemPoolStats_t TlmPoolStatsCmd;
         CFE_ES_DumpCDSRegistry_t DumpCDSRegCmd;
         CFE_ES_QueryAllTasks_t   QueryAllTasksCmd;
+        CFE_ES_SetAppCpuAffinity_t SetAppCpuAffinityCmd;
     } CmdBuf;
     Pool_t                      UT_TestPool;
 
@@ -2346,9 +2445,11 @@ void TestTask(void)
     memset(&CmdBuf, 0, sizeof(CmdBuf));
     CFE_ES_Global.AppTable[Id].Type = CFE_ES_AppType_EXTERNAL;
     CFE_ES_Global.AppTable[Id].AppState = CFE_ES_AppState_RUNNING;
+    CFE_ES_NameIndexRemove(&CFE_ES_AppNameIndex, Id);
     strncpy((char *) CFE_ES_Global.AppTable[Id].StartParams.Name, "CFE_ES", 
         sizeof(CFE_ES_Global.AppTable[Id].StartParams.Name));
     CFE_ES_Global.AppTable[Id].StartParams.Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_ES_AppNameIndex, Id);
     strncpy((char *) CmdBuf.StopAppCmd.Payload.Application, "CFE_ES",
             sizeof(CmdBuf.StopAppCmd.Payload.Application));
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CFE_ES_StopApp_t),
@@ -2392,9 +2493,11 @@ void TestTask(void)
             sizeof(CmdBuf.RestartAppCmd.Payload.Application));
     CFE_ES_Global.AppTable[Id].Type = CFE_ES_AppType_EXTERNAL;
     CFE_ES_Global.AppTable[Id].AppState = CFE_ES_AppState_RUNNING;
-    strncpy((char *) CFE_ES_Global.AppTable[0].StartParams.Name,
+    CFE_ES_NameIndexRemove(&CFE_ES_AppNameIndex, Id);
+    strncpy((char *) CFE_ES_Global.AppTable[Id].StartParams.Name,
             "CFE_ES", OS_MAX_API_NAME);
     CFE_ES_Global.AppTable[Id].StartParams.Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_ES_AppNameIndex, Id);
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CFE_ES_RestartApp_t),
             UT_TPID_CFE_ES_CMD_RESTART_APP_CC);
     UT_Report(__FILE__, __LINE__,
@@ -2423,9 +2526,11 @@ void TestTask(void)
         sizeof(CmdBuf.RestartAppCmd.Payload.Application));
     CFE_ES_Global.AppTable[Id].Type = CFE_ES_AppType_CORE;
     CFE_ES_Global.AppTable[Id].AppState = CFE_ES_AppState_WAITING;
+    CFE_ES_NameIndexRemove(&CFE_ES_AppNameIndex, Id);
     strncpy((char *) CFE_ES_Global.AppTable[Id].StartParams.Name,
             "CFE_ES", OS_MAX_API_NAME);
     CFE_ES_Global.AppTable[Id].StartParams.Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_ES_AppNameIndex, Id);
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CFE_ES_RestartApp_t),
             UT_TPID_CFE_ES_CMD_RESTART_APP_CC);
     UT_Report(__FILE__, __LINE__,
@@ -2505,9 +2610,11 @@ void TestTask(void)
     OS_TaskCreate(&TestObjId, "UT", NULL, NULL, 0, 0, 0);
     Id = ES_UT_OSALID_TO_ARRAYIDX(TestObjId);
     CFE_ES_Global.AppTable[Id].AppState = CFE_ES_AppState_RUNNING;
+    CFE_ES_NameIndexRemove(&CFE_ES_AppNameIndex, Id);
     strncpy((char *) CFE_ES_Global.AppTable[Id].StartParams.Name, "CFE_ES",
             OS_MAX_API_NAME);
     CFE_ES_Global.AppTable[Id].StartParams.Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_ES_AppNameIndex, Id);
     strncpy((char *) CmdBuf.QueryOneCmd.Payload.Application, "CFE_ES",
             sizeof(CmdBuf.QueryOneCmd.Payload.Application));
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_SendMsg), 1, -1);
@@ -2650,6 +2757,58 @@ void TestTask(void)
               "CFE_ES_QueryAllTasksCmd",
               "Task information file write fail; OS create");
 
+    /* Test successfully setting the CPU affinity of an app */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    OS_TaskCreate(&TestObjId, "UT", NULL, NULL, 0, 0, 0);
+    Id = ES_UT_OSALID_TO_ARRAYIDX(TestObjId);
+    CFE_ES_Global.AppTable[Id].Type = CFE_ES_AppType_EXTERNAL;
+    CFE_ES_Global.AppTable[Id].AppState = CFE_ES_AppState_RUNNING;
+    CFE_ES_NameIndexRemove(&CFE_ES_AppNameIndex, Id);
+    strncpy((char *) CFE_ES_Global.AppTable[Id].StartParams.Name,
+            "CFE_ES", OS_MAX_API_NAME);
+    CFE_ES_Global.AppTable[Id].StartParams.Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_ES_AppNameIndex, Id);
+    CFE_ES_Global.TaskTable[Id].RecordUsed = true;
+    CFE_ES_Global.TaskTable[Id].AppId = Id;
+    CFE_ES_Global.TaskTable[Id].TaskId = TestObjId;
+    strncpy((char *) CmdBuf.SetAppCpuAffinityCmd.Payload.Application, "CFE_ES",
+            sizeof(CmdBuf.SetAppCpuAffinityCmd.Payload.Application));
+    CmdBuf.SetAppCpuAffinityCmd.Payload.CpuMask = 0x3;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CFE_ES_SetAppCpuAffinity_t),
+            UT_TPID_CFE_ES_CMD_SET_APP_CPU_AFFINITY_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_SET_AFFINITY_INF_EID) &&
+              UT_GetStubCount(UT_KEY(OS_TaskSetAffinity)) == 1 &&
+              CFE_ES_Global.AppTable[Id].StartParams.CpuAffinityMask == 0x3,
+              "CFE_ES_SetAppCpuAffinityCmd",
+              "Set application CPU affinity; successful");
+
+    /* Test setting the CPU affinity when the OS does not support it */
+    UT_ClearEventHistory();
+    UT_SetForceFail(UT_KEY(OS_TaskSetAffinity), OS_ERR_NOT_IMPLEMENTED);
+    CmdBuf.SetAppCpuAffinityCmd.Payload.CpuMask = 0x1;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CFE_ES_SetAppCpuAffinity_t),
+            UT_TPID_CFE_ES_CMD_SET_APP_CPU_AFFINITY_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_SET_AFFINITY_ERR_EID) &&
+              CFE_ES_Global.AppTable[Id].StartParams.CpuAffinityMask == 0x3,
+              "CFE_ES_SetAppCpuAffinityCmd",
+              "Set application CPU affinity; not implemented");
+
+    /* Test setting the CPU affinity with a bad app name */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    strncpy((char *) CmdBuf.SetAppCpuAffinityCmd.Payload.Application, "BAD_APP_NAME",
+            sizeof(CmdBuf.SetAppCpuAffinityCmd.Payload.Application));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CFE_ES_SetAppCpuAffinity_t),
+            UT_TPID_CFE_ES_CMD_SET_APP_CPU_AFFINITY_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_SET_AFFINITY_ERR_EID) &&
+              UT_GetStubCount(UT_KEY(OS_TaskSetAffinity)) == 0,
+              "CFE_ES_SetAppCpuAffinityCmd",
+              "Set application CPU affinity; bad name");
+
     /* Test successful clearing of the system log */
     ES_ResetUnitTest();
     memset(&CmdBuf, 0, sizeof(CmdBuf));
@@ -2941,10 +3100,12 @@ void TestTask(void)
     strncpy(CmdBuf.DeleteCDSCmd.Payload.CdsName,
             "CFE_ES.CDS_NAME",
             sizeof(CmdBuf.DeleteCDSCmd.Payload.CdsName));
+    CFE_ES_NameIndexRemove(&CFE_ES_CDSNameIndex, 0);
     strncpy(CFE_ES_Global.CDSVars.Registry[0].Name,
             "CFE_ES.CDS_NAME",
             sizeof(CFE_ES_Global.CDSVars.Registry[0].Name));
     CFE_ES_Global.CDSVars.Registry[0].Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_ES_CDSNameIndex, 0);
     CFE_ES_Global.CDSVars.Registry[0].Taken = true;
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CFE_ES_DeleteCDS_t),
             UT_TPID_CFE_ES_CMD_DELETE_CDS_CC);
@@ -2985,15 +3146,19 @@ void TestTask(void)
 
     /* Test deletion of a specified CDS with the owning app being active */
     ES_ResetUnitTest();
+    CFE_ES_NameIndexRemove(&CFE_ES_CDSNameIndex, 0);
     strncpy(CFE_ES_Global.CDSVars.Registry[0].Name,
             "CFE_ES.CDS_NAME",
             sizeof(CFE_ES_Global.CDSVars.Registry[0].Name));
     CFE_ES_Global.CDSVars.Registry[0].Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_ES_CDSNameIndex, 0);
     CFE_ES_Global.CDSVars.Registry[0].MemHandle =
         sizeof(CFE_ES_Global.CDSVars.ValidityField);
+    CFE_ES_NameIndexClear(&CFE_ES_AppNameIndex); /* drop names left by earlier tests */
     strncpy((char *) CFE_ES_Global.AppTable[0].StartParams.Name, "CFE_ES",
             OS_MAX_API_NAME);
     CFE_ES_Global.AppTable[0].StartParams.Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_ES_AppNameIndex, 0);
     CFE_ES_Global.CDSVars.Registry[0].Table = false;
     CFE_ES_Global.CDSVars.Registry[0].Taken = true;
     CFE_ES_Global.AppTable[0].AppState = CFE_ES_AppState_RUNNING;
@@ -3008,9 +3173,11 @@ void TestTask(void)
     ES_ResetUnitTest();
     CFE_ES_Global.CDSVars.Registry[0].MemHandle =
         sizeof(CFE_ES_Global.CDSVars.ValidityField);
+    CFE_ES_NameIndexRemove(&CFE_ES_AppNameIndex, 0);
     strncpy((char *) CFE_ES_Global.AppTable[0].StartParams.Name, "CFE_BAD",
             OS_MAX_API_NAME);
     CFE_ES_Global.AppTable[0].StartParams.Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_ES_AppNameIndex, 0);
     CFE_ES_Global.AppTable[0].AppState = CFE_ES_AppState_UNDEFINED;
     CFE_ES_Global.CDSVars.Registry[0].Taken = false;
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CFE_ES_DeleteCDS_t),
@@ -3023,9 +3190,11 @@ void TestTask(void)
     /* Test successful dump of CDS to file using the default dump file name */
     ES_ResetUnitTest();
     memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CFE_ES_NameIndexRemove(&CFE_ES_AppNameIndex, 0);
     strncpy((char *) CFE_ES_Global.AppTable[0].StartParams.Name, "CFE_ES",
             OS_MAX_API_NAME);
     CFE_ES_Global.AppTable[0].StartParams.Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_ES_AppNameIndex, 0);
     CFE_ES_Global.AppTable[0].AppState = CFE_ES_AppState_RUNNING;
     CFE_ES_Global.CDSVars.Registry[0].Taken = true;
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CFE_ES_DumpCDSRegistry_t),
@@ -3210,9 +3379,11 @@ void TestTask(void)
     /* Test successful dump of CDS to file using a specified dump file name */
     ES_ResetUnitTest();
     memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CFE_ES_NameIndexRemove(&CFE_ES_AppNameIndex, 0);
     strncpy((char *) CFE_ES_Global.AppTable[0].StartParams.Name, "CFE_ES",
             OS_MAX_API_NAME);
     CFE_ES_Global.AppTable[0].StartParams.Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_ES_AppNameIndex, 0);
     CFE_ES_Global.AppTable[0].AppState = CFE_ES_AppState_RUNNING;
     strncpy(CmdBuf.DumpCDSRegCmd.Payload.DumpFilename, "DumpFile",
             sizeof(CmdBuf.DumpCDSRegCmd.Payload.DumpFilename));
@@ -3713,6 +3884,7 @@ void TestAPI(void)
     int i;
     int32  Return;
     uint8  Data[12];
+    uint8  CRCData[12];
     uint32 ResetType;
     uint32 *ResetTypePtr;
     uint32 AppId;
@@ -4004,6 +4176,62 @@ void TestAPI(void)
               "CFE_ES_GetAppID",
               "Get application ID by name successful");
 
+    /* Test getting the app ID of a registered task without taking the lock */
+    ES_ResetUnitTest();
+    TestObjId = OS_TaskGetId();
+    Id = ES_UT_OSALID_TO_ARRAYIDX(TestObjId);
+    CFE_ES_Global.TaskTable[Id].RecordUsed = true;
+    CFE_ES_Global.TaskTable[Id].TaskId = TestObjId;
+    CFE_ES_Global.TaskTable[Id].AppId = 3;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetAppID(&AppId) == CFE_SUCCESS && AppId == 3 &&
+              UT_GetStubCount(UT_KEY(OS_MutSemTake)) == 0,
+              "CFE_ES_GetAppID",
+              "Get application ID; lock-free fast path");
+
+    /* Test that a stale task record (slot reused) falls back to the locked lookup */
+    ES_ResetUnitTest();
+    CFE_ES_Global.TaskTable[Id].RecordUsed = true;
+    CFE_ES_Global.TaskTable[Id].TaskId = TestObjId + 0x10000;
+    CFE_ES_Global.TaskTable[Id].AppId = 3;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetAppID(&AppId) == CFE_SUCCESS && AppId == 3 &&
+              UT_GetStubCount(UT_KEY(OS_MutSemTake)) == 1,
+              "CFE_ES_GetAppID",
+              "Get application ID; task ID mismatch uses locked lookup");
+
+    /* Test getting the app ID of the calling main task */
+    ES_ResetUnitTest();
+    AppId = 0;
+    CFE_ES_Global.TaskTable[Id].RecordUsed = true;
+    CFE_ES_Global.TaskTable[Id].TaskId = TestObjId;
+    CFE_ES_Global.TaskTable[Id].AppId = 3;
+    CFE_ES_Global.AppTable[3].TaskInfo.MainTaskId = TestObjId;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetMainTaskAppID(&AppId) == CFE_SUCCESS && AppId == 3 &&
+              UT_GetStubCount(UT_KEY(OS_MutSemTake)) == 0,
+              "CFE_ES_GetMainTaskAppID",
+              "Get main task application ID successful");
+
+    /* Test that a child task has no main task app ID */
+    ES_ResetUnitTest();
+    AppId = 0;
+    CFE_ES_Global.TaskTable[Id].RecordUsed = true;
+    CFE_ES_Global.TaskTable[Id].TaskId = TestObjId;
+    CFE_ES_Global.TaskTable[Id].AppId = 3;
+    CFE_ES_Global.AppTable[3].TaskInfo.MainTaskId = TestObjId + 0x10000;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetMainTaskAppID(&AppId) == CFE_ES_ERR_APPID && AppId == 0,
+              "CFE_ES_GetMainTaskAppID",
+              "Get main task application ID; caller is a child task");
+
+    /* Test that an unregistered task has no main task app ID */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetMainTaskAppID(&AppId) == CFE_ES_ERR_APPID,
+              "CFE_ES_GetMainTaskAppID",
+              "Get main task application ID; task not registered");
+
     /* Test getting the app name with a bad app ID */
     CFE_ES_Global.AppTable[4].AppState = CFE_ES_AppState_UNDEFINED;
     ES_ResetUnitTest();
@@ -4194,6 +4422,29 @@ void TestAPI(void)
               Return == CFE_SUCCESS, "CFE_ES_CreateChildTask",
               "Create child task successful");
 
+    /* Test creating a child task that inherits the app's CPU affinity */
+    ES_ResetUnitTest();
+    OS_TaskCreate(&TestObjId, "UT", NULL, NULL, 0, 0, 0);
+    Id = ES_UT_OSALID_TO_ARRAYIDX(TestObjId);
+    CFE_ES_Global.TaskTable[Id].RecordUsed = true;
+    CFE_ES_Global.AppTable[Id].TaskInfo.MainTaskId = TestObjId;
+    CFE_ES_Global.AppTable[Id].AppState = CFE_ES_AppState_RUNNING;
+    CFE_ES_Global.AppTable[Id].StartParams.CpuAffinityMask = 0x4;
+    CFE_ES_Global.TaskTable[Id].AppId = Id;
+    UT_SetForceFail(UT_KEY(OS_TaskSetAffinity), OS_ERROR);
+    Return = CFE_ES_CreateChildTask(&TaskId,
+                                    "TaskName",
+                                    TestAPI,
+                                    StackBuf,
+                                    sizeof(StackBuf),
+                                    400,
+                                    0);
+    UT_Report(__FILE__, __LINE__,
+              Return == CFE_SUCCESS &&
+              UT_GetStubCount(UT_KEY(OS_TaskSetAffinity)) == 1,
+              "CFE_ES_CreateChildTask",
+              "Create child task with CPU affinity; affinity failure not fatal");
+
     /* Test deleting a child task with an invalid task ID */
     ES_ResetUnitTest();
     OS_TaskCreate(&TestObjId, "UT", NULL, NULL, 0, 0, 0);
@@ -4320,7 +4571,7 @@ void TestAPI(void)
     CFE_ES_ResetDataPtr->SystemLogEndIdx = CFE_ES_ResetDataPtr->SystemLogWriteIdx;
     CFE_ES_ResetDataPtr->SystemLogMode = CFE_ES_LogMode_DISCARD;
     UT_Report(__FILE__, __LINE__,
-              CFE_ES_SysLogWrite_Unsync("SysLogText This message should be truncated") == CFE_ES_ERR_SYS_LOG_TRUNCATED,
+              CFE_ES_SysLogWrite("SysLogText This message should be truncated") == CFE_ES_ERR_SYS_LOG_TRUNCATED,
               "CFE_ES_SysLogWrite_Internal",
               "Add message to log that must be truncated");
 
@@ -4351,6 +4602,51 @@ void TestAPI(void)
      * which has no failure path.
      */
 
+    /* Test recalculating a CRC-16 after a range of memory changes, with
+     * the range at the start, middle and end of the block
+     */
+    ES_ResetUnitTest();
+    for (i = 0; i < (int)sizeof(Data); i++)
+    {
+        Data[i] = (uint8)(i * 37 + 11);
+    }
+    TempSize = CFE_ES_CalculateCRC(Data, sizeof(Data), 0, CFE_MISSION_ES_CRC_16);
+    memcpy(CRCData, &Data[4], 5);
+    memset(&Data[4], 0xC3, 5);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_RecalculateCRC(CRCData, &Data[4], 5, sizeof(Data) - 9, TempSize,
+                                    CFE_MISSION_ES_CRC_16) ==
+                  CFE_ES_CalculateCRC(Data, sizeof(Data), 0, CFE_MISSION_ES_CRC_16),
+              "CFE_ES_RecalculateCRC",
+              "CRC-16 algorithm - range in middle of block");
+
+    TempSize = CFE_ES_CalculateCRC(Data, sizeof(Data), 0, CFE_MISSION_ES_CRC_16);
+    memcpy(CRCData, Data, 3);
+    memset(Data, 0x7E, 3);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_RecalculateCRC(CRCData, Data, 3, sizeof(Data) - 3, TempSize,
+                                    CFE_MISSION_ES_CRC_16) ==
+                  CFE_ES_CalculateCRC(Data, sizeof(Data), 0, CFE_MISSION_ES_CRC_16),
+              "CFE_ES_RecalculateCRC",
+              "CRC-16 algorithm - range at start of block");
+
+    TempSize = CFE_ES_CalculateCRC(Data, sizeof(Data), 0, CFE_MISSION_ES_CRC_16);
+    memcpy(CRCData, &Data[10], 2);
+    memset(&Data[10], 0x01, 2);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_RecalculateCRC(CRCData, &Data[10], 2, 0, TempSize,
+                                    CFE_MISSION_ES_CRC_16) ==
+                  CFE_ES_CalculateCRC(Data, sizeof(Data), 0, CFE_MISSION_ES_CRC_16),
+              "CFE_ES_RecalculateCRC",
+              "CRC-16 algorithm - range at end of block");
+
+    /* Test recalculating a CRC with an algorithm that is not implemented */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_RecalculateCRC(CRCData, Data, 2, 0, 345353, CFE_MISSION_ES_CRC_32) == 0,
+              "CFE_ES_RecalculateCRC",
+              "*Not implemented* CRC-32 algorithm");
+
     /* Test calculating a CRC on a range of memory using CRC type 32
      * NOTE: This capability is not currently implemented in cFE
      */
@@ -4535,6 +4831,35 @@ void TestAPI(void)
               "CFE_ES_RestoreFromCDS",
               "Restore from CDS successful");
 
+    /* Test copying a range to a CDS; the CDS CRC must still match the
+     * whole block when it is restored
+     */
+    ES_ResetUnitTest();
+    TempSize = 0x11223344;
+    CFE_ES_CopyToCDS(CDSHandle, &TempSize);
+    ((uint8 *)&TempSize)[1] = 0xA5;
+    ((uint8 *)&TempSize)[2] = 0x5A;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CopyToCDSRange(CDSHandle, &TempSize, 1, 2) == CFE_SUCCESS,
+              "CFE_ES_CopyToCDSRange",
+              "Copy range to CDS successful");
+    Data[0] = ((uint8 *)&TempSize)[1];
+    Data[1] = ((uint8 *)&TempSize)[2];
+    TempSize = 0;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_RestoreFromCDS(&TempSize, CDSHandle) == CFE_SUCCESS &&
+              ((uint8 *)&TempSize)[1] == Data[0] &&
+              ((uint8 *)&TempSize)[2] == Data[1],
+              "CFE_ES_RestoreFromCDS",
+              "Restore from CDS after range copy successful");
+
+    /* Test copying a range that does not fit in the CDS */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CopyToCDSRange(CDSHandle, &TempSize, 3, 2) == CFE_ES_CDS_INVALID_SIZE,
+              "CFE_ES_CopyToCDSRange",
+              "Range exceeds CDS block");
+
     /* Test shared mutex take with a take error */
     ES_ResetUnitTest();
     OS_TaskCreate(&TestObjId, "UT", NULL, NULL, 0, 0, 0);
@@ -4564,9 +4889,11 @@ void TestAPI(void)
     /* Test successfully registering a generic counter */
     ES_ResetUnitTest();
     UT_Report(__FILE__, __LINE__,
-              CFE_ES_RegisterGenCounter(&CounterId, "Counter1") == CFE_SUCCESS,
+              CFE_ES_RegisterGenCounter(&CounterId, "Counter1") == CFE_SUCCESS &&
+              UT_GetStubCount(UT_KEY(OS_MutSemTake)) == 1 &&
+              UT_GetStubCount(UT_KEY(OS_MutSemGive)) == 1,
               "CFE_ES_RegisterGenCounter",
-              "Register counter successful");
+              "Register counter successful, shared data locked once");
 
     /* Test registering a generic counter that is already registered */
     ES_ResetUnitTest();
@@ -5070,9 +5397,11 @@ void TestCDS()
     CFE_ES_Global.CDSVars.Registry[0].Taken = true;
     CFE_ES_Global.CDSVars.Registry[0].Table = true;
     CFE_ES_Global.CDSVars.Registry[0].MemHandle = 200;
+    CFE_ES_NameIndexRemove(&CFE_ES_CDSNameIndex, 0);
     strncpy(CFE_ES_Global.CDSVars.Registry[0].Name,
             "NO_APP.CDS_NAME", OS_MAX_API_NAME);
     CFE_ES_Global.CDSVars.Registry[0].Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_ES_CDSNameIndex, 0);
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 2, OS_ERROR);
     UT_Report(__FILE__, __LINE__,
               CFE_ES_DeleteCDS("NO_APP.CDS_NAME", true) == -1,
@@ -5086,12 +5415,16 @@ void TestCDS()
     CFE_ES_Global.CDSVars.Registry[0].Taken = true;
     CFE_ES_Global.CDSVars.Registry[0].Table = true;
     CFE_ES_Global.CDSVars.Registry[0].MemHandle = 200;
+    CFE_ES_NameIndexRemove(&CFE_ES_CDSNameIndex, 0);
     strncpy(CFE_ES_Global.CDSVars.Registry[0].Name,
             "CFE_ES.CDS_NAME", OS_MAX_API_NAME);
     CFE_ES_Global.CDSVars.Registry[0].Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_ES_CDSNameIndex, 0);
+    CFE_ES_NameIndexClear(&CFE_ES_AppNameIndex); /* drop names left by earlier tests */
     strncpy((char *) CFE_ES_Global.AppTable[0].StartParams.Name, "CFE_ES",
             OS_MAX_API_NAME);
     CFE_ES_Global.AppTable[0].StartParams.Name[OS_MAX_API_NAME - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_ES_AppNameIndex, 0);
     CFE_ES_Global.AppTable[0].AppState = CFE_ES_AppState_RUNNING;
     UT_Report(__FILE__, __LINE__,
               CFE_ES_DeleteCDS("CFE_ES.CDS_NAME", true) ==
@@ -5145,8 +5478,10 @@ void TestCDS()
     ES_ResetUnitTest();
     CFE_ES_Global.CDSVars.Registry[0].Taken = true;
     CFE_ES_Global.CDSVars.Registry[0].Table = true;
+    CFE_ES_NameIndexRemove(&CFE_ES_CDSNameIndex, 0);
     memset(CFE_ES_Global.CDSVars.Registry[0].Name, 'a', CFE_ES_CDS_MAX_FULL_NAME_LEN - 1);
     CFE_ES_Global.CDSVars.Registry[0].Name[CFE_ES_CDS_MAX_FULL_NAME_LEN - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_ES_CDSNameIndex, 0);
     UT_Report(__FILE__, __LINE__,
               CFE_ES_DeleteCDS(CFE_ES_Global.CDSVars.Registry[0].Name,
                                true) == CFE_ES_ERR_MEM_HANDLE,
@@ -6199,6 +6534,28 @@ void TestSysLog(void)
               true,
               "CFE_ES_WriteToSysLog",
               "Truncate message");
+
+    /* Test that writing to the syslog takes only the syslog lock */
+    ES_ResetUnitTest();
+    OS_MutSemCreate(&CFE_ES_Global.SysLogMutex, "UT", 0);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_WriteToSysLog("SysLogText") == CFE_SUCCESS &&
+              UT_GetStubCount(UT_KEY(OS_MutSemTake)) == 1 &&
+              UT_GetStubCount(UT_KEY(OS_MutSemGive)) == 1,
+              "CFE_ES_WriteToSysLog",
+              "Syslog lock taken and released");
+
+    /* Test syslog lock take and give failures; the message is still logged */
+    ES_ResetUnitTest();
+    OS_MutSemCreate(&CFE_ES_Global.SysLogMutex, "UT", 0);
+    UT_SetForceFail(UT_KEY(OS_MutSemTake), OS_ERROR);
+    UT_SetForceFail(UT_KEY(OS_MutSemGive), OS_ERROR);
+    CFE_ES_SysLogClear_Unsync();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_SysLogWrite("SysLogText") == CFE_SUCCESS &&
+              CFE_ES_ResetDataPtr->SystemLogEntryNum == 1,
+              "CFE_ES_SysLogWrite",
+              "Syslog lock take/give failure");
     
 }
 
@@ -6252,3 +6609,143 @@ void TestBackground(void)
             "CFE_ES_BackgroundTask - Nominal, CFE_ES_Global.BackgroundTask.NumJobsRunning (%u) == 1",
             (unsigned int)CFE_ES_Global.BackgroundTask.NumJobsRunning);
 }
+
+/*
+ * Async job functions for TestAsyncJob - these record the order in
+ * which the jobs ran using the first character of the job argument.
+ */
+static char  UT_AsyncJobOrder[8];
+static uint32 UT_AsyncJobCount;
+static int32 UT_AsyncJobDoneStatus;
+
+static int32 ES_UT_AsyncJob(void *JobArg)
+{
+    if (UT_AsyncJobCount < sizeof(UT_AsyncJobOrder))
+    {
+        UT_AsyncJobOrder[UT_AsyncJobCount] = *((char *)JobArg);
+    }
+    ++UT_AsyncJobCount;
+    return UT_AsyncJobCount;
+}
+
+static void ES_UT_AsyncJobDone(void *JobArg, int32 Status)
+{
+    UT_AsyncJobDoneStatus = Status;
+}
+
+void TestAsyncJob(void)
+{
+    char Arg[CFE_PLATFORM_ES_ASYNC_JOB_ARG_SIZE + 1];
+    int32 status;
+    uint32 i;
+
+    memset(Arg, 0, sizeof(Arg));
+
+    /* Test submitting jobs with invalid arguments */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.AsyncJob, 0, sizeof(CFE_ES_Global.AsyncJob));
+    status = CFE_ES_SubmitAsyncJob(NULL, NULL, Arg, 1, 0);
+    UtAssert_True(status == CFE_ES_BAD_ARGUMENT, "CFE_ES_SubmitAsyncJob - NULL job function (%08x)", (unsigned int)status);
+    status = CFE_ES_SubmitAsyncJob(ES_UT_AsyncJob, NULL, Arg, sizeof(Arg), 0);
+    UtAssert_True(status == CFE_ES_BAD_ARGUMENT, "CFE_ES_SubmitAsyncJob - argument too large (%08x)", (unsigned int)status);
+    status = CFE_ES_SubmitAsyncJob(ES_UT_AsyncJob, NULL, NULL, 1, 0);
+    UtAssert_True(status == CFE_ES_BAD_ARGUMENT, "CFE_ES_SubmitAsyncJob - NULL argument (%08x)", (unsigned int)status);
+    UtAssert_True(CFE_ES_Global.AsyncJob.QueueDepth == 0, "CFE_ES_SubmitAsyncJob - nothing queued");
+
+    /* Test that jobs run in priority order, and submission order within a priority */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.AsyncJob, 0, sizeof(CFE_ES_Global.AsyncJob));
+    memset(UT_AsyncJobOrder, 0, sizeof(UT_AsyncJobOrder));
+    UT_AsyncJobCount = 0;
+    UT_AsyncJobDoneStatus = 0;
+    Arg[0] = 'A';
+    CFE_ES_SubmitAsyncJob(ES_UT_AsyncJob, ES_UT_AsyncJobDone, Arg, 1, 5);
+    Arg[0] = 'B';
+    CFE_ES_SubmitAsyncJob(ES_UT_AsyncJob, ES_UT_AsyncJobDone, Arg, 1, 1);
+    Arg[0] = 'C';
+    status = CFE_ES_SubmitAsyncJob(ES_UT_AsyncJob, ES_UT_AsyncJobDone, Arg, 1, 5);
+    UtAssert_True(status == CFE_SUCCESS, "CFE_ES_SubmitAsyncJob - Nominal (%08x)", (unsigned int)status);
+    UtAssert_True(CFE_ES_Global.AsyncJob.QueueDepth == 3, "CFE_ES_SubmitAsyncJob - QueueDepth (%u) == 3",
+            (unsigned int)CFE_ES_Global.AsyncJob.QueueDepth);
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_CountSemGive)) == 3, "CFE_ES_SubmitAsyncJob - OS_CountSemGive called");
+    UtAssert_True(CFE_ES_AsyncJobRunNext(), "CFE_ES_AsyncJobRunNext - first job");
+    UtAssert_True(CFE_ES_AsyncJobRunNext(), "CFE_ES_AsyncJobRunNext - second job");
+    UtAssert_True(CFE_ES_AsyncJobRunNext(), "CFE_ES_AsyncJobRunNext - third job");
+    UtAssert_True(!CFE_ES_AsyncJobRunNext(), "CFE_ES_AsyncJobRunNext - queue empty");
+    UtAssert_True(memcmp(UT_AsyncJobOrder, "BAC", 3) == 0, "CFE_ES_AsyncJobRunNext - run order (%.3s) == BAC",
+            UT_AsyncJobOrder);
+    UtAssert_True(UT_AsyncJobDoneStatus == 3, "CFE_ES_AsyncJobRunNext - completion status (%d) == 3",
+            (int)UT_AsyncJobDoneStatus);
+    UtAssert_True(CFE_ES_Global.AsyncJob.QueueDepth == 0 && CFE_ES_Global.AsyncJob.JobsCompleted == 3,
+            "CFE_ES_AsyncJobRunNext - QueueDepth (%u) == 0, JobsCompleted (%u) == 3",
+            (unsigned int)CFE_ES_Global.AsyncJob.QueueDepth, (unsigned int)CFE_ES_Global.AsyncJob.JobsCompleted);
+
+    /* Test submitting a job when the queue is full */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.AsyncJob, 0, sizeof(CFE_ES_Global.AsyncJob));
+    for (i = 0; i < CFE_PLATFORM_ES_ASYNC_JOB_QUEUE_DEPTH; ++i)
+    {
+        CFE_ES_SubmitAsyncJob(ES_UT_AsyncJob, NULL, NULL, 0, 0);
+    }
+    status = CFE_ES_SubmitAsyncJob(ES_UT_AsyncJob, NULL, NULL, 0, 0);
+    UtAssert_True(status == CFE_ES_ASYNC_JOB_QUEUE_FULL, "CFE_ES_SubmitAsyncJob - queue full (%08x)", (unsigned int)status);
+    UtAssert_True(CFE_ES_Global.AsyncJob.JobsRejected == 1, "CFE_ES_SubmitAsyncJob - JobsRejected (%u) == 1",
+            (unsigned int)CFE_ES_Global.AsyncJob.JobsRejected);
+
+    /* Test cancelling the pending jobs of an app, leaving other apps' jobs */
+    CFE_ES_Global.AsyncJob.Queue[0].AppId = 1;
+    for (i = 1; i < CFE_PLATFORM_ES_ASYNC_JOB_QUEUE_DEPTH; ++i)
+    {
+        CFE_ES_Global.AsyncJob.Queue[i].AppId = 2;
+    }
+    CFE_ES_AsyncJobCancelApp_Unsync(2);
+    UtAssert_True(CFE_ES_Global.AsyncJob.QueueDepth == 1, "CFE_ES_AsyncJobCancelApp_Unsync - QueueDepth (%u) == 1",
+            (unsigned int)CFE_ES_Global.AsyncJob.QueueDepth);
+    UtAssert_True(CFE_ES_AsyncJobRunNext() && !CFE_ES_AsyncJobRunNext(), "CFE_ES_AsyncJobCancelApp_Unsync - one job left");
+
+    /* Test waiting for the running jobs of an app, where one never completes */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.AsyncJob, 0, sizeof(CFE_ES_Global.AsyncJob));
+    CFE_ES_Global.AsyncJob.Queue[1].State = CFE_ES_ASYNC_JOB_RUNNING;
+    CFE_ES_Global.AsyncJob.Queue[1].AppId = 2;
+    UtAssert_True(CFE_ES_AsyncJobWaitApp(1) && UT_GetStubCount(UT_KEY(OS_TaskDelay)) == 0,
+            "CFE_ES_AsyncJobWaitApp - no job of the app running");
+    UtAssert_True(!CFE_ES_AsyncJobWaitApp(2) && UT_GetStubCount(UT_KEY(OS_TaskDelay)) > 0,
+            "CFE_ES_AsyncJobWaitApp - job of the app still running");
+
+    /* Test async job init where the semaphore cannot be created */
+    ES_ResetUnitTest();
+    UT_SetForceFail(UT_KEY(OS_CountSemCreate), OS_ERROR);
+    status = CFE_ES_AsyncJobInit();
+    UtAssert_True(status == OS_ERROR, "CFE_ES_AsyncJobInit - OS_CountSemCreate failure (%08x)", (unsigned int)status);
+
+    /* CFE_ES_AsyncJobInit() with default setup
+     * causes CFE_ES_CreateChildTask to fail.
+     */
+    ES_ResetUnitTest();
+    status = CFE_ES_AsyncJobInit();
+    UtAssert_True(status == CFE_ES_ERR_APPID, "CFE_ES_AsyncJobInit - CFE_ES_CreateChildTask failure (%08x)", (unsigned int)status);
+
+    /* Test the cleanup deletes the semaphore */
+    ES_ResetUnitTest();
+    OS_CountSemCreate(&CFE_ES_Global.AsyncJob.JobSem, "UT", 0, 0);
+    CFE_ES_AsyncJobCleanup();
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_CountSemDelete)) == 1, "CFE_ES_AsyncJobCleanup - OS_CountSemDelete called");
+
+    /* Test the worker task where it fails to register */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskRegister), 1, -1);
+    CFE_ES_AsyncJobWorker();
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_printf)) == 1, "CFE_ES_AsyncJobWorker - CFE_ES_RegisterChildTask failure");
+
+    /* Test the worker task loop, which exits when the semaphore fails */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.AsyncJob, 0, sizeof(CFE_ES_Global.AsyncJob));
+    UT_AsyncJobCount = 0;
+    CFE_ES_SubmitAsyncJob(ES_UT_AsyncJob, NULL, NULL, 0, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, OS_ERROR);
+    CFE_ES_AsyncJobWorker();
+    UtAssert_True(UT_AsyncJobCount == 1 && UT_GetStubCount(UT_KEY(OS_printf)) == 1,
+            "CFE_ES_AsyncJobWorker - Nominal");
+}
+
@@ -212,6 +212,23 @@ void TestTask(void);
 ******************************************************************************/
 void TestBackground(void);
 
+/*****************************************************************************/
+/**
+** \brief Performs tests of the async job workers contained in
+**        cfe_es_asyncjob.c
+**
+** \par Description
+**        Gets Coverage on all lines/functions in this unit
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void TestAsyncJob(void);
+
 /*****************************************************************************/
 /**
 ** \brief Performs tests on the functions that implement the software timing
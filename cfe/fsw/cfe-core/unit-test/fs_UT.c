@@ -66,6 +66,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_CFE_FS_ReadHeader);
     UT_ADD_TEST(Test_CFE_FS_WriteHeader);
     UT_ADD_TEST(Test_CFE_FS_SetTimestamp);
+    UT_ADD_TEST(Test_CFE_FS_BufferedWriter);
     UT_ADD_TEST(Test_CFE_FS_ExtractFileNameFromPath);
     UT_ADD_TEST(Test_CFE_FS_Private);
 }
@@ -144,6 +145,16 @@ void Test_CFE_FS_WriteHeader(void)
               CFE_FS_WriteHeader(FileDes, &Hdr) == OS_SUCCESS,
               "CFE_FS_WriteHeader",
               "Header write - successful");
+
+    /* Test writing the header on behalf of another application */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_SUCCESS);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_WriteHeaderWithAppID(FileDes, &Hdr, 3) == OS_SUCCESS &&
+              Hdr.ApplicationID == 3,
+              "CFE_FS_WriteHeaderWithAppID",
+              "Header write with application ID - successful");
 }
 
 /*
@@ -190,6 +201,121 @@ void Test_CFE_FS_SetTimestamp(void)
               "Write time stamp - successful");
 }
 
+/*
+** Test FS API buffered record writer functions
+*/
+void Test_CFE_FS_BufferedWriter(void)
+{
+    CFE_FS_BufferedWriter_t Writer;
+    uint32 Buffer[4];
+    uint8 Record[6];
+    uint8 LargeRecord[20];
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Buffered Writer\n");
+#endif
+
+    memset(Record, 0xA5, sizeof(Record));
+    memset(LargeRecord, 0x5A, sizeof(LargeRecord));
+
+    /* Test that records are staged until the buffer is flushed */
+    UT_InitData();
+    CFE_FS_BufferedWriterInit(&Writer, 1, Buffer, sizeof(Buffer));
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_BufferedWrite(&Writer, Record, sizeof(Record)) == sizeof(Record) &&
+              CFE_FS_BufferedWrite(&Writer, Record, sizeof(Record)) == sizeof(Record) &&
+              CFE_FS_BufferedWriterSpace(&Writer) == sizeof(Buffer) - 2 * sizeof(Record) &&
+              UT_GetStubCount(UT_KEY(OS_write)) == 0,
+              "CFE_FS_BufferedWrite",
+              "Records staged without a file write");
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_BufferedWriterFlush(&Writer) == CFE_SUCCESS &&
+              UT_GetStubCount(UT_KEY(OS_write)) == 1 &&
+              CFE_FS_BufferedWriterSpace(&Writer) == sizeof(Buffer) &&
+              Writer.TotalBytes == 2 * sizeof(Record),
+              "CFE_FS_BufferedWriterFlush",
+              "Staged records written in one call");
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_BufferedWriterFlush(&Writer) == CFE_SUCCESS &&
+              UT_GetStubCount(UT_KEY(OS_write)) == 1,
+              "CFE_FS_BufferedWriterFlush",
+              "Nothing staged, no file write");
+
+    /* Test that a record which does not fit flushes the buffer first */
+    UT_InitData();
+    CFE_FS_BufferedWriterInit(&Writer, 1, Buffer, sizeof(Buffer));
+    CFE_FS_BufferedWrite(&Writer, Record, sizeof(Record));
+    CFE_FS_BufferedWrite(&Writer, Record, sizeof(Record));
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_BufferedWrite(&Writer, Record, sizeof(Record)) == sizeof(Record) &&
+              UT_GetStubCount(UT_KEY(OS_write)) == 1 &&
+              Writer.Used == sizeof(Record),
+              "CFE_FS_BufferedWrite",
+              "Full buffer flushed before staging");
+
+    /* Test that a record larger than the buffer is written directly */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_BufferedWrite(&Writer, LargeRecord, sizeof(LargeRecord)) == sizeof(LargeRecord) &&
+              UT_GetStubCount(UT_KEY(OS_write)) == 2 &&
+              Writer.Used == 0,
+              "CFE_FS_BufferedWrite",
+              "Large record written through after flush");
+
+    /* Test writing without a staging buffer */
+    UT_InitData();
+    CFE_FS_BufferedWriterInit(&Writer, 1, NULL, sizeof(Buffer));
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_BufferedWrite(&Writer, Record, sizeof(Record)) == sizeof(Record) &&
+              UT_GetStubCount(UT_KEY(OS_write)) == 1 &&
+              CFE_FS_BufferedWriterSpace(&Writer) == 0,
+              "CFE_FS_BufferedWrite",
+              "No buffer, record written through");
+
+    /* Test that a failed flush is reported and sticky */
+    UT_InitData();
+    CFE_FS_BufferedWriterInit(&Writer, 1, Buffer, sizeof(Buffer));
+    CFE_FS_BufferedWrite(&Writer, Record, sizeof(Record));
+    UT_SetForceFail(UT_KEY(OS_write), OS_ERROR);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_BufferedWriterFlush(&Writer) == OS_ERROR,
+              "CFE_FS_BufferedWriterFlush",
+              "Write failure");
+    UT_ClearForceFail(UT_KEY(OS_write));
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_BufferedWrite(&Writer, LargeRecord, sizeof(LargeRecord)) == OS_ERROR &&
+              CFE_FS_BufferedWriterFlush(&Writer) == OS_ERROR &&
+              UT_GetStubCount(UT_KEY(OS_write)) == 1,
+              "CFE_FS_BufferedWrite",
+              "Error retained after write failure");
+
+    /* Test a short write of the staged data */
+    UT_InitData();
+    CFE_FS_BufferedWriterInit(&Writer, 1, Buffer, sizeof(Buffer));
+    CFE_FS_BufferedWrite(&Writer, Record, sizeof(Record));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, 1);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_BufferedWriterFlush(&Writer) == CFE_FS_SHORT_WRITE,
+              "CFE_FS_BufferedWriterFlush",
+              "Short write");
+
+    /* Test a failure and a short write of a record written through */
+    UT_InitData();
+    CFE_FS_BufferedWriterInit(&Writer, 1, Buffer, sizeof(Buffer));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_ERROR);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_BufferedWrite(&Writer, LargeRecord, sizeof(LargeRecord)) == OS_ERROR,
+              "CFE_FS_BufferedWrite",
+              "Large record write failure");
+    UT_InitData();
+    CFE_FS_BufferedWriterInit(&Writer, 1, Buffer, sizeof(Buffer));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, 1);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_BufferedWrite(&Writer, LargeRecord, sizeof(LargeRecord)) == CFE_FS_SHORT_WRITE,
+              "CFE_FS_BufferedWrite",
+              "Large record short write");
+}
+
 /*
 ** Test FS API write extract file name from path function
 */
@@ -120,7 +120,7 @@ void Test_CFE_FS_ReadHeader(void);
 **        This function does not return a value.
 **
 ** \sa #UT_Text, #UT_InitData, #UT_SetOSFail, #UT_Report, #CFE_FS_WriteHeader,
-** \sa #UT_SetRtnCode
+** \sa #CFE_FS_WriteHeaderWithAppID, #UT_SetRtnCode
 **
 ******************************************************************************/
 void Test_CFE_FS_WriteHeader(void);
@@ -144,6 +144,27 @@ void Test_CFE_FS_WriteHeader(void);
 ******************************************************************************/
 void Test_CFE_FS_SetTimestamp(void);
 
+/*****************************************************************************/
+/**
+** \brief Test FS API buffered record writer functions
+**
+** \par Description
+**        This function tests staging, flushing and error handling of the
+**        buffered record writer.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #UT_InitData, #UT_Report, #CFE_FS_BufferedWriterInit,
+** \sa #CFE_FS_BufferedWrite, #CFE_FS_BufferedWriterSpace,
+** \sa #CFE_FS_BufferedWriterFlush
+**
+******************************************************************************/
+void Test_CFE_FS_BufferedWriter(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test FS API byte swap cFE header function
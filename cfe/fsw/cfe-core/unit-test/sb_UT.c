@@ -468,8 +468,12 @@ void Test_SB_Cmds(void)
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoDef);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoSpec);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoCreateFail);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoQueueFail);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoJobResult);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoHdrFail);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoNoBuf);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoWriteFail);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoFlushFail);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_PipeInfoDef);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_PipeInfoSpec);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_PipeInfoCreateFail);
@@ -621,14 +625,93 @@ void Test_SB_Cmds_RoutingInfoCreateFail(void)
 
 } /* end Test_SB_Cmds_RoutingInfoCreateFail */
 
+/*
+**  Test send routing information command when the write cannot be queued
+*/
+void Test_SB_Cmds_RoutingInfoQueueFail(void)
+{
+    CFE_SB_SendRoutingInfo_t WriteFileCmd;
+    uint8 ErrCount;
+
+    CFE_SB_InitMsg(&WriteFileCmd, CFE_SB_MsgId_From_TopicId(CFE_MISSION_SB_CMD_TOPICID),
+                   sizeof(WriteFileCmd), true);
+    CFE_SB_SetCmdCode((CFE_SB_MsgPtr_t) &WriteFileCmd,
+                      CFE_SB_SEND_ROUTING_INFO_CC);
+    strncpy((char *)WriteFileCmd.Payload.Filename, "RoutingTstFile", sizeof(WriteFileCmd.Payload.Filename));
+
+    ErrCount = CFE_SB.HKTlmMsg.Payload.CommandErrorCounter;
+    UT_SetForceFail(UT_KEY(CFE_ES_SubmitAsyncJob), CFE_ES_ASYNC_JOB_QUEUE_FULL);
+    CFE_SB_SendRoutingInfoCmd(&WriteFileCmd);
+
+    EVTCNT(1);
+
+    EVTSENT(CFE_SB_SND_RTG_ERR1_EID);
+
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(OS_creat)) == 0);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.CommandErrorCounter, ErrCount + 1);
+
+} /* end Test_SB_Cmds_RoutingInfoQueueFail */
+
+/*
+** Hook to record the application ID the SB information file header is
+** written for
+*/
+static int32 UT_SB_WriteHeaderAppIdHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                        const UT_StubContext_t *Context)
+{
+    *((uint32 *)UserObj) = *((const uint32 *)Context->ArgPtr[2]);
+    return StubRetcode;
+}
+
+/*
+**  Test that the result of a routing information write job is counted by
+**  the SB task, and that the file is written on behalf of SB
+*/
+void Test_SB_Cmds_RoutingInfoJobResult(void)
+{
+    CFE_SB_SendRoutingInfo_t WriteFileCmd;
+    uint32 HdrAppId = 0;
+    uint8 CmdCount;
+    uint8 ErrCount;
+
+    CFE_SB_InitMsg(&WriteFileCmd, CFE_SB_MsgId_From_TopicId(CFE_MISSION_SB_CMD_TOPICID),
+                   sizeof(WriteFileCmd), true);
+    CFE_SB_SetCmdCode((CFE_SB_MsgPtr_t) &WriteFileCmd,
+                      CFE_SB_SEND_ROUTING_INFO_CC);
+    strncpy((char *)WriteFileCmd.Payload.Filename, "RoutingTstFile", sizeof(WriteFileCmd.Payload.Filename));
+
+    CFE_SB.AppId = 5;
+    CFE_SB_ResetCounters();
+    CmdCount = CFE_SB.HKTlmMsg.Payload.CommandCounter;
+    ErrCount = CFE_SB.HKTlmMsg.Payload.CommandErrorCounter;
+    UT_SetHookFunction(UT_KEY(CFE_FS_WriteHeaderWithAppID), UT_SB_WriteHeaderAppIdHook, &HdrAppId);
+    CFE_SB_SendRoutingInfoCmd(&WriteFileCmd);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteHeaderWithAppID), 1, -1);
+    CFE_SB_SendRoutingInfoCmd(&WriteFileCmd);
+
+    ASSERT_EQ(HdrAppId, 5);
+
+    /* The job results are only added to the counters by the SB task */
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.CommandCounter, CmdCount);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.CommandErrorCounter, ErrCount);
+
+    CFE_SB_CollectFileDumpCounters();
+
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.CommandCounter, CmdCount + 1);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.CommandErrorCounter, ErrCount + 1);
+    ASSERT_EQ(CFE_SB.FileDumpCmdCount, 0);
+    ASSERT_EQ(CFE_SB.FileDumpErrCount, 0);
+
+} /* end Test_SB_Cmds_RoutingInfoJobResult */
+
 /*
 ** Test send routing information command with a file header write failure
 */
 void Test_SB_Cmds_RoutingInfoHdrFail(void)
 {
-    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteHeader), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteHeaderWithAppID), 1, -1);
 
-    ASSERT_EQ(CFE_SB_SendRtgInfo("RoutingTstFile"), CFE_SB_FILE_IO_ERR);
+    ASSERT_EQ(CFE_SB_SendRtgInfo("RoutingTstFile", 0), CFE_SB_FILE_IO_ERR);
 
     EVTCNT(1);
 
@@ -636,6 +719,46 @@ void Test_SB_Cmds_RoutingInfoHdrFail(void)
 
 } /* end Test_SB_Cmds_RoutingInfoHdrFail */
 
+/*
+** Test send routing information command when no staging buffer is available,
+** which writes the entries unbuffered, one per SB lock cycle
+*/
+void Test_SB_Cmds_RoutingInfoNoBuf(void)
+{
+    CFE_SB_PipeId_t PipeId = 0;
+    uint32 Records;
+
+    /* Make some routing info by calling CFE_SB_AppInit */
+    SETUP(CFE_SB_AppInit());
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    UT_ResetState(UT_KEY(CFE_ES_PutPoolBuf));
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+
+    ASSERT(CFE_SB_SendRtgInfo("RoutingTstFile", 0));
+
+    EVTSENT(CFE_SB_SND_RTG_EID);
+
+    Records = UT_GetStubCount(UT_KEY(CFE_FS_BufferedWrite));
+    ASSERT_TRUE(Records > 1);
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(OS_creat)) == 1);
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(OS_MutSemTake)) >= Records);
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(CFE_ES_PutPoolBuf)) == 0);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SB_Cmds_RoutingInfoNoBuf */
+
+/*
+** Hook to record whether the SB lock is held when an event is sent
+*/
+static int32 UT_SB_EventLockHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                 const UT_StubContext_t *Context)
+{
+    *((bool *)UserObj) = (UT_GetStubCount(UT_KEY(OS_MutSemTake)) != UT_GetStubCount(UT_KEY(OS_MutSemGive)));
+    return StubRetcode;
+}
+
 /*
 ** Test send routing information command with a file write failure on
 ** the second write
@@ -643,13 +766,19 @@ void Test_SB_Cmds_RoutingInfoHdrFail(void)
 void Test_SB_Cmds_RoutingInfoWriteFail(void)
 {
     CFE_SB_PipeId_t PipeId = 0;
+    bool EventLocked = true;
 
     /* Make some routing info by calling CFE_SB_AppInit */
     SETUP(CFE_SB_AppInit());
 
     UT_SetDeferredRetcode(UT_KEY(OS_write), 2, -1);
+    UT_SetHookFunction(UT_KEY(CFE_EVS_SendEventWithAppID), UT_SB_EventLockHook, &EventLocked);
+
+    ASSERT_EQ(CFE_SB_SendRtgInfo("RoutingTstFile", 0), CFE_SB_FILE_IO_ERR);
 
-    ASSERT_EQ(CFE_SB_SendRtgInfo("RoutingTstFile"), CFE_SB_FILE_IO_ERR);
+    /* the write error is reported after the SB lock is released */
+    ASSERT_TRUE(!EventLocked);
+    UT_SetHookFunction(UT_KEY(CFE_EVS_SendEventWithAppID), NULL, NULL);
 
     EVTCNT(11);
 
@@ -665,6 +794,29 @@ void Test_SB_Cmds_RoutingInfoWriteFail(void)
 
 } /* end Test_SB_Cmds_RoutingInfoWriteFail */
 
+/*
+** Test send routing information command with a failure writing the
+** staged entries
+*/
+void Test_SB_Cmds_RoutingInfoFlushFail(void)
+{
+    CFE_SB_PipeId_t PipeId = 0;
+
+    /* Make some routing info by calling CFE_SB_AppInit */
+    SETUP(CFE_SB_AppInit());
+
+    UT_SetForceFail(UT_KEY(CFE_FS_BufferedWriterFlush), OS_ERROR);
+
+    ASSERT_EQ(CFE_SB_SendRtgInfo("RoutingTstFile", 0), CFE_SB_FILE_IO_ERR);
+
+    EVTSENT(CFE_SB_FILEWRITE_ERR_EID);
+
+    ASSERT_TRUE(!UT_EventIsInHistory(CFE_SB_SND_RTG_EID));
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SB_Cmds_RoutingInfoFlushFail */
+
 /*
 ** Test send pipe information command using the default file name
 */
@@ -725,7 +877,7 @@ void Test_SB_Cmds_PipeInfoSpec(void)
 void Test_SB_Cmds_PipeInfoCreateFail(void)
 {
     UT_SetForceFail(UT_KEY(OS_creat), OS_ERROR);
-    ASSERT_EQ(CFE_SB_SendPipeInfo("PipeTstFile"), CFE_SB_FILE_IO_ERR);
+    ASSERT_EQ(CFE_SB_SendPipeInfo("PipeTstFile", 0), CFE_SB_FILE_IO_ERR);
 
     EVTCNT(1);
 
@@ -738,8 +890,8 @@ void Test_SB_Cmds_PipeInfoCreateFail(void)
 */
 void Test_SB_Cmds_PipeInfoHdrFail(void)
 {
-    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteHeader), 1, -1);
-    ASSERT_EQ(CFE_SB_SendPipeInfo("PipeTstFile"), CFE_SB_FILE_IO_ERR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteHeaderWithAppID), 1, -1);
+    ASSERT_EQ(CFE_SB_SendPipeInfo("PipeTstFile", 0), CFE_SB_FILE_IO_ERR);
 
     EVTCNT(1);
 
@@ -763,7 +915,7 @@ void Test_SB_Cmds_PipeInfoWriteFail(void)
     SETUP(CFE_SB_CreatePipe(&PipeId3, PipeDepth, "TestPipe3"));
     UT_SetDeferredRetcode(UT_KEY(OS_write), 2, -1);
 
-    ASSERT_EQ(CFE_SB_SendPipeInfo("PipeTstFile"), CFE_SB_FILE_IO_ERR);
+    ASSERT_EQ(CFE_SB_SendPipeInfo("PipeTstFile", 0), CFE_SB_FILE_IO_ERR);
 
     EVTCNT(4);
 
@@ -853,7 +1005,7 @@ void Test_SB_Cmds_MapInfoSpec(void)
 void Test_SB_Cmds_MapInfoCreateFail(void)
 {
     UT_SetForceFail(UT_KEY(OS_creat), OS_ERROR);
-    ASSERT_EQ(CFE_SB_SendMapInfo("MapTstFile"), CFE_SB_FILE_IO_ERR);
+    ASSERT_EQ(CFE_SB_SendMapInfo("MapTstFile", 0), CFE_SB_FILE_IO_ERR);
 
     EVTCNT(1);
 
@@ -866,8 +1018,8 @@ void Test_SB_Cmds_MapInfoCreateFail(void)
 */
 void Test_SB_Cmds_MapInfoHdrFail(void)
 {
-    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteHeader), 1, -1);
-    ASSERT_EQ(CFE_SB_SendMapInfo("MapTstFile"), CFE_SB_FILE_IO_ERR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteHeaderWithAppID), 1, -1);
+    ASSERT_EQ(CFE_SB_SendMapInfo("MapTstFile", 0), CFE_SB_FILE_IO_ERR);
 
     EVTCNT(1);
 
@@ -905,7 +1057,7 @@ void Test_SB_Cmds_MapInfoWriteFail(void)
     SETUP(CFE_SB_Subscribe(MsgId5, PipeId2));
     UT_SetDeferredRetcode(UT_KEY(OS_write), 2, -1);
 
-    ASSERT_EQ(CFE_SB_SendMapInfo("MapTstFile"), CFE_SB_FILE_IO_ERR);
+    ASSERT_EQ(CFE_SB_SendMapInfo("MapTstFile", 0), CFE_SB_FILE_IO_ERR);
 
     EVTCNT(18);
 
@@ -1689,6 +1841,7 @@ void Test_PipeOpts_API(void)
     SB_UT_ADD_SUBTEST(Test_SetPipeOpts_BadID);
     SB_UT_ADD_SUBTEST(Test_SetPipeOpts_NotOwner);
     SB_UT_ADD_SUBTEST(Test_SetPipeOpts);
+    SB_UT_ADD_SUBTEST(Test_SetSubscriptionOpts_BadArg);
     SB_UT_ADD_SUBTEST(Test_GetPipeOpts_BadID);
     SB_UT_ADD_SUBTEST(Test_GetPipeOpts_BadPtr);
     SB_UT_ADD_SUBTEST(Test_GetPipeOpts);
@@ -1873,6 +2026,43 @@ void Test_SetPipeOpts(void)
 
 } /* end Test_SetPipeOpts */
 
+/*
+** Try setting subscription options with bad arguments
+*/
+void Test_SetSubscriptionOpts_BadArg(void)
+{
+    CFE_SB_PipeId_t PipeID = 0;
+    CFE_SB_MsgId_t  MsgId = SB_UT_TLM_MID;
+    uint8           PipeTblIdx = 0;
+    uint32          OrigOwner = 0;
+    uint8           SubscribeErrors;
+
+    SubscribeErrors = CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter;
+
+    SETUP(CFE_SB_CreatePipe(&PipeID, 4, "TestPipe1"));
+
+    /* invalid pipe */
+    ASSERT_EQ(CFE_SB_SetSubscriptionOpts(MsgId, CFE_PLATFORM_SB_MAX_PIPES, CFE_SB_SUBOPTS_LATEST, 0), CFE_SB_BAD_ARGUMENT);
+
+    /* pipe not subscribed to the message */
+    ASSERT_EQ(CFE_SB_SetSubscriptionOpts(MsgId, PipeID, CFE_SB_SUBOPTS_LATEST, 0), CFE_SB_BAD_ARGUMENT);
+
+    /* caller is not the owner of the pipe */
+    SETUP(CFE_SB_Subscribe(MsgId, PipeID));
+    PipeTblIdx = CFE_SB_GetPipeIdx(PipeID);
+    OrigOwner = CFE_SB.PipeTbl[PipeTblIdx].AppId;
+    CFE_SB.PipeTbl[PipeTblIdx].AppId = 0xFFFFFFFF;
+    ASSERT_EQ(CFE_SB_SetSubscriptionOpts(MsgId, PipeID, CFE_SB_SUBOPTS_LATEST, 0), CFE_SB_BAD_ARGUMENT);
+    CFE_SB.PipeTbl[PipeTblIdx].AppId = OrigOwner;
+
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.SubscribeErrorCounter, SubscribeErrors + 3);
+
+    EVTSENT(CFE_SB_SETSUBOPTS_ERR_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeID));
+
+} /* end Test_SetSubscriptionOpts_BadArg */
+
 /*
 ** Try getting pipe options on an invalid pipe ID
 */
@@ -1933,6 +2123,8 @@ void Test_Subscribe_API(void)
     SB_UT_ADD_SUBTEST(Test_Subscribe_DuplicateSubscription);
     SB_UT_ADD_SUBTEST(Test_Subscribe_LocalSubscription);
     SB_UT_ADD_SUBTEST(Test_Subscribe_MaxDestCount);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_DestArrayGrowth);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_HighLaneCreateErr);
     SB_UT_ADD_SUBTEST(Test_Subscribe_MaxMsgIdCount);
     SB_UT_ADD_SUBTEST(Test_Subscribe_SendPrevSubs);
     SB_UT_ADD_SUBTEST(Test_Subscribe_FindGlobalMsgIdCnt);
@@ -2113,6 +2305,88 @@ void Test_Subscribe_MaxDestCount(void)
 
 } /* end Test_Subscribe_MaxDestCount */
 
+/*
+** Test growing and releasing the destination array of a route
+*/
+void Test_Subscribe_DestArrayGrowth(void)
+{
+    CFE_SB_PipeId_t      PipeId[CFE_SB_MIN_DESTS_PER_ROUTE + 1];
+    CFE_SB_MsgId_t       MsgId = SB_UT_TLM_MID;
+    CFE_SB_RouteEntry_t *RoutePtr;
+    char                 PipeName[OS_MAX_API_NAME];
+    uint16               PipeDepth = 50;
+    int32                i;
+
+    for (i = 0; i < CFE_SB_MIN_DESTS_PER_ROUTE + 1; i++)
+    {
+        snprintf(PipeName, OS_MAX_API_NAME, "TestPipe%ld", (long) i);
+        SETUP(CFE_SB_CreatePipe(&PipeId[i], PipeDepth, &PipeName[0]));
+    }
+
+    /* Fill the initial array */
+    for (i = 0; i < CFE_SB_MIN_DESTS_PER_ROUTE; i++)
+    {
+        SETUP(CFE_SB_Subscribe(MsgId, PipeId[i]));
+    }
+
+    RoutePtr = CFE_SB_GetRoutePtrFromIdx(CFE_SB_GetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(MsgId)));
+    ASSERT_EQ(RoutePtr->DestCapacity, CFE_SB_MIN_DESTS_PER_ROUTE);
+
+    /* Failure to grow the array leaves the existing destinations alone */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, -1);
+    ASSERT_EQ(CFE_SB_Subscribe(MsgId, PipeId[CFE_SB_MIN_DESTS_PER_ROUTE]), CFE_SB_BUF_ALOC_ERR);
+    EVTSENT(CFE_SB_DEST_BLK_ERR_EID);
+    ASSERT_EQ(RoutePtr->Destinations, CFE_SB_MIN_DESTS_PER_ROUTE);
+    ASSERT_EQ(RoutePtr->DestArray[0].PipeId, PipeId[CFE_SB_MIN_DESTS_PER_ROUTE - 1]);
+
+    /* Growing keeps the most recent subscription first */
+    ASSERT(CFE_SB_Subscribe(MsgId, PipeId[CFE_SB_MIN_DESTS_PER_ROUTE]));
+    ASSERT_EQ(RoutePtr->Destinations, CFE_SB_MIN_DESTS_PER_ROUTE + 1);
+    ASSERT_TRUE(RoutePtr->DestCapacity > CFE_SB_MIN_DESTS_PER_ROUTE);
+    ASSERT_EQ(RoutePtr->DestArray[0].PipeId, PipeId[CFE_SB_MIN_DESTS_PER_ROUTE]);
+    ASSERT_EQ(RoutePtr->DestArray[CFE_SB_MIN_DESTS_PER_ROUTE].PipeId, PipeId[0]);
+
+    /* Removing one from the middle keeps the others in order */
+    ASSERT(CFE_SB_Unsubscribe(MsgId, PipeId[1]));
+    ASSERT_EQ(RoutePtr->Destinations, CFE_SB_MIN_DESTS_PER_ROUTE);
+    ASSERT_TRUE(CFE_SB_GetDestPtr(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), PipeId[1]) == NULL);
+    ASSERT_EQ(RoutePtr->DestArray[CFE_SB_MIN_DESTS_PER_ROUTE - 1].PipeId, PipeId[0]);
+
+    /* The array is released with the last destination */
+    for (i = 0; i < CFE_SB_MIN_DESTS_PER_ROUTE + 1; i++)
+    {
+        TEARDOWN(CFE_SB_DeletePipe(PipeId[i]));
+    }
+
+    ASSERT_EQ(RoutePtr->Destinations, 0);
+    ASSERT_EQ(RoutePtr->DestCapacity, 0);
+    ASSERT_TRUE(RoutePtr->DestArray == NULL);
+
+} /* end Test_Subscribe_DestArrayGrowth */
+
+/*
+** Test response to a failure to create the high priority lane of a pipe
+*/
+void Test_Subscribe_HighLaneCreateErr(void)
+{
+    CFE_SB_PipeId_t PipeId;
+    CFE_SB_MsgId_t  MsgId = SB_UT_CMD_MID;
+    CFE_SB_Qos_t    Quality = {CFE_SB_QosPriority_HIGH, 0};
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 4, "TestPipe"));
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueCreate), 1, OS_ERROR);
+    ASSERT_EQ(CFE_SB_SubscribeEx(MsgId, PipeId, Quality, 4), CFE_SB_PIPE_CR_ERR);
+
+    EVTSENT(CFE_SB_HIGH_LANE_ERR_EID);
+
+    ASSERT_EQ(CFE_SB.PipeTbl[PipeId].HighQueueId, CFE_SB_UNUSED_QUEUE);
+    ASSERT_TRUE(!CFE_SB_IsSubscribed(MsgId));
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_Subscribe_HighLaneCreateErr */
+
 /*
 ** Test message subscription response to reaching the maximum message ID count
 */
@@ -2177,8 +2451,8 @@ void Test_Subscribe_SendPrevSubs(void)
     SETUP(CFE_SB_Subscribe(MsgId2, PipeId1));
     SETUP(CFE_SB_Subscribe(MsgId0, PipeId2));
 
-    /* Set the last list header pointer to NULL to get branch path coverage */
-    CFE_SB.RoutingTbl[2].ListHeadPtr = NULL;
+    /* Empty the last destination list to get branch path coverage */
+    CFE_SB.RoutingTbl[2].Destinations = 0;
 
     ASSERT(CFE_SB_SendPrevSubsCmd(&SendPrevSubsMsg));
 
@@ -2217,8 +2491,8 @@ void Test_Subscribe_FindGlobalMsgIdCnt(void)
     SETUP(CFE_SB_Subscribe(MsgId2, PipeId1));
     SETUP(CFE_SB_SubscribeLocal(MsgId0, PipeId2, MsgLim));
 
-    /* Set the last list head pointer to NULL for branch path coverage */
-    CFE_SB.RoutingTbl[2].ListHeadPtr = NULL;
+    /* Empty the last destination list for branch path coverage */
+    CFE_SB.RoutingTbl[2].Destinations = 0;
 
     ASSERT_EQ(CFE_SB_FindGlobalMsgIdCnt(), 2); /* 2 unique msg ids; the third is set to skip */
 
@@ -2431,8 +2705,7 @@ void Test_Unsubscribe_NoMatch(void)
 
     /* Get index into routing table */
     Idx = CFE_SB_GetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(MsgId));
-    CFE_SB.RoutingTbl[CFE_SB_RouteIdxToValue(Idx)].ListHeadPtr->PipeId = 1;
-    CFE_SB.RoutingTbl[CFE_SB_RouteIdxToValue(Idx)].ListHeadPtr->Next = NULL;
+    CFE_SB.RoutingTbl[CFE_SB_RouteIdxToValue(Idx)].DestArray[0].PipeId = 1;
     ASSERT(CFE_SB_Unsubscribe(MsgId, TestPipe));
 
     EVTCNT(6);
@@ -2594,6 +2867,7 @@ void Test_SendMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_SendMsg_NullPtr);
     SB_UT_ADD_SUBTEST(Test_SendMsg_InvalidMsgId);
     SB_UT_ADD_SUBTEST(Test_SendMsg_NoSubscribers);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_IsSubscribed);
     SB_UT_ADD_SUBTEST(Test_SendMsg_MaxMsgSizePlusOne);
     SB_UT_ADD_SUBTEST(Test_SendMsg_BasicSend);
     SB_UT_ADD_SUBTEST(Test_SendMsg_SequenceCount);
@@ -2606,6 +2880,8 @@ void Test_SendMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_SendMsg_ZeroCopyPass);
     SB_UT_ADD_SUBTEST(Test_SendMsg_ZeroCopyReleasePtr);
     SB_UT_ADD_SUBTEST(Test_SendMsg_DisabledDestination);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_LatestValue);
+    SB_UT_ADD_SUBTEST(Test_SendMsg_Decimate);
     SB_UT_ADD_SUBTEST(Test_SendMsg_SendWithMetadata);
     SB_UT_ADD_SUBTEST(Test_SendMsg_InvalidMsgId_ZeroCopy);
     SB_UT_ADD_SUBTEST(Test_SendMsg_MaxMsgSizePlusOne_ZeroCopy);
@@ -2662,6 +2938,31 @@ void Test_SendMsg_NoSubscribers(void)
 
 } /* end Test_SendMsg_NoSubscribers */
 
+/*
+** Test checking whether a message ID has subscribers
+*/
+void Test_SendMsg_IsSubscribed(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    int32            PipeDepth = 2;
+
+    ASSERT_TRUE(!CFE_SB_IsSubscribed(CFE_SB_INVALID_MSG_ID));
+    ASSERT_TRUE(!CFE_SB_IsSubscribed(MsgId));
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    ASSERT_TRUE(CFE_SB_IsSubscribed(MsgId));
+
+    SETUP(CFE_SB_Unsubscribe(MsgId, PipeId));
+
+    ASSERT_TRUE(!CFE_SB_IsSubscribed(MsgId));
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_IsSubscribed */
+
 /*
 ** Test response to sending a message with the message size larger than allowed
 */
@@ -3123,6 +3424,99 @@ void Test_SendMsg_DisabledDestination(void)
 
 } /* end Test_SendMsg_DisabledDestination */
 
+/*
+** Test that a latest value subscription keeps only the newest message
+*/
+void Test_SendMsg_LatestValue(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    uint32           PipeDepth = 4;
+    uint32           BuffersInUse;
+    uint16           MsgLimitErrors;
+    uint32           i;
+
+    BuffersInUse = CFE_SB.StatTlmMsg.Payload.SBBuffersInUse;
+    MsgLimitErrors = CFE_SB.HKTlmMsg.Payload.MsgLimitErrorCounter;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "LatestTestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    ASSERT(CFE_SB_SetSubscriptionOpts(MsgId, PipeId, CFE_SB_SUBOPTS_LATEST, 0));
+    EVTSENT(CFE_SB_SETSUBOPTS_EID);
+
+    CFE_SB_InitMsg(&TlmPkt, MsgId, sizeof(TlmPkt), true);
+    for (i = 1; i <= 3; i++)
+    {
+        TlmPkt.Tlm32Param1 = i;
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
+
+    /* one message waits on the pipe, the later ones replaced each other */
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].InUse, 1);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].OverwrittenCount, 2);
+    ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.MsgLimitErrorCounter, MsgLimitErrors);
+
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *) PtrToMsg)->Tlm32Param1, 3);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+
+    /* with nothing waiting, the next message is queued normally */
+    TlmPkt.Tlm32Param1 = 4;
+    ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(((SB_UT_Test_Tlm_t *) PtrToMsg)->Tlm32Param1, 4);
+
+    /* a message kept aside is released with the subscription */
+    SETUP(CFE_SB_SendMsg(TlmPktPtr));
+    SETUP(CFE_SB_SendMsg(TlmPktPtr));
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, BuffersInUse);
+
+} /* end Test_SendMsg_LatestValue */
+
+/*
+** Test that a decimating subscription forwards one of every N messages
+*/
+void Test_SendMsg_Decimate(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    uint32           PipeDepth = 10;
+    uint32           i;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "DecimateTestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    ASSERT(CFE_SB_SetSubscriptionOpts(MsgId, PipeId, 0, 3));
+
+    CFE_SB_InitMsg(&TlmPkt, MsgId, sizeof(TlmPkt), true);
+    for (i = 0; i < 7; i++)
+    {
+        TlmPkt.Tlm32Param1 = i;
+        ASSERT(CFE_SB_SendMsg(TlmPktPtr));
+    }
+
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].DecimatedCount, 4);
+
+    for (i = 0; i < 7; i += 3)
+    {
+        ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+        ASSERT_EQ(((SB_UT_Test_Tlm_t *) PtrToMsg)->Tlm32Param1, i);
+    }
+
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SendMsg_Decimate */
+
 /*
 ** Test successfully sending a message with the metadata
 */
@@ -3265,6 +3659,11 @@ void Test_RcvMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_RcvMsg_Timeout);
     SB_UT_ADD_SUBTEST(Test_RcvMsg_PipeReadError);
     SB_UT_ADD_SUBTEST(Test_RcvMsg_PendForever);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_HighPriorityLane);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_BacklogBeforeLane);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_LaneSurplusWakeup);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_LaneCreatedWhilePending);
+    SB_UT_ADD_SUBTEST(Test_RcvMsg_QuiescentWhileBlocked);
     SB_UT_ADD_SUBTEST(Test_RcvMsg_InvalidBufferPtr);
 } /* end Test_RcvMsg_API */
 
@@ -3519,6 +3918,240 @@ void Test_RcvMsg_PendForever(void)
 
 } /* end Test_RcvMsg_PendForever */
 
+/*
+** Test that a command on the high priority lane of a pipe is received ahead
+** of a saturating load of low priority telemetry
+*/
+void Test_RcvMsg_HighPriorityLane(void)
+{
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    CFE_SB_MsgId_t   TlmMsgId = SB_UT_TLM_MID;
+    CFE_SB_MsgId_t   CmdMsgId = SB_UT_CMD_MID;
+    CFE_SB_PipeId_t  PipeId;
+    SB_UT_Test_Tlm_t TlmPkt;
+    SB_UT_Test_Cmd_t CmdPkt;
+    CFE_SB_Qos_t     Quality = {CFE_SB_QosPriority_HIGH, 0};
+    uint32           PipeDepth = 8;
+    uint32           i;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "LaneTestPipe"));
+    SETUP(CFE_SB_SubscribeEx(TlmMsgId, PipeId, CFE_SB_Default_Qos, PipeDepth));
+    SETUP(CFE_SB_SubscribeEx(CmdMsgId, PipeId, Quality, 1));
+    ASSERT_TRUE(CFE_SB.PipeTbl[PipeId].HighQueueId != CFE_SB_UNUSED_QUEUE);
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(OS_CountSemCreate)) == 1);
+
+    /* fill the normal queue, the command does not need room on it */
+    CFE_SB_InitMsg(&TlmPkt, TlmMsgId, sizeof(TlmPkt), true);
+    for (i = 0; i < PipeDepth; i++)
+    {
+        TlmPkt.Tlm32Param1 = i;
+        SETUP(CFE_SB_SendMsg((CFE_SB_MsgPtr_t) &TlmPkt));
+    }
+
+    CFE_SB_InitMsg(&CmdPkt, CmdMsgId, sizeof(CmdPkt), true);
+    SETUP(CFE_SB_SendMsg((CFE_SB_MsgPtr_t) &CmdPkt));
+
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].InUse, PipeDepth + 1);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].HighPriorityInUse, 1);
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(OS_CountSemGive)) == PipeDepth + 1);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].HighPriorityPeakInUse, 1);
+
+    /* the command is received first, then the telemetry in order */
+    ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_PEND_FOREVER));
+    ASSERT_TRUE(CFE_SB_MsgId_Equal(CFE_SB_GetMsgId(PtrToMsg), CmdMsgId));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].HighPriorityInUse, 0);
+
+    for (i = 0; i < PipeDepth; i++)
+    {
+        ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+        ASSERT_EQ(((SB_UT_Test_Tlm_t *) PtrToMsg)->Tlm32Param1, i);
+    }
+
+    /* the entry that announced the lane is skipped */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 1, OS_SEM_TIMEOUT);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].InUse, 0);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_RcvMsg_HighPriorityLane */
+
+/*
+** Test that messages already on a pipe when its high priority lane is
+** created, which were never counted on the wake semaphore, are received
+*/
+void Test_RcvMsg_BacklogBeforeLane(void)
+{
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    CFE_SB_MsgId_t   TlmMsgId = SB_UT_TLM_MID;
+    CFE_SB_MsgId_t   CmdMsgId = SB_UT_CMD_MID;
+    CFE_SB_PipeId_t  PipeId;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_Qos_t     Quality = {CFE_SB_QosPriority_HIGH, 0};
+    uint32           i;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 4, "LaneTestPipe"));
+    SETUP(CFE_SB_Subscribe(TlmMsgId, PipeId));
+
+    CFE_SB_InitMsg(&TlmPkt, TlmMsgId, sizeof(TlmPkt), true);
+    for (i = 0; i < 2; i++)
+    {
+        TlmPkt.Tlm32Param1 = i;
+        SETUP(CFE_SB_SendMsg((CFE_SB_MsgPtr_t) &TlmPkt));
+    }
+
+    SETUP(CFE_SB_SubscribeEx(CmdMsgId, PipeId, Quality, 1));
+    ASSERT_TRUE(CFE_SB.PipeTbl[PipeId].HighQueueId != CFE_SB_UNUSED_QUEUE);
+
+    /* the backlog is read without waiting on the semaphore */
+    for (i = 0; i < 2; i++)
+    {
+        ASSERT(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL));
+        ASSERT_EQ(((SB_UT_Test_Tlm_t *) PtrToMsg)->Tlm32Param1, i);
+    }
+
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(OS_CountSemTimedWait)) == 0);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 1, OS_SEM_TIMEOUT);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_RcvMsg_BacklogBeforeLane */
+
+/*
+** Test that a wakeup for a message that was already read without waiting
+** makes a timed receiver wait again
+*/
+void Test_RcvMsg_LaneSurplusWakeup(void)
+{
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    CFE_SB_MsgId_t   CmdMsgId = SB_UT_CMD_MID;
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_Qos_t     Quality = {CFE_SB_QosPriority_HIGH, 0};
+    OS_time_t        Times[2] = { {10, 0}, {10, 300000} };
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 4, "LaneTestPipe"));
+    SETUP(CFE_SB_SubscribeEx(CmdMsgId, PipeId, Quality, 1));
+
+    /* a poll ends at the first wakeup that finds both queues empty */
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(OS_CountSemTimedWait)) == 1);
+
+    /* a timed receive waits again for the rest of its timeout */
+    UT_ResetState(UT_KEY(OS_CountSemTimedWait));
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), Times, sizeof(Times), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 2, OS_SEM_TIMEOUT);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, 500), CFE_SB_TIME_OUT);
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(OS_CountSemTimedWait)) == 2);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_RcvMsg_LaneSurplusWakeup */
+
+/*
+** Hook to record the timeout of each pipe queue read
+*/
+static int32 UT_SB_QueueGetTimeoutHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                       const UT_StubContext_t *Context)
+{
+    int32 *TimeOuts = UserObj;
+
+    if (CallCount < 2)
+    {
+        TimeOuts[CallCount] = *((const int32 *)Context->ArgPtr[4]);
+    }
+    return StubRetcode;
+}
+
+/*
+** Test a timed receive that is woken by the creation of the high priority
+** lane of its pipe, which only waits for the rest of its timeout after that
+*/
+void Test_RcvMsg_LaneCreatedWhilePending(void)
+{
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_BufferD_t *Wakeup = NULL;
+    OS_time_t        Times[3] = { {10, 0}, {10, 300000}, {10, 600000} };
+    int32            TimeOuts[2] = { 0, 0 };
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 4, "LaneTestPipe"));
+
+    /* the NULL entry is read, then the rest of the timeout expires */
+    OS_QueuePut(CFE_SB.PipeTbl[PipeId].SysQueueId, &Wakeup, sizeof(Wakeup), 0);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), Times, sizeof(Times), false);
+    UT_SetHookFunction(UT_KEY(OS_QueueGet), UT_SB_QueueGetTimeoutHook, TimeOuts);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 2, OS_QUEUE_TIMEOUT);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, 500), CFE_SB_TIME_OUT);
+    ASSERT_EQ(TimeOuts[0], 500);
+    ASSERT_EQ(TimeOuts[1], 200);
+
+    /* the timeout has already expired when the NULL entry is read */
+    UT_ResetState(UT_KEY(OS_QueueGet));
+    OS_QueuePut(CFE_SB.PipeTbl[PipeId].SysQueueId, &Wakeup, sizeof(Wakeup), 0);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), Times, sizeof(Times), false);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, 200), CFE_SB_TIME_OUT);
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(OS_QueueGet)) == 1);
+
+    UT_SetHookFunction(UT_KEY(OS_QueueGet), NULL, NULL);
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_RcvMsg_LaneCreatedWhilePending */
+
+/*
+** Hook to record the application marked as no longer blocked
+*/
+static int32 UT_BlockingCallEndHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                    const UT_StubContext_t *Context)
+{
+    uint32 *AppIdPtr = UserObj;
+
+    *AppIdPtr = *((const uint32 *)Context->ArgPtr[0]);
+    return StubRetcode;
+}
+
+/*
+** Test that a main task waiting in a receive is quiescent for epoch tables,
+** while a poll or the receive of a child task is not
+*/
+void Test_RcvMsg_QuiescentWhileBlocked(void)
+{
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    CFE_SB_PipeId_t  PipeId;
+    uint32           MainAppId = 3;
+    uint32           EndAppId = 0;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 4, "QuiescentTestPipe"));
+
+    /* a main task pending for a message is quiescent until it returns */
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetMainTaskAppID), &MainAppId, sizeof(MainAppId), false);
+    UT_SetHookFunction(UT_KEY(CFE_TBL_BlockingCallEnd), UT_BlockingCallEndHook, &EndAppId);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_TIMEOUT);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_TIME_OUT);
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(CFE_TBL_BlockingCallBegin)) == 1);
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(CFE_TBL_BlockingCallEnd)) == 1);
+    ASSERT_TRUE(EndAppId == MainAppId);
+
+    /* a poll does not block, so it is not a quiescent point */
+    UT_ResetState(UT_KEY(CFE_TBL_BlockingCallBegin));
+    UT_ResetState(UT_KEY(CFE_TBL_BlockingCallEnd));
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_EMPTY);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(CFE_TBL_BlockingCallBegin)) == 0);
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(CFE_TBL_BlockingCallEnd)) == 0);
+
+    /* a child task waiting says nothing about what its main task holds */
+    UT_SetForceFail(UT_KEY(CFE_ES_GetMainTaskAppID), CFE_ES_ERR_APPID);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_TIMEOUT);
+    ASSERT_EQ(CFE_SB_RcvMsg(&PtrToMsg, PipeId, 100), CFE_SB_TIME_OUT);
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(CFE_TBL_BlockingCallBegin)) == 0);
+    ASSERT_TRUE(UT_GetStubCount(UT_KEY(CFE_TBL_BlockingCallEnd)) == 0);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_RcvMsg_QuiescentWhileBlocked */
+
 /*
 ** Test releasing zero copy buffers for all pipes owned by a given app ID
 */
@@ -4391,6 +5024,8 @@ void Test_SB_SpecialCases(void)
     SB_UT_ADD_SUBTEST(Test_RcvMsg_UnsubResubPath);
     SB_UT_ADD_SUBTEST(Test_MessageString);
     SB_UT_ADD_SUBTEST(Test_SB_IdxPushPop);
+    SB_UT_ADD_SUBTEST(Test_SB_EDS_DispatchCache);
+    SB_UT_ADD_SUBTEST(Test_SB_MsgMap);
 } /* end Test_SB_SpecialCases */
 
 /*
@@ -4591,7 +5226,7 @@ void Test_SB_SendMsgPaths_Nominal(void)
     CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter = 0;
     CFE_SB.StopRecurseFlags[1] |= CFE_BIT(CFE_SB_GET_BUF_ERR_EID_BIT);
     MsgId = CFE_SB_GetMsgId((CFE_SB_MsgPtr_t) &CFE_SB.HKTlmMsg);
-    CFE_SB.MsgMap[CFE_SB_MsgKeyToValue(CFE_SB_ConvertMsgIdtoMsgKey(MsgId))] = CFE_SB_INVALID_ROUTE_IDX;
+    CFE_SB_SetRoutingTblIdx(CFE_SB_ConvertMsgIdtoMsgKey(MsgId), CFE_SB_INVALID_ROUTE_IDX);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
     CFE_SB_SendHKTlmCmd(NULL);
     ASSERT_EQ(CFE_SB.HKTlmMsg.Payload.MsgSendErrorCounter, 0);
@@ -4831,3 +5466,164 @@ void Test_MessageString(void)
     		  "CFE_SB_MessageStringGet",
               "Destination size < source string size");
 } /* end Test_MessageString */
+
+/*
+** Handler function for the EDS dispatch test
+*/
+static uint32 UT_SB_DispatchHandlerCount;
+static uint32 UT_SB_DispatchHandler2Count;
+
+static int32 UT_SB_DispatchHandler(const CFE_SB_Msg_t *MsgPtr)
+{
+    ++UT_SB_DispatchHandlerCount;
+    return CFE_SUCCESS;
+}
+
+static int32 UT_SB_DispatchHandler2(const CFE_SB_Msg_t *MsgPtr)
+{
+    ++UT_SB_DispatchHandler2Count;
+    return CFE_SUCCESS;
+}
+
+/*
+** Test that repeated dispatches of the same message are resolved from
+** the cache, and that the cache is discarded when invalidated
+*/
+void Test_SB_EDS_DispatchCache(void)
+{
+    SB_UT_Test_Cmd_t CmdPkt;
+    EdsLib_DataTypeDB_TypeInfo_t TypeInfo[4];
+    CFE_MissionLib_IndicationInfo_t IndicationInfo;
+    uint16 SubcommandOffset[4];
+    uint32 i;
+    int32 (*DispatchTable[2])(const CFE_SB_Msg_t *);
+
+    DispatchTable[0] = UT_SB_DispatchHandler;
+    DispatchTable[1] = UT_SB_DispatchHandler2;
+    UT_SB_DispatchHandlerCount = 0;
+    UT_SB_DispatchHandler2Count = 0;
+    memset(TypeInfo, 0, sizeof(TypeInfo));
+    for (i = 0; i < 4; ++i)
+    {
+        TypeInfo[i].Size.Bytes = sizeof(CmdPkt);
+    }
+    memset(SubcommandOffset, 0, sizeof(SubcommandOffset));
+    CFE_SB_InitMsg(&CmdPkt, SB_UT_CMD_MID, sizeof(CmdPkt), true);
+
+    /* First dispatch does the full lookup */
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_GetTypeInfo), TypeInfo, sizeof(TypeInfo), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MissionLib_GetSubcommandOffset), SubcommandOffset, sizeof(SubcommandOffset), false);
+    ASSERT(CFE_SB_EDS_Dispatch(CFE_SB_Telecommand_Interface_ID, 1, 1, (CFE_SB_MsgPtr_t)&CmdPkt, DispatchTable));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.EdsDispatchCacheMisses, 1);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.EdsDispatchCacheHits, 0);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MissionLib_GetTopicInfo)), 1);
+
+    /*
+     * Second dispatch of the same message is a cache hit, with no topic lookup.
+     * The indication has derived types, so the message itself is still identified.
+     */
+    ASSERT(CFE_SB_EDS_Dispatch(CFE_SB_Telecommand_Interface_ID, 1, 1, (CFE_SB_MsgPtr_t)&CmdPkt, DispatchTable));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.EdsDispatchCacheMisses, 1);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.EdsDispatchCacheHits, 1);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MissionLib_GetTopicInfo)), 1);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(EdsLib_DataTypeDB_IdentifyBuffer)), 2);
+    ASSERT_EQ(UT_SB_DispatchHandlerCount, 2);
+
+    /* A cached entry does not fix the handler: a different derived type selects a different one */
+    SubcommandOffset[2] = sizeof(DispatchTable[0]);
+    ASSERT(CFE_SB_EDS_Dispatch(CFE_SB_Telecommand_Interface_ID, 1, 1, (CFE_SB_MsgPtr_t)&CmdPkt, DispatchTable));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.EdsDispatchCacheHits, 2);
+    ASSERT_EQ(UT_SB_DispatchHandlerCount, 2);
+    ASSERT_EQ(UT_SB_DispatchHandler2Count, 1);
+
+    /* Length check still applies to cached entries */
+    CFE_SB_SetTotalMsgLength((CFE_SB_MsgPtr_t)&CmdPkt, sizeof(CmdPkt) - 1);
+    ASSERT_EQ(CFE_SB_EDS_Dispatch(CFE_SB_Telecommand_Interface_ID, 1, 1, (CFE_SB_MsgPtr_t)&CmdPkt, DispatchTable),
+            CFE_STATUS_WRONG_MSG_LENGTH);
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.EdsDispatchCacheHits, 3);
+    CFE_SB_SetTotalMsgLength((CFE_SB_MsgPtr_t)&CmdPkt, sizeof(CmdPkt));
+
+    /* After invalidation the full lookup is done again */
+    CFE_SB_EDS_InvalidateDispatchCache_Unsync();
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_GetTypeInfo), TypeInfo, sizeof(TypeInfo), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MissionLib_GetSubcommandOffset), SubcommandOffset, sizeof(SubcommandOffset), false);
+    SubcommandOffset[0] = 0;
+    ASSERT(CFE_SB_EDS_Dispatch(CFE_SB_Telecommand_Interface_ID, 1, 1, (CFE_SB_MsgPtr_t)&CmdPkt, DispatchTable));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.EdsDispatchCacheMisses, 2);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MissionLib_GetTopicInfo)), 2);
+    ASSERT_EQ(UT_SB_DispatchHandlerCount, 3);
+
+    /*
+     * An indication without derived types (e.g. telemetry, where the function
+     * code is always zero) is resolved entirely from the cache.
+     */
+    memset(&IndicationInfo, 0, sizeof(IndicationInfo));
+    IndicationInfo.NumArguments = 1;
+    UT_SetDataBuffer(UT_KEY(CFE_MissionLib_GetIndicationInfo), &IndicationInfo, sizeof(IndicationInfo), false);
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_GetTypeInfo), TypeInfo, sizeof(TypeInfo), false);
+    ASSERT(CFE_SB_EDS_Dispatch(CFE_SB_Telecommand_Interface_ID, 2, 1, (CFE_SB_MsgPtr_t)&CmdPkt, DispatchTable));
+    ASSERT(CFE_SB_EDS_Dispatch(CFE_SB_Telecommand_Interface_ID, 2, 1, (CFE_SB_MsgPtr_t)&CmdPkt, DispatchTable));
+    ASSERT_EQ(CFE_SB.StatTlmMsg.Payload.EdsDispatchCacheMisses, 3);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MissionLib_GetTopicInfo)), 3);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(EdsLib_DataTypeDB_IdentifyBuffer)), 5);
+    ASSERT_EQ(UT_SB_DispatchHandlerCount, 5);
+
+} /* end Test_SB_EDS_DispatchCache */
+
+/*
+** Test filling the message map with as many keys as there are routes
+*/
+void Test_SB_MsgMap(void)
+{
+    CFE_SB_MsgKey_t      MsgKey;
+    CFE_SB_MsgRouteIdx_t RouteIdx;
+    uint32               i;
+    uint32               Stride;
+    uint32               Count;
+
+    /* spread the keys out over the valid range */
+    Stride = CFE_PLATFORM_SB_HIGHEST_VALID_MSGID / CFE_PLATFORM_SB_MAX_MSG_IDS;
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_MSG_IDS; i++)
+    {
+        MsgKey = CFE_SB_ConvertMsgIdtoMsgKey(CFE_SB_ValueToMsgId(i * Stride));
+        CFE_SB_SetRoutingTblIdx(MsgKey, CFE_SB_ValueToRouteIdx(i));
+    }
+
+    Count = 0;
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_MSG_IDS; i++)
+    {
+        MsgKey = CFE_SB_ConvertMsgIdtoMsgKey(CFE_SB_ValueToMsgId(i * Stride));
+        RouteIdx = CFE_SB_GetRoutingTblIdx(MsgKey);
+        if (CFE_SB_IsValidRouteIdx(RouteIdx) && CFE_SB_RouteIdxToValue(RouteIdx) == i)
+        {
+            ++Count;
+        }
+    }
+    ASSERT_EQ(Count, CFE_PLATFORM_SB_MAX_MSG_IDS);
+
+    /* a key which was never mapped is not found */
+    MsgKey = CFE_SB_ConvertMsgIdtoMsgKey(CFE_SB_ValueToMsgId(Stride + 1));
+    ASSERT_TRUE(!CFE_SB_IsValidRouteIdx(CFE_SB_GetRoutingTblIdx(MsgKey)));
+
+    /* walking every slot finds each mapped key exactly once */
+    Count = 0;
+    for (i = 0; i < CFE_SB_MSG_MAP_SIZE; i++)
+    {
+        if (CFE_SB_IsValidRouteIdx(CFE_SB_GetRoutingTblIdxFromSlot(i)))
+        {
+            ++Count;
+        }
+    }
+    ASSERT_EQ(Count, CFE_PLATFORM_SB_MAX_MSG_IDS);
+    ASSERT_TRUE(!CFE_SB_IsValidRouteIdx(CFE_SB_GetRoutingTblIdxFromSlot(CFE_SB_MSG_MAP_SIZE)));
+
+    /* clearing a key only affects that key */
+    MsgKey = CFE_SB_ConvertMsgIdtoMsgKey(CFE_SB_ValueToMsgId(Stride));
+    CFE_SB_SetRoutingTblIdx(MsgKey, CFE_SB_INVALID_ROUTE_IDX);
+    ASSERT_TRUE(!CFE_SB_IsValidRouteIdx(CFE_SB_GetRoutingTblIdx(MsgKey)));
+    MsgKey = CFE_SB_ConvertMsgIdtoMsgKey(CFE_SB_ValueToMsgId(2 * Stride));
+    ASSERT_EQ(CFE_SB_RouteIdxToValue(CFE_SB_GetRoutingTblIdx(MsgKey)), 2);
+
+    CFE_SB_InitMsgMap();
+
+} /* end Test_SB_MsgMap */
@@ -378,11 +378,13 @@ void Test_SB_Main_InitErr(void);
 ** \sa #UT_Text, #Test_SB_Cmds_Noop(), #Test_SB_Cmds_RstCtrs(),
 ** \sa #Test_SB_Cmds_Stats(), #Test_SB_Cmds_RoutingInfoDef(),
 ** \sa #Test_SB_Cmds_RoutingInfoSpec(), #Test_SB_Cmds_RoutingInfoCreateFail(),
+** \sa #Test_SB_Cmds_RoutingInfoQueueFail(), #Test_SB_Cmds_RoutingInfoJobResult(),
 ** \sa #Test_SB_Cmds_PipeOpts(),
 ** \sa #Test_SB_Cmds_GetPipeName(),
 ** \sa #Test_SB_Cmds_GetPipeIdByName(),
-** \sa #Test_SB_Cmds_RoutingInfoHdrFail(),
-** \sa #Test_SB_Cmds_RoutingInfoWriteFail(), #Test_SB_Cmds_PipeInfoDef(),
+** \sa #Test_SB_Cmds_RoutingInfoHdrFail(), #Test_SB_Cmds_RoutingInfoNoBuf(),
+** \sa #Test_SB_Cmds_RoutingInfoWriteFail(), #Test_SB_Cmds_RoutingInfoFlushFail(),
+** \sa #Test_SB_Cmds_PipeInfoDef(),
 ** \sa #Test_SB_Cmds_PipeInfoSpec(), #Test_SB_Cmds_PipeInfoCreateFail(),
 ** \sa #Test_SB_Cmds_PipeInfoHdrFail(), #Test_SB_Cmds_PipeInfoWriteFail(),
 ** \sa #Test_SB_Cmds_MapInfoDef(), #Test_SB_Cmds_MapInfoSpec(),
@@ -523,6 +525,42 @@ void Test_SB_Cmds_RoutingInfoSpec(void);
 ******************************************************************************/
 void Test_SB_Cmds_RoutingInfoCreateFail(void);
 
+/*****************************************************************************/
+/**
+** \brief Test send routing information command when the write cannot be queued
+**
+** \par Description
+**        This function tests the send routing information command when
+**        the file write job is rejected by the ES async job queue.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_SB_Cmds_RoutingInfoQueueFail(void);
+
+/*****************************************************************************/
+/**
+** \brief Test the result of a send routing information job
+**
+** \par Description
+**        This function tests that the result of the file write job is
+**        added to the command counters by the SB task rather than by the
+**        ES async worker, and that the file header carries the ID of the
+**        app that queued the write.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_SB_Cmds_RoutingInfoJobResult(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB pipe opts API test functions
@@ -607,6 +645,25 @@ void Test_SetPipeOpts_NotOwner(void);
 ******************************************************************************/
 void Test_SetPipeOpts(void);
 
+/*****************************************************************************/
+/**
+** \brief Try setting subscription options with bad arguments
+**
+** \par Description
+**        This function tests CFE_SB_SetSubscriptionOpts with an invalid pipe,
+**        a pipe not subscribed to the message and a pipe owned by another app.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #CFE_SB_SetSubscriptionOpts
+**
+******************************************************************************/
+void Test_SetSubscriptionOpts_BadArg(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test getting pipe options with invalid pipe ID.
@@ -849,6 +906,25 @@ void Test_GetPipeIdByName(void);
 ******************************************************************************/
 void Test_SB_Cmds_RoutingInfoHdrFail(void);
 
+/*****************************************************************************/
+/**
+** \brief Test send routing information command when no staging buffer
+**        is available
+**
+** \par Description
+**        This function tests the send routing information command when
+**        the staging buffer cannot be taken from the SB memory pool.  The
+**        file is not created in that case.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_SB_Cmds_RoutingInfoNoBuf(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send routing information command with a file header write
@@ -871,6 +947,24 @@ void Test_SB_Cmds_RoutingInfoHdrFail(void);
 ******************************************************************************/
 void Test_SB_Cmds_RoutingInfoWriteFail(void);
 
+/*****************************************************************************/
+/**
+** \brief Test send routing information command with a failure writing
+**        the staged entries
+**
+** \par Description
+**        This function tests the send routing information command when
+**        the staged routing entries cannot be written to the file.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_SB_Cmds_RoutingInfoFlushFail(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send pipe information command using the default file name
@@ -2021,6 +2115,47 @@ void Test_Subscribe_LocalSubscription(void);
 ******************************************************************************/
 void Test_Subscribe_MaxDestCount(void);
 
+/*****************************************************************************/
+/**
+** \brief Test growing and releasing the destination array of a route
+**
+** \par Description
+**        This function tests that a route's destination array grows when it
+**        is full, that a failure to grow it leaves the route unchanged, that
+**        the most recent subscription stays first, and that the array is
+**        released when the last destination is removed.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #CFE_SB_Subscribe, #CFE_SB_Unsubscribe, #CFE_SB_AddDest,
+** \sa #CFE_SB_RemoveDest
+**
+******************************************************************************/
+void Test_Subscribe_DestArrayGrowth(void);
+
+/*****************************************************************************/
+/**
+** \brief Test response to a failure to create the high priority lane of a pipe
+**
+** \par Description
+**        This function tests that a high priority subscription fails, and
+**        leaves the pipe without a lane, when the lane queue cannot be created.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #CFE_SB_SubscribeEx
+**
+******************************************************************************/
+void Test_Subscribe_HighLaneCreateErr(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test message subscription response to reaching the maximum
@@ -2469,6 +2604,25 @@ void Test_SendMsg_InvalidMsgId(void);
 ******************************************************************************/
 void Test_SendMsg_NoSubscribers(void);
 
+/*****************************************************************************/
+/**
+** \brief Test checking whether a message ID has subscribers
+**
+** \par Description
+**        This function tests CFE_SB_IsSubscribed for an invalid message ID,
+**        and for a valid one before, during and after a subscription.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #CFE_SB_IsSubscribed
+**
+******************************************************************************/
+void Test_SendMsg_IsSubscribed(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test response to sending a message with the message size larger
@@ -2729,6 +2883,46 @@ void Test_SendMsg_ZeroCopyReleasePtr(void);
 ******************************************************************************/
 void Test_SendMsg_DisabledDestination(void);
 
+/*****************************************************************************/
+/**
+** \brief Test that a latest value subscription keeps only the newest message
+**
+** \par Description
+**        This function tests that messages published to a latest value
+**        subscription while one is waiting replace each other, that the
+**        receiver gets the newest one, and that a message kept aside is
+**        released when the pipe is deleted.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #CFE_SB_SetSubscriptionOpts, #CFE_SB_SendMsg, #CFE_SB_RcvMsg
+**
+******************************************************************************/
+void Test_SendMsg_LatestValue(void);
+
+/*****************************************************************************/
+/**
+** \brief Test that a decimating subscription forwards one of every N messages
+**
+** \par Description
+**        This function tests that a subscription with a decimation of 3
+**        delivers the first of every three messages and counts the others.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #CFE_SB_SetSubscriptionOpts, #CFE_SB_SendMsg, #CFE_SB_RcvMsg
+**
+******************************************************************************/
+void Test_SendMsg_Decimate(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test successfully sending a message with the metadata
@@ -3066,6 +3260,104 @@ void Test_RcvMsg_PipeReadError(void);
 ******************************************************************************/
 void Test_RcvMsg_PendForever(void);
 
+/*****************************************************************************/
+/**
+** \brief Test receiving from the high priority lane of a pipe
+**
+** \par Description
+**        This function tests that a command subscribed with a high priority
+**        is received ahead of the telemetry already filling the pipe, and
+**        that the lane statistics follow the message.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #CFE_SB_SubscribeEx, #CFE_SB_SendMsg, #CFE_SB_RcvMsg
+**
+******************************************************************************/
+void Test_RcvMsg_HighPriorityLane(void);
+
+/*****************************************************************************/
+/**
+** \brief Test receiving messages queued before the high priority lane
+**
+** \par Description
+**        This function tests that telemetry already on a pipe when its high
+**        priority lane is created is still received, without waiting on the
+**        wake semaphore of the lane.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #CFE_SB_SubscribeEx, #CFE_SB_SendMsg, #CFE_SB_RcvMsg
+**
+******************************************************************************/
+void Test_RcvMsg_BacklogBeforeLane(void);
+
+/*****************************************************************************/
+/**
+** \brief Test a wakeup of a high priority lane with no message left
+**
+** \par Description
+**        This function tests that a timed receiver woken for a message it
+**        already read without waiting waits on the wake semaphore again, and
+**        that a poll does not.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #CFE_SB_SubscribeEx, #CFE_SB_RcvMsg
+**
+******************************************************************************/
+void Test_RcvMsg_LaneSurplusWakeup(void);
+
+/*****************************************************************************/
+/**
+** \brief Test a timed receive woken by the creation of a high priority lane
+**
+** \par Description
+**        This function tests that a timed receive that reads the entry
+**        announcing a new high priority lane only waits again for the part
+**        of its timeout that is left.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_RcvMsg_LaneCreatedWhilePending(void);
+
+/*****************************************************************************/
+/**
+** \brief Test that a blocking receive is a table quiescent point
+**
+** \par Description
+**        This function tests that the main task of an application is marked
+**        as blocked for epoch table reclamation while it pends in a receive,
+**        and that a poll or the receive of a child task is not.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #CFE_SB_RcvMsg
+**
+******************************************************************************/
+void Test_RcvMsg_QuiescentWhileBlocked(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test receiving a message response to an invalid buffer pointer (null)
@@ -3625,6 +3917,49 @@ void Test_RcvMsg_UnsubResubPath(void);
 ******************************************************************************/
 void Test_MessageString(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the EDS dispatch cache
+**
+** \par Description
+**        This function tests that repeated dispatches of the same message
+**        are resolved from the cache, that derived types are still
+**        identified from each message, and that invalidating the cache
+**        causes the full lookup to be repeated.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #CFE_SB_EDS_Dispatch, #CFE_SB_EDS_InvalidateDispatchCache_Unsync
+**
+******************************************************************************/
+void Test_SB_EDS_DispatchCache(void);
+
+/*****************************************************************************/
+/**
+** \brief Test the message map lookups
+**
+** \par Description
+**        This function fills the message map with as many message keys as
+**        there are routes and checks that each key maps back to its route,
+**        that unmapped and cleared keys are not found, and that a walk over
+**        every map slot visits each mapped key once.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #CFE_SB_SetRoutingTblIdx, #CFE_SB_GetRoutingTblIdx,
+** \sa #CFE_SB_GetRoutingTblIdxFromSlot
+**
+******************************************************************************/
+void Test_SB_MsgMap(void);
+
 
 void Test_SB_Macros(void);
 
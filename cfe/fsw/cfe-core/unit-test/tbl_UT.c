@@ -173,6 +173,18 @@ void UtTest_Setup(void)
 
     /* Miscellaneous cfe_tbl_internal.c tests */
     UT_ADD_TEST(Test_CFE_TBL_Internal);
+
+    /* Epoch reclaimed table tests */
+    UT_ADD_TEST(Test_CFE_TBL_EpochReclaim);
+
+    /* Delta load tests */
+    UT_ADD_TEST(Test_CFE_TBL_LoadDelta);
+
+    /* Validation job tests */
+    UT_ADD_TEST(Test_CFE_TBL_ValidationJob);
+
+    /* Packed table image tests */
+    UT_ADD_TEST(Test_CFE_TBL_PackedImage);
 }
 
 /*
@@ -182,11 +194,14 @@ void UT_InitializeTableRegistryNames()
 {
     int i;
 
+    CFE_ES_NameIndexClear(&CFE_TBL_RegistryNameIndex);
+
     for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_TABLES; i++)
     {
         snprintf(CFE_TBL_TaskData.Registry[i].Name,
                  CFE_TBL_MAX_FULL_NAME_LEN, "%d", i);
         CFE_TBL_TaskData.Registry[i].OwnerAppId = 0;
+        CFE_ES_NameIndexAdd(&CFE_TBL_RegistryNameIndex, i);
     }
 }
 
@@ -201,6 +216,7 @@ void UT_ResetTableRegistry(void)
     {
         CFE_TBL_InitRegistryRecord(&CFE_TBL_TaskData.Registry[i]);
     }
+    CFE_ES_NameIndexClear(&CFE_TBL_RegistryNameIndex);
 
     /* Initialize the table access descriptors */
     for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_HANDLES; i++)
@@ -1244,9 +1260,11 @@ void Test_CFE_TBL_DumpCmd(void)
      * working buffer; load in progress, single-buffered
      */
     UT_InitData();
+    CFE_ES_NameIndexRemove(&CFE_TBL_RegistryNameIndex, 2);
     strncpy(CFE_TBL_TaskData.Registry[2].Name, "DumpCmdTest",
             CFE_TBL_MAX_FULL_NAME_LEN);
     CFE_TBL_TaskData.Registry[2].Name[CFE_TBL_MAX_FULL_NAME_LEN - 1] = '\0';
+    CFE_ES_NameIndexAdd(&CFE_TBL_RegistryNameIndex, 2);
     CFE_TBL_TaskData.Registry[2].OwnerAppId = 0;
     strncpy(DumpCmd.Payload.TableName, CFE_TBL_TaskData.Registry[2].Name,
             sizeof(DumpCmd.Payload.TableName));
@@ -4062,6 +4080,971 @@ void Test_CFE_TBL_TblMod(void)
               "Invalid table handle");
 }
 
+/*
+** Test tables whose inactive buffer is reclaimed by epoch rather than by
+** reader locks
+*/
+void Test_CFE_TBL_EpochReclaim(void)
+{
+    int32                      RtnCode;
+    bool                       EventsCorrect;
+    UT_Table1_t                TblSrc;
+    UT_Table1_t                *TblDataPtr;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+    CFE_TBL_RegistryRec_t      *RegRecPtr;
+    EdsLib_DataTypeDB_TypeInfo_t TestInfo;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Epoch Reclaim\n");
+#endif
+
+    /* Test registering an epoch table */
+    UT_InitData();
+    UT_SetAppID(1);
+    CFE_TBL_EarlyInit();
+    UT_ResetPoolBufferIndex();
+    TestInfo = UT_TABLE1_EDSINFO;
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_GetTypeInfo), &TestInfo, sizeof(TestInfo), false);
+    RtnCode = CFE_TBL_Register(&App1TblHandle1, "UT_Table1", 1, 1,
+                               CFE_TBL_OPT_EPOCH, NULL);
+    AccessDescPtr = &CFE_TBL_TaskData.Handles[App1TblHandle1];
+    RegRecPtr = &CFE_TBL_TaskData.Registry[AccessDescPtr->RegIndex];
+    EventsCorrect = (UT_GetNumEventsSent() == 0);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && EventsCorrect &&
+              RegRecPtr->DoubleBuffered == true &&
+              RegRecPtr->EpochReclaim == true,
+              "CFE_TBL_Register",
+              "Register epoch table");
+
+    /* Test that an epoch table cannot be user defined */
+    UT_InitData();
+    RtnCode = CFE_TBL_Register(&App1TblHandle2, "UT_Table2", 1, 1,
+                               CFE_TBL_OPT_EPOCH | CFE_TBL_OPT_USR_DEF_ADDR,
+                               NULL);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_INVALID_OPTIONS,
+              "CFE_TBL_Register",
+              "Epoch table with user defined address");
+
+    /* Perform the initial load */
+    UT_InitData();
+    TblSrc.TblElement1 = 1;
+    TblSrc.TblElement2 = 1;
+    RtnCode = CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TblSrc);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS,
+              "CFE_TBL_Load",
+              "Initial load of epoch table");
+
+    /* Test that a reader does not lock an epoch table */
+    UT_InitData();
+    UT_SetAppID(2);
+    RtnCode = CFE_TBL_Share(&App2TblHandle1, "ut_cfe_tbl.UT_Table1");
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS,
+              "CFE_TBL_Share",
+              "Share epoch table");
+
+    UT_InitData();
+    UT_SetAppID(2);
+    RtnCode = CFE_TBL_GetAddress((void **) &TblDataPtr, App2TblHandle1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INFO_UPDATED &&
+              TblDataPtr->TblElement1 == 1 &&
+              CFE_TBL_TaskData.Handles[App2TblHandle1].LockFlag == false,
+              "CFE_TBL_GetAddress",
+              "Get address of epoch table without locking");
+
+    /* Test that a load switches buffers immediately even while the
+     * reader still holds the address of the active buffer
+     */
+    UT_InitData();
+    UT_SetAppID(1);
+    TblSrc.TblElement1 = 2;
+    RtnCode = CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TblSrc);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS &&
+              RegRecPtr->LoadInProgress == CFE_TBL_NO_LOAD_IN_PROGRESS &&
+              RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr !=
+                  (void *) TblDataPtr &&
+              RegRecPtr->RetireEpoch == CFE_TBL_TaskData.Epoch &&
+              TblDataPtr->TblElement1 == 1,
+              "CFE_TBL_Load",
+              "Epoch table switches buffers without waiting for readers");
+
+    /* Test that the retired buffer is not reused before every
+     * application has passed a quiescent point
+     */
+    UT_InitData();
+    UT_SetAppID(1);
+    TblSrc.TblElement1 = 3;
+    RtnCode = CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TblSrc);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_NO_BUFFER_AVAIL &&
+              TblDataPtr->TblElement1 == 1,
+              "CFE_TBL_Load",
+              "Epoch table retired buffer still in use");
+
+    UT_InitData();
+    UT_SetAppID(1);
+    CFE_TBL_QuiescentPoint(1);
+    RtnCode = CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TblSrc);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_NO_BUFFER_AVAIL &&
+              TblDataPtr->TblElement1 == 1,
+              "CFE_TBL_Load",
+              "Epoch table retired buffer in use by one application");
+
+    /* Test that the retired buffer is reused once all readers are
+     * quiescent
+     */
+    UT_InitData();
+    UT_SetAppID(1);
+    CFE_TBL_QuiescentPoint(2);
+    RtnCode = CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TblSrc);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS &&
+              RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr ==
+                  (void *) TblDataPtr &&
+              TblDataPtr->TblElement1 == 3,
+              "CFE_TBL_Load",
+              "Epoch table retired buffer reclaimed");
+
+    /* Test that an application that never reaches a quiescent point holds
+     * the retired buffer, until it blocks in a receive
+     */
+    UT_InitData();
+    UT_SetAppID(1);
+    CFE_TBL_QuiescentPoint(1);
+    TblSrc.TblElement1 = 4;
+    RtnCode = CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TblSrc);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_NO_BUFFER_AVAIL,
+              "CFE_TBL_Load",
+              "Epoch table retired buffer held by an application that never checkpoints");
+
+    UT_InitData();
+    UT_SetAppID(1);
+    CFE_TBL_BlockingCallBegin(2);
+    RtnCode = CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TblSrc);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS &&
+              RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr !=
+                  (void *) TblDataPtr,
+              "CFE_TBL_Load",
+              "Epoch table retired buffer reclaimed while an application is blocked");
+
+    /* Test that an application returning from a blocking call catches up
+     * with the epochs that passed meanwhile
+     */
+    UT_InitData();
+    CFE_TBL_BlockingCallEnd(2);
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_TaskData.AppBlocked[2] == false &&
+              CFE_TBL_TaskData.AppEpoch[2] == CFE_TBL_TaskData.Epoch &&
+              CFE_TBL_AppPassedEpoch(2, RegRecPtr->RetireEpoch),
+              "CFE_TBL_BlockingCallEnd",
+              "Quiescent point recorded when the blocking call returns");
+
+    /* Test that an application cleaned up while blocked is not left
+     * quiescent for the next application given its ID
+     */
+    UT_InitData();
+    CFE_TBL_BlockingCallBegin(3);
+    CFE_TBL_CleanUpApp(3);
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_TaskData.AppBlocked[3] == false,
+              "CFE_TBL_CleanUpApp",
+              "Blocked state cleared on cleanup");
+
+    /* Test that an out of range application never passes an epoch */
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_AppPassedEpoch(CFE_PLATFORM_ES_MAX_APPLICATIONS, 0) == false,
+              "CFE_TBL_AppPassedEpoch",
+              "Invalid application ID");
+}
+
+/*
+** Test loading a range of a table
+*/
+void Test_CFE_TBL_LoadDelta(void)
+{
+    int32                      RtnCode;
+    bool                       EventsCorrect;
+    UT_Table1_t                TblSrc;
+    UT_Table1_t                *TblDataPtr;
+    UT_Table1_t                WorkBuf;
+    UT_Table1_t                *WorkBufPtr = &WorkBuf;
+    void                       *SavedLoadBuffPtr;
+    uint32                     NewElement2;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+    CFE_TBL_RegistryRec_t      *RegRecPtr;
+    EdsLib_DataTypeDB_TypeInfo_t TestInfo;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Load Delta\n");
+#endif
+
+    /* Register a single buffered table */
+    UT_InitData();
+    UT_SetAppID(1);
+    CFE_TBL_EarlyInit();
+    UT_ResetPoolBufferIndex();
+    TestInfo = UT_TABLE1_EDSINFO;
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_GetTypeInfo), &TestInfo, sizeof(TestInfo), false);
+    RtnCode = CFE_TBL_Register(&App1TblHandle1, "UT_Table1", 1, 1,
+                               CFE_TBL_OPT_DEFAULT, NULL);
+    AccessDescPtr = &CFE_TBL_TaskData.Handles[App1TblHandle1];
+    RegRecPtr = &CFE_TBL_TaskData.Registry[AccessDescPtr->RegIndex];
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS,
+              "CFE_TBL_LoadDelta",
+              "Register single buffered table (setup)");
+
+    /* Test a delta load of a table that has never been loaded */
+    UT_InitData();
+    NewElement2 = 0x55AA55AA;
+    RtnCode = CFE_TBL_LoadDelta(App1TblHandle1, sizeof(uint32), sizeof(uint32), &NewElement2);
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_PARTIAL_LOAD_ERR_EID) == true &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_PARTIAL_LOAD && EventsCorrect,
+              "CFE_TBL_LoadDelta",
+              "Table not loaded yet");
+
+    /* Perform the initial load */
+    UT_InitData();
+    TblSrc.TblElement1 = 1;
+    TblSrc.TblElement2 = 2;
+    RtnCode = CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TblSrc);
+    TblDataPtr = RegRecPtr->Buffers[0].BufferPtr;
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS,
+              "CFE_TBL_LoadDelta",
+              "Initial load (setup)");
+
+    /* Test delta loads with ranges that do not fit in the table */
+    UT_InitData();
+    RtnCode = CFE_TBL_LoadDelta(App1TblHandle1, sizeof(UT_Table1_t) - 2, sizeof(uint32), &NewElement2);
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_LOAD_EXCEEDS_SIZE_ERR_EID) == true &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_INVALID_SIZE && EventsCorrect,
+              "CFE_TBL_LoadDelta",
+              "Range extends past end of table");
+
+    UT_InitData();
+    RtnCode = CFE_TBL_LoadDelta(App1TblHandle1, 0, 0, &NewElement2);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_INVALID_SIZE,
+              "CFE_TBL_LoadDelta",
+              "Empty range");
+
+    /* Test a delta load of a single buffered table; only the range should
+     * pass through the shared working buffer
+     */
+    UT_InitData();
+    SavedLoadBuffPtr = CFE_TBL_TaskData.LoadBuffs[0].BufferPtr;
+    CFE_TBL_TaskData.LoadBuffs[0].BufferPtr = WorkBufPtr;
+    memset(WorkBufPtr, 0xFF, sizeof(UT_Table1_t));
+    RtnCode = CFE_TBL_LoadDelta(App1TblHandle1, sizeof(uint32), sizeof(uint32), &NewElement2);
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_LOAD_SUCCESS_INF_EID) == true &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && EventsCorrect &&
+              TblDataPtr->TblElement1 == 1 &&
+              TblDataPtr->TblElement2 == NewElement2 &&
+              WorkBufPtr->TblElement1 == 0xFFFFFFFF &&
+              UT_GetStubCount(UT_KEY(CFE_ES_RecalculateCRC)) == 1 &&
+              RegRecPtr->DeltaSize == 0 &&
+              RegRecPtr->LoadInProgress == CFE_TBL_NO_LOAD_IN_PROGRESS,
+              "CFE_TBL_LoadDelta",
+              "Single buffered table range copied");
+
+    /* Test a delta load while another application has the table locked;
+     * the pending working buffer must then hold the whole table
+     */
+    UT_InitData();
+    UT_SetAppID(2);
+    CFE_TBL_Share(&App2TblHandle1, "ut_cfe_tbl.UT_Table1");
+    CFE_TBL_GetAddress((void **) &TblDataPtr, App2TblHandle1);
+    UT_SetAppID(1);
+    memset(WorkBufPtr, 0xFF, sizeof(UT_Table1_t));
+    NewElement2 = 0x12345678;
+    RtnCode = CFE_TBL_LoadDelta(App1TblHandle1, sizeof(uint32), sizeof(uint32), &NewElement2);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INFO_TABLE_LOCKED &&
+              TblDataPtr->TblElement2 == 0x55AA55AA &&
+              WorkBufPtr->TblElement1 == 1 &&
+              WorkBufPtr->TblElement2 == NewElement2 &&
+              RegRecPtr->DeltaSize == sizeof(uint32),
+              "CFE_TBL_LoadDelta",
+              "Table locked by another application");
+
+    /* Test that the pending delta is applied once the table is released */
+    UT_InitData();
+    UT_SetAppID(2);
+    CFE_TBL_ReleaseAddress(App2TblHandle1);
+    UT_SetAppID(1);
+    RtnCode = CFE_TBL_Update(App1TblHandle1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS &&
+              TblDataPtr->TblElement1 == 1 &&
+              TblDataPtr->TblElement2 == NewElement2 &&
+              RegRecPtr->DeltaSize == 0,
+              "CFE_TBL_LoadDelta",
+              "Pending delta load applied");
+    CFE_TBL_TaskData.LoadBuffs[0].BufferPtr = SavedLoadBuffPtr;
+
+    /* Test a delta load of a critical double buffered table; only the
+     * range is written to the CDS
+     */
+    UT_InitData();
+    TestInfo = UT_TABLE1_EDSINFO;
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_GetTypeInfo), &TestInfo, sizeof(TestInfo), false);
+    RtnCode = CFE_TBL_Register(&App1TblHandle2, "UT_Table2", 1, 1,
+                               CFE_TBL_OPT_CRITICAL | CFE_TBL_OPT_DBL_BUFFER, NULL);
+    TblSrc.TblElement1 = 3;
+    TblSrc.TblElement2 = 4;
+    RtnCode = CFE_TBL_Load(App1TblHandle2, CFE_TBL_SRC_ADDRESS, &TblSrc);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS,
+              "CFE_TBL_LoadDelta",
+              "Register and load critical double buffered table (setup)");
+
+    UT_InitData();
+    AccessDescPtr = &CFE_TBL_TaskData.Handles[App1TblHandle2];
+    RegRecPtr = &CFE_TBL_TaskData.Registry[AccessDescPtr->RegIndex];
+    RtnCode = CFE_TBL_LoadDelta(App1TblHandle2, 0, sizeof(uint32), &NewElement2);
+    TblDataPtr = RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr;
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS &&
+              TblDataPtr->TblElement1 == NewElement2 &&
+              TblDataPtr->TblElement2 == 4 &&
+              UT_GetStubCount(UT_KEY(CFE_ES_CopyToCDSRange)) == 1 &&
+              UT_GetStubCount(UT_KEY(CFE_ES_CopyToCDS)) == 1,
+              "CFE_TBL_LoadDelta",
+              "Critical double buffered table range written to CDS");
+}
+
+/*
+** Hook that reloads the inactive buffer of a table, as a Load command
+** handled while its validation job is queued or running would
+*/
+static int32 UT_TBL_ReloadInactiveHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                       const UT_StubContext_t *Context)
+{
+    CFE_TBL_RegistryRec_t *RegRecPtr = UserObj;
+
+    RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex].LoadGeneration++;
+    return StubRetcode;
+}
+
+/*
+** Hook that cleans up the table owner, as ES would if the owner were
+** stopped while its validation job is queued or running
+*/
+static int32 UT_TBL_CleanUpOwnerHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                     const UT_StubContext_t *Context)
+{
+    CFE_TBL_CleanUpApp(1);
+    return StubRetcode;
+}
+
+/*
+** Hook that records whether the table was still registered when cleaning
+** up its owner first waited for a running validation job
+*/
+static int32 UT_TBL_WaitValidationHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                       const UT_StubContext_t *Context)
+{
+    bool *HandleInUse = UserObj;
+
+    if (CallCount == 0)
+    {
+        *HandleInUse = CFE_TBL_TaskData.Handles[App1TblHandle1].UsedFlag;
+    }
+
+    return StubRetcode;
+}
+
+/*
+** Test the validation of tables by ES async jobs
+*/
+void Test_CFE_TBL_ValidationJob(void)
+{
+    int32                      RtnCode;
+    CFE_TBL_Validate_t         ValidateCmd;
+    CFE_TBL_RegistryRec_t      *RegRecPtr;
+    CFE_TBL_ValidationResult_t *ResultPtr = &CFE_TBL_TaskData.ValidationResults[0];
+    EdsLib_DataTypeDB_TypeInfo_t TestInfo;
+    OS_time_t                  Times[2];
+    uint32                     Crc;
+    bool                       HandleInUse;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Validation Job\n");
+#endif
+
+    /* Register a double buffered table validated by Table Services */
+    UT_InitData();
+    UT_SetAppID(1);
+    CFE_TBL_EarlyInit();
+    UT_ResetPoolBufferIndex();
+    TestInfo = UT_TABLE1_EDSINFO;
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_GetTypeInfo), &TestInfo, sizeof(TestInfo), false);
+    RtnCode = CFE_TBL_Register(&App1TblHandle1, "UT_Table1", 1, 1,
+                               CFE_TBL_OPT_DBL_BUFFER | CFE_TBL_OPT_ASYNC_VALIDATE,
+                               Test_CFE_TBL_ValidationFunc);
+    RegRecPtr = &CFE_TBL_TaskData.Registry[CFE_TBL_TaskData.Handles[App1TblHandle1].RegIndex];
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && RegRecPtr->AsyncValidation,
+              "CFE_TBL_ValidationJob",
+              "Register table with async validation (setup)");
+
+    memset(&ValidateCmd, 0, sizeof(ValidateCmd));
+    strncpy(ValidateCmd.Payload.TableName, RegRecPtr->Name,
+            sizeof(ValidateCmd.Payload.TableName));
+    ValidateCmd.Payload.ActiveTableFlag = CFE_TBL_BufferSelect_INACTIVE;
+
+    /* Test that the job runs the validation function and records how long
+     * the validation took
+     */
+    UT_InitData();
+    Times[0].seconds = 100;
+    Times[0].microsecs = 200;
+    Times[1].seconds = 100;
+    Times[1].microsecs = 1450;
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), Times, sizeof(Times), false);
+    RtnCode = CFE_TBL_ValidateCmd(&ValidateCmd);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INC_CMD_CTR &&
+              UT_GetStubCount(UT_KEY(CFE_ES_SubmitAsyncJob)) == 1 &&
+              UT_GetStubCount(UT_KEY(Test_CFE_TBL_ValidationFunc)) == 1 &&
+              UT_EventIsInHistory(CFE_TBL_VALIDATION_INF_EID) &&
+              ResultPtr->State == CFE_TBL_VALIDATION_PERFORMED &&
+              ResultPtr->Result == CFE_SUCCESS &&
+              RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex].Validated &&
+              RegRecPtr->ValidateInactiveIndex == CFE_TBL_NO_VALIDATION_PENDING &&
+              RegRecPtr->ValidationTime == 1250,
+              "CFE_TBL_ValidationJob",
+              "Validation function run by the job");
+
+    /* Test that the validation time is reported in registry telemetry */
+    UT_InitData();
+    CFE_TBL_TaskData.HkTlmTblRegIndex = CFE_TBL_TaskData.Handles[App1TblHandle1].RegIndex;
+    CFE_TBL_GetTblRegData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_TaskData.TblRegPacket.Payload.LastValidationTime == 1250,
+              "CFE_TBL_ValidationJob",
+              "Validation time in registry telemetry");
+    CFE_TBL_TaskData.HkTlmTblRegIndex = CFE_TBL_NOT_FOUND;
+
+    /* Test a validation function that fails */
+    UT_InitData();
+    ResultPtr->State = CFE_TBL_VALIDATION_FREE;
+    RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex].Validated = false;
+    UT_SetForceFail(UT_KEY(Test_CFE_TBL_ValidationFunc), -1);
+    RtnCode = CFE_TBL_ValidateCmd(&ValidateCmd);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INC_CMD_CTR &&
+              UT_EventIsInHistory(CFE_TBL_VALIDATION_ERR_EID) &&
+              ResultPtr->State == CFE_TBL_VALIDATION_PERFORMED &&
+              ResultPtr->Result == -1 &&
+              !RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex].Validated,
+              "CFE_TBL_ValidationJob",
+              "Validation function fails");
+
+    /* Test that the job is run by the TBL task when it cannot be queued */
+    UT_InitData();
+    ResultPtr->State = CFE_TBL_VALIDATION_FREE;
+    UT_SetForceFail(UT_KEY(CFE_ES_SubmitAsyncJob), CFE_ES_ASYNC_JOB_QUEUE_FULL);
+    RtnCode = CFE_TBL_ValidateCmd(&ValidateCmd);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INC_CMD_CTR &&
+              UT_GetStubCount(UT_KEY(Test_CFE_TBL_ValidationFunc)) == 1 &&
+              ResultPtr->State == CFE_TBL_VALIDATION_PERFORMED &&
+              RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex].Validated,
+              "CFE_TBL_ValidationJob",
+              "Job queue full, validated by the TBL task");
+
+    /* Test that the owner is only asked to validate once the job has
+     * computed the CRC, when it runs the validation function itself
+     */
+    UT_InitData();
+    ResultPtr->State = CFE_TBL_VALIDATION_FREE;
+    RegRecPtr->AsyncValidation = false;
+    CFE_TBL_TaskData.NumValRequests = 0;
+    Crc = 0x1234;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_CalculateCRC), &Crc, sizeof(Crc), false);
+    RtnCode = CFE_TBL_ValidateCmd(&ValidateCmd);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INC_CMD_CTR &&
+              UT_GetStubCount(UT_KEY(Test_CFE_TBL_ValidationFunc)) == 0 &&
+              ResultPtr->State == CFE_TBL_VALIDATION_PENDING &&
+              ResultPtr->CrcOfTable == 0x1234 &&
+              RegRecPtr->ValidateInactiveIndex == 0 &&
+              CFE_TBL_TaskData.NumValRequests == 1,
+              "CFE_TBL_ValidationJob",
+              "Owner notified after the CRC is computed");
+
+    /* Test that the owner's validation completes the request */
+    UT_InitData();
+    RtnCode = CFE_TBL_Validate(App1TblHandle1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS &&
+              UT_GetStubCount(UT_KEY(Test_CFE_TBL_ValidationFunc)) == 1 &&
+              ResultPtr->State == CFE_TBL_VALIDATION_PERFORMED &&
+              RegRecPtr->ValidateInactiveIndex == CFE_TBL_NO_VALIDATION_PENDING,
+              "CFE_TBL_ValidationJob",
+              "Owner validation after notification");
+
+    /* Test that a job is abandoned when the buffer is reloaded while the
+     * job is queued
+     */
+    UT_InitData();
+    ResultPtr->State = CFE_TBL_VALIDATION_FREE;
+    RegRecPtr->AsyncValidation = true;
+    RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex].Validated = false;
+    UT_SetHookFunction(UT_KEY(CFE_ES_SubmitAsyncJob), UT_TBL_ReloadInactiveHook, RegRecPtr);
+    RtnCode = CFE_TBL_ValidateCmd(&ValidateCmd);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INC_CMD_CTR &&
+              UT_GetStubCount(UT_KEY(Test_CFE_TBL_ValidationFunc)) == 0 &&
+              UT_EventIsInHistory(CFE_TBL_VALIDATION_ABANDONED_ERR_EID) &&
+              ResultPtr->State == CFE_TBL_VALIDATION_PERFORMED &&
+              ResultPtr->Result == CFE_TBL_ERR_UNREGISTERED &&
+              !RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex].Validated,
+              "CFE_TBL_ValidationJob",
+              "Buffer reloaded while the job is queued");
+
+    /* Test that the result of a job is discarded when the buffer is
+     * reloaded while the job runs
+     */
+    UT_InitData();
+    ResultPtr->State = CFE_TBL_VALIDATION_FREE;
+    UT_SetHookFunction(UT_KEY(Test_CFE_TBL_ValidationFunc), UT_TBL_ReloadInactiveHook, RegRecPtr);
+    RtnCode = CFE_TBL_ValidateCmd(&ValidateCmd);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INC_CMD_CTR &&
+              UT_GetStubCount(UT_KEY(Test_CFE_TBL_ValidationFunc)) == 1 &&
+              UT_EventIsInHistory(CFE_TBL_VALIDATION_ABANDONED_ERR_EID) &&
+              !UT_EventIsInHistory(CFE_TBL_VALIDATION_INF_EID) &&
+              ResultPtr->Result == CFE_TBL_ERR_UNREGISTERED &&
+              !RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex].Validated,
+              "CFE_TBL_ValidationJob",
+              "Buffer reloaded while the job runs");
+
+    /* Test that housekeeping collects the validation results under the
+     * registry lock, as the jobs complete on the ES workers
+     */
+    UT_InitData();
+    CFE_TBL_GetHkData();
+    UT_Report(__FILE__, __LINE__,
+              ResultPtr->State == CFE_TBL_VALIDATION_FREE &&
+              UT_GetStubCount(UT_KEY(OS_MutSemTake)) == 1 &&
+              UT_GetStubCount(UT_KEY(OS_MutSemGive)) == 1,
+              "CFE_TBL_ValidationJob",
+              "Validation results collected under the registry lock");
+
+    /* Test that a job is abandoned when the owner is cleaned up while the
+     * job is queued, without waiting
+     */
+    UT_InitData();
+    UT_SetHookFunction(UT_KEY(CFE_ES_SubmitAsyncJob), UT_TBL_CleanUpOwnerHook, NULL);
+    RtnCode = CFE_TBL_ValidateCmd(&ValidateCmd);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INC_CMD_CTR &&
+              UT_GetStubCount(UT_KEY(Test_CFE_TBL_ValidationFunc)) == 0 &&
+              UT_GetStubCount(UT_KEY(OS_TaskDelay)) == 0 &&
+              UT_EventIsInHistory(CFE_TBL_VALIDATION_ABANDONED_ERR_EID) &&
+              ResultPtr->Result == CFE_TBL_ERR_UNREGISTERED &&
+              !CFE_TBL_TaskData.Handles[App1TblHandle1].UsedFlag &&
+              RegRecPtr->ValidationJobsRunning == 0,
+              "CFE_TBL_ValidationJob",
+              "Owner cleaned up while the job is queued");
+
+    /* Register the table again */
+    UT_InitData();
+    ResultPtr->State = CFE_TBL_VALIDATION_FREE;
+    UT_ResetPoolBufferIndex();
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_GetTypeInfo), &TestInfo, sizeof(TestInfo), false);
+    RtnCode = CFE_TBL_Register(&App1TblHandle1, "UT_Table1", 1, 1,
+                               CFE_TBL_OPT_DBL_BUFFER | CFE_TBL_OPT_ASYNC_VALIDATE,
+                               Test_CFE_TBL_ValidationFunc);
+    RegRecPtr = &CFE_TBL_TaskData.Registry[CFE_TBL_TaskData.Handles[App1TblHandle1].RegIndex];
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS,
+              "CFE_TBL_ValidationJob",
+              "Register table with async validation again (setup)");
+
+    /* Test that cleaning up the owner while its validation function runs
+     * in the job waits for the job before releasing the table, and gives
+     * up after the wait limit
+     */
+    UT_InitData();
+    HandleInUse = false;
+    UT_SetHookFunction(UT_KEY(Test_CFE_TBL_ValidationFunc), UT_TBL_CleanUpOwnerHook, NULL);
+    UT_SetHookFunction(UT_KEY(OS_TaskDelay), UT_TBL_WaitValidationHook, &HandleInUse);
+    RtnCode = CFE_TBL_ValidateCmd(&ValidateCmd);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INC_CMD_CTR &&
+              HandleInUse &&
+              UT_GetStubCount(UT_KEY(OS_TaskDelay)) ==
+                  CFE_TBL_VALIDATION_WAIT_LIMIT_MSEC / CFE_TBL_VALIDATION_WAIT_DELAY_MSEC &&
+              UT_GetStubCount(UT_KEY(CFE_ES_WriteToSysLog)) == 1 &&
+              UT_EventIsInHistory(CFE_TBL_VALIDATION_ABANDONED_ERR_EID) &&
+              !CFE_TBL_TaskData.Handles[App1TblHandle1].UsedFlag &&
+              RegRecPtr->ValidationJobsRunning == 0,
+              "CFE_TBL_ValidationJob",
+              "Owner cleaned up while the job runs");
+}
+
+/*
+** Test packed table dump images
+*/
+void Test_CFE_TBL_PackedImage(void)
+{
+    int32                      RtnCode;
+    uint32                     i;
+    uint32                     Offset;
+    uint32                     Length;
+    uint32                     RecordSize;
+    uint32                     TotalSize;
+    uint32                     Seed;
+    uint32                     Crc[2];
+    bool                       CodecCorrect;
+    bool                       BuffersFree;
+    uint8                      Image[600];
+    uint8                      Reference[600];
+    uint8                      Decoded[600];
+    uint8                      Record[CFE_TBL_PACKED_BLOCK_SIZE + 1];
+    uint32                     MatchTable[1 << CFE_TBL_PACKED_MATCH_BITS];
+    uint8                      FileBytes[2 * sizeof(UT_Table1_t) + 1 + sizeof(UT_Table1_t)];
+    uint8                      Contents[sizeof(UT_Table1_t)];
+    CFE_TBL_Dump_t             DumpCmd;
+    CFE_TBL_RegistryRec_t      *RegRecPtr;
+    CFE_TBL_LoadBuff_t         *WorkingBufferPtr;
+    CFE_FS_Header_t            StdFileHeader;
+    EdsLib_DataTypeDB_TypeInfo_t TestInfo[2];
+    struct
+    {
+        CFE_TBL_File_Hdr_t      TblFile;
+        CFE_TBL_PackedImg_Hdr_t PackedImg;
+    } Headers;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Packed Image\n");
+#endif
+
+    /* Test that a repetitive image compresses and decodes to the original */
+    UT_InitData();
+    for (i = 0; i < sizeof(Image); i++)
+    {
+        Image[i] = (i % 24) < 16 ? (uint8)(i % 24) : 0;
+    }
+
+    memset(Decoded, 0, sizeof(Decoded));
+    memset(MatchTable, 0, sizeof(MatchTable));
+    CodecCorrect = true;
+    TotalSize = 0;
+    for (Offset = 0; Offset < sizeof(Image); Offset += Length)
+    {
+        Length = sizeof(Image) - Offset;
+        if (Length > CFE_TBL_PACKED_BLOCK_SIZE)
+        {
+            Length = CFE_TBL_PACKED_BLOCK_SIZE;
+        }
+
+        RecordSize = CFE_TBL_PackBlock(Record, Image, Offset, Length, NULL, MatchTable);
+        TotalSize += RecordSize;
+        if (Record[0] != CFE_TBL_PACKED_BLOCK_LZ ||
+            CFE_TBL_UnpackBlock(Decoded, Offset, Length, Record, RecordSize) != CFE_SUCCESS)
+        {
+            CodecCorrect = false;
+        }
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              CodecCorrect &&
+              TotalSize < (sizeof(Image) / 4) &&
+              memcmp(Decoded, Image, sizeof(Image)) == 0,
+              "CFE_TBL_PackBlock",
+              "Repetitive image compressed and decoded");
+
+    /* Test that a block which does not compress is stored as a copy */
+    UT_InitData();
+    Seed = 1;
+    for (i = 0; i < CFE_TBL_PACKED_BLOCK_SIZE; i++)
+    {
+        Seed = (Seed * 1103515245) + 12345;
+        Image[i] = (uint8)(Seed >> 24);
+    }
+
+    memset(MatchTable, 0, sizeof(MatchTable));
+    RecordSize = CFE_TBL_PackBlock(Record, Image, 0, CFE_TBL_PACKED_BLOCK_SIZE, NULL, MatchTable);
+    RtnCode = CFE_TBL_UnpackBlock(Decoded, 0, CFE_TBL_PACKED_BLOCK_SIZE, Record, RecordSize);
+    UT_Report(__FILE__, __LINE__,
+              RecordSize == (CFE_TBL_PACKED_BLOCK_SIZE + 1) &&
+              Record[0] == CFE_TBL_PACKED_BLOCK_RAW &&
+              RtnCode == CFE_SUCCESS &&
+              memcmp(Decoded, Image, CFE_TBL_PACKED_BLOCK_SIZE) == 0,
+              "CFE_TBL_PackBlock",
+              "Incompressible block stored as a copy");
+
+    /* Test that only the changed block of a delta image is stored */
+    UT_InitData();
+    for (i = 0; i < sizeof(Image); i++)
+    {
+        Image[i] = (uint8)(i * 7);
+    }
+
+    memcpy(Reference, Image, sizeof(Reference));
+    Image[300] ^= 0xFF;
+    memcpy(Decoded, Reference, sizeof(Decoded));
+    CodecCorrect = true;
+    for (Offset = 0; Offset < sizeof(Image); Offset += Length)
+    {
+        Length = sizeof(Image) - Offset;
+        if (Length > CFE_TBL_PACKED_BLOCK_SIZE)
+        {
+            Length = CFE_TBL_PACKED_BLOCK_SIZE;
+        }
+
+        RecordSize = CFE_TBL_PackBlock(Record, Image, Offset, Length, Reference, NULL);
+        if (RecordSize != ((Offset == CFE_TBL_PACKED_BLOCK_SIZE) ? (Length + 1) : 1) ||
+            CFE_TBL_UnpackBlock(Decoded, Offset, Length, Record, RecordSize) != CFE_SUCCESS)
+        {
+            CodecCorrect = false;
+        }
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              CodecCorrect &&
+              memcmp(Decoded, Image, sizeof(Image)) == 0,
+              "CFE_TBL_PackBlock",
+              "Delta image stores only the changed block");
+
+    /* Test that corrupt records are rejected */
+    UT_InitData();
+    Record[0] = CFE_TBL_PACKED_BLOCK_LZ;
+    Record[1] = 0;
+    Record[2] = 3;
+    Record[3] = 0x80;
+    Record[4] = 0;
+    Record[5] = 1;
+    CodecCorrect = (CFE_TBL_UnpackBlock(Decoded, 0, 4, Record, 6) == CFE_TBL_ERR_BAD_PACKED_IMAGE);
+    Record[2] = 2;
+    Record[3] = 0x05;
+    CodecCorrect = CodecCorrect &&
+                   (CFE_TBL_UnpackBlock(Decoded, 0, 4, Record, 5) == CFE_TBL_ERR_BAD_PACKED_IMAGE);
+    Record[3] = 0x00;
+    CodecCorrect = CodecCorrect &&
+                   (CFE_TBL_UnpackBlock(Decoded, 0, 4, Record, 5) == CFE_TBL_ERR_BAD_PACKED_IMAGE);
+    Record[0] = CFE_TBL_PACKED_BLOCK_RAW;
+    CodecCorrect = CodecCorrect &&
+                   (CFE_TBL_UnpackBlock(Decoded, 0, 4, Record, 4) == CFE_TBL_ERR_BAD_PACKED_IMAGE);
+    UT_Report(__FILE__, __LINE__,
+              CodecCorrect,
+              "CFE_TBL_UnpackBlock",
+              "Corrupt records rejected");
+
+    /* Register a table to dump and load packed images of */
+    UT_InitData();
+    UT_SetAppID(1);
+    CFE_TBL_EarlyInit();
+    UT_ResetPoolBufferIndex();
+    TestInfo[0] = UT_TABLE1_EDSINFO;
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_GetTypeInfo), &TestInfo[0], sizeof(TestInfo[0]), false);
+    RtnCode = CFE_TBL_Register(&App1TblHandle1, "UT_Table1", 1, 1,
+                               CFE_TBL_OPT_DEFAULT, NULL);
+    RegRecPtr = &CFE_TBL_TaskData.Registry[CFE_TBL_TaskData.Handles[App1TblHandle1].RegIndex];
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS,
+              "CFE_TBL_PackedImage",
+              "Register table (setup)");
+
+    memset(&DumpCmd, 0, sizeof(DumpCmd));
+    strncpy(DumpCmd.Payload.TableName, RegRecPtr->Name,
+            sizeof(DumpCmd.Payload.TableName));
+    strncpy(DumpCmd.Payload.DumpFilename, "/ram/packed.tbl",
+            sizeof(DumpCmd.Payload.DumpFilename));
+    DumpCmd.Payload.ActiveTableFlag = CFE_TBL_BufferSelect_ACTIVE;
+
+    /* Test a dump command with an illegal dump format */
+    UT_InitData();
+    DumpCmd.Payload.DumpFormat = CFE_TBL_DumpFormat_DELTA_LZ + 1;
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_DumpCmd(&DumpCmd) == CFE_TBL_INC_ERR_CTR &&
+              UT_EventIsInHistory(CFE_TBL_ILLEGAL_DUMP_FORMAT_ERR_EID),
+              "CFE_TBL_DumpCmd",
+              "Illegal dump format");
+
+    /* Test that delta dumps of the active buffer, which the delta is taken
+     * against, are rejected without writing a file
+     */
+    UT_InitData();
+    DumpCmd.Payload.DumpFormat = CFE_TBL_DumpFormat_DELTA;
+    RtnCode = CFE_TBL_DumpCmd(&DumpCmd);
+    DumpCmd.Payload.DumpFormat = CFE_TBL_DumpFormat_DELTA_LZ;
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INC_ERR_CTR &&
+              CFE_TBL_DumpCmd(&DumpCmd) == CFE_TBL_INC_ERR_CTR &&
+              UT_GetNumEventsSent() == 2 &&
+              UT_EventIsInHistory(CFE_TBL_ILLEGAL_DUMP_FORMAT_ERR_EID) &&
+              UT_GetStubCount(UT_KEY(OS_creat)) == 0,
+              "CFE_TBL_DumpCmd",
+              "Delta dump of the active buffer");
+
+    /* Delta dumps are taken of the inactive buffer of a load in progress */
+    DumpCmd.Payload.ActiveTableFlag = CFE_TBL_BufferSelect_INACTIVE;
+    RegRecPtr->LoadInProgress = CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS - 1;
+    CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].Taken = true;
+
+    /* Test a compressed delta dump, which writes the two headers and one
+     * record and returns its working buffers
+     */
+    UT_InitData();
+    DumpCmd.Payload.DumpFormat = CFE_TBL_DumpFormat_DELTA_LZ;
+    TestInfo[1] = UT_TABLE1_EDSINFO;
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_GetTypeInfo), TestInfo, sizeof(TestInfo), false);
+    RtnCode = CFE_TBL_DumpCmd(&DumpCmd);
+    BuffersFree = CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].Taken;
+    for (i = 0; i < CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS - 1; i++)
+    {
+        BuffersFree = BuffersFree && !CFE_TBL_TaskData.LoadBuffs[i].Taken;
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INC_CMD_CTR &&
+              UT_EventIsInHistory(CFE_TBL_OVERWRITE_DUMP_INF_EID) &&
+              UT_GetStubCount(UT_KEY(CFE_FS_BufferedWrite)) == 3 &&
+              BuffersFree,
+              "CFE_TBL_DumpCmd",
+              "Compressed delta dump");
+
+    /* Test a packed dump when there is no working buffer for the reference */
+    UT_InitData();
+    for (i = 1; i < CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS; i++)
+    {
+        CFE_TBL_TaskData.LoadBuffs[i].Taken = true;
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_DumpCmd(&DumpCmd) == CFE_TBL_INC_ERR_CTR &&
+              UT_EventIsInHistory(CFE_TBL_NO_WORK_BUFFERS_ERR_EID) &&
+              !CFE_TBL_TaskData.LoadBuffs[0].Taken,
+              "CFE_TBL_DumpCmd",
+              "Packed dump with no working buffer for the reference");
+
+    for (i = 1; i < CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS; i++)
+    {
+        CFE_TBL_TaskData.LoadBuffs[i].Taken = false;
+    }
+
+    RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+
+    /* Set up a compressed image file holding a single copied block */
+    memset(&StdFileHeader, 0, sizeof(StdFileHeader));
+    StdFileHeader.ContentType = CFE_FS_FILE_CONTENT_ID;
+    StdFileHeader.SubType = CFE_FS_SubType_TBL_PACKED_IMG;
+    StdFileHeader.SpacecraftID = CFE_PLATFORM_TBL_VALID_SCID_1;
+    StdFileHeader.ProcessorID = CFE_PLATFORM_TBL_VALID_PRID_1;
+    memset(&Headers, 0, sizeof(Headers));
+    strncpy(Headers.TblFile.TableName, RegRecPtr->Name,
+            sizeof(Headers.TblFile.TableName) - 1);
+    Headers.TblFile.NumBytes = sizeof(UT_Table1_t);
+    Headers.PackedImg.Format = CFE_TBL_DumpFormat_LZ;
+    Headers.PackedImg.BlockSize = CFE_TBL_PACKED_BLOCK_SIZE;
+    Headers.PackedImg.ImageCrc = 0x1234;
+    for (i = 0; i < sizeof(Contents); i++)
+    {
+        Contents[i] = (uint8)(i + 1);
+    }
+
+    memset(FileBytes, 0, sizeof(FileBytes));
+    FileBytes[2 * sizeof(UT_Table1_t)] = CFE_TBL_PACKED_BLOCK_RAW;
+    memcpy(&FileBytes[(2 * sizeof(UT_Table1_t)) + 1], Contents, sizeof(Contents));
+    WorkingBufferPtr = CFE_TBL_TakeScratchBuffer();
+
+    /* Test loading a compressed image */
+    UT_InitData();
+    Crc[0] = 0x1234;
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_GetTypeInfo), TestInfo, sizeof(TestInfo), false);
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_UnpackCompleteObject), &Headers, sizeof(Headers), false);
+    UT_SetDataBuffer(UT_KEY(OS_read), FileBytes, sizeof(FileBytes), false);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_CalculateCRC), Crc, sizeof(Crc[0]), false);
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
+    RtnCode = CFE_TBL_LoadFromFile("UT", WorkingBufferPtr, RegRecPtr, "packed.tbl");
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS &&
+              UT_GetNumEventsSent() == 0 &&
+              memcmp(WorkingBufferPtr->BufferPtr, Contents, sizeof(Contents)) == 0,
+              "CFE_TBL_LoadFromFile",
+              "Load compressed image");
+
+    /* Test loading an image whose CRC does not match its header */
+    UT_InitData();
+    Crc[0] = 0x4321;
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_GetTypeInfo), TestInfo, sizeof(TestInfo), false);
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_UnpackCompleteObject), &Headers, sizeof(Headers), false);
+    UT_SetDataBuffer(UT_KEY(OS_read), FileBytes, sizeof(FileBytes), false);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_CalculateCRC), Crc, sizeof(Crc[0]), false);
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
+    RtnCode = CFE_TBL_LoadFromFile("UT", WorkingBufferPtr, RegRecPtr, "packed.tbl");
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_BAD_PACKED_IMAGE &&
+              UT_EventIsInHistory(CFE_TBL_PACKED_CRC_ERR_EID),
+              "CFE_TBL_LoadFromFile",
+              "Packed image CRC mismatch");
+
+    /* Test loading a delta image made against other contents */
+    UT_InitData();
+    Headers.PackedImg.Format = CFE_TBL_DumpFormat_DELTA;
+    Headers.PackedImg.ReferenceCrc = 0x1111;
+    Crc[0] = 0x1234;
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_GetTypeInfo), TestInfo, sizeof(TestInfo), false);
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_UnpackCompleteObject), &Headers, sizeof(Headers), false);
+    UT_SetDataBuffer(UT_KEY(OS_read), FileBytes, sizeof(FileBytes), false);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_CalculateCRC), Crc, sizeof(Crc[0]), false);
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    RtnCode = CFE_TBL_LoadFromFile("UT", WorkingBufferPtr, RegRecPtr, "packed.tbl");
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_REFERENCE_MISMATCH &&
+              UT_EventIsInHistory(CFE_TBL_PACKED_REF_ERR_EID),
+              "CFE_TBL_LoadFromFile",
+              "Delta image reference mismatch");
+
+    /* Test loading a delta image with no changed blocks, which decodes
+     * to the active contents
+     */
+    UT_InitData();
+    Headers.PackedImg.ReferenceCrc = 0x1234;
+    Crc[0] = 0x1234;
+    Crc[1] = 0x1234;
+    FileBytes[2 * sizeof(UT_Table1_t)] = CFE_TBL_PACKED_BLOCK_SAME;
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_GetTypeInfo), TestInfo, sizeof(TestInfo), false);
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_UnpackCompleteObject), &Headers, sizeof(Headers), false);
+    UT_SetDataBuffer(UT_KEY(EdsLib_DataTypeDB_PackCompleteObject), Contents, sizeof(Contents), false);
+    UT_SetDataBuffer(UT_KEY(OS_read), FileBytes, (2 * sizeof(UT_Table1_t)) + 1, false);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_CalculateCRC), Crc, sizeof(Crc), false);
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
+    memset(WorkingBufferPtr->BufferPtr, 0, sizeof(Contents));
+    RtnCode = CFE_TBL_LoadFromFile("UT", WorkingBufferPtr, RegRecPtr, "packed.tbl");
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS &&
+              UT_GetNumEventsSent() == 0 &&
+              memcmp(WorkingBufferPtr->BufferPtr, Contents, sizeof(Contents)) == 0,
+              "CFE_TBL_LoadFromFile",
+              "Load delta image");
+
+    WorkingBufferPtr->Taken = false;
+}
+
 /*
 ** Tests for the remaining functions in cfe_tbl_internal.c
 */
@@ -767,6 +767,94 @@ void Test_CFE_TBL_GetInfo(void);
 ******************************************************************************/
 void Test_CFE_TBL_TblMod(void);
 
+/*****************************************************************************/
+/**
+** \brief Test tables that reclaim their inactive buffer by epoch
+**
+** \par Description
+**        This function tests registering, reading and loading a table
+**        created with #CFE_TBL_OPT_EPOCH.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #UT_InitData, #UT_SetAppID, #CFE_TBL_EarlyInit,
+** \sa #CFE_TBL_Register, #CFE_TBL_Load, #CFE_TBL_Share,
+** \sa #CFE_TBL_GetAddress, #CFE_TBL_QuiescentPoint, #UT_Report
+**
+******************************************************************************/
+void Test_CFE_TBL_EpochReclaim(void);
+
+/*****************************************************************************/
+/**
+** \brief Test loading a range of a table
+**
+** \par Description
+**        This function tests #CFE_TBL_LoadDelta on single and double
+**        buffered tables, including a locked and a critical table.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #UT_InitData, #UT_SetAppID, #CFE_TBL_EarlyInit,
+** \sa #CFE_TBL_Register, #CFE_TBL_Load, #CFE_TBL_LoadDelta, #CFE_TBL_Share,
+** \sa #CFE_TBL_GetAddress, #CFE_TBL_ReleaseAddress, #CFE_TBL_Update, #UT_Report
+**
+******************************************************************************/
+void Test_CFE_TBL_LoadDelta(void);
+
+/*****************************************************************************/
+/**
+** \brief Test validating tables with ES async jobs
+**
+** \par Description
+**        This function tests the validation of a table by a Validate
+**        command, with the validation function run by the job or by the
+**        table owner, and with the job run by the TBL task when it cannot
+**        be queued.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #UT_InitData, #UT_SetAppID, #CFE_TBL_EarlyInit,
+** \sa #CFE_TBL_Register, #CFE_TBL_ValidateCmd, #CFE_TBL_GetTblRegData,
+** \sa #CFE_TBL_Validate, #UT_Report
+**
+******************************************************************************/
+void Test_CFE_TBL_ValidationJob(void);
+
+/*****************************************************************************/
+/**
+** \brief Test packed table dump images
+**
+** \par Description
+**        This function tests the block codec used by packed table images,
+**        dumping a table in a compressed and delta format, and loading
+**        packed images through CFE_TBL_LoadFromFile.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #UT_InitData, #UT_SetAppID, #CFE_TBL_EarlyInit,
+** \sa #CFE_TBL_Register, #CFE_TBL_PackBlock, #CFE_TBL_UnpackBlock,
+** \sa #CFE_TBL_DumpCmd, #CFE_TBL_TakeScratchBuffer, #CFE_TBL_LoadFromFile,
+** \sa #UT_Report
+**
+******************************************************************************/
+void Test_CFE_TBL_PackedImage(void);
+
 /*****************************************************************************/
 /**
 ** \brief Tests for the remaining functions in cfe_tbl_internal.c
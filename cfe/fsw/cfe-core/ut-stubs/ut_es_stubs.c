@@ -59,6 +59,11 @@
  */
 #define CFE_UT_ES_POOL_STATIC_BLOCK_SIZE    4096
 
+/*
+ * Maximum argument size for async jobs run by the stub
+ */
+#define CFE_UT_ES_ASYNC_JOB_ARG_SIZE        256
+
 /*
 ** Functions
 */
@@ -152,6 +157,49 @@ int32 CFE_ES_GetAppID(uint32 *AppIdPtr)
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_ES_GetMainTaskAppID stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE ES function
+**        CFE_ES_GetMainTaskAppID.  The Application ID is taken from the data
+**        buffer of this stub if one is set, and is 0 otherwise.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_ES_GetMainTaskAppID(uint32 *AppIdPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_GetMainTaskAppID), AppIdPtr);
+
+    int32 status;
+    uint32 *IdBuff;
+    uint32 BuffSize;
+    uint32 Position;
+
+    status = UT_DEFAULT_IMPL(CFE_ES_GetMainTaskAppID);
+
+    if (status >= 0)
+    {
+        UT_GetDataBuffer(UT_KEY(CFE_ES_GetMainTaskAppID), (void **)&IdBuff, &BuffSize, &Position);
+        if (IdBuff != NULL && BuffSize == sizeof(*AppIdPtr))
+        {
+            *AppIdPtr = *IdBuff;
+        }
+        else
+        {
+            *AppIdPtr = 0;
+        }
+    }
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_ES_GetAppIDByName stub function
@@ -715,6 +763,48 @@ uint32 CFE_ES_CalculateCRC(const void *DataPtr,
     return result;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_ES_RecalculateCRC stub function
+**
+** \par Description
+**        This function is used as a placeholder for the cFE ES function
+**        CFE_ES_RecalculateCRC.  It is set to return a fixed CRC value for the
+**        unit tests.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns 332424.
+**
+******************************************************************************/
+uint32 CFE_ES_RecalculateCRC(const void *OldDataPtr,
+                             const void *NewDataPtr,
+                             uint32 DataLength,
+                             uint32 TrailingLength,
+                             uint32 InputCRC,
+                             uint32 TypeCRC)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_RecalculateCRC), OldDataPtr);
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_RecalculateCRC), NewDataPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_RecalculateCRC), DataLength);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_RecalculateCRC), TrailingLength);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_RecalculateCRC), InputCRC);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_RecalculateCRC), TypeCRC);
+
+    uint32 result;
+
+    UT_DEFAULT_IMPL(CFE_ES_RecalculateCRC);
+
+    if (UT_Stub_CopyToLocal(UT_KEY(CFE_ES_RecalculateCRC), (uint8*)&result, sizeof(result)) < sizeof(result))
+    {
+        result = 332424;
+    }
+
+    return result;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_ES_GetTaskInfo stub function
@@ -829,6 +919,46 @@ int32 CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, void *DataToCopy)
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_ES_CopyToCDSRange stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE ES function
+**        CFE_ES_CopyToCDSRange.  If a data buffer has been supplied for this
+**        function, the range is copied into it at the same offset.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, uint32 Offset, uint32 NumBytes)
+{
+    int32   status;
+    uint8   *CdsBufferPtr;
+    uint32  CdsBufferSize;
+
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_CopyToCDSRange), (void*)Handle);
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_CopyToCDSRange), DataToCopy);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_CopyToCDSRange), Offset);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_CopyToCDSRange), NumBytes);
+    status = UT_DEFAULT_IMPL(CFE_ES_CopyToCDSRange);
+
+    if (status >= 0)
+    {
+        UT_GetDataBuffer(UT_KEY(CFE_ES_CopyToCDSRange), (void**)&CdsBufferPtr, &CdsBufferSize, NULL);
+        if (CdsBufferPtr != NULL && (Offset + NumBytes) <= CdsBufferSize)
+        {
+            memcpy(&CdsBufferPtr[Offset], (const uint8 *)DataToCopy + Offset, NumBytes);
+        }
+    }
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_ES_RestoreFromCDS stub function
@@ -1051,6 +1181,61 @@ void CFE_ES_ExitChildTask(void)
     UT_DEFAULT_IMPL(CFE_ES_ExitChildTask);
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_ES_SubmitAsyncJob stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE ES function
+**        CFE_ES_SubmitAsyncJob.  Unless the user sets a different return
+**        value, the job is run immediately, followed by the completion
+**        function, so that the caller observes the same results as it would
+**        once a worker had run the job.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_ES_SubmitAsyncJob(CFE_ES_AsyncJobFuncPtr_t JobFunc, CFE_ES_AsyncJobDoneFuncPtr_t DoneFunc,
+                            const void *JobArg, uint32 ArgSize, uint16 Priority)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_SubmitAsyncJob), JobFunc);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_SubmitAsyncJob), DoneFunc);
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_SubmitAsyncJob), JobArg);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_SubmitAsyncJob), ArgSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_SubmitAsyncJob), Priority);
+
+    union
+    {
+        uint8   Bytes[CFE_UT_ES_ASYNC_JOB_ARG_SIZE];
+        uint64  AlignU64;
+        void   *AlignPtr;
+    } ArgData;
+    int32 JobStatus;
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_ES_SubmitAsyncJob);
+
+    if (status == CFE_SUCCESS && JobFunc != NULL && ArgSize <= sizeof(ArgData.Bytes))
+    {
+        memset(&ArgData, 0, sizeof(ArgData));
+        if (JobArg != NULL)
+        {
+            memcpy(ArgData.Bytes, JobArg, ArgSize);
+        }
+        JobStatus = JobFunc(ArgData.Bytes);
+        if (DoneFunc != NULL)
+        {
+            DoneFunc(ArgData.Bytes, JobStatus);
+        }
+    }
+
+    return status;
+}
+
 int32 CFE_ES_DeleteApp(uint32 AppID)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_DeleteApp), AppID);
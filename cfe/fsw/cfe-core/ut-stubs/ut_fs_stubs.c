@@ -104,6 +104,41 @@ int32 CFE_FS_WriteHeader(int32 FileDes, CFE_FS_Header_t *Hdr)
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_FS_WriteHeaderWithAppID stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_WriteHeaderWithAppID.  The size of the CFE_FS_Header_t
+**        structure, in bytes, is returned unless the user sets a return code.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or the size of the
+**        CFE_FS_Header_t structure in bytes.
+**
+******************************************************************************/
+int32 CFE_FS_WriteHeaderWithAppID(int32 FileDes, CFE_FS_Header_t *Hdr, uint32 AppId)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_FS_WriteHeaderWithAppID), FileDes);
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_WriteHeaderWithAppID), Hdr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_FS_WriteHeaderWithAppID), AppId);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL_RC(CFE_FS_WriteHeaderWithAppID, sizeof(CFE_FS_Header_t));
+
+    if (status > 0)
+    {
+        UT_Stub_CopyFromLocal(UT_KEY(CFE_FS_WriteHeaderWithAppID), (const uint8*)Hdr, status);
+    }
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_FS_ReadHeader stub function
@@ -175,6 +210,133 @@ int32 CFE_FS_SetTimestamp(int32 FileDes, CFE_TIME_SysTime_t NewTimestamp)
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_FS_BufferedWriterInit stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_BufferedWriterInit.  The writer state is initialized the
+**        same way as the real function.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void CFE_FS_BufferedWriterInit(CFE_FS_BufferedWriter_t *Writer, int32 FileDes, void *Buffer, uint32 BufferSize)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_BufferedWriterInit), Writer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_FS_BufferedWriterInit), FileDes);
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_BufferedWriterInit), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_FS_BufferedWriterInit), BufferSize);
+
+    memset(Writer, 0, sizeof(*Writer));
+    Writer->FileDes = FileDes;
+    if (Buffer != NULL)
+    {
+        Writer->Buffer = Buffer;
+        Writer->BufferSize = BufferSize;
+    }
+
+    UT_DEFAULT_IMPL(CFE_FS_BufferedWriterInit);
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_FS_BufferedWrite stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_BufferedWrite.  Unless a return code has been set, each
+**        record is passed straight through to OS_write so that tests can
+**        inject failures on a particular record.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or the OS_write result.
+**
+******************************************************************************/
+int32 CFE_FS_BufferedWrite(CFE_FS_BufferedWriter_t *Writer, const void *Data, uint32 Size)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_BufferedWrite), Writer);
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_BufferedWrite), Data);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_FS_BufferedWrite), Size);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_FS_BufferedWrite);
+
+    if (status == CFE_SUCCESS)
+    {
+        status = OS_write(Writer->FileDes, Data, Size);
+        if (status > 0)
+        {
+            Writer->TotalBytes += status;
+        }
+    }
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_FS_BufferedWriterSpace stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_BufferedWriterSpace.  The free space in the writer state is
+**        returned unless a return code has been set.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined value or the free staging space.
+**
+******************************************************************************/
+uint32 CFE_FS_BufferedWriterSpace(const CFE_FS_BufferedWriter_t *Writer)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_BufferedWriterSpace), Writer);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL_RC(CFE_FS_BufferedWriterSpace, Writer->BufferSize - Writer->Used);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_FS_BufferedWriterFlush stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_BufferedWriterFlush.  The user can adjust the response by
+**        setting a return code.  CFE_SUCCESS is returned otherwise.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_FS_BufferedWriterFlush(CFE_FS_BufferedWriter_t *Writer)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_BufferedWriterFlush), Writer);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_FS_BufferedWriterFlush);
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_FS_EarlyInit stub function
@@ -1167,6 +1167,17 @@ uint16 CFE_SB_GetUserDataLength(const CFE_SB_Msg_t *MsgPtr)
     return status;
 }
 
+bool CFE_SB_IsSubscribed(CFE_SB_MsgId_t MsgId)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_IsSubscribed), MsgId);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL_RC(CFE_SB_IsSubscribed, true);
+
+    return status;
+}
+
 bool CFE_SB_IsValidMsgId(CFE_SB_MsgId_t MsgId)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_IsValidMsgId), MsgId);
@@ -1201,6 +1212,20 @@ int32 CFE_SB_SetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 Opts)
     return status;
 }
 
+int32 CFE_SB_SetSubscriptionOpts(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8 Opts, uint16 Decimation)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetSubscriptionOpts), MsgId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetSubscriptionOpts), PipeId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetSubscriptionOpts), Opts);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetSubscriptionOpts), Decimation);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_SetSubscriptionOpts);
+
+    return status;
+}
+
 void CFE_SB_SetUserDataLength(CFE_SB_MsgPtr_t MsgPtr, uint16 DataLength)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetUserDataLength), MsgPtr);
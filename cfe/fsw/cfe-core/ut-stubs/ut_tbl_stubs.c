@@ -99,6 +99,69 @@ int32 CFE_TBL_CleanUpApp(uint32 AppId)
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_TBL_QuiescentPoint stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE TBL function
+**        CFE_TBL_QuiescentPoint.  It does nothing beyond recording the call.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void CFE_TBL_QuiescentPoint(uint32 AppId)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_TBL_QuiescentPoint), &AppId);
+    UT_DEFAULT_IMPL(CFE_TBL_QuiescentPoint);
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_TBL_BlockingCallBegin stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE TBL function
+**        CFE_TBL_BlockingCallBegin.  It does nothing beyond recording the call.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void CFE_TBL_BlockingCallBegin(uint32 AppId)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_TBL_BlockingCallBegin), &AppId);
+    UT_DEFAULT_IMPL(CFE_TBL_BlockingCallBegin);
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_TBL_BlockingCallEnd stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE TBL function
+**        CFE_TBL_BlockingCallEnd.  It does nothing beyond recording the call.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void CFE_TBL_BlockingCallEnd(uint32 AppId)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_TBL_BlockingCallEnd), &AppId);
+    UT_DEFAULT_IMPL(CFE_TBL_BlockingCallEnd);
+}
+
 int32 CFE_TBL_Register( CFE_TBL_Handle_t *TblHandlePtr,                   /* Returned Handle */
                         const char   *Name,                               /* Application specific name  */
                         uint16  EdsAppIdx,
@@ -153,6 +216,20 @@ int32 CFE_TBL_Load( CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType, const
 
     return status;
 }
+
+int32 CFE_TBL_LoadDelta( CFE_TBL_Handle_t TblHandle, uint32 Offset, uint32 NumBytes, const void *SrcDataPtr )
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_TBL_LoadDelta), TblHandle);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_TBL_LoadDelta), Offset);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_TBL_LoadDelta), NumBytes);
+    UT_Stub_RegisterContext(UT_KEY(CFE_TBL_LoadDelta), SrcDataPtr);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_TBL_LoadDelta);
+
+    return status;
+}
     
 int32 CFE_TBL_Unregister( CFE_TBL_Handle_t TblHandle )
 {
@@ -270,3 +270,11 @@ set(OSAL_CONFIG_MAX_CMD_LEN             1000
 set(OSAL_CONFIG_QUEUE_MAX_DEPTH         50
     CACHE STRING "Maximum depth of message queue"
 )
+
+# The size of the intermediate buffer used by OS_cp() when the OS layer
+# has no native file-to-file copy.  A single buffer of this size is
+# statically allocated and shared by all copies, so this does not affect
+# task stack usage.
+set(OSAL_CONFIG_FILE_COPY_BLOCK_SIZE    65536
+    CACHE STRING "Size of the block buffer used for file copies"
+)
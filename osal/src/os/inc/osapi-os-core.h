@@ -482,6 +482,27 @@ int32 OS_TaskDelay             (uint32 millisecond);
  */
 int32 OS_TaskSetPriority       (uint32 task_id, uint32 new_priority);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Restricts the given task to a set of processor cores
+ *
+ * Each bit set in the mask allows the task to run on the corresponding
+ * core (bit 0 is the first core).  A mask of zero removes any restriction,
+ * allowing the task to run on any core.  Tasks created by the task after
+ * this call may inherit the restriction, depending on the OS.
+ *
+ * @param[in] task_id        The object ID to operate on
+ *
+ * @param[in] cpu_mask       Bit mask of the cores the task may run on, or zero for all cores
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the ID passed to it is invalid
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the OS does not support processor affinity
+ * @retval #OS_ERROR if the OS call to change the affinity fails (e.g. no such core)
+ */
+int32 OS_TaskSetAffinity       (uint32 task_id, uint32 cpu_mask);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Obsolete
@@ -233,6 +233,20 @@ typedef void * os_dirp_t; /**< @deprecated */
 /** @brief Access filename part of the dirent structure */
 #define OS_DIRENTRY_NAME(x)   ((x).FileName)
 
+/**
+ * @brief File copy progress callback
+ *
+ * Invoked by OS_cpWithProgress() after each block has been copied.
+ *
+ * @param[in]  bytes_copied   Number of bytes copied so far
+ * @param[in]  total_bytes    Size of the source file when the copy started
+ * @param[in]  arg            Opaque argument passed to OS_cpWithProgress()
+ *
+ * @return OS_SUCCESS to continue the copy, any other value aborts it
+ *         and is returned to the caller of OS_cpWithProgress()
+ */
+typedef int32 (*OS_FileCopyProgressFunc_t)(uint32 bytes_copied, uint32 total_bytes, void *arg);
+
 #ifndef OSAL_OMIT_DEPRECATED
 /*
  * Several old type names can be aliases for compatibility
@@ -548,6 +562,32 @@ int32           OS_rename (const char *old_filename, const char *new_filename);
 int32 OS_cp (const char *src, const char *dest);
 
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Copies a single file from src to dest, reporting progress
+ *
+ * Identical to OS_cp(), but calls the supplied function after each block
+ * is copied.  The callback may delay to throttle the copy, or return a
+ * value other than OS_SUCCESS to abandon it.  The partially written
+ * destination file is left in place if the copy is abandoned.
+ *
+ * @param[in]  src           The source file to operate on
+ * @param[in]  dest          The destination file
+ * @param[in]  ProgressFunc  Function to call after each block (may be NULL)
+ * @param[in]  ProgressArg   Opaque argument passed to ProgressFunc
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERROR if the file could not be accessed
+ * @retval #OS_INVALID_POINTER if src or dest are NULL
+ * @retval #OS_FS_ERR_PATH_INVALID if path cannot be parsed
+ * @retval #OS_FS_ERR_PATH_TOO_LONG if the paths given are too long to be stored locally
+ * @retval #OS_FS_ERR_NAME_TOO_LONG if the dest name is too long to be stored locally
+ */
+int32 OS_cpWithProgress (const char *src, const char *dest,
+                         OS_FileCopyProgressFunc_t ProgressFunc, void *ProgressArg);
+
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Move a single file from src to dest
@@ -29,6 +29,14 @@
                                     INCLUDE FILES
  ***************************************************************************************/
 
+/*
+ * pthread_setaffinity_np() and the CPU_SET macros are GNU extensions and
+ * are not exposed by the _XOPEN_SOURCE setting used for the rest of the build
+ */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include "os-posix.h"
 #include "bsp-impl.h"
 #include <sched.h>
@@ -722,6 +730,46 @@ int32 OS_TaskSetPriority_Impl (uint32 task_id, uint32 new_priority)
 } /* end OS_TaskSetPriority_Impl */
 
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskSetAffinity_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskSetAffinity_Impl (uint32 task_id, uint32 cpu_mask)
+{
+#ifdef __linux__
+    cpu_set_t          cpuset;
+    uint32             cpu;
+    int                ret;
+
+    CPU_ZERO(&cpuset);
+    for (cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+        /* a zero mask means the task may run anywhere */
+        if (cpu_mask == 0 || (cpu < 32 && (cpu_mask & (1U << cpu)) != 0))
+        {
+            CPU_SET(cpu, &cpuset);
+        }
+    }
+
+    ret = pthread_setaffinity_np(OS_impl_task_table[task_id].id, sizeof(cpuset), &cpuset);
+    if (ret != 0)
+    {
+        OS_DEBUG("pthread_setaffinity_np: Task ID = %u, mask = 0x%08x, err = %s\n",
+                (unsigned int)task_id, (unsigned int)cpu_mask, strerror(ret));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+#else
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+} /* end OS_TaskSetAffinity_Impl */
+
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TaskRegister_Impl
@@ -238,6 +238,22 @@ int32 OS_TaskSetPriority_Impl (uint32 task_id, uint32 new_priority)
 } /* end OS_TaskSetPriority_Impl */
 
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskSetAffinity_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *  Processor affinity is not supported by this implementation.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskSetAffinity_Impl (uint32 task_id, uint32 cpu_mask)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_TaskSetAffinity_Impl */
+
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TaskMatch_Impl
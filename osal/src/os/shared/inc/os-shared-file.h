@@ -146,6 +146,20 @@ int32 OS_FileOpen_Impl(uint32 local_id, const char *local_path, int32 flags, int
  ------------------------------------------------------------------*/
 int32 OS_ShellOutputToFile_Impl(uint32 stream_id, const char* Cmd);
 
+/*----------------------------------------------------------------
+   Function: OS_FileCopy_Impl
+
+    Purpose: Copy up to "nbytes" from the current position of the source
+             file to the current position of the destination file, without
+             passing the data through a user buffer.  Both file positions
+             are advanced by the amount copied.
+
+    Returns: Number of bytes copied (non-negative, zero at end of file) on success,
+             OS_ERR_NOT_IMPLEMENTED if the OS has no native copy for these files,
+             or relevant error code (negative)
+ ------------------------------------------------------------------*/
+int32 OS_FileCopy_Impl(uint32 dest_local_id, uint32 src_local_id, uint32 nbytes);
+
 
 
 /****************************************************************************************
@@ -133,6 +133,16 @@ int32  OS_TaskDelay_Impl             (uint32 millisecond);
  ------------------------------------------------------------------*/
 int32  OS_TaskSetPriority_Impl       (uint32 task_id, uint32 new_priority);
 
+/*----------------------------------------------------------------
+   Function: OS_TaskSetAffinity_Impl
+
+    Purpose: Restrict the specified task to the cores in cpu_mask
+             (zero means no restriction)
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32  OS_TaskSetAffinity_Impl       (uint32 task_id, uint32 cpu_mask);
+
 /*----------------------------------------------------------------
    Function: OS_TaskGetId_Impl
 
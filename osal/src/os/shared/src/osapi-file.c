@@ -61,6 +61,13 @@ enum
 };
 
 OS_stream_internal_record_t         OS_stream_table[OS_MAX_NUM_OPEN_FILES];
+
+/*
+ * Block buffer for file copies when the OS has no native copy.
+ * One copy at a time owns it, claimed under the stream table lock.
+ */
+static uint8 OS_file_copy_block[OS_FILE_COPY_BLOCK_SIZE];
+static bool  OS_file_copy_block_busy;
                         
 
 /****************************************************************************************
@@ -79,6 +86,7 @@ OS_stream_internal_record_t         OS_stream_table[OS_MAX_NUM_OPEN_FILES];
 int32 OS_FileAPI_Init(void)
 {
    memset(OS_stream_table, 0, sizeof(OS_stream_table));
+   OS_file_copy_block_busy = false;
    return OS_SUCCESS;
 } /* end OS_FileAPI_Init */
 
@@ -479,6 +487,70 @@ int32 OS_rename (const char *old, const char *new)
 } /* end OS_rename */
 
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileCopyNative
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Copies the next chunk between two open streams using the
+ *           native OS mechanism, if the implementation has one.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_FileCopyNative(uint32 dest_filedes, uint32 src_filedes, uint32 nbytes)
+{
+   OS_common_record_t *src_record;
+   OS_common_record_t *dest_record;
+   uint32 src_local_id;
+   uint32 dest_local_id;
+   int32 return_code;
+
+   return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, src_filedes, &src_local_id, &src_record);
+   if (return_code == OS_SUCCESS)
+   {
+      return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, dest_filedes, &dest_local_id, &dest_record);
+      if (return_code == OS_SUCCESS)
+      {
+         return_code = OS_FileCopy_Impl(dest_local_id, src_local_id, nbytes);
+         OS_ObjectIdRefcountDecr(dest_record);
+      }
+      OS_ObjectIdRefcountDecr(src_record);
+   }
+
+   return return_code;
+} /* end OS_FileCopyNative */
+
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileCopyBuffered
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Copies the next block between two open streams by way
+ *           of a caller-supplied buffer.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_FileCopyBuffered(uint32 dest_filedes, uint32 src_filedes, uint8 *copyblock, uint32 blocksize)
+{
+   int32 rd_size;
+   int32 wr_size;
+   int32 wr_total;
+
+   rd_size = OS_read(src_filedes, copyblock, blocksize);
+   wr_total = 0;
+   while (wr_total < rd_size)
+   {
+      wr_size = OS_write(dest_filedes, &copyblock[wr_total], rd_size - wr_total);
+      if (wr_size < 0)
+      {
+         return wr_size;
+      }
+      wr_total += wr_size;
+   }
+
+   return rd_size;
+} /* end OS_FileCopyBuffered */
+
+
 /*----------------------------------------------------------------
  *
  * Function: OS_cp
@@ -489,13 +561,39 @@ int32 OS_rename (const char *old, const char *new)
  *-----------------------------------------------------------------*/
 int32 OS_cp (const char *src, const char *dest)
 {
+    return OS_cpWithProgress(src, dest, NULL, NULL);
+} /* end OS_cp */
+
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_cpWithProgress
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_cpWithProgress (const char *src, const char *dest,
+                         OS_FileCopyProgressFunc_t ProgressFunc, void *ProgressArg)
+{
+    /*
+     * Amount handed to the native copy per call.  The kernel does not need
+     * a buffer for this, so it is only bounded to keep the progress callback
+     * (and the chance to abort) reasonably frequent.
+     */
+    enum { NATIVE_COPY_CHUNK = 0x100000 };
+
     int32 return_code;
-    int32 rd_size;
-    int32 wr_size;
-    int32 wr_total;
+    int32 chunk_size;
     int32 file1;
     int32 file2;
-    uint8 copyblock[512];
+    bool use_native;
+    uint32 total_size;
+    uint32 copied_size;
+    uint32 blocksize;
+    uint8 *copyblock;
+    uint8 stackblock[512];
+    os_fstat_t src_stat;
 
     if (src == NULL || dest == NULL)
     {
@@ -518,31 +616,75 @@ int32 OS_cp (const char *src, const char *dest)
        }
     }
 
+    total_size = 0;
+    if (return_code == OS_SUCCESS && ProgressFunc != NULL &&
+          OS_stat(src, &src_stat) == OS_SUCCESS)
+    {
+       total_size = OS_FILESTAT_SIZE(src_stat);
+    }
+
+    use_native = true;
+    copied_size = 0;
+    copyblock = NULL;
+    blocksize = 0;
+
     while (return_code == OS_SUCCESS)
     {
-       rd_size = OS_read((uint32)file1, copyblock, sizeof(copyblock));
-       if (rd_size < 0)
+       chunk_size = OS_ERR_NOT_IMPLEMENTED;
+       if (use_native)
        {
-          return_code = rd_size;
-          break;
+          chunk_size = OS_FileCopyNative((uint32)file2, (uint32)file1, NATIVE_COPY_CHUNK);
+       }
+
+       if (chunk_size == OS_ERR_NOT_IMPLEMENTED)
+       {
+          if (copyblock == NULL)
+          {
+             /*
+              * No native copy on this OS (or not for these files) -
+              * continue from the current position through a buffer,
+              * using the small stack block only while another copy
+              * owns the shared block.
+              */
+             use_native = false;
+             copyblock = stackblock;
+             blocksize = sizeof(stackblock);
+             OS_Lock_Global(LOCAL_OBJID_TYPE);
+             if (!OS_file_copy_block_busy)
+             {
+                OS_file_copy_block_busy = true;
+                copyblock = OS_file_copy_block;
+                blocksize = sizeof(OS_file_copy_block);
+             }
+             OS_Unlock_Global(LOCAL_OBJID_TYPE);
+          }
+          chunk_size = OS_FileCopyBuffered((uint32)file2, (uint32)file1, copyblock, blocksize);
+       }
+
+       if (chunk_size < 0)
+       {
+          return_code = chunk_size;
        }
-       if (rd_size == 0)
+       else if (chunk_size == 0)
        {
           break;
        }
-       wr_total = 0;
-       while (wr_total < rd_size)
+       else
        {
-          wr_size = OS_write((uint32)file2, &copyblock[wr_total], rd_size - wr_total);
-          if (wr_size < 0)
+          copied_size += chunk_size;
+          if (ProgressFunc != NULL)
           {
-             return_code = wr_size;
-             break;
+             return_code = ProgressFunc(copied_size, total_size, ProgressArg);
           }
-          wr_total += wr_size;
        }
     }
 
+    if (copyblock == OS_file_copy_block)
+    {
+       OS_Lock_Global(LOCAL_OBJID_TYPE);
+       OS_file_copy_block_busy = false;
+       OS_Unlock_Global(LOCAL_OBJID_TYPE);
+    }
     if (file1 >= 0)
     {
        OS_close(file1);
@@ -554,7 +696,7 @@ int32 OS_cp (const char *src, const char *dest)
 
     return return_code;
 
-} /* end OS_cp */
+} /* end OS_cpWithProgress */
 
 
 /*----------------------------------------------------------------
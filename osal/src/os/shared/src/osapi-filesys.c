@@ -78,6 +78,26 @@ extern const OS_VolumeInfo_t OS_VolumeTable[];
  */
 const char OS_FILESYS_RAMDISK_VOLNAME_PREFIX[] = "RAM";
 
+/*
+ * Index of the virtual mount points, for path translation.
+ *
+ * Entries are ordered by decreasing mount point length, so the first match
+ * is the longest (most specific) prefix.  The lengths are computed once when
+ * the index is rebuilt, which happens whenever a file system is mounted,
+ * unmounted, mapped or removed, always with the filesys table locked.
+ * OS_TranslatePath() then only needs a short scan of this index rather than
+ * a search of the whole object table.
+ */
+typedef struct
+{
+    uint32 local_id;
+    uint32 virtual_mountpt_len;
+    uint32 system_mountpt_len;
+} OS_filesys_mount_index_t;
+
+static OS_filesys_mount_index_t OS_filesys_mount_index[LOCAL_NUM_OBJECTS];
+static uint32 OS_filesys_mount_count = 0;
+
 /*----------------------------------------------------------------
  *
  * Function: OS_FileSys_FindVirtMountPoint
@@ -106,6 +126,57 @@ bool OS_FileSys_FindVirtMountPoint(void *ref, uint32 local_id, const OS_common_r
 } /* end OS_FileSys_FindVirtMountPoint */
 
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileSys_UpdateMountIndex
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Rebuilds the mount point index from the filesys table.
+ *           Must be called with the filesys table locked.
+ *
+ *-----------------------------------------------------------------*/
+void OS_FileSys_UpdateMountIndex(void)
+{
+    OS_filesys_internal_record_t *local;
+    uint32 local_id;
+    uint32 count;
+    uint32 i;
+    size_t mplen;
+
+    count = 0;
+    for (local_id = 0; local_id < LOCAL_NUM_OBJECTS; ++local_id)
+    {
+        local = &OS_filesys_table[local_id];
+        if (OS_global_filesys_table[local_id].active_id == 0 ||
+                (local->flags & OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL) == 0)
+        {
+            continue;
+        }
+
+        mplen = strlen(local->virtual_mountpt);
+        if (mplen == 0)
+        {
+            continue;
+        }
+
+        /* insert in order of decreasing length */
+        i = count;
+        while (i > 0 && OS_filesys_mount_index[i - 1].virtual_mountpt_len < mplen)
+        {
+            OS_filesys_mount_index[i] = OS_filesys_mount_index[i - 1];
+            --i;
+        }
+
+        OS_filesys_mount_index[i].local_id = local_id;
+        OS_filesys_mount_index[i].virtual_mountpt_len = mplen;
+        OS_filesys_mount_index[i].system_mountpt_len = strlen(local->system_mountpt);
+        ++count;
+    }
+
+    OS_filesys_mount_count = count;
+} /* end OS_FileSys_UpdateMountIndex */
+
+
 /*----------------------------------------------------------------
  *
  * Function: OS_FileSys_InitLocalFromVolTable
@@ -379,6 +450,7 @@ int32 OS_FileSysAPI_Init(void)
     int32 return_code = OS_SUCCESS;
 
     memset(OS_filesys_table, 0, sizeof(OS_filesys_table));
+    OS_filesys_mount_count = 0;
 
 #ifndef OSAL_OMIT_DEPRECATED
     uint32 i;
@@ -431,6 +503,10 @@ int32 OS_FileSysAPI_Init(void)
         }
         ++Vol;
     }
+
+    OS_Lock_Global(LOCAL_OBJID_TYPE);
+    OS_FileSys_UpdateMountIndex();
+    OS_Unlock_Global(LOCAL_OBJID_TYPE);
 #endif
 
     return return_code;
@@ -529,6 +605,12 @@ int32 OS_FileSysAddFixedMap(uint32 *filesys_id, const char *phys_path, const cha
         /* Check result, finalize record, and unlock global table. */
         return_code = OS_ObjectIdFinalizeNew(return_code, global, filesys_id);
 
+        if (return_code == OS_SUCCESS)
+        {
+            OS_Lock_Global(LOCAL_OBJID_TYPE);
+            OS_FileSys_UpdateMountIndex();
+            OS_Unlock_Global(LOCAL_OBJID_TYPE);
+        }
     }
 
     return return_code;
@@ -612,6 +694,7 @@ int32 OS_rmfs (const char *devname)
         {
            /* Only need to clear the ID as zero is the "unused" flag */
            global->active_id = 0;
+           OS_FileSys_UpdateMountIndex();
         }
 
         OS_Unlock_Global(LOCAL_OBJID_TYPE);
@@ -722,6 +805,7 @@ int32 OS_mount (const char *devname, const char* mountpoint)
              * For now this does both sides (system and virtual) */
             local->flags |= OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
             strcpy(local->virtual_mountpt, mountpoint);
+            OS_FileSys_UpdateMountIndex();
         }
 
         OS_Unlock_Global(LOCAL_OBJID_TYPE);
@@ -795,6 +879,7 @@ int32 OS_unmount (const char *mountpoint)
             /* mark as mounted in the local table.
              * For now this does both sides (system and virtual) */
             local->flags &= ~(OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL);
+            OS_FileSys_UpdateMountIndex();
         }
 
         OS_Unlock_Global(LOCAL_OBJID_TYPE);
@@ -1083,10 +1168,10 @@ int32 OS_GetFsInfo(os_fsinfo_t  *filesys_info)
  *-----------------------------------------------------------------*/
 int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
 {
-    uint32 local_id;
+    uint32 i;
     int32 return_code;
     const char *name_ptr;
-    OS_common_record_t *global;
+    const OS_filesys_mount_index_t *entry;
     OS_filesys_internal_record_t *local;
     size_t SysMountPointLen;
     size_t VirtPathLen;
@@ -1134,54 +1219,51 @@ int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
        return OS_FS_ERR_PATH_INVALID;
     }
 
-    /* Get a reference lock, as a filesystem check could take some time. */
-    return_code = OS_ObjectIdGetBySearch(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE,
-            OS_FileSys_FindVirtMountPoint, (void*)VirtualPath, &global);
+    /*
+     * Find the longest mount point that is a prefix of the path.
+     * The index holds the precomputed lengths, so this is only a
+     * handful of compares with the table locked.
+     */
+    return_code = OS_FS_ERR_PATH_INVALID;
+    OS_Lock_Global(LOCAL_OBJID_TYPE);
 
-    if (return_code != OS_SUCCESS)
-    {
-        return_code = OS_FS_ERR_PATH_INVALID;
-    }
-    else
+    for (i = 0; i < OS_filesys_mount_count; ++i)
     {
-        OS_ObjectIdToArrayIndex(LOCAL_OBJID_TYPE, global->active_id, &local_id);
-        local = &OS_filesys_table[local_id];
-
-        if ((local->flags & OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM) != 0)
+        entry = &OS_filesys_mount_index[i];
+        local = &OS_filesys_table[entry->local_id];
+        if (entry->virtual_mountpt_len <= VirtPathLen &&
+                (VirtualPath[entry->virtual_mountpt_len] == '/' ||
+                 VirtualPath[entry->virtual_mountpt_len] == 0) &&
+                strncmp(VirtualPath, local->virtual_mountpt, entry->virtual_mountpt_len) == 0)
         {
-            SysMountPointLen = strlen(local->system_mountpt);
-            VirtPathBegin = strlen(local->virtual_mountpt);
-            if (SysMountPointLen < OS_MAX_LOCAL_PATH_LEN)
+            if ((local->flags & OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM) != 0)
             {
+                SysMountPointLen = entry->system_mountpt_len;
+                VirtPathBegin = entry->virtual_mountpt_len;
                 memcpy(LocalPath, local->system_mountpt, SysMountPointLen);
+                return_code = OS_SUCCESS;
             }
+            else
+            {
+                return_code = OS_ERR_INCORRECT_OBJ_STATE;
+            }
+            break;
         }
-        else
-        {
-            return_code = OS_ERR_INCORRECT_OBJ_STATE;
-        }
-
-        OS_Unlock_Global(LOCAL_OBJID_TYPE);
     }
 
+    OS_Unlock_Global(LOCAL_OBJID_TYPE);
+
     if (return_code == OS_SUCCESS)
     {
-        if (VirtPathLen < VirtPathBegin)
+        VirtPathLen -= VirtPathBegin;
+        if ((SysMountPointLen + VirtPathLen) < OS_MAX_LOCAL_PATH_LEN)
         {
-            return_code = OS_FS_ERR_PATH_INVALID;
+            memcpy(&LocalPath[SysMountPointLen],&VirtualPath[VirtPathBegin], VirtPathLen);
+            LocalPath[SysMountPointLen + VirtPathLen] = 0;
         }
         else
         {
-            VirtPathLen -= VirtPathBegin;
-            if ((SysMountPointLen + VirtPathLen) < OS_MAX_LOCAL_PATH_LEN)
-            {
-                memcpy(&LocalPath[SysMountPointLen],&VirtualPath[VirtPathBegin], VirtPathLen);
-                LocalPath[SysMountPointLen + VirtPathLen] = 0;
-            }
-            else
-            {
-                return_code = OS_FS_ERR_PATH_TOO_LONG;
-            }
+            return_code = OS_FS_ERR_PATH_TOO_LONG;
         }
     }
 
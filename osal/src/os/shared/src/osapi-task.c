@@ -380,6 +380,33 @@ int32 OS_TaskSetPriority (uint32 task_id, uint32 new_priority)
 } /* end OS_TaskSetPriority */
 
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskSetAffinity
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskSetAffinity (uint32 task_id, uint32 cpu_mask)
+{
+   OS_common_record_t *record;
+   int32             return_code;
+   uint32            local_id;
+
+   return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL,LOCAL_OBJID_TYPE, task_id, &local_id, &record);
+   if (return_code == OS_SUCCESS)
+   {
+      return_code = OS_TaskSetAffinity_Impl(local_id, cpu_mask);
+
+      /* Unlock the global from OS_ObjectIdGetAndLock() */
+      OS_Unlock_Global(LOCAL_OBJID_TYPE);
+   }
+
+   return return_code;
+} /* end OS_TaskSetAffinity */
+
+
 
 /*----------------------------------------------------------------
  *
@@ -66,3 +66,20 @@ int32 OS_VxWorks_StreamAPI_Impl_Init(void)
 } /* end OS_VxWorks_StreamAPI_Impl_Init */
 
 
+
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileCopy_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *  No native file-to-file copy is used on this OS; the shared
+ *  layer falls back to a buffered read/write loop.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileCopy_Impl(uint32 dest_local_id, uint32 src_local_id, uint32 nbytes)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_FileCopy_Impl */
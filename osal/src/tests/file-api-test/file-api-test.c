@@ -37,6 +37,7 @@ void TestReadWriteLseek(void);
 void TestMkRmDirFreeBytes(void);
 void TestOpenReadCloseDir(void);
 void TestRename(void);
+void TestCopyMove(void);
 void TestStat(void);
 void TestOpenFileAPI(void);
 void TestUnmountRemount(void);
@@ -82,6 +83,7 @@ void UtTest_Setup(void)
     UtTest_Add(TestOpenFileAPI, NULL, NULL, "TestOpenFileAPI");
     UtTest_Add(TestUnmountRemount, NULL, NULL, "TestUnmountRemount");
     UtTest_Add(TestRename, NULL, NULL, "TestRename");
+    UtTest_Add(TestCopyMove, NULL, NULL, "TestCopyMove");
 }
 
 void TestMkfsMount(void)
@@ -813,6 +815,97 @@ void TestRename(void)
     status = OS_rmdir(newdir1);
     UtAssert_True(status == OS_SUCCESS, "status after rmdir 1 = %d",(int)status);
 }
+/*---------------------------------------------------------------------------------------
+ *  Name TestCopyMove()
+ *
+ *  Copies a file spanning many blocks, moves the copy, and checks that the
+ *  contents read back the same as the original.
+---------------------------------------------------------------------------------------*/
+void TestCopyMove(void)
+{
+    int status;
+    int fd1;
+    int fd2;
+    int i;
+    int total;
+    int size;
+    char filename1[OS_MAX_PATH_LEN];
+    char copyname1[OS_MAX_PATH_LEN];
+    char movename1[OS_MAX_PATH_LEN];
+    char buffer1[1000];
+    char buffer2[1000];
+
+    strcpy(filename1,"/drive1/CopySource");
+    strcpy(copyname1,"/drive1/CopyDest");
+    strcpy(movename1,"/drive1/MoveDest");
+
+    /* write 40 blocks of a pattern that differs in every block */
+    status = OS_creat(filename1,OS_READ_WRITE);
+    UtAssert_True(status >= OS_SUCCESS, "status after creat = %d",(int)status);
+    fd1 = status;
+
+    for (total = 0; total < 40 * (int)sizeof(buffer1); total += sizeof(buffer1))
+    {
+        for (i = 0; i < (int)sizeof(buffer1); ++i)
+        {
+            buffer1[i] = (char)((total + i) * 7 + (total >> 10));
+        }
+
+        status = OS_write(fd1, buffer1, sizeof(buffer1));
+        UtAssert_True(status == sizeof(buffer1), "status after write = %d",(int)status);
+    }
+
+    status = OS_close(fd1);
+    UtAssert_True(status == OS_SUCCESS, "status after close = %d",(int)status);
+
+    status = OS_cp(filename1,copyname1);
+    UtAssert_True(status == OS_SUCCESS, "status after cp = %d",(int)status);
+
+    status = OS_mv(copyname1,movename1);
+    UtAssert_True(status == OS_SUCCESS, "status after mv = %d",(int)status);
+
+    /* compare the moved copy with the original */
+    fd1 = OS_open(filename1,OS_READ_ONLY,0644);
+    UtAssert_True(fd1 >= OS_SUCCESS, "status after open 1 = %d",(int)fd1);
+    fd2 = OS_open(movename1,OS_READ_ONLY,0644);
+    UtAssert_True(fd2 >= OS_SUCCESS, "status after open 2 = %d",(int)fd2);
+
+    total = 0;
+    if (fd1 >= OS_SUCCESS && fd2 >= OS_SUCCESS)
+    {
+        do
+        {
+            size = OS_read(fd1, buffer1, sizeof(buffer1));
+            status = OS_read(fd2, buffer2, sizeof(buffer2));
+            if (size <= 0 || status != size || memcmp(buffer1, buffer2, size) != 0)
+            {
+                break;
+            }
+            total += size;
+        }
+        while (1);
+
+        UtAssert_True(size == 0 && status == 0, "end of both files reached together");
+    }
+
+    UtAssert_True(total == 40 * (int)sizeof(buffer1), "bytes matched = %d",(int)total);
+
+    status = OS_close(fd1);
+    UtAssert_True(status == OS_SUCCESS, "status after close 1 = %d",(int)status);
+    status = OS_close(fd2);
+    UtAssert_True(status == OS_SUCCESS, "status after close 2 = %d",(int)status);
+
+    /* the copy must no longer exist under its original name */
+    fd1 = OS_open(copyname1,OS_READ_ONLY,0644);
+    UtAssert_True(fd1 < OS_SUCCESS, "status after open of moved file = %d",(int)fd1);
+
+    /* note - if this is not done, subsequent runs of this test will fail */
+    status = OS_remove(filename1);
+    UtAssert_True(status == OS_SUCCESS, "status after remove 1 = %d",(int)status);
+    status = OS_remove(movename1);
+    UtAssert_True(status == OS_SUCCESS, "status after remove 2 = %d",(int)status);
+}
+
 /*---------------------------------------------------------------------------------------
  *  Name TestStat()
 ---------------------------------------------------------------------------------------*/
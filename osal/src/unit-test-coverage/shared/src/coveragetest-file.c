@@ -29,6 +29,7 @@
 #include "os-shared-idmap.h"
 
 #include <OCS_string.h>
+#include <OCS_stdlib.h>
 
 /*
 **********************************************************************************
@@ -304,6 +305,117 @@ void Test_OS_cp(void)
 }
 
 
+static uint32 UT_CopyProgressCount;
+static uint32 UT_CopyProgressBytes;
+
+static int32 UT_CopyProgressHandler(uint32 bytes_copied, uint32 total_bytes, void *arg)
+{
+    ++UT_CopyProgressCount;
+    UT_CopyProgressBytes = bytes_copied;
+    return *((int32 *)arg);
+}
+
+static uint8  UT_CopyLargeBuf[1000];
+static uint8  UT_CopySinkBuf[2 * sizeof(UT_CopyLargeBuf)];
+static uint32 UT_CopyNestedCount;
+
+/*
+ * Progress handler that starts a second copy while the first one
+ * still owns the shared copy block
+ */
+static int32 UT_CopyProgressNested(uint32 bytes_copied, uint32 total_bytes, void *arg)
+{
+    int32 ProgressRc = OS_SUCCESS;
+
+    if (UT_CopyNestedCount == 0)
+    {
+        UT_SetDataBuffer(UT_KEY(OS_GenericRead_Impl), UT_CopyLargeBuf, sizeof(UT_CopyLargeBuf), false);
+        *((int32 *)arg) = OS_cpWithProgress("/cf/file3", "/cf/file4", UT_CopyProgressHandler, &ProgressRc);
+    }
+    ++UT_CopyNestedCount;
+    return OS_SUCCESS;
+}
+
+void Test_OS_cpWithProgress(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_cpWithProgress (const char *src, const char *dest,
+     *                          OS_FileCopyProgressFunc_t ProgressFunc, void *ProgressArg)
+     */
+    int32 expected;
+    int32 actual;
+    int32 ProgressRc;
+    int32 NestedRc;
+    char ReadBuf[] = "cpcpcpcp";
+    char WriteBuf[sizeof(ReadBuf)] = "";
+
+    /* native copy succeeds: one chunk then end of file, no buffered I/O */
+    ProgressRc = OS_SUCCESS;
+    UT_CopyProgressCount = 0;
+    UT_CopyProgressBytes = 0;
+    UT_SetDeferredRetcode(UT_KEY(OS_FileCopy_Impl), 1, 1000);
+    UT_SetForceFail(UT_KEY(OS_FileCopy_Impl), 0);
+    expected = OS_SUCCESS;
+    actual = OS_cpWithProgress("/cf/file1", "/cf/file2", UT_CopyProgressHandler, &ProgressRc);
+    UtAssert_True(actual == expected, "OS_cpWithProgress() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(UT_CopyProgressCount == 1, "UT_CopyProgressCount (%lu) == 1", (unsigned long)UT_CopyProgressCount);
+    UtAssert_True(UT_CopyProgressBytes == 1000, "UT_CopyProgressBytes (%lu) == 1000", (unsigned long)UT_CopyProgressBytes);
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_GenericRead_Impl)) == 0, "OS_GenericRead_Impl() not called");
+
+    /* native copy error is passed back */
+    UT_SetForceFail(UT_KEY(OS_FileCopy_Impl), -666);
+    expected = -666;
+    actual = OS_cpWithProgress("/cf/file1", "/cf/file2", UT_CopyProgressHandler, &ProgressRc);
+    UtAssert_True(actual == expected, "OS_cpWithProgress() (%ld) == -666", (long)actual);
+
+    /* progress callback aborts the copy */
+    ProgressRc = -777;
+    UT_SetDeferredRetcode(UT_KEY(OS_FileCopy_Impl), 1, 1000);
+    UT_SetForceFail(UT_KEY(OS_FileCopy_Impl), 0);
+    expected = -777;
+    actual = OS_cpWithProgress("/cf/file1", "/cf/file2", UT_CopyProgressHandler, &ProgressRc);
+    UtAssert_True(actual == expected, "OS_cpWithProgress() (%ld) == -777", (long)actual);
+    UT_ClearForceFail(UT_KEY(OS_FileCopy_Impl));
+
+    /* buffered fallback through the shared copy block, without the heap */
+    ProgressRc = OS_SUCCESS;
+    UT_CopyProgressCount = 0;
+    UT_SetDataBuffer(UT_KEY(OS_GenericRead_Impl), ReadBuf, sizeof(ReadBuf), false);
+    UT_SetDataBuffer(UT_KEY(OS_GenericWrite_Impl), WriteBuf, sizeof(WriteBuf), false);
+    expected = OS_SUCCESS;
+    actual = OS_cpWithProgress("/cf/file1", "/cf/file2", UT_CopyProgressHandler, &ProgressRc);
+    UtAssert_True(actual == expected, "OS_cpWithProgress() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(UT_CopyProgressCount == 1, "UT_CopyProgressCount (%lu) == 1", (unsigned long)UT_CopyProgressCount);
+    UtAssert_True(UT_GetStubCount(UT_KEY(OCS_malloc)) == 0, "malloc() not called");
+    UtAssert_True(memcmp(ReadBuf, WriteBuf, sizeof(ReadBuf)) == 0, "WriteBuf == ReadBuf");
+
+    /* a copy started while the shared block is owned uses the small stack block */
+    UT_ResetState(UT_KEY(OS_GenericRead_Impl));
+    UT_ResetState(UT_KEY(OS_GenericWrite_Impl));
+    UT_CopyProgressCount = 0;
+    UT_CopyNestedCount = 0;
+    NestedRc = -1;
+    UT_SetDataBuffer(UT_KEY(OS_GenericRead_Impl), ReadBuf, sizeof(ReadBuf), false);
+    UT_SetDataBuffer(UT_KEY(OS_GenericWrite_Impl), UT_CopySinkBuf, sizeof(UT_CopySinkBuf), false);
+    expected = OS_SUCCESS;
+    actual = OS_cpWithProgress("/cf/file1", "/cf/file2", UT_CopyProgressNested, &NestedRc);
+    UtAssert_True(actual == expected, "OS_cpWithProgress() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(NestedRc == OS_SUCCESS, "nested OS_cpWithProgress() (%ld) == OS_SUCCESS", (long)NestedRc);
+    UtAssert_True(UT_CopyProgressCount == 2, "nested UT_CopyProgressCount (%lu) == 2", (unsigned long)UT_CopyProgressCount);
+
+    /* once released, the shared block is used again */
+    UT_ResetState(UT_KEY(OS_GenericRead_Impl));
+    UT_ResetState(UT_KEY(OS_GenericWrite_Impl));
+    UT_CopyProgressCount = 0;
+    UT_SetDataBuffer(UT_KEY(OS_GenericRead_Impl), UT_CopyLargeBuf, sizeof(UT_CopyLargeBuf), false);
+    UT_SetDataBuffer(UT_KEY(OS_GenericWrite_Impl), UT_CopySinkBuf, sizeof(UT_CopySinkBuf), false);
+    actual = OS_cpWithProgress("/cf/file3", "/cf/file4", UT_CopyProgressHandler, &ProgressRc);
+    UtAssert_True(actual == expected, "OS_cpWithProgress() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(UT_CopyProgressCount == 1, "UT_CopyProgressCount (%lu) == 1", (unsigned long)UT_CopyProgressCount);
+}
+
+
 void Test_OS_mv(void)
 {
     /*
@@ -468,6 +580,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_remove);
     ADD_TEST(OS_rename);
     ADD_TEST(OS_cp);
+    ADD_TEST(OS_cpWithProgress);
     ADD_TEST(OS_mv);
     ADD_TEST(OS_FDGetInfo);
     ADD_TEST(OS_FileOpenCheck);
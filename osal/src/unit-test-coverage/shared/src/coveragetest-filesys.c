@@ -448,19 +448,55 @@ void Test_OS_TranslatePath(void)
      * Test Case For:
      * int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
      */
-    char LocalBuffer[OS_MAX_PATH_LEN];
+    char LocalBuffer[OS_MAX_LOCAL_PATH_LEN];
     int32 expected = OS_SUCCESS;
     int32 actual = ~OS_SUCCESS;
 
     /* Set up the local record for success */
+    OS_global_filesys_table[1].active_id = 1;
     OS_filesys_table[1].flags = OS_FILESYS_FLAG_IS_READY | OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
     strcpy(OS_filesys_table[1].virtual_mountpt,"/cf");
     strcpy(OS_filesys_table[1].system_mountpt,"/mnt/cf");
+    OS_FileSys_UpdateMountIndex();
 
     actual = OS_TranslatePath("/cf/test",LocalBuffer);
     UtAssert_True(actual == expected, "OS_TranslatePath(/cf/test) (%ld) == OS_SUCCESS", (long)actual);
     UtAssert_True(strcmp(LocalBuffer,"/mnt/cf/test") == 0, "OS_TranslatePath(/cf/test) (%s)  == /mnt/cf/test", LocalBuffer);
 
+    /* The mount point itself translates too */
+    actual = OS_TranslatePath("/cf/",LocalBuffer);
+    UtAssert_True(actual == expected, "OS_TranslatePath(/cf/) (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(strcmp(LocalBuffer,"/mnt/cf/") == 0, "OS_TranslatePath(/cf/) (%s)  == /mnt/cf/", LocalBuffer);
+
+    /* A nested mount point takes precedence over its parent, regardless of table order */
+    OS_global_filesys_table[0].active_id = 1;
+    OS_filesys_table[0].flags = OS_FILESYS_FLAG_IS_READY | OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
+    strcpy(OS_filesys_table[0].virtual_mountpt,"/cf/apps");
+    strcpy(OS_filesys_table[0].system_mountpt,"/mnt/apps");
+    OS_global_filesys_table[2].active_id = 1;
+    OS_filesys_table[2].flags = OS_FILESYS_FLAG_IS_READY | OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
+    strcpy(OS_filesys_table[2].virtual_mountpt,"/c");
+    strcpy(OS_filesys_table[2].system_mountpt,"/mnt/c");
+    OS_FileSys_UpdateMountIndex();
+
+    actual = OS_TranslatePath("/cf/apps/test",LocalBuffer);
+    UtAssert_True(actual == expected, "OS_TranslatePath(/cf/apps/test) (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(strcmp(LocalBuffer,"/mnt/apps/test") == 0, "OS_TranslatePath(/cf/apps/test) (%s)  == /mnt/apps/test", LocalBuffer);
+    actual = OS_TranslatePath("/cf/appsx",LocalBuffer);
+    UtAssert_True(actual == expected, "OS_TranslatePath(/cf/appsx) (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(strcmp(LocalBuffer,"/mnt/cf/appsx") == 0, "OS_TranslatePath(/cf/appsx) (%s)  == /mnt/cf/appsx", LocalBuffer);
+    actual = OS_TranslatePath("/c/test",LocalBuffer);
+    UtAssert_True(actual == expected, "OS_TranslatePath(/c/test) (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(strcmp(LocalBuffer,"/mnt/c/test") == 0, "OS_TranslatePath(/c/test) (%s)  == /mnt/c/test", LocalBuffer);
+
+    /* Removing an entry takes it out of the index */
+    OS_global_filesys_table[0].active_id = 0;
+    OS_global_filesys_table[2].active_id = 0;
+    OS_FileSys_UpdateMountIndex();
+    actual = OS_TranslatePath("/cf/apps/test",LocalBuffer);
+    UtAssert_True(actual == expected, "OS_TranslatePath(/cf/apps/test) (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(strcmp(LocalBuffer,"/mnt/cf/apps/test") == 0, "OS_TranslatePath(/cf/apps/test) (%s)  == /mnt/cf/apps/test", LocalBuffer);
+
     /* Check various error paths */
     expected = OS_INVALID_POINTER;
     actual = OS_TranslatePath(NULL, NULL);
@@ -487,28 +523,33 @@ void Test_OS_TranslatePath(void)
     actual = OS_TranslatePath("invalid/",LocalBuffer);
     UtAssert_True(actual == expected, "OS_TranslatePath() (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
 
-    UT_SetForceFail(UT_KEY(OS_ObjectIdGetBySearch), OS_ERR_NAME_NOT_FOUND);
-    actual = OS_TranslatePath("/cf/test",LocalBuffer);
-    UtAssert_True(actual == expected, "OS_TranslatePath() (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
-    UT_ClearForceFail(UT_KEY(OS_ObjectIdGetBySearch));
-
-   /* VirtPathLen < VirtPathBegin */
-    UT_SetDeferredRetcode(UT_KEY(OCS_strlen), 4, OS_MAX_PATH_LEN);
-    expected = OS_FS_ERR_PATH_INVALID;
-    actual = OS_TranslatePath("/cf/test",LocalBuffer);
-    UtAssert_True(actual == expected, "OS_TranslatePath(/cf/test) (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
+    /* No matching mount point */
+    actual = OS_TranslatePath("/ram/test",LocalBuffer);
+    UtAssert_True(actual == expected, "OS_TranslatePath(/ram/test) (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
+    actual = OS_TranslatePath("/cfx/test",LocalBuffer);
+    UtAssert_True(actual == expected, "OS_TranslatePath(/cfx/test) (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
 
     /* (SysMountPointLen + VirtPathLen) > OS_MAX_LOCAL_PATH_LEN */
-    UT_SetDeferredRetcode(UT_KEY(OCS_strlen), 3, OS_MAX_LOCAL_PATH_LEN);
+    memset(OS_filesys_table[1].system_mountpt, 'x', sizeof(OS_filesys_table[1].system_mountpt) - 4);
+    OS_filesys_table[1].system_mountpt[sizeof(OS_filesys_table[1].system_mountpt) - 4] = 0;
+    OS_FileSys_UpdateMountIndex();
     expected = OS_FS_ERR_PATH_TOO_LONG;
     actual = OS_TranslatePath("/cf/test",LocalBuffer);
     UtAssert_True(actual == expected, "OS_TranslatePath(/cf/test) (%ld) == OS_FS_ERR_PATH_TOO_LONG", (long)actual);
- 
-    OS_filesys_table[1].flags = 0;
+
+    OS_filesys_table[1].flags = OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
     expected = OS_ERR_INCORRECT_OBJ_STATE;
     actual = OS_TranslatePath("/cf/test",LocalBuffer);
     UtAssert_True(actual == expected, "OS_TranslatePath(/cf/test) (%ld) == OS_ERR_INCORRECT_OBJ_STATE", (long)actual);
 
+    /* Unmounted entries are not indexed */
+    OS_filesys_table[1].flags = 0;
+    OS_FileSys_UpdateMountIndex();
+    expected = OS_FS_ERR_PATH_INVALID;
+    actual = OS_TranslatePath("/cf/test",LocalBuffer);
+    UtAssert_True(actual == expected, "OS_TranslatePath(/cf/test) (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
+
+    OS_global_filesys_table[1].active_id = 0;
 }
 
 void Test_OS_FileSys_FindVirtMountPoint(void)
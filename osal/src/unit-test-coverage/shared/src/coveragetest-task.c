@@ -195,6 +195,21 @@ void Test_OS_TaskSetPriority(void)
 
     OSAPI_TEST_FUNCTION_RC(OS_TaskSetPriority(1, 10 + OS_MAX_TASK_PRIORITY), OS_ERR_INVALID_PRIORITY);
 }
+void Test_OS_TaskSetAffinity(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TaskSetAffinity (uint32 task_id, uint32 cpu_mask)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity(1, 0x3), OS_SUCCESS);
+
+    UT_SetForceFail(UT_KEY(OS_TaskSetAffinity_Impl), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity(1, 0x3), OS_ERR_NOT_IMPLEMENTED);
+    UT_ClearForceFail(UT_KEY(OS_TaskSetAffinity_Impl));
+
+    UT_SetForceFail(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity(1, 0x3), OS_ERR_INVALID_ID);
+}
 void Test_OS_TaskRegister(void)
 {
     /*
@@ -380,6 +395,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TaskExit);
     ADD_TEST(OS_TaskDelay);
     ADD_TEST(OS_TaskSetPriority);
+    ADD_TEST(OS_TaskSetAffinity);
     ADD_TEST(OS_TaskRegister);
     ADD_TEST(OS_TaskGetId);
     ADD_TEST(OS_TaskGetIdByName);
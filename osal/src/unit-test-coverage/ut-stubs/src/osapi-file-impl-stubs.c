@@ -47,6 +47,15 @@ UT_DEFAULT_STUB(OS_FileRename_Impl,(const char *old_path, const char *new_path))
 UT_DEFAULT_STUB(OS_FileChmod_Impl, (const char *local_path, uint32 access))
 UT_DEFAULT_STUB(OS_ShellOutputToFile_Impl,(uint32 file_id, const char* Cmd))
 
+/*
+ * The native copy is optional; default to "not implemented" so that
+ * callers exercise their buffered fallback unless a test says otherwise.
+ */
+int32 OS_FileCopy_Impl(uint32 dest_local_id, uint32 src_local_id, uint32 nbytes)
+{
+    return UT_DEFAULT_IMPL_RC(OS_FileCopy_Impl, OS_ERR_NOT_IMPLEMENTED);
+}
+
 /*
  * Directory API abstraction layer
  */
@@ -48,6 +48,7 @@ void OS_TaskExit_Impl               (void)
 
 UT_DEFAULT_STUB(OS_TaskDelay_Impl,(uint32 millisecond))
 UT_DEFAULT_STUB(OS_TaskSetPriority_Impl,(uint32 task_id, uint32 new_priority))
+UT_DEFAULT_STUB(OS_TaskSetAffinity_Impl,(uint32 task_id, uint32 cpu_mask))
 uint32 OS_TaskGetId_Impl            (void)
 {
     return UT_DEFAULT_IMPL(OS_TaskGetId_Impl);
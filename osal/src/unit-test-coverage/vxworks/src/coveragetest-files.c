@@ -44,6 +44,15 @@ void Test_OS_VxWorks_StreamAPI_Impl_Init(void)
     OSAPI_TEST_FUNCTION_RC(UT_Call_OS_VxWorks_StreamAPI_Impl_Init(), OS_SUCCESS);
 }
 
+void Test_OS_FileCopy_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileCopy_Impl(uint32 dest_local_id, uint32 src_local_id, uint32 nbytes)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopy_Impl(0, 1, 4096), OS_ERR_NOT_IMPLEMENTED);
+}
+
 
 /* ------------------- End of test cases --------------------------------------*/
 
@@ -76,6 +85,7 @@ void Osapi_Test_Teardown(void)
 void UtTest_Setup(void)
 {
     ADD_TEST(OS_VxWorks_StreamAPI_Impl_Init);
+    ADD_TEST(OS_FileCopy_Impl);
 }
 
 
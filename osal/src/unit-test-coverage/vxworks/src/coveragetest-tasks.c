@@ -161,6 +161,15 @@ void Test_OS_TaskSetPriority_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_TaskSetPriority_Impl(0, 100), OS_ERROR);
 }
 
+void Test_OS_TaskSetAffinity_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TaskSetAffinity_Impl (uint32 task_id, uint32 cpu_mask)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity_Impl(0, 0x1), OS_ERR_NOT_IMPLEMENTED);
+}
+
 void Test_OS_TaskRegister_Impl(void)
 {
     /*
@@ -270,6 +279,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TaskExit_Impl);
     ADD_TEST(OS_TaskDelay_Impl);
     ADD_TEST(OS_TaskSetPriority_Impl);
+    ADD_TEST(OS_TaskSetAffinity_Impl);
     ADD_TEST(OS_TaskRegister_Impl);
     ADD_TEST(OS_TaskGetId_Impl);
     ADD_TEST(OS_TaskGetInfo_Impl);
@@ -1749,6 +1749,266 @@ UT_os_copyfile_test_exit_tag:
     
 }
 
+/*--------------------------------------------------------------------------------*
+** Helpers for the OS_cpWithProgress() test
+**--------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    uint32 Calls;
+    uint32 LastCopied;
+    uint32 LastTotal;
+    uint32 AbortAfter;
+} UT_os_copyprogress_t;
+
+static int32 UT_os_copyprogress_handler(uint32 bytes_copied, uint32 total_bytes, void *arg)
+{
+    UT_os_copyprogress_t *progress = arg;
+
+    ++progress->Calls;
+    progress->LastCopied = bytes_copied;
+    progress->LastTotal = total_bytes;
+
+    if (progress->AbortAfter > 0 && progress->Calls >= progress->AbortAfter)
+    {
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*
+ * Writes "size" bytes of a position-dependent pattern at "offset" in an open file
+ */
+static int32 UT_os_write_pattern(int32 fd, uint32 offset, uint32 size)
+{
+    uint8  block[1024];
+    uint32 i;
+    uint32 chunk;
+
+    if (OS_lseek(fd, offset, OS_SEEK_SET) != (int32)offset)
+    {
+        return OS_ERROR;
+    }
+
+    while (size > 0)
+    {
+        chunk = (size < sizeof(block)) ? size : sizeof(block);
+        for (i = 0; i < chunk; ++i)
+        {
+            block[i] = (uint8)((offset + i) * 7 + ((offset + i) >> 12));
+        }
+        if (OS_write(fd, block, chunk) != (int32)chunk)
+        {
+            return OS_ERROR;
+        }
+        offset += chunk;
+        size -= chunk;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*
+ * Compares two files byte-for-byte, including their sizes
+ */
+static int32 UT_os_compare_files(const char *name1, const char *name2)
+{
+    uint8  block1[1024];
+    uint8  block2[1024];
+    int32  fd1;
+    int32  fd2;
+    int32  rd1;
+    int32  rd2;
+    int32  res;
+
+    res = OS_ERROR;
+    fd1 = OS_open(name1, OS_READ_ONLY, 0);
+    fd2 = OS_open(name2, OS_READ_ONLY, 0);
+
+    if (fd1 >= 0 && fd2 >= 0)
+    {
+        do
+        {
+            rd1 = OS_read(fd1, block1, sizeof(block1));
+            rd2 = OS_read(fd2, block2, sizeof(block2));
+        }
+        while (rd1 > 0 && rd1 == rd2 && memcmp(block1, block2, rd1) == 0);
+
+        if (rd1 == 0 && rd2 == 0)
+        {
+            res = OS_SUCCESS;
+        }
+    }
+
+    if (fd1 >= 0)
+    {
+        OS_close(fd1);
+    }
+    if (fd2 >= 0)
+    {
+        OS_close(fd2);
+    }
+
+    return res;
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_cpWithProgress(const char *src, const char *dest,
+**                                 OS_FileCopyProgressFunc_t ProgressFunc, void *ProgressArg)
+** Purpose: Copies the given file to a new specified file, reporting progress
+** Parameters: *src - pointer to the absolute path of the file to be copied
+**             *dest - pointer to the absolute path of the new file
+**             ProgressFunc - called after each block is copied (may be NULL)
+**             *ProgressArg - opaque argument passed to ProgressFunc
+** Returns: As OS_cp(), or the value returned by ProgressFunc if it aborts the copy
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Sparse-file condition
+**   1) Create a file with data at the start and end and an unwritten hole between
+**   2) Call this routine to copy it
+**   3) Expect the returned value to be
+**        (a) OS_SUCCESS
+**   4) Expect the copy to be the same size and contents as the original,
+**      with the hole reading back as zeros
+** -----------------------------------------------------
+** Test #3: Large-file condition
+**   1) Create a file spanning many copy blocks
+**   2) Call this routine to copy it
+**   3) Expect the returned value to be
+**        (a) OS_SUCCESS
+**   4) Expect the progress function to have been called, finishing with the
+**      number of bytes copied equal to the file size
+**   5) Expect the copy to be the same size and contents as the original
+** -----------------------------------------------------
+** Test #4: Progress-abort condition
+**   1) Call this routine on the file from #3 with a progress function that
+**      returns OS_ERROR on its first call
+**   2) Expect the returned value to be
+**        (a) OS_ERROR
+**--------------------------------------------------------------------------------*/
+void UT_os_copyfile_progress_test()
+{
+    /* Spans several native and buffered copy blocks */
+    enum { UT_OS_CP_LARGE_SIZE = 4 * 1024 * 1024 + 1234 };
+
+    UT_os_copyprogress_t progress;
+    os_fstat_t fstats1;
+    os_fstat_t fstats2;
+    const char* testDesc;
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if ((OS_cpWithProgress(NULL, "/any", NULL, NULL) == OS_INVALID_POINTER) &&
+        (OS_cpWithProgress("/any", NULL, NULL, NULL) == OS_INVALID_POINTER))
+        UT_OS_TEST_RESULT( testDesc, UTASSERT_CASETYPE_PASS);
+    else
+        UT_OS_TEST_RESULT( testDesc, UTASSERT_CASETYPE_FAILURE);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Sparse-file";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    memset(g_fNames[1], '\0', sizeof(g_fNames[1]));
+    UT_os_sprintf(g_fNames[0], "%s/Cp_Sparse_Old.dat", g_mntName);
+    UT_os_sprintf(g_fNames[1], "%s/Cp_Sparse_New.dat", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#2 Sparse-file - File-create failed";
+        UT_OS_TEST_RESULT( testDesc, UTASSERT_CASETYPE_TSF);
+        goto UT_os_copyfile_progress_test_exit_tag;
+    }
+
+    if (UT_os_write_pattern(g_fDescs[0], 0, 100) != OS_SUCCESS ||
+        UT_os_write_pattern(g_fDescs[0], 3 * OS_FILE_COPY_BLOCK_SIZE + 17, 100) != OS_SUCCESS)
+    {
+        OS_close(g_fDescs[0]);
+        testDesc = "#2 Sparse-file - File-write failed";
+        UT_OS_TEST_RESULT( testDesc, UTASSERT_CASETYPE_TSF);
+        goto UT_os_copyfile_progress_test_exit_tag;
+    }
+
+    OS_close(g_fDescs[0]);
+
+    if (OS_cpWithProgress(g_fNames[0], g_fNames[1], NULL, NULL) == OS_SUCCESS &&
+        OS_stat(g_fNames[0], &fstats1) == OS_SUCCESS &&
+        OS_stat(g_fNames[1], &fstats2) == OS_SUCCESS &&
+        OS_FILESTAT_SIZE(fstats1) == OS_FILESTAT_SIZE(fstats2) &&
+        UT_os_compare_files(g_fNames[0], g_fNames[1]) == OS_SUCCESS)
+        UT_OS_TEST_RESULT( testDesc, UTASSERT_CASETYPE_PASS);
+    else
+        UT_OS_TEST_RESULT( testDesc, UTASSERT_CASETYPE_FAILURE);
+
+    OS_remove(g_fNames[0]);
+    OS_remove(g_fNames[1]);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Large-file";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    memset(g_fNames[1], '\0', sizeof(g_fNames[1]));
+    UT_os_sprintf(g_fNames[0], "%s/Cp_Large_Old.dat", g_mntName);
+    UT_os_sprintf(g_fNames[1], "%s/Cp_Large_New.dat", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#3 Large-file - File-create failed";
+        UT_OS_TEST_RESULT( testDesc, UTASSERT_CASETYPE_TSF);
+        goto UT_os_copyfile_progress_test_exit_tag;
+    }
+
+    if (UT_os_write_pattern(g_fDescs[0], 0, UT_OS_CP_LARGE_SIZE) != OS_SUCCESS)
+    {
+        /* e.g. a small RAM disk on an RTOS */
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+        testDesc = "#3 Large-file - File-write failed";
+        UT_OS_TEST_RESULT( testDesc, UTASSERT_CASETYPE_TSF);
+        goto UT_os_copyfile_progress_test_exit_tag;
+    }
+
+    OS_close(g_fDescs[0]);
+
+    memset(&progress, 0, sizeof(progress));
+    if (OS_cpWithProgress(g_fNames[0], g_fNames[1], UT_os_copyprogress_handler, &progress) == OS_SUCCESS &&
+        progress.Calls > 0 &&
+        progress.LastCopied == UT_OS_CP_LARGE_SIZE &&
+        progress.LastTotal == UT_OS_CP_LARGE_SIZE &&
+        UT_os_compare_files(g_fNames[0], g_fNames[1]) == OS_SUCCESS)
+        UT_OS_TEST_RESULT( testDesc, UTASSERT_CASETYPE_PASS);
+    else
+        UT_OS_TEST_RESULT( testDesc, UTASSERT_CASETYPE_FAILURE);
+
+    OS_remove(g_fNames[1]);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Progress-abort";
+
+    memset(&progress, 0, sizeof(progress));
+    progress.AbortAfter = 1;
+    if (OS_cpWithProgress(g_fNames[0], g_fNames[1], UT_os_copyprogress_handler, &progress) == OS_ERROR &&
+        progress.Calls == 1)
+        UT_OS_TEST_RESULT( testDesc, UTASSERT_CASETYPE_PASS);
+    else
+        UT_OS_TEST_RESULT( testDesc, UTASSERT_CASETYPE_FAILURE);
+
+    /* Reset test environment */
+    OS_remove(g_fNames[0]);
+    OS_remove(g_fNames[1]);
+
+UT_os_copyfile_progress_test_exit_tag:
+    return;
+
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: int32 OS_mv(const char *src, const char *dest)
 ** Purpose: Moves the given file to a new specified file
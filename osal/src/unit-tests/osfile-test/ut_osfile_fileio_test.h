@@ -69,6 +69,7 @@ void UT_os_statfile_test(void);
 void UT_os_removefile_test(void);
 void UT_os_renamefile_test(void);
 void UT_os_copyfile_test(void);
+void UT_os_copyfile_progress_test(void);
 void UT_os_movefile_test(void);
 
 void UT_os_outputtofile_test(void);
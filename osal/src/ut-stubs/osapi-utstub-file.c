@@ -361,6 +361,25 @@ int32 OS_cp (const char *src, const char *dest)
     return Status;
 }
 
+/*****************************************************************************
+ *
+ * Stub function for OS_cpWithProgress()
+ *
+ *****************************************************************************/
+int32 OS_cpWithProgress (const char *src, const char *dest,
+                         OS_FileCopyProgressFunc_t ProgressFunc, void *ProgressArg)
+{
+    UT_Stub_RegisterContext(UT_KEY(OS_cpWithProgress), src);
+    UT_Stub_RegisterContext(UT_KEY(OS_cpWithProgress), dest);
+    UT_Stub_RegisterContext(UT_KEY(OS_cpWithProgress), ProgressArg);
+
+    int32 Status;
+
+    Status = UT_DEFAULT_IMPL(OS_cpWithProgress);
+
+    return Status;
+}
+
 /*****************************************************************************
  *
  * Stub function for OS_mv()
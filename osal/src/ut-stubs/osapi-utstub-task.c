@@ -183,6 +183,23 @@ int32 OS_TaskSetPriority (uint32 task_id, uint32 new_priority)
     return status;
 }
 
+/*****************************************************************************
+ *
+ * Stub function for OS_TaskSetAffinity()
+ *
+ *****************************************************************************/
+int32 OS_TaskSetAffinity (uint32 task_id, uint32 cpu_mask)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_TaskSetAffinity), task_id);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_TaskSetAffinity), cpu_mask);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_TaskSetAffinity);
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief OS_TaskRegister stub function
@@ -0,0 +1,616 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     tlm_archive.c
+ * \ingroup  cfecfs
+ *
+ * Batch decoder for recorded telemetry archives
+ *
+ * Reads telemetry packets from capture files and writes the decoded content
+ * as CSV, one output file per message type, with one row per packet and one
+ * column per field.  This uses the same identification and decoding steps as
+ * the tlm_decode utility, but operates on files rather than a live socket.
+ *
+ * Two input formats are accepted, and detected automatically:
+ *  - pcap capture files (classic format), where each UDP datagram over IPv4
+ *    contains a single telemetry packet, as sent by TO_LAB.
+ *  - raw files containing a contiguous stream of CCSDS space packets, where
+ *    the length of each packet is taken from its primary header.
+ *
+ * Input files are memory mapped and indexed in a single pass, after which the
+ * packets are decoded by a set of worker threads.  Each worker handles a
+ * contiguous range of packets and writes to its own set of output files, which
+ * are concatenated in order afterward so the rows remain in archive order.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <getopt.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include <cfe_mission_cfg.h>
+#include "ccsds_spacepacket_eds_typedefs.h"
+#include "cfe_sb_eds_typedefs.h"
+#include "cfe_mission_eds_parameters.h"
+#include "cfe_mission_eds_interface_parameters.h"
+#include "edslib_displaydb.h"
+#include "cfe_missionlib_runtime.h"
+#include "cfe_missionlib_api.h"
+#include "tlm_archive_io.h"
+
+
+#define TLM_ARCHIVE_MAX_WORKERS         64
+#define TLM_ARCHIVE_OUTPUT_BUFSIZE      (256 * 1024)
+
+typedef struct
+{
+    EdsLib_Id_t EdsId;
+    FILE *OutputFile;
+} TlmArchive_Output_t;
+
+typedef struct
+{
+    pthread_t Thread;
+    unsigned int WorkerNum;
+    const TlmArchive_Packet_t *PacketList;
+    size_t StartIndex;
+    size_t EndIndex;
+    TlmArchive_Output_t *OutputList;
+    size_t NumOutputs;
+    unsigned long DecodeCount;
+    unsigned long UnknownCount;
+    unsigned long VerifyFailCount;
+    int Error;
+} TlmArchive_Worker_t;
+
+typedef struct
+{
+    FILE *OutputFile;
+    const uint8_t *BasePtr;
+} TlmArchive_RowState_t;
+
+/*
+ * Types for which an output file has already been started during this run.
+ * Subsequent input files append to these rather than starting a new file.
+ */
+static EdsLib_Id_t *TlmArchive_StartedTypes = NULL;
+static size_t TlmArchive_NumStartedTypes = 0;
+
+static const char *TlmArchive_OutputDir = ".";
+static EdsLib_DataTypeDB_TypeInfo_t TlmArchive_HeaderTypeInfo;
+
+static const char *optString = "j:o:?";
+
+/*
+** getopts_long long form argument table
+*/
+static struct option longOpts[] = {
+    { "jobs",      required_argument, NULL, 'j' },
+    { "outdir",    required_argument, NULL, 'o' },
+    { "help",      no_argument,       NULL, '?' },
+    { NULL,        no_argument,       NULL, 0   }
+};
+
+
+static void TlmArchive_Usage(const char *ProgName)
+{
+    fprintf(stderr, "Usage: %s [options] <file> [<file> ...]\n", ProgName);
+    fprintf(stderr, "  -j, --jobs=N       number of decode threads (default: number of CPUs)\n");
+    fprintf(stderr, "  -o, --outdir=DIR   directory for output CSV files (default: current directory)\n");
+    fprintf(stderr, "Input files may be pcap captures of UDP telemetry or raw CCSDS packet streams.\n");
+}
+
+static void TlmArchive_WriteHeaderField(void *Arg, const EdsLib_EntityDescriptor_t *Param)
+{
+    FILE *OutputFile = Arg;
+
+    if (Param->FullName != NULL)
+    {
+        fprintf(OutputFile, ",%s", Param->FullName);
+    }
+}
+
+static void TlmArchive_WriteValueField(void *Arg, const EdsLib_EntityDescriptor_t *Param)
+{
+    TlmArchive_RowState_t *State = Arg;
+    char OutputBuffer[256];
+
+    if (Param->FullName == NULL)
+    {
+        return;
+    }
+
+    EdsLib_Scalar_ToString(&EDS_DATABASE, Param->EntityInfo.EdsId, OutputBuffer, sizeof(OutputBuffer),
+            State->BasePtr + Param->EntityInfo.Offset.Bytes);
+
+    /* string values are quoted in case they contain a separator */
+    if (strpbrk(OutputBuffer, ",\"\n") != NULL)
+    {
+        char *Quote;
+        char *Pos;
+
+        fputs(",\"", State->OutputFile);
+        Pos = OutputBuffer;
+        while ((Quote = strchr(Pos, '"')) != NULL)
+        {
+            fwrite(Pos, 1, Quote - Pos + 1, State->OutputFile);
+            fputc('"', State->OutputFile);
+            Pos = Quote + 1;
+        }
+        fputs(Pos, State->OutputFile);
+        fputc('"', State->OutputFile);
+    }
+    else
+    {
+        fputc(',', State->OutputFile);
+        fputs(OutputBuffer, State->OutputFile);
+    }
+}
+
+static void TlmArchive_GetFileName(char *FileName, size_t FileNameSize, EdsLib_Id_t EdsId, int WorkerNum)
+{
+    char TypeName[128];
+    char *Pos;
+
+    if (EdsLib_DisplayDB_GetTypeName(&EDS_DATABASE, EdsId, TypeName, sizeof(TypeName)) == NULL)
+    {
+        snprintf(TypeName, sizeof(TypeName), "%08lx", (unsigned long)EdsId);
+    }
+
+    /* namespace separators are not valid in a file name */
+    for (Pos = TypeName; *Pos != 0; ++Pos)
+    {
+        if (*Pos == '/')
+        {
+            *Pos = '.';
+        }
+    }
+
+    if (WorkerNum < 0)
+    {
+        snprintf(FileName, FileNameSize, "%s/%s.csv", TlmArchive_OutputDir, TypeName);
+    }
+    else
+    {
+        snprintf(FileName, FileNameSize, "%s/%s.csv.part%d", TlmArchive_OutputDir, TypeName, WorkerNum);
+    }
+}
+
+static FILE *TlmArchive_GetWorkerOutput(TlmArchive_Worker_t *Worker, EdsLib_Id_t EdsId)
+{
+    TlmArchive_Output_t *NewList;
+    TlmArchive_Output_t *Output;
+    char FileName[512];
+    size_t i;
+
+    for (i = 0; i < Worker->NumOutputs; ++i)
+    {
+        if (Worker->OutputList[i].EdsId == EdsId)
+        {
+            return Worker->OutputList[i].OutputFile;
+        }
+    }
+
+    NewList = realloc(Worker->OutputList, (Worker->NumOutputs + 1) * sizeof(*NewList));
+    if (NewList == NULL)
+    {
+        return NULL;
+    }
+    Worker->OutputList = NewList;
+
+    TlmArchive_GetFileName(FileName, sizeof(FileName), EdsId, Worker->WorkerNum);
+    Output = &Worker->OutputList[Worker->NumOutputs];
+    Output->EdsId = EdsId;
+    Output->OutputFile = fopen(FileName, "w");
+    if (Output->OutputFile == NULL)
+    {
+        perror(FileName);
+        return NULL;
+    }
+    setvbuf(Output->OutputFile, NULL, _IOFBF, TLM_ARCHIVE_OUTPUT_BUFSIZE);
+    ++Worker->NumOutputs;
+
+    return Output->OutputFile;
+}
+
+static void *TlmArchive_WorkerThread(void *Arg)
+{
+    TlmArchive_Worker_t *Worker = Arg;
+    const TlmArchive_Packet_t *Pkt;
+    CCSDS_SpacePacket_Buffer_t LocalBuffer;
+    CFE_SB_SoftwareBus_PubSub_Interface_t PubSubParams;
+    CFE_SB_Publisher_Component_t PublisherParams;
+    TlmArchive_RowState_t RowState;
+    EdsLib_Id_t EdsId;
+    size_t Idx;
+    int32_t Status;
+
+    RowState.BasePtr = LocalBuffer.Byte;
+
+    for (Idx = Worker->StartIndex; Idx < Worker->EndIndex; ++Idx)
+    {
+        Pkt = &Worker->PacketList[Idx];
+
+        /* First decode the headers to determine the topic, then the remainder based on that */
+        EdsId = EDSLIB_MAKE_ID(EDS_INDEX(CCSDS_SPACEPACKET), CCSDS_TelemetryPacket_DATADICTIONARY);
+        Status = EdsLib_DataTypeDB_UnpackPartialObject(&EDS_DATABASE, &EdsId,
+                LocalBuffer.Byte, Pkt->Data, sizeof(LocalBuffer), 8 * Pkt->Length, 0);
+        if (Status == EDSLIB_SUCCESS)
+        {
+            CFE_SB_Get_PubSub_Parameters(&PubSubParams, &LocalBuffer.BaseObject);
+            CFE_SB_UnmapPublisherComponent(&PublisherParams, &PubSubParams);
+
+            Status = CFE_MissionLib_GetArgumentType(&CFE_SOFTWAREBUS_INTERFACE, CFE_SB_Telemetry_Interface_ID,
+                    PublisherParams.Telemetry.TopicId, 1, 1, &EdsId);
+        }
+        if (Status == EDSLIB_SUCCESS)
+        {
+            Status = EdsLib_DataTypeDB_UnpackPartialObject(&EDS_DATABASE, &EdsId, LocalBuffer.Byte, Pkt->Data,
+                    sizeof(LocalBuffer), 8 * Pkt->Length, TlmArchive_HeaderTypeInfo.Size.Bytes);
+        }
+        if (Status != EDSLIB_SUCCESS)
+        {
+            ++Worker->UnknownCount;
+            continue;
+        }
+
+        if (EdsLib_DataTypeDB_VerifyUnpackedObject(&EDS_DATABASE, EdsId, LocalBuffer.Byte,
+                Pkt->Data, EDSLIB_DATATYPEDB_RECOMPUTE_NONE) != EDSLIB_SUCCESS)
+        {
+            ++Worker->VerifyFailCount;
+        }
+
+        RowState.OutputFile = TlmArchive_GetWorkerOutput(Worker, EdsId);
+        if (RowState.OutputFile == NULL)
+        {
+            Worker->Error = 1;
+            break;
+        }
+
+        fprintf(RowState.OutputFile, "%lu,%lu.%06lu", (unsigned long)Idx,
+                (unsigned long)Pkt->TimeSec, (unsigned long)Pkt->TimeUsec);
+        EdsLib_DisplayDB_IterateAllEntities(&EDS_DATABASE, EdsId, TlmArchive_WriteValueField, &RowState);
+        fputc('\n', RowState.OutputFile);
+        ++Worker->DecodeCount;
+    }
+
+    for (Idx = 0; Idx < Worker->NumOutputs; ++Idx)
+    {
+        if (fclose(Worker->OutputList[Idx].OutputFile) != 0)
+        {
+            Worker->Error = 1;
+        }
+        Worker->OutputList[Idx].OutputFile = NULL;
+    }
+
+    return NULL;
+}
+
+/*
+ * Append the per-worker part files for a given type onto the final output file,
+ * in worker order, and remove the parts.
+ */
+static int TlmArchive_MergeOutput(TlmArchive_Worker_t *WorkerList, unsigned int NumWorkers, EdsLib_Id_t EdsId)
+{
+    char FileName[512];
+    FILE *OutputFile;
+    FILE *PartFile;
+    size_t i;
+    unsigned int w;
+    int IsStarted;
+    int Result;
+
+    Result = 0;
+    IsStarted = 0;
+    for (i = 0; i < TlmArchive_NumStartedTypes; ++i)
+    {
+        if (TlmArchive_StartedTypes[i] == EdsId)
+        {
+            IsStarted = 1;
+            break;
+        }
+    }
+
+    TlmArchive_GetFileName(FileName, sizeof(FileName), EdsId, -1);
+    OutputFile = fopen(FileName, IsStarted ? "a" : "w");
+    if (OutputFile == NULL)
+    {
+        perror(FileName);
+        return -1;
+    }
+
+    if (!IsStarted)
+    {
+        EdsLib_Id_t *NewList = realloc(TlmArchive_StartedTypes, (TlmArchive_NumStartedTypes + 1) * sizeof(*NewList));
+        if (NewList == NULL)
+        {
+            fclose(OutputFile);
+            return -1;
+        }
+        TlmArchive_StartedTypes = NewList;
+        TlmArchive_StartedTypes[TlmArchive_NumStartedTypes] = EdsId;
+        ++TlmArchive_NumStartedTypes;
+
+        fputs("PacketIndex,CaptureTime", OutputFile);
+        EdsLib_DisplayDB_IterateAllEntities(&EDS_DATABASE, EdsId, TlmArchive_WriteHeaderField, OutputFile);
+        fputc('\n', OutputFile);
+    }
+
+    for (w = 0; w < NumWorkers; ++w)
+    {
+        for (i = 0; i < WorkerList[w].NumOutputs; ++i)
+        {
+            if (WorkerList[w].OutputList[i].EdsId == EdsId)
+            {
+                break;
+            }
+        }
+        if (i >= WorkerList[w].NumOutputs)
+        {
+            continue;
+        }
+
+        TlmArchive_GetFileName(FileName, sizeof(FileName), EdsId, w);
+        PartFile = fopen(FileName, "r");
+        if (PartFile == NULL)
+        {
+            perror(FileName);
+            continue;
+        }
+        if (TlmArchive_AppendFile(OutputFile, PartFile) != 0)
+        {
+            /* keep the part file so the data is not lost */
+            fprintf(stderr, "%s: failed to append to output: %s\n", FileName, strerror(errno));
+            fclose(PartFile);
+            Result = -1;
+            continue;
+        }
+        fclose(PartFile);
+        remove(FileName);
+
+        /* mark as merged so later workers do not repeat it */
+        WorkerList[w].OutputList[i].EdsId = EDSLIB_ID_INVALID;
+    }
+
+    if (fclose(OutputFile) != 0)
+    {
+        perror("fclose");
+        Result = -1;
+    }
+
+    return Result;
+}
+
+static int TlmArchive_ProcessFile(const char *InputName, unsigned int NumWorkers,
+        unsigned long *TotalPackets, unsigned long *TotalDecoded)
+{
+    TlmArchive_Worker_t WorkerList[TLM_ARCHIVE_MAX_WORKERS];
+    TlmArchive_Packet_t *PacketList;
+    size_t NumPackets;
+    struct stat FileStat;
+    struct timespec StartTime;
+    struct timespec EndTime;
+    const uint8_t *FileData;
+    unsigned long UnknownCount;
+    unsigned long VerifyFailCount;
+    unsigned long DecodeCount;
+    unsigned int w;
+    size_t i;
+    double Elapsed;
+    int fd;
+    int Result;
+
+    fd = open(InputName, O_RDONLY);
+    if (fd < 0)
+    {
+        perror(InputName);
+        return -1;
+    }
+
+    if (fstat(fd, &FileStat) < 0 || FileStat.st_size < CCSDS_PRIMARY_HEADER_SIZE)
+    {
+        fprintf(stderr, "%s: not a valid input file\n", InputName);
+        close(fd);
+        return -1;
+    }
+
+    FileData = mmap(NULL, FileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (FileData == MAP_FAILED)
+    {
+        perror(InputName);
+        return -1;
+    }
+    posix_madvise((void *)FileData, FileStat.st_size, POSIX_MADV_SEQUENTIAL);
+
+    clock_gettime(CLOCK_MONOTONIC, &StartTime);
+
+    PacketList = NULL;
+    NumPackets = 0;
+    Result = TlmArchive_IndexFile(FileData, FileStat.st_size, &PacketList, &NumPackets);
+
+    if (Result != 0)
+    {
+        fprintf(stderr, "%s: out of memory indexing packets\n", InputName);
+        free(PacketList);
+        munmap((void *)FileData, FileStat.st_size);
+        return -1;
+    }
+
+    /* avoid idle workers for small files */
+    if (NumWorkers > NumPackets)
+    {
+        NumWorkers = (NumPackets > 0) ? NumPackets : 1;
+    }
+
+    memset(WorkerList, 0, sizeof(WorkerList));
+    for (w = 0; w < NumWorkers; ++w)
+    {
+        WorkerList[w].WorkerNum = w;
+        WorkerList[w].PacketList = PacketList;
+        WorkerList[w].StartIndex = (NumPackets * w) / NumWorkers;
+        WorkerList[w].EndIndex = (NumPackets * (w + 1)) / NumWorkers;
+        if (pthread_create(&WorkerList[w].Thread, NULL, TlmArchive_WorkerThread, &WorkerList[w]) != 0)
+        {
+            /* run it inline instead */
+            TlmArchive_WorkerThread(&WorkerList[w]);
+            WorkerList[w].Thread = pthread_self();
+        }
+    }
+
+    UnknownCount = 0;
+    VerifyFailCount = 0;
+    DecodeCount = 0;
+    for (w = 0; w < NumWorkers; ++w)
+    {
+        if (!pthread_equal(WorkerList[w].Thread, pthread_self()))
+        {
+            pthread_join(WorkerList[w].Thread, NULL);
+        }
+        if (WorkerList[w].Error)
+        {
+            Result = -1;
+        }
+        UnknownCount += WorkerList[w].UnknownCount;
+        VerifyFailCount += WorkerList[w].VerifyFailCount;
+        DecodeCount += WorkerList[w].DecodeCount;
+    }
+
+    for (w = 0; w < NumWorkers; ++w)
+    {
+        for (i = 0; i < WorkerList[w].NumOutputs; ++i)
+        {
+            if (WorkerList[w].OutputList[i].EdsId != EDSLIB_ID_INVALID &&
+                    TlmArchive_MergeOutput(WorkerList, NumWorkers, WorkerList[w].OutputList[i].EdsId) != 0)
+            {
+                Result = -1;
+            }
+        }
+        free(WorkerList[w].OutputList);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &EndTime);
+    Elapsed = (EndTime.tv_sec - StartTime.tv_sec) + 1e-9 * (EndTime.tv_nsec - StartTime.tv_nsec);
+
+    printf("%s: %lu packets, %lu decoded, %lu unidentified, %lu failed verification\n",
+            InputName, (unsigned long)NumPackets, DecodeCount, UnknownCount, VerifyFailCount);
+    printf("%s: %.3f sec using %u threads, %.0f packets/sec\n",
+            InputName, Elapsed, NumWorkers, (Elapsed > 0) ? (NumPackets / Elapsed) : 0.0);
+
+    *TotalPackets += NumPackets;
+    *TotalDecoded += DecodeCount;
+
+    free(PacketList);
+    munmap((void *)FileData, FileStat.st_size);
+
+    return Result;
+}
+
+int main(int argc, char *argv[])
+{
+    int opt = 0;
+    int longIndex = 0;
+    long NumWorkers;
+    unsigned long TotalPackets;
+    unsigned long TotalDecoded;
+    struct timespec StartTime;
+    struct timespec EndTime;
+    double Elapsed;
+    EdsLib_Id_t EdsId;
+    int Result;
+
+    NumWorkers = sysconf(_SC_NPROCESSORS_ONLN);
+
+    opt = getopt_long( argc, argv, optString, longOpts, &longIndex );
+    while( opt != -1 )
+    {
+        switch( opt )
+        {
+        case 'j':
+            NumWorkers = atol(optarg);
+            break;
+
+        case 'o':
+            TlmArchive_OutputDir = optarg;
+            break;
+
+        case '?':
+        default:
+            TlmArchive_Usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        opt = getopt_long( argc, argv, optString, longOpts, &longIndex );
+    }
+
+    if (optind >= argc)
+    {
+        TlmArchive_Usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (NumWorkers < 1)
+    {
+        NumWorkers = 1;
+    }
+    else if (NumWorkers > TLM_ARCHIVE_MAX_WORKERS)
+    {
+        NumWorkers = TLM_ARCHIVE_MAX_WORKERS;
+    }
+
+    EdsId = EDSLIB_MAKE_ID(EDS_INDEX(CCSDS_SPACEPACKET), CCSDS_TelemetryPacket_DATADICTIONARY);
+    if (EdsLib_DataTypeDB_GetTypeInfo(&EDS_DATABASE, EdsId, &TlmArchive_HeaderTypeInfo) != EDSLIB_SUCCESS)
+    {
+        fprintf(stderr, "%s: telemetry header type not found in EDS database\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    Result = EXIT_SUCCESS;
+    TotalPackets = 0;
+    TotalDecoded = 0;
+    clock_gettime(CLOCK_MONOTONIC, &StartTime);
+    for (; optind < argc; ++optind)
+    {
+        if (TlmArchive_ProcessFile(argv[optind], NumWorkers, &TotalPackets, &TotalDecoded) != 0)
+        {
+            Result = EXIT_FAILURE;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &EndTime);
+    Elapsed = (EndTime.tv_sec - StartTime.tv_sec) + 1e-9 * (EndTime.tv_nsec - StartTime.tv_nsec);
+
+    printf("Total: %lu packets, %lu decoded in %.3f sec, %.0f packets/sec\n",
+            TotalPackets, TotalDecoded, Elapsed, (Elapsed > 0) ? (TotalPackets / Elapsed) : 0.0);
+
+    free(TlmArchive_StartedTypes);
+
+    return Result;
+}
@@ -0,0 +1,327 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file     tlm_archive_io.c
+ * \ingroup  cfecfs
+ *
+ * Input file indexing and output file handling for the tlm_archive utility
+ *
+ * Two input formats are accepted, and detected automatically:
+ *  - pcap capture files (classic format), where each UDP datagram over IPv4
+ *    contains a single telemetry packet, as sent by TO_LAB.
+ *  - raw files containing a contiguous stream of CCSDS space packets, where
+ *    the length of each packet is taken from its primary header.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "tlm_archive_io.h"
+
+
+#define PCAP_MAGIC_USEC                 0xa1b2c3d4
+#define PCAP_MAGIC_NSEC                 0xa1b23c4d
+#define PCAP_GLOBAL_HEADER_SIZE         24
+#define PCAP_RECORD_HEADER_SIZE         16
+
+#define PCAP_LINKTYPE_NULL              0
+#define PCAP_LINKTYPE_ETHERNET          1
+#define PCAP_LINKTYPE_RAW               101
+#define PCAP_LINKTYPE_LINUX_SLL         113
+#define PCAP_LINKTYPE_IPV4              228
+
+static uint16_t TlmArchive_GetBE16(const uint8_t *Ptr)
+{
+    return (uint16_t)((Ptr[0] << 8) | Ptr[1]);
+}
+
+static uint32_t TlmArchive_GetPcap32(const uint8_t *Ptr, int Swap)
+{
+    uint32_t Value;
+
+    memcpy(&Value, Ptr, sizeof(Value));
+    if (Swap)
+    {
+        Value = ((Value & 0xFF) << 24) | ((Value & 0xFF00) << 8) |
+                ((Value >> 8) & 0xFF00) | (Value >> 24);
+    }
+
+    return Value;
+}
+
+static int TlmArchive_AddPacket(TlmArchive_Packet_t **PacketList, size_t *NumPackets, size_t *MaxPackets,
+        const uint8_t *Data, uint32_t Length, uint32_t TimeSec, uint32_t TimeUsec)
+{
+    TlmArchive_Packet_t *NewList;
+    TlmArchive_Packet_t *Pkt;
+
+    if (*NumPackets >= *MaxPackets)
+    {
+        *MaxPackets = (*MaxPackets == 0) ? 65536 : (2 * *MaxPackets);
+        NewList = realloc(*PacketList, *MaxPackets * sizeof(*NewList));
+        if (NewList == NULL)
+        {
+            return -1;
+        }
+        *PacketList = NewList;
+    }
+
+    Pkt = &(*PacketList)[*NumPackets];
+    Pkt->Data = Data;
+    Pkt->Length = Length;
+    Pkt->TimeSec = TimeSec;
+    Pkt->TimeUsec = TimeUsec;
+    ++(*NumPackets);
+
+    return 0;
+}
+
+/*
+ * Locates the UDP payload within a captured frame.
+ * Returns the payload length, or -1 if the frame is not an unfragmented IPv4/UDP datagram.
+ */
+static long TlmArchive_GetUdpPayload(const uint8_t *Frame, uint32_t FrameLen, uint32_t LinkType, const uint8_t **Payload)
+{
+    uint32_t Pos;
+    uint32_t IpHdrLen;
+    uint32_t UdpLen;
+    uint16_t EtherType;
+
+    switch(LinkType)
+    {
+    case PCAP_LINKTYPE_ETHERNET:
+        if (FrameLen < 14)
+        {
+            return -1;
+        }
+        Pos = 12;
+        EtherType = TlmArchive_GetBE16(&Frame[Pos]);
+        while (EtherType == 0x8100 && (Pos + 6) <= FrameLen)
+        {
+            /* skip 802.1Q VLAN tag(s) */
+            Pos += 4;
+            EtherType = TlmArchive_GetBE16(&Frame[Pos]);
+        }
+        if (EtherType != 0x0800)
+        {
+            return -1;
+        }
+        Pos += 2;
+        break;
+    case PCAP_LINKTYPE_LINUX_SLL:
+        if (FrameLen < 16 || TlmArchive_GetBE16(&Frame[14]) != 0x0800)
+        {
+            return -1;
+        }
+        Pos = 16;
+        break;
+    case PCAP_LINKTYPE_NULL:
+        Pos = 4;
+        break;
+    case PCAP_LINKTYPE_RAW:
+    case PCAP_LINKTYPE_IPV4:
+        Pos = 0;
+        break;
+    default:
+        return -1;
+    }
+
+    /* IPv4 header: version 4, protocol UDP, not a fragment */
+    if ((Pos + 20) > FrameLen || (Frame[Pos] >> 4) != 4 || Frame[Pos + 9] != 17 ||
+            (TlmArchive_GetBE16(&Frame[Pos + 6]) & 0x3FFF) != 0)
+    {
+        return -1;
+    }
+
+    /* the header length is in 32-bit words, and the fixed part alone is 5 words */
+    IpHdrLen = 4 * (Frame[Pos] & 0x0F);
+    if (IpHdrLen < 20)
+    {
+        return -1;
+    }
+    Pos += IpHdrLen;
+    if ((Pos + 8) > FrameLen)
+    {
+        return -1;
+    }
+
+    UdpLen = TlmArchive_GetBE16(&Frame[Pos + 4]);
+    Pos += 8;
+    if (UdpLen < 8)
+    {
+        return -1;
+    }
+    UdpLen -= 8;
+    if (UdpLen > (FrameLen - Pos))
+    {
+        /* truncated capture, use what is available */
+        UdpLen = FrameLen - Pos;
+    }
+
+    *Payload = &Frame[Pos];
+    return UdpLen;
+}
+
+static int TlmArchive_IndexPcap(const uint8_t *FileData, size_t FileSize,
+        TlmArchive_Packet_t **PacketList, size_t *NumPackets, size_t *MaxPackets)
+{
+    uint32_t Magic;
+    uint32_t LinkType;
+    uint32_t CapLen;
+    uint32_t TimeSec;
+    uint32_t TimeFrac;
+    size_t Pos;
+    int Swap;
+    int IsNsec;
+    long PayloadLen;
+    const uint8_t *Payload;
+
+    if (FileSize < PCAP_GLOBAL_HEADER_SIZE)
+    {
+        return 0;
+    }
+
+    memcpy(&Magic, FileData, sizeof(Magic));
+    Swap = (Magic != PCAP_MAGIC_USEC && Magic != PCAP_MAGIC_NSEC);
+    Magic = TlmArchive_GetPcap32(FileData, Swap);
+    IsNsec = (Magic == PCAP_MAGIC_NSEC);
+    LinkType = TlmArchive_GetPcap32(&FileData[20], Swap) & 0xFFFF;
+
+    Pos = PCAP_GLOBAL_HEADER_SIZE;
+    while ((Pos + PCAP_RECORD_HEADER_SIZE) <= FileSize)
+    {
+        TimeSec = TlmArchive_GetPcap32(&FileData[Pos], Swap);
+        TimeFrac = TlmArchive_GetPcap32(&FileData[Pos + 4], Swap);
+        CapLen = TlmArchive_GetPcap32(&FileData[Pos + 8], Swap);
+        Pos += PCAP_RECORD_HEADER_SIZE;
+        if (CapLen > (FileSize - Pos))
+        {
+            /* truncated final record */
+            break;
+        }
+
+        if (IsNsec)
+        {
+            TimeFrac /= 1000;
+        }
+
+        PayloadLen = TlmArchive_GetUdpPayload(&FileData[Pos], CapLen, LinkType, &Payload);
+        if (PayloadLen >= CCSDS_PRIMARY_HEADER_SIZE)
+        {
+            if (TlmArchive_AddPacket(PacketList, NumPackets, MaxPackets,
+                    Payload, PayloadLen, TimeSec, TimeFrac) != 0)
+            {
+                return -1;
+            }
+        }
+
+        Pos += CapLen;
+    }
+
+    return 0;
+}
+
+static int TlmArchive_IndexRaw(const uint8_t *FileData, size_t FileSize,
+        TlmArchive_Packet_t **PacketList, size_t *NumPackets, size_t *MaxPackets)
+{
+    size_t Pos;
+    uint32_t PktLen;
+
+    Pos = 0;
+    while ((Pos + CCSDS_PRIMARY_HEADER_SIZE) <= FileSize)
+    {
+        PktLen = TlmArchive_GetBE16(&FileData[Pos + CCSDS_LENGTH_OFFSET]) + 7;
+        if (PktLen > (FileSize - Pos))
+        {
+            /* truncated final packet */
+            break;
+        }
+
+        if (TlmArchive_AddPacket(PacketList, NumPackets, MaxPackets,
+                &FileData[Pos], PktLen, 0, 0) != 0)
+        {
+            return -1;
+        }
+
+        Pos += PktLen;
+    }
+
+    return 0;
+}
+
+/*
+ * Identifies the format of an input file and indexes every packet within it.
+ *
+ * A file is treated as pcap only if it is long enough to hold the pcap global
+ * header and starts with a pcap magic number, in either byte order.  Anything
+ * else is treated as a raw CCSDS packet stream.
+ */
+int TlmArchive_IndexFile(const uint8_t *FileData, size_t FileSize,
+        TlmArchive_Packet_t **PacketList, size_t *NumPackets)
+{
+    size_t MaxPackets;
+    uint32_t Magic;
+
+    MaxPackets = 0;
+    Magic = 0;
+    if (FileSize >= PCAP_GLOBAL_HEADER_SIZE)
+    {
+        Magic = TlmArchive_GetPcap32(FileData, 0);
+        if (Magic != PCAP_MAGIC_USEC && Magic != PCAP_MAGIC_NSEC)
+        {
+            Magic = TlmArchive_GetPcap32(FileData, 1);
+        }
+    }
+
+    if (Magic == PCAP_MAGIC_USEC || Magic == PCAP_MAGIC_NSEC)
+    {
+        return TlmArchive_IndexPcap(FileData, FileSize, PacketList, NumPackets, &MaxPackets);
+    }
+
+    return TlmArchive_IndexRaw(FileData, FileSize, PacketList, NumPackets, &MaxPackets);
+}
+
+/*
+ * Copies the remaining content of InputFile onto the end of OutputFile.
+ * Returns 0 on success, or -1 if reading or writing failed.
+ */
+int TlmArchive_AppendFile(FILE *OutputFile, FILE *InputFile)
+{
+    char CopyBuffer[65536];
+    size_t CopySize;
+
+    while ((CopySize = fread(CopyBuffer, 1, sizeof(CopyBuffer), InputFile)) > 0)
+    {
+        if (fwrite(CopyBuffer, 1, CopySize, OutputFile) != CopySize)
+        {
+            return -1;
+        }
+    }
+
+    if (ferror(InputFile) || fflush(OutputFile) != 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
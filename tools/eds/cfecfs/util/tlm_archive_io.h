@@ -0,0 +1,78 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file     tlm_archive_io.h
+ * \ingroup  cfecfs
+ *
+ * Input file indexing and output file handling for the tlm_archive utility
+ *
+ * These functions do not depend on the EDS database, so they can be
+ * exercised directly by the tlm_archive_io_test program.
+ */
+
+#ifndef _TLM_ARCHIVE_IO_H_
+#define _TLM_ARCHIVE_IO_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * The size of a CCSDS primary header, and the offset of the
+ * length word within it.  The length field holds the total
+ * packet length minus 7.
+ */
+#define CCSDS_PRIMARY_HEADER_SIZE       6
+#define CCSDS_LENGTH_OFFSET             4
+
+typedef struct
+{
+    const uint8_t *Data;
+    uint32_t Length;
+    uint32_t TimeSec;
+    uint32_t TimeUsec;
+} TlmArchive_Packet_t;
+
+/**
+ * Identifies the format of an input file and indexes every packet within it.
+ *
+ * The packet list is grown with realloc() as needed and remains owned by the caller,
+ * who must free() it even when an error is returned.
+ *
+ * \param FileData   the complete content of the input file
+ * \param FileSize   the size of the input file
+ * \param PacketList pointer to the packet list, initially NULL
+ * \param NumPackets pointer to the number of packets in the list, initially 0
+ * \returns 0 on success, -1 if out of memory
+ */
+int TlmArchive_IndexFile(const uint8_t *FileData, size_t FileSize,
+        TlmArchive_Packet_t **PacketList, size_t *NumPackets);
+
+/**
+ * Copies the remaining content of one file onto the end of another.
+ *
+ * \param OutputFile the file to append to
+ * \param InputFile  the file to copy from
+ * \returns 0 on success, -1 if reading or writing failed
+ */
+int TlmArchive_AppendFile(FILE *OutputFile, FILE *InputFile);
+
+#endif  /* _TLM_ARCHIVE_IO_H_ */
@@ -0,0 +1,315 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file     tlm_archive_io_test.c
+ * \ingroup  cfecfs
+ *
+ * Tests for the tlm_archive input indexing and output merge helpers
+ *
+ * Builds small pcap and raw packet images in memory and checks which packets
+ * are found in them, including malformed and truncated inputs.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "tlm_archive_io.h"
+
+#define TEST_MAGIC_USEC     0xa1b2c3d4
+#define TEST_MAGIC_NSEC     0xa1b23c4d
+
+static unsigned int TestFailCount = 0;
+static unsigned int TestPassCount = 0;
+
+#define TEST_CHECK(cond, ...)                                   \
+    do {                                                        \
+        if (cond)                                               \
+        {                                                       \
+            ++TestPassCount;                                    \
+        }                                                       \
+        else                                                    \
+        {                                                       \
+            ++TestFailCount;                                    \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);         \
+            printf(__VA_ARGS__);                                \
+            printf("\n");                                       \
+        }                                                       \
+    } while(0)
+
+typedef struct
+{
+    uint8_t Data[2048];
+    size_t Size;
+} TestImage_t;
+
+static void Test_Put32(TestImage_t *Image, uint32_t Value)
+{
+    /* pcap headers are written in host byte order, as a capture tool does */
+    memcpy(&Image->Data[Image->Size], &Value, sizeof(Value));
+    Image->Size += sizeof(Value);
+}
+
+static void Test_Put16(TestImage_t *Image, uint16_t Value)
+{
+    memcpy(&Image->Data[Image->Size], &Value, sizeof(Value));
+    Image->Size += sizeof(Value);
+}
+
+static void Test_PutBytes(TestImage_t *Image, const void *Data, size_t Size)
+{
+    memcpy(&Image->Data[Image->Size], Data, Size);
+    Image->Size += Size;
+}
+
+static void Test_PcapHeader(TestImage_t *Image, uint32_t Magic, uint32_t LinkType)
+{
+    Image->Size = 0;
+    Test_Put32(Image, Magic);
+    Test_Put16(Image, 2);
+    Test_Put16(Image, 4);
+    Test_Put32(Image, 0);
+    Test_Put32(Image, 0);
+    Test_Put32(Image, 65535);
+    Test_Put32(Image, LinkType);
+}
+
+/*
+ * Builds an Ethernet/IPv4/UDP frame around a 10 byte CCSDS packet.
+ * IpHdrWords is the IHL field; any words beyond 5 are filled as IP options.
+ */
+static size_t Test_MakeFrame(uint8_t *Frame, uint8_t IpHdrWords, uint8_t Tag)
+{
+    static const uint8_t EtherHdr[14] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0x08, 0x00 };
+    uint8_t Packet[10] = { 0x08, 0x01, 0xC0, 0x00, 0x00, 0x03, 0, 0, 0, 0 };
+    size_t Pos;
+    size_t IpHdrLen;
+    size_t UdpLen;
+
+    Packet[6] = Tag;
+    IpHdrLen = (IpHdrWords < 5) ? 20 : (4 * IpHdrWords);
+    UdpLen = 8 + sizeof(Packet);
+
+    memcpy(Frame, EtherHdr, sizeof(EtherHdr));
+    Pos = sizeof(EtherHdr);
+    memset(&Frame[Pos], 0, IpHdrLen);
+    Frame[Pos] = 0x40 | IpHdrWords;
+    Frame[Pos + 2] = (IpHdrLen + UdpLen) >> 8;
+    Frame[Pos + 3] = (IpHdrLen + UdpLen) & 0xFF;
+    Frame[Pos + 8] = 64;
+    Frame[Pos + 9] = 17;
+    Pos += IpHdrLen;
+    memset(&Frame[Pos], 0, 8);
+    Frame[Pos + 5] = UdpLen;
+    Pos += 8;
+    memcpy(&Frame[Pos], Packet, sizeof(Packet));
+    Pos += sizeof(Packet);
+
+    return Pos;
+}
+
+static void Test_PcapRecord(TestImage_t *Image, uint32_t Sec, uint32_t Frac, const uint8_t *Frame, size_t FrameLen)
+{
+    Test_Put32(Image, Sec);
+    Test_Put32(Image, Frac);
+    Test_Put32(Image, FrameLen);
+    Test_Put32(Image, FrameLen);
+    Test_PutBytes(Image, Frame, FrameLen);
+}
+
+/*
+ * Indexes an image from a heap copy of exactly its size, so that any read
+ * past the end is caught by tools such as valgrind or ASan.
+ */
+static size_t Test_Index(const TestImage_t *Image, TlmArchive_Packet_t **PacketList, uint8_t **Copy)
+{
+    size_t NumPackets;
+    int Result;
+
+    *Copy = malloc(Image->Size > 0 ? Image->Size : 1);
+    memcpy(*Copy, Image->Data, Image->Size);
+    *PacketList = NULL;
+    NumPackets = 0;
+    Result = TlmArchive_IndexFile(*Copy, Image->Size, PacketList, &NumPackets);
+    TEST_CHECK(Result == 0, "TlmArchive_IndexFile() (%d) == 0", Result);
+
+    return NumPackets;
+}
+
+static void Test_Pcap(void)
+{
+    TestImage_t Image;
+    TlmArchive_Packet_t *PacketList;
+    uint8_t *Copy;
+    uint8_t Frame[256];
+    size_t FrameLen;
+    size_t NumPackets;
+
+    /* two good frames, the second with IP options */
+    Test_PcapHeader(&Image, TEST_MAGIC_USEC, 1);
+    FrameLen = Test_MakeFrame(Frame, 5, 0x11);
+    Test_PcapRecord(&Image, 100, 250, Frame, FrameLen);
+    FrameLen = Test_MakeFrame(Frame, 7, 0x22);
+    Test_PcapRecord(&Image, 101, 500, Frame, FrameLen);
+    NumPackets = Test_Index(&Image, &PacketList, &Copy);
+    TEST_CHECK(NumPackets == 2, "pcap: NumPackets (%lu) == 2", (unsigned long)NumPackets);
+    if (NumPackets == 2)
+    {
+        TEST_CHECK(PacketList[0].Length == 10 && PacketList[0].Data[6] == 0x11,
+                "pcap: packet 0 length %lu tag 0x%02x", (unsigned long)PacketList[0].Length,
+                (unsigned int)PacketList[0].Data[6]);
+        TEST_CHECK(PacketList[0].TimeSec == 100 && PacketList[0].TimeUsec == 250,
+                "pcap: packet 0 time %lu.%06lu", (unsigned long)PacketList[0].TimeSec,
+                (unsigned long)PacketList[0].TimeUsec);
+        TEST_CHECK(PacketList[1].Length == 10 && PacketList[1].Data[6] == 0x22,
+                "pcap: packet 1 with IP options length %lu tag 0x%02x", (unsigned long)PacketList[1].Length,
+                (unsigned int)PacketList[1].Data[6]);
+    }
+    free(PacketList);
+    free(Copy);
+
+    /* nanosecond timestamps are reduced to microseconds */
+    Test_PcapHeader(&Image, TEST_MAGIC_NSEC, 1);
+    FrameLen = Test_MakeFrame(Frame, 5, 0x33);
+    Test_PcapRecord(&Image, 7, 123456789, Frame, FrameLen);
+    NumPackets = Test_Index(&Image, &PacketList, &Copy);
+    TEST_CHECK(NumPackets == 1 && PacketList[0].TimeUsec == 123456,
+            "pcap nsec: NumPackets (%lu) == 1, TimeUsec == 123456", (unsigned long)NumPackets);
+    free(PacketList);
+    free(Copy);
+
+    /* an IHL below 5 is not a valid IPv4 header and the frame is skipped */
+    Test_PcapHeader(&Image, TEST_MAGIC_USEC, 1);
+    FrameLen = Test_MakeFrame(Frame, 4, 0x44);
+    Test_PcapRecord(&Image, 1, 0, Frame, FrameLen);
+    FrameLen = Test_MakeFrame(Frame, 0, 0x45);
+    Test_PcapRecord(&Image, 2, 0, Frame, FrameLen);
+    FrameLen = Test_MakeFrame(Frame, 5, 0x46);
+    Test_PcapRecord(&Image, 3, 0, Frame, FrameLen);
+    NumPackets = Test_Index(&Image, &PacketList, &Copy);
+    TEST_CHECK(NumPackets == 1 && PacketList[0].Data[6] == 0x46,
+            "pcap bad IHL: NumPackets (%lu) == 1", (unsigned long)NumPackets);
+    free(PacketList);
+    free(Copy);
+
+    /* a truncated final record is dropped */
+    Test_PcapHeader(&Image, TEST_MAGIC_USEC, 1);
+    FrameLen = Test_MakeFrame(Frame, 5, 0x55);
+    Test_PcapRecord(&Image, 1, 0, Frame, FrameLen);
+    Test_PcapRecord(&Image, 2, 0, Frame, FrameLen);
+    Image.Size -= 3;
+    NumPackets = Test_Index(&Image, &PacketList, &Copy);
+    TEST_CHECK(NumPackets == 1, "pcap truncated: NumPackets (%lu) == 1", (unsigned long)NumPackets);
+    free(PacketList);
+    free(Copy);
+
+    /*
+     * A file shorter than the pcap global header is not read as pcap, even if
+     * it starts with the magic number; it is indexed as a raw stream instead.
+     */
+    Test_PcapHeader(&Image, TEST_MAGIC_USEC, 1);
+    Image.Size = 20;
+    NumPackets = Test_Index(&Image, &PacketList, &Copy);
+    TEST_CHECK(NumPackets == 0 || (PacketList[NumPackets-1].Data + PacketList[NumPackets-1].Length) <= (Copy + Image.Size),
+            "short pcap: all %lu packets within the file", (unsigned long)NumPackets);
+    free(PacketList);
+    free(Copy);
+}
+
+static void Test_Raw(void)
+{
+    static const uint8_t Stream[] =
+    {
+        0x08, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xAA, 0xBB,
+        0x08, 0x02, 0xC0, 0x01, 0x00, 0x03, 0x01, 0x02, 0x03, 0x04,
+        0x08, 0x03, 0xC0, 0x02, 0x00, 0x09, 0x01
+    };
+    TestImage_t Image;
+    TlmArchive_Packet_t *PacketList;
+    uint8_t *Copy;
+    size_t NumPackets;
+
+    Image.Size = 0;
+    Test_PutBytes(&Image, Stream, sizeof(Stream));
+    NumPackets = Test_Index(&Image, &PacketList, &Copy);
+    TEST_CHECK(NumPackets == 2, "raw: NumPackets (%lu) == 2", (unsigned long)NumPackets);
+    if (NumPackets == 2)
+    {
+        TEST_CHECK(PacketList[0].Length == 8 && PacketList[1].Length == 10,
+                "raw: lengths %lu, %lu", (unsigned long)PacketList[0].Length,
+                (unsigned long)PacketList[1].Length);
+        TEST_CHECK(PacketList[1].Data == &Copy[8], "raw: packet 1 offset");
+    }
+    free(PacketList);
+    free(Copy);
+}
+
+static void Test_Append(void)
+{
+    FILE *InputFile;
+    FILE *OutputFile;
+    char Buffer[64];
+    size_t Size;
+    int Result;
+
+    InputFile = tmpfile();
+    OutputFile = tmpfile();
+    if (InputFile == NULL || OutputFile == NULL)
+    {
+        TEST_CHECK(0, "tmpfile() failed");
+        return;
+    }
+
+    fputs("header\n", OutputFile);
+    fputs("row1\nrow2\n", InputFile);
+    rewind(InputFile);
+    Result = TlmArchive_AppendFile(OutputFile, InputFile);
+    TEST_CHECK(Result == 0, "TlmArchive_AppendFile() (%d) == 0", Result);
+    rewind(OutputFile);
+    Size = fread(Buffer, 1, sizeof(Buffer) - 1, OutputFile);
+    Buffer[Size] = 0;
+    TEST_CHECK(strcmp(Buffer, "header\nrow1\nrow2\n") == 0, "appended content: %s", Buffer);
+    fclose(OutputFile);
+
+    /* a write failure must be reported, not dropped */
+    OutputFile = fopen("/dev/full", "w");
+    if (OutputFile != NULL)
+    {
+        rewind(InputFile);
+        Result = TlmArchive_AppendFile(OutputFile, InputFile);
+        TEST_CHECK(Result != 0, "TlmArchive_AppendFile(/dev/full) (%d) != 0", Result);
+        fclose(OutputFile);
+    }
+
+    fclose(InputFile);
+}
+
+int main(void)
+{
+    Test_Pcap();
+    Test_Raw();
+    Test_Append();
+
+    printf("tlm_archive_io_test: %u passed, %u failed\n", TestPassCount, TestFailCount);
+
+    return (TestFailCount == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
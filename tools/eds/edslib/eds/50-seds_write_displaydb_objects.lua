@@ -29,6 +29,23 @@ SEDS.info ("SEDS write display objects START")
 
 local datasheet_namespace_objs = {}
 
+-- -----------------------------------------------------------------------
+-- Byte-wise string ordering, identical to C strcmp()
+-- -----------------------------------------------------------------------
+-- The default "<" operator on Lua strings uses strcoll(), which follows the
+-- locale of the build host.  The name indices are binary searched at runtime
+-- with strcmp(), so they must be sorted with the same byte-wise ordering.
+local function bytewise_less(a,b)
+  local len = math.min(#a, #b)
+  for i = 1, len do
+    local ca, cb = string.byte(a, i), string.byte(b, i)
+    if (ca ~= cb) then
+      return ca < cb
+    end
+  end
+  return #a < #b
+end
+
 -- -----------------------------------------------------------------------
 -- Generate fields for a "display hint" object
 -- -----------------------------------------------------------------------
@@ -38,7 +55,7 @@ local datasheet_namespace_objs = {}
 --   3) Containers have named members
 --   4) Arrays might use an "indextyperef" to name their indices
 local function write_c_displayhint_object(output,node)
-  local displayhint, displayarg, displayargsz
+  local displayhint, displayarg, displayargsz, nameindex, nameindexsz
   if (node.entity_type == "ENUMERATION_DATATYPE") then
     displayhint = "ENUM_SYMTABLE"
     local labels = {}
@@ -47,7 +64,7 @@ local function write_c_displayhint_object(output,node)
       labels[1 + #labels]  = ent.name
       values[ent.name] = ent.value
     end
-    table.sort(labels)
+    table.sort(labels, bytewise_less)
     displayargsz = #labels
     local table_name = string.format("%s_SYMTABLE", node:get_flattened_name())
     output:write(string.format("static const EdsLib_SymbolTableEntry_t %s[] =", table_name))
@@ -67,9 +84,23 @@ local function write_c_displayhint_object(output,node)
     if (#node.decode_sequence > 0) then
       local checksum = node.resolved_size.checksum
       local table_name = string.format("%s_%s_NAMETABLE", output.datasheet_name, checksum)
+      local index_name = string.format("%s_%s_NAMEINDEX", output.datasheet_name, checksum)
+      -- The name index holds the (zero-based) position of every named member,
+      -- sorted by name, so the runtime can do a binary search instead of a linear scan.
+      local sorted_members = {}
+      for idx,info in ipairs(node.decode_sequence) do
+        if (info.name) then
+          sorted_members[1 + #sorted_members] = { name = info.name, position = idx - 1 }
+        end
+      end
+      table.sort(sorted_members, function(a,b) return bytewise_less(a.name, b.name) end)
       displayargsz = #node.decode_sequence
       displayarg = string.format("{ .NameTable = %s }", table_name)
       displayhint = "MEMBER_NAMETABLE"
+      if (#sorted_members > 0) then
+        nameindex = index_name
+        nameindexsz = #sorted_members
+      end
       if (not output.checksum_table[checksum]) then
         output.checksum_table[checksum] = table_name
         output:write(string.format("static const char * const %s[] =", table_name))
@@ -84,6 +115,16 @@ local function write_c_displayhint_object(output,node)
         end
         output:end_group("};")
         output:add_whitespace(1)
+        if (nameindex) then
+          output:write(string.format("static const uint16_t %s[] =", index_name))
+          output:start_group("{")
+          for _,member in ipairs(sorted_members) do
+            output:append_previous(",")
+            output:write(string.format("%d /* %s */", member.position, member.name))
+          end
+          output:end_group("};")
+          output:add_whitespace(1)
+        end
       end
     end
   elseif(node.entity_type == "BOOLEAN_DATATYPE") then
@@ -106,7 +147,9 @@ local function write_c_displayhint_object(output,node)
   return {
     DisplayHint = "EDSLIB_DISPLAYHINT_" .. (displayhint or "NONE"),
     DisplayArg = displayarg,
-    DisplayArgTableSize = displayargsz
+    DisplayArgTableSize = displayargsz,
+    NameIndex = nameindex,
+    NameIndexSize = nameindexsz
   }
 end
 
@@ -165,6 +208,8 @@ for ds in SEDS.root:iterate_children(SEDS.basenode_filter) do
   output:write(string.format("#include \"edslib_database_types.h\""))
   output:write(string.format("#include \"%s\"", SEDS.to_filename("master_index.h")))
 
+  local sorted_typenames = {}
+
   output:section_marker("Display Hint Objects")
   for node in ds:iterate_subtree() do
     if (node.edslib_refobj_local_index and node.header_data) then
@@ -176,18 +221,33 @@ for ds in SEDS.root:iterate_children(SEDS.basenode_filter) do
         end
       end
       datasheet_objs[1 + #datasheet_objs] = objs
+      sorted_typenames[1 + #sorted_typenames] = { name = node:get_qualified_name(), position = #datasheet_objs - 1 }
     end
   end
 
   local ds_name = SEDS.to_macro_name(ds.name)
 
+  -- The type name index holds the position of every type in the lookup table below,
+  -- sorted by its fully qualified name, so a type can be located by binary search.
+  table.sort(sorted_typenames, function(a,b) return bytewise_less(a.name, b.name) end)
+  if (#sorted_typenames > 0) then
+    output:section_marker("Type Name Index")
+    output:write(string.format("static const uint16_t %s_TYPENAME_INDEX[] =", ds_name))
+    output:start_group("{")
+    for _,typename in ipairs(sorted_typenames) do
+      output:append_previous(",")
+      output:write(string.format("%d /* %s */", typename.position, typename.name))
+    end
+    output:end_group("};")
+  end
+
   output:section_marker("Lookup Table")
   output:write(string.format("static const EdsLib_DisplayDB_Entry_t %s_DISPLAYINFO_TABLE[] =", ds_name))
   output:start_group("{")
   for idx,objs in ipairs(datasheet_objs) do
     output:append_previous(",")
     output:start_group("{")
-    for i,key in ipairs({ "Namespace", "Name", "DisplayHint", "DisplayArgTableSize", "DisplayArg" }) do
+    for i,key in ipairs({ "Namespace", "Name", "DisplayHint", "DisplayArgTableSize", "NameIndexSize", "DisplayArg", "NameIndex" }) do
       if (objs[key] ~= nil) then
         output:append_previous(",")
         output:write(string.format(".%s = %s", key, objs[key]))
@@ -202,6 +262,11 @@ for ds in SEDS.root:iterate_children(SEDS.basenode_filter) do
   output:start_group("{")
   output:write(string.format(".EdsName = \"%s\",", ds.name))
   output:write(string.format(".DisplayInfoTable = %s_DISPLAYINFO_TABLE", ds_name));
+  if (#sorted_typenames > 0) then
+    output:append_previous(",")
+    output:write(string.format(".TypeNameIndexSize = %d,", #sorted_typenames));
+    output:write(string.format(".TypeNameIndex = %s_TYPENAME_INDEX", ds_name));
+  end
   output:end_group("};")
 
   -- Close the output files
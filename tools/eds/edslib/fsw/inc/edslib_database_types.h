@@ -318,7 +318,9 @@ struct EdsLib_DisplayDB_Entry
 {
     uint16_t DisplayHint;           /**< Type of display logic to apply */
     uint16_t DisplayArgTableSize;
+    uint16_t NameIndexSize;         /**< Number of entries in the NameIndex table */
     EdsLib_DisplayArg_t DisplayArg; /**< Optional extra data - typically the name table for enums or containers */
+    const uint16_t *NameIndex;      /**< Optional positions within the member name table, sorted by name */
     const char *Namespace;          /**< Namespace of entry */
     const char *Name;               /**< Friendly name of data type or component */
 };
@@ -345,6 +347,8 @@ struct EdsLib_App_DisplayDB
 {
    const char *EdsName;
    const EdsLib_DisplayDB_Entry_t *DisplayInfoTable;
+   uint16_t TypeNameIndexSize;       /**< Number of entries in the TypeNameIndex table */
+   const uint16_t *TypeNameIndex;    /**< Optional type indices, sorted by fully qualified type name */
 };
 
 
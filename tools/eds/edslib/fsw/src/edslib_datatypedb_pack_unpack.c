@@ -1478,6 +1478,155 @@ static void EdsLib_Internal_DoBitwiseUnpack(uint8_t *DstPtr, const uint8_t *SrcP
     }
 }
 
+/*
+ * Copy a run of fixed-size elements while reversing the byte order of each one.
+ *
+ * The common element sizes are handled with fixed-length loops so the compiler
+ * can unroll (and where supported, vectorize) them, the generic loop is used
+ * for anything else.
+ */
+static void EdsLib_Internal_DoBulkByteSwap(uint8_t *DstPtr, const uint8_t *SrcPtr, size_t ElemSize, uint32_t Count)
+{
+    size_t Idx;
+
+    switch(ElemSize)
+    {
+    case 2:
+        while(Count > 0)
+        {
+            DstPtr[0] = SrcPtr[1];
+            DstPtr[1] = SrcPtr[0];
+            DstPtr += 2;
+            SrcPtr += 2;
+            --Count;
+        }
+        break;
+    case 4:
+        while(Count > 0)
+        {
+            DstPtr[0] = SrcPtr[3];
+            DstPtr[1] = SrcPtr[2];
+            DstPtr[2] = SrcPtr[1];
+            DstPtr[3] = SrcPtr[0];
+            DstPtr += 4;
+            SrcPtr += 4;
+            --Count;
+        }
+        break;
+    case 8:
+        while(Count > 0)
+        {
+            DstPtr[0] = SrcPtr[7];
+            DstPtr[1] = SrcPtr[6];
+            DstPtr[2] = SrcPtr[5];
+            DstPtr[3] = SrcPtr[4];
+            DstPtr[4] = SrcPtr[3];
+            DstPtr[5] = SrcPtr[2];
+            DstPtr[6] = SrcPtr[1];
+            DstPtr[7] = SrcPtr[0];
+            DstPtr += 8;
+            SrcPtr += 8;
+            --Count;
+        }
+        break;
+    default:
+        while(Count > 0)
+        {
+            for (Idx = 0; Idx < ElemSize; ++Idx)
+            {
+                DstPtr[Idx] = SrcPtr[ElemSize - 1 - Idx];
+            }
+            DstPtr += ElemSize;
+            SrcPtr += ElemSize;
+            --Count;
+        }
+        break;
+    }
+}
+
+/*
+ * Pack or unpack an entire array of scalar (integer/float) elements in one pass.
+ *
+ * This produces the same result as descending into the array and handling each element
+ * through the iterator callback, but without the per-element iterator overhead.  When the
+ * elements are byte-aligned and contiguous in both representations then the whole
+ * array is handled as a single block copy (with byte swapping, if needed).  Otherwise
+ * each element is run through the bitwise packer at its computed offset.
+ */
+static void EdsLib_Internal_DoScalarArrayPackUnpack(EdsLib_DataTypePackUnpack_ControlBlock_t *Base,
+        const EdsLib_DataTypeIterator_StackEntry_t *CbInfo,
+        const EdsLib_DataTypeDB_Entry_t *ElemDictPtr)
+{
+    const uint8_t *SrcPtr;
+    uint8_t *DstPtr;
+    uint32_t NumElements;
+    uint32_t ElemIdx;
+    uint32_t StrideBytes;
+    uint32_t StrideBits;
+    uint32_t BitOffset;
+    uint32_t ByteOffset;
+    bool IsByteOrderMatch;
+    bool IsPacked;
+
+    NumElements = CbInfo->DataDictPtr->NumSubElements;
+    StrideBytes = (CbInfo->EndOffset.Bytes - CbInfo->StartOffset.Bytes) / NumElements;
+    StrideBits = (CbInfo->EndOffset.Bits - CbInfo->StartOffset.Bits) / NumElements;
+    IsPacked = (ElemDictPtr->Flags & EDSLIB_DATATYPE_FLAG_PACKED_MASK) != 0;
+    IsByteOrderMatch = (ElemDictPtr->Flags & EDSLIB_DATATYPE_FLAG_PACKED_MASK) == EDSLIB_NATIVE_BYTE_PACK;
+
+    if (IsPacked && (CbInfo->StartOffset.Bits & 0x07) == 0 &&
+            StrideBytes == ElemDictPtr->SizeInfo.Bytes &&
+            StrideBits == (8 * StrideBytes))
+    {
+        /*
+         * Every element is a whole number of bytes with no padding on either side,
+         * so the array is one contiguous block in both representations.
+         */
+        SrcPtr = Base->SourceBasePtr;
+        DstPtr = Base->DestBasePtr;
+        if (Base->OperMode == EDSLIB_BITPACK_OPERMODE_PACK)
+        {
+            SrcPtr += CbInfo->StartOffset.Bytes;
+            DstPtr += CbInfo->StartOffset.Bits / 8;
+        }
+        else
+        {
+            SrcPtr += CbInfo->StartOffset.Bits / 8;
+            DstPtr += CbInfo->StartOffset.Bytes;
+        }
+
+        if (IsByteOrderMatch)
+        {
+            memcpy(DstPtr, SrcPtr, StrideBytes * NumElements);
+        }
+        else
+        {
+            EdsLib_Internal_DoBulkByteSwap(DstPtr, SrcPtr, StrideBytes, NumElements);
+        }
+        return;
+    }
+
+    BitOffset = CbInfo->StartOffset.Bits;
+    ByteOffset = CbInfo->StartOffset.Bytes;
+    for (ElemIdx = 0; ElemIdx < NumElements; ++ElemIdx)
+    {
+        SrcPtr = Base->SourceBasePtr;
+        DstPtr = Base->DestBasePtr;
+        if (Base->OperMode == EDSLIB_BITPACK_OPERMODE_PACK)
+        {
+            EdsLib_Internal_DoBitwisePack(DstPtr + (BitOffset / 8), SrcPtr + ByteOffset,
+                    ElemDictPtr, BitOffset & 0x07);
+        }
+        else
+        {
+            EdsLib_Internal_DoBitwiseUnpack(DstPtr + ByteOffset, SrcPtr + (BitOffset / 8),
+                    ElemDictPtr, BitOffset & 0x07);
+        }
+        BitOffset += StrideBits;
+        ByteOffset += StrideBytes;
+    }
+}
+
 static EdsLib_Iterator_Rc_t EdsLib_DataTypePackUnpack_Callback(const EdsLib_DatabaseObject_t *GD,
         EdsLib_Iterator_CbType_t CbType,
         const EdsLib_DataTypeIterator_StackEntry_t *CbInfo,
@@ -1486,6 +1635,7 @@ static EdsLib_Iterator_Rc_t EdsLib_DataTypePackUnpack_Callback(const EdsLib_Data
     EdsLib_DataTypePackUnpack_ControlBlock_t *Base = (EdsLib_DataTypePackUnpack_ControlBlock_t *)OpaqueArg;
     const uint8_t *SrcPtr;
     uint8_t *DstPtr;
+    const EdsLib_DataTypeDB_Entry_t *ElemDictPtr;
     EdsLib_PackAction_t PackAction;
     uint32_t AlignBits;
     bool IsByteOrderMatch;
@@ -1625,6 +1775,7 @@ static EdsLib_Iterator_Rc_t EdsLib_DataTypePackUnpack_Callback(const EdsLib_Data
      * copied as bytes (the latter obviously being more efficient)
      */
     AlignBits = CbInfo->StartOffset.Bits & 0x07;
+    ElemDictPtr = NULL;
 
     switch(CbInfo->DataDictPtr->BasicType)
     {
@@ -1643,10 +1794,32 @@ static EdsLib_Iterator_Rc_t EdsLib_DataTypePackUnpack_Callback(const EdsLib_Data
         if (IsByteOrderMatch && IsPacked && AlignBits == 0)
         {
             PackAction = EDSLIB_PACKACTION_BYTECOPY_STRAIGHT;
+            break;
         }
-        else
-        {
-            PackAction = EDSLIB_PACKACTION_SUBCOMPONENTS;
+
+        /*
+         * Otherwise, if this is an array of plain numbers, the elements are
+         * all handled the same way and can be done as a batch rather than
+         * descending into the array and visiting each element individually.
+         *
+         * The batch does not apply the per-element ProcessedSize check above, so it
+         * is only used when no part of the array was handled by an earlier pass.
+         * An array that straddles the ProcessedSize boundary is descended into.
+         */
+        PackAction = EDSLIB_PACKACTION_SUBCOMPONENTS;
+        if (CbInfo->DataDictPtr->BasicType == EDSLIB_BASICTYPE_ARRAY &&
+                CbInfo->DataDictPtr->NumSubElements > 0 &&
+                CbInfo->StartOffset.Bits >= Base->ProcessedSize.Bits &&
+                CbInfo->StartOffset.Bytes >= Base->ProcessedSize.Bytes)
+        {
+            ElemDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &CbInfo->DataDictPtr->Detail.Array->ElementRefObj);
+            if (ElemDictPtr != NULL &&
+                    (ElemDictPtr->BasicType == EDSLIB_BASICTYPE_SIGNED_INT ||
+                     ElemDictPtr->BasicType == EDSLIB_BASICTYPE_UNSIGNED_INT ||
+                     ElemDictPtr->BasicType == EDSLIB_BASICTYPE_FLOAT))
+            {
+                PackAction = EDSLIB_PACKACTION_SCALAR_ARRAY;
+            }
         }
         break;
     }
@@ -1748,6 +1921,12 @@ static EdsLib_Iterator_Rc_t EdsLib_DataTypePackUnpack_Callback(const EdsLib_Data
         }
         break;
     }
+    case EDSLIB_PACKACTION_SCALAR_ARRAY:
+    {
+        /* handle all array elements at once, relative to the base pointers */
+        EdsLib_Internal_DoScalarArrayPackUnpack(Base, CbInfo, ElemDictPtr);
+        break;
+    }
     case EDSLIB_PACKACTION_BITPACK:
     {
         /* This depends on whether packing or unpacking */
@@ -252,21 +252,7 @@ int32_t EdsLib_DisplayDB_GetIndexByName(const EdsLib_DatabaseObject_t *GD, EdsLi
             }
             case EDSLIB_DISPLAYHINT_MEMBER_NAMETABLE:
             {
-                const char * const *NameTable = DisplayInf->DisplayArg.NameTable;
-                uint16_t Idx;
-                for (Idx = 0; Idx < DisplayInf->DisplayArgTableSize; ++Idx)
-                {
-                    if (*NameTable != NULL)
-                    {
-                        if(strcmp(*NameTable, Name) == 0)
-                        {
-                            *SubIndex = Idx;
-                            Status = EDSLIB_SUCCESS;
-                            break;
-                        }
-                    }
-                    ++NameTable;
-                }
+                Status = EdsLib_DisplayDB_MemberLookup_GetByName(DisplayInf, Name, strlen(Name), SubIndex);
                 break;
             }
             default:
@@ -69,7 +69,67 @@ static EdsLib_Iterator_Rc_t EdsLib_DisplayLocateMember_GetContainerPosition_Call
     return EDSLIB_ITERATOR_RC_STOP;
 }
 
-static void EdsLib_DisplayLocateMember_GetContainerPosition(const EdsLib_DatabaseObject_t *GD, EdsLib_DisplayLocateMember_ControlBlock_t *CtrlBlock)
+static void EdsLib_DisplayLocateMember_GetDirectMemberPosition(const EdsLib_DatabaseObject_t *GD, EdsLib_DisplayLocateMember_ControlBlock_t *CtrlBlock)
+{
+    const EdsLib_DisplayDB_Entry_t *DisplayInf;
+    const EdsLib_ContainerDescriptor_t *ContainerDesc;
+    const EdsLib_FieldDetailEntry_t *EntryPtr;
+    EdsLib_SizeInfo_t EndOffset;
+    uint16_t SubIndex;
+
+    DisplayInf = EdsLib_DisplayDB_GetEntry(GD, &CtrlBlock->RefObj);
+    while (DisplayInf != NULL && DisplayInf->DisplayHint == EDSLIB_DISPLAYHINT_REFERENCE_TYPE)
+    {
+        DisplayInf = EdsLib_DisplayDB_GetEntry(GD, &DisplayInf->DisplayArg.RefObj);
+    }
+
+    /*
+     * This is only worthwhile if the DB has a name index; otherwise the
+     * iterator is just as good as a sequential search of the name table.
+     */
+    if (DisplayInf == NULL ||
+            DisplayInf->DisplayHint != EDSLIB_DISPLAYHINT_MEMBER_NAMETABLE ||
+            DisplayInf->NameIndex == NULL)
+    {
+        return;
+    }
+
+    ContainerDesc = CtrlBlock->DataDict->Detail.Container;
+    if (ContainerDesc == NULL || ContainerDesc->EntryList == NULL)
+    {
+        return;
+    }
+
+    if (EdsLib_DisplayDB_MemberLookup_GetByName(DisplayInf, CtrlBlock->ContentPos,
+            CtrlBlock->ContentLength, &SubIndex) != EDSLIB_SUCCESS ||
+            SubIndex >= CtrlBlock->DataDict->NumSubElements)
+    {
+        return;
+    }
+
+    /*
+     * Calculate the extent of the entry the same way as the iterator does,
+     * where the end of an entry is the start of the next one (includes any padding)
+     */
+    EntryPtr = &ContainerDesc->EntryList[SubIndex];
+    if (SubIndex < (CtrlBlock->DataDict->NumSubElements - 1))
+    {
+        EndOffset = EntryPtr[1].Offset;
+    }
+    else
+    {
+        EndOffset = CtrlBlock->DataDict->SizeInfo;
+    }
+
+    CtrlBlock->MatchQuality = EDSLIB_MATCHQUALITY_EXACT;
+    CtrlBlock->RefObj = EntryPtr->RefObj;
+    CtrlBlock->MaxSize.Bytes = EndOffset.Bytes - EntryPtr->Offset.Bytes;
+    CtrlBlock->MaxSize.Bits = EndOffset.Bits - EntryPtr->Offset.Bits;
+    CtrlBlock->StartOffset.Bytes += EntryPtr->Offset.Bytes;
+    CtrlBlock->StartOffset.Bits += EntryPtr->Offset.Bits;
+}
+
+static void EdsLib_DisplayLocateMember_SearchContainer(const EdsLib_DatabaseObject_t *GD, EdsLib_DisplayLocateMember_ControlBlock_t *CtrlBlock)
 {
     EDSLIB_DECLARE_DISPLAY_ITERATOR_CB(IteratorState,
             EDSLIB_ITERATOR_MAX_BASETYPE_DEPTH,
@@ -81,6 +141,20 @@ static void EdsLib_DisplayLocateMember_GetContainerPosition(const EdsLib_Databas
     EdsLib_DataTypeIterator_Impl(GD, &IteratorState.BaseIter.Cb);
 }
 
+static void EdsLib_DisplayLocateMember_GetContainerPosition(const EdsLib_DatabaseObject_t *GD, EdsLib_DisplayLocateMember_ControlBlock_t *CtrlBlock)
+{
+    /*
+     * First try a direct lookup of the name in this container.  Members
+     * that are inherited from a base type are not found this way, so
+     * those fall back to walking the full structure.
+     */
+    EdsLib_DisplayLocateMember_GetDirectMemberPosition(GD, CtrlBlock);
+    if (CtrlBlock->MatchQuality != EDSLIB_MATCHQUALITY_EXACT)
+    {
+        EdsLib_DisplayLocateMember_SearchContainer(GD, CtrlBlock);
+    }
+}
+
 static void EdsLib_DisplayLocateMember_GetArrayPosition(const EdsLib_DatabaseObject_t *GD, EdsLib_DisplayLocateMember_ControlBlock_t *CtrlBlock)
 {
     const EdsLib_DisplayDB_Entry_t *DisplayInf;
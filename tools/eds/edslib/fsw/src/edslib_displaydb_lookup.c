@@ -89,3 +89,70 @@ const EdsLib_DisplayDB_Entry_t *EdsLib_DisplayDB_GetEntry(const EdsLib_DatabaseO
    return &NameDict->DisplayInfoTable[RefObj->TypeIndex];
 }
 
+
+int32_t EdsLib_DisplayDB_MemberLookup_GetByName(const EdsLib_DisplayDB_Entry_t *DisplayInf, const char *String, uint32_t StringLen, uint16_t *SubIndex)
+{
+    const char * const *NameTable;
+    const char *MemberName;
+    int Compare;
+    uint32_t LowIndex;
+    uint32_t HighIndex;
+    uint32_t SearchIndex;
+    uint16_t Position;
+
+    NameTable = DisplayInf->DisplayArg.NameTable;
+
+    if (DisplayInf->NameIndex == NULL)
+    {
+        /*
+         * Database was generated without a name index,
+         * so this must do a sequential search.
+         */
+        for (Position = 0; Position < DisplayInf->DisplayArgTableSize; ++Position)
+        {
+            MemberName = NameTable[Position];
+            if (MemberName != NULL &&
+                    strncmp(MemberName, String, StringLen) == 0 &&
+                    MemberName[StringLen] == 0)
+            {
+                *SubIndex = Position;
+                return EDSLIB_SUCCESS;
+            }
+        }
+
+        return EDSLIB_NAME_NOT_FOUND;
+    }
+
+    LowIndex = 0;
+    HighIndex = DisplayInf->NameIndexSize;
+    while (LowIndex < HighIndex)
+    {
+        SearchIndex = (LowIndex + HighIndex) / 2;
+        Position = DisplayInf->NameIndex[SearchIndex];
+        MemberName = NameTable[Position];
+
+        Compare = strncmp(MemberName, String, StringLen);
+        if (Compare == 0)
+        {
+            if (MemberName[StringLen] == 0)
+            {
+                *SubIndex = Position;
+                return EDSLIB_SUCCESS;
+            }
+
+            /* the member name is longer, so it sorts after the search string */
+            Compare = 1;
+        }
+
+        if (Compare < 0)
+        {
+            LowIndex = SearchIndex + 1;
+        }
+        else
+        {
+            HighIndex = SearchIndex;
+        }
+    }
+
+    return EDSLIB_NAME_NOT_FOUND;
+}
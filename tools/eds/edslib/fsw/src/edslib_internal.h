@@ -232,6 +232,7 @@ typedef enum
     EDSLIB_PACKACTION_BITPACK,
     EDSLIB_PACKACTION_BYTECOPY_INVERT,
     EDSLIB_PACKACTION_BYTECOPY_STRAIGHT,
+    EDSLIB_PACKACTION_SCALAR_ARRAY,
     EDSLIB_PACKACTION_SUBCOMPONENTS,
 } EdsLib_PackAction_t;
 
@@ -442,6 +443,7 @@ const EdsLib_DisplayDB_Entry_t *EdsLib_DisplayDB_GetEntry(const EdsLib_DatabaseO
 
 const EdsLib_SymbolTableEntry_t *EdsLib_DisplaySymbolLookup_GetByName(const EdsLib_SymbolTableEntry_t *SymbolDict, uint16_t TableSize, const char *String, uint32_t StringLen);
 const EdsLib_SymbolTableEntry_t *EdsLib_DisplaySymbolLookup_GetByValue(const EdsLib_SymbolTableEntry_t *SymbolDict, uint16_t TableSize, intmax_t Value);
+int32_t EdsLib_DisplayDB_MemberLookup_GetByName(const EdsLib_DisplayDB_Entry_t *DisplayInf, const char *String, uint32_t StringLen, uint16_t *SubIndex);
 
 void EdsLib_DisplayLocateMember_Impl(const EdsLib_DatabaseObject_t *GD, EdsLib_DisplayLocateMember_ControlBlock_t *CtrlBlock);
 
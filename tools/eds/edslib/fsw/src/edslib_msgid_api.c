@@ -41,13 +41,101 @@
 #include "edslib_displaydb.h"
 #include "edslib_internal.h"
 
+/*
+ * Compare the fully qualified name of a DB entry ("Namespace/Name") against a string,
+ * with the same ordering as strcmp() would give if the qualified name were one string.
+ */
+static int EdsLib_DisplayDB_CompareQualifiedName(const EdsLib_DisplayDB_Entry_t *DisplayInfo, const char *String)
+{
+    size_t PartLength;
+    int Compare;
+
+    if (DisplayInfo->Namespace != NULL)
+    {
+        PartLength = strlen(DisplayInfo->Namespace);
+        Compare = strncmp(DisplayInfo->Namespace, String, PartLength);
+        if (Compare != 0)
+        {
+            return Compare;
+        }
+        if (String[PartLength] != '/')
+        {
+            return (int)'/' - (int)((unsigned char)String[PartLength]);
+        }
+        String += PartLength + 1;
+    }
+
+    if (DisplayInfo->Name == NULL)
+    {
+        return -1;
+    }
+
+    return strcmp(DisplayInfo->Name, String);
+}
+
+static int32_t EdsLib_DisplayDB_TypeLookup_GetByName(EdsLib_DataTypeDB_t DataDict, EdsLib_DisplayDB_t NameDict, const char *String, uint16_t *StructId)
+{
+    int Compare;
+    uint32_t LowIndex;
+    uint32_t HighIndex;
+    uint32_t SearchIndex;
+    uint16_t Position;
+
+    if (NameDict->TypeNameIndex == NULL)
+    {
+        /*
+         * Database was generated without a type name index,
+         * so this must do a sequential search.
+         */
+        for (Position = 0; Position < DataDict->DataTypeTableSize; ++Position)
+        {
+            if (NameDict->DisplayInfoTable[Position].Name != NULL &&
+                    EdsLib_DisplayDB_CompareQualifiedName(&NameDict->DisplayInfoTable[Position], String) == 0)
+            {
+                *StructId = Position;
+                return EDSLIB_SUCCESS;
+            }
+        }
+
+        return EDSLIB_NAME_NOT_FOUND;
+    }
+
+    LowIndex = 0;
+    HighIndex = NameDict->TypeNameIndexSize;
+    while (LowIndex < HighIndex)
+    {
+        SearchIndex = (LowIndex + HighIndex) / 2;
+        Position = NameDict->TypeNameIndex[SearchIndex];
+        if (Position >= DataDict->DataTypeTableSize)
+        {
+            /* bad index - should not happen in a consistent DB */
+            break;
+        }
+
+        Compare = EdsLib_DisplayDB_CompareQualifiedName(&NameDict->DisplayInfoTable[Position], String);
+        if (Compare == 0)
+        {
+            *StructId = Position;
+            return EDSLIB_SUCCESS;
+        }
+
+        if (Compare < 0)
+        {
+            LowIndex = SearchIndex + 1;
+        }
+        else
+        {
+            HighIndex = SearchIndex;
+        }
+    }
+
+    return EDSLIB_NAME_NOT_FOUND;
+}
+
 EdsLib_Id_t EdsLib_DisplayDB_LookupTypeName(const EdsLib_DatabaseObject_t *GD, const char *String)
 {
     EdsLib_DisplayDB_t NameDict;
     EdsLib_DataTypeDB_t DataDict;
-    const EdsLib_DisplayDB_Entry_t *DisplayInfo;
-    const char *EndPtr;
-    size_t PartLength;
     uint16_t InstanceNum;
     uint16_t AppIdx;
     uint16_t StructId;
@@ -60,7 +148,6 @@ EdsLib_Id_t EdsLib_DisplayDB_LookupTypeName(const EdsLib_DatabaseObject_t *GD, c
      */
 
     Result = EDSLIB_ID_INVALID;
-    NameDict = NULL;
     InstanceNum = 0;
 
     if (GD->DisplayDB_Table != NULL && GD->DataTypeDB_Table != NULL)
@@ -70,7 +157,8 @@ EdsLib_Id_t EdsLib_DisplayDB_LookupTypeName(const EdsLib_DatabaseObject_t *GD, c
          * this is actually the fully-qualified name including the namespace parts
          * Note that the DB is organized by datasheets, NOT by namespace, so there is
          * no way to go directly to a namespace -- it could be scattered in multiple datasheets.
-         * So this must do a sequential search
+         * So each datasheet must be searched, but within a datasheet the type name
+         * index (if present) allows a binary search.
          */
         for (AppIdx = 0; AppIdx < GD->AppTableSize; ++AppIdx)
         {
@@ -82,32 +170,15 @@ EdsLib_Id_t EdsLib_DisplayDB_LookupTypeName(const EdsLib_DatabaseObject_t *GD, c
                 continue;
             }
 
-            DisplayInfo = NameDict->DisplayInfoTable;
-            for (StructId = 0; StructId < DataDict->DataTypeTableSize; ++StructId, ++DisplayInfo)
+            if (EdsLib_DisplayDB_TypeLookup_GetByName(DataDict, NameDict, String, &StructId) == EDSLIB_SUCCESS)
             {
-                EndPtr = String;
-                if (DisplayInfo->Namespace != NULL)
-                {
-                    PartLength = strlen(DisplayInfo->Namespace);
-                    if (strncmp(DisplayInfo->Namespace, String, PartLength) != 0 ||
-                            String[PartLength] != '/')
-                    {
-                        continue;
-                    }
-                    EndPtr += PartLength + 1;
-                }
-                if (DisplayInfo->Name != NULL &&
-                        strcmp(DisplayInfo->Name,EndPtr) == 0)
-                {
-                    /* Initialize the Global ID with the result */
-                    Result = EDSLIB_MAKE_ID(AppIdx, StructId);
-                    EdsLib_Set_CpuNumber(&Result, InstanceNum);
-                    break;
-                }
+                /* Initialize the Global ID with the result */
+                Result = EDSLIB_MAKE_ID(AppIdx, StructId);
+                EdsLib_Set_CpuNumber(&Result, InstanceNum);
+                break;
             }
         }
     }
 
     return Result;
 }
-
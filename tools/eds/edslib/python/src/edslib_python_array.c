@@ -166,7 +166,7 @@ static int EdsLib_Python_ObjectArray_getbuffer(PyObject *obj, Py_buffer *view, i
     Py_ssize_t ArrayItemSize;
 
     ArrayItemSize = EdsLib_Python_DatabaseEntry_GetMaxSize((PyTypeObject*)self->RefDbEntry);
-    if (view->itemsize <= 0)
+    if (ArrayItemSize <= 0)
     {
         return -1;
     }
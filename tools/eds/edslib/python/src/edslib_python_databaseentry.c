@@ -42,6 +42,20 @@ static int          EdsLib_Python_DatabaseEntry_clear(PyObject *obj);
 static Py_ssize_t   EdsLib_Python_DatabaseEntry_len(PyObject *obj);
 static PyObject *   EdsLib_Python_DatabaseEntry_seq_item(PyObject *obj, Py_ssize_t idx);
 static PyObject *   EdsLib_Python_DatabaseEntry_map_subscript(PyObject *obj, PyObject *subscr);
+static PyObject *   EdsLib_Python_DatabaseEntry_get_format(PyObject *obj, void *closure);
+static PyObject *   EdsLib_Python_DatabaseEntry_unpackstream(PyObject *obj, PyObject *args);
+
+static PyMethodDef EdsLib_Python_DatabaseEntry_methods[] =
+{
+        {"UnpackStream",  EdsLib_Python_DatabaseEntry_unpackstream, METH_VARARGS, "Decode consecutive packed objects into a DynamicArray."},
+        {NULL}  /* Sentinel */
+};
+
+static PyGetSetDef EdsLib_Python_DatabaseEntry_getset[] =
+{
+        {"Format", EdsLib_Python_DatabaseEntry_get_format, NULL, "Buffer protocol (struct module) format of native objects", NULL },
+        {NULL}  /* Sentinel */
+};
 
 static PySequenceMethods EdsLib_Python_DatabaseEntry_SequenceMethods =
 {
@@ -65,6 +79,8 @@ PyTypeObject EdsLib_Python_DatabaseEntryType =
     .tp_as_sequence = &EdsLib_Python_DatabaseEntry_SequenceMethods,
     .tp_as_mapping = &EdsLib_Python_DatabaseEntry_MappingMethods,
     .tp_init = EdsLib_Python_DatabaseEntry_init,
+    .tp_methods = EdsLib_Python_DatabaseEntry_methods,
+    .tp_getset = EdsLib_Python_DatabaseEntry_getset,
     .tp_repr = EdsLib_Python_DatabaseEntry_repr,
     .tp_traverse = EdsLib_Python_DatabaseEntry_traverse,
     .tp_clear = EdsLib_Python_DatabaseEntry_clear,
@@ -73,23 +89,113 @@ PyTypeObject EdsLib_Python_DatabaseEntryType =
     .tp_doc = "EDS database entry"
 };
 
-static void EdsLib_Python_DatabaseEntry_GetFormatCodes(char *buffer, const EdsLib_Python_Database_t *refdb, EdsLib_Id_t EdsId)
+/*
+ * Accumulates a PEP-3118 (struct module style) format string describing
+ * the native memory layout of an EDS object.  For containers this is a
+ * "T{...}" structure format with named fields, which allows consumers of the
+ * buffer protocol such as NumPy to interpret the object as a structured type.
+ */
+typedef struct
+{
+    const EdsLib_Python_Database_t *refdb;
+    char *Buffer;
+    size_t Length;
+    size_t Capacity;
+    size_t Position;
+} EdsLib_Python_FormatBuilder_t;
+
+static size_t EdsLib_Python_DatabaseEntry_AppendFormatCodes(EdsLib_Python_FormatBuilder_t *Builder, EdsLib_Id_t EdsId, size_t MinSize);
+
+static void EdsLib_Python_FormatBuilder_Append(EdsLib_Python_FormatBuilder_t *Builder, const char *Format, ...)
+{
+    va_list va;
+    char *NewBuffer;
+    size_t NewCapacity;
+    int Len;
+
+    if (PyErr_Occurred())
+    {
+        return;
+    }
+
+    while (1)
+    {
+        va_start(va, Format);
+        Len = vsnprintf(Builder->Buffer + Builder->Length, Builder->Capacity - Builder->Length, Format, va);
+        va_end(va);
+
+        if (Len < 0)
+        {
+            PyErr_Format(PyExc_RuntimeError, "Error building format string");
+            break;
+        }
+
+        if ((Builder->Length + Len) < Builder->Capacity)
+        {
+            Builder->Length += Len;
+            break;
+        }
+
+        NewCapacity = 2 * (Builder->Length + Len + 1);
+        NewBuffer = PyMem_Realloc(Builder->Buffer, NewCapacity);
+        if (NewBuffer == NULL)
+        {
+            PyErr_NoMemory();
+            break;
+        }
+
+        Builder->Buffer = NewBuffer;
+        Builder->Capacity = NewCapacity;
+    }
+}
+
+static void EdsLib_Python_DatabaseEntry_format_member_callback(void *Arg, const EdsLib_EntityDescriptor_t *ParamDesc)
+{
+    EdsLib_Python_FormatBuilder_t *Builder = Arg;
+    size_t FieldSize;
+
+    /*
+     * Unnamed entities cannot be represented as a field, and an entity that
+     * starts before the current position would overlap the previous field.
+     * Either way the bytes will be covered by padding instead.
+     */
+    if (ParamDesc->FullName == NULL || ParamDesc->EntityInfo.Offset.Bytes < Builder->Position)
+    {
+        return;
+    }
+
+    if (ParamDesc->EntityInfo.Offset.Bytes > Builder->Position)
+    {
+        EdsLib_Python_FormatBuilder_Append(Builder, "%ux",
+                (unsigned int)(ParamDesc->EntityInfo.Offset.Bytes - Builder->Position));
+    }
+
+    FieldSize = EdsLib_Python_DatabaseEntry_AppendFormatCodes(Builder, ParamDesc->EntityInfo.EdsId, 0);
+    EdsLib_Python_FormatBuilder_Append(Builder, ":%s:", ParamDesc->FullName);
+    Builder->Position = ParamDesc->EntityInfo.Offset.Bytes + FieldSize;
+}
+
+static size_t EdsLib_Python_DatabaseEntry_AppendFormatCodes(EdsLib_Python_FormatBuilder_t *Builder, EdsLib_Id_t EdsId, size_t MinSize)
 {
     EdsLib_DataTypeDB_EntityInfo_t EntityInfo;
     EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
     Py_ssize_t RepeatCount;
+    size_t SavedPosition;
+    size_t FieldSize;
     char code = 0;
 
     /*
      * For arrays, get the format for the actual item.
      * Otherwise get the format for the element itself
      */
-    EdsLib_DataTypeDB_GetTypeInfo(refdb->GD, EdsId, &TypeInfo);
+    EdsLib_DataTypeDB_GetTypeInfo(Builder->refdb->GD, EdsId, &TypeInfo);
     if (TypeInfo.ElemType == EDSLIB_BASICTYPE_ARRAY)
     {
         RepeatCount = TypeInfo.NumSubElements;
-        EdsLib_DataTypeDB_GetMemberByIndex(refdb->GD, EdsId, 0, &EntityInfo);
-        EdsLib_DataTypeDB_GetTypeInfo(refdb->GD, EntityInfo.EdsId, &TypeInfo);
+        MinSize = 0;
+        EdsLib_DataTypeDB_GetMemberByIndex(Builder->refdb->GD, EdsId, 0, &EntityInfo);
+        EdsId = EntityInfo.EdsId;
+        EdsLib_DataTypeDB_GetTypeInfo(Builder->refdb->GD, EdsId, &TypeInfo);
     }
     else
     {
@@ -98,6 +204,32 @@ static void EdsLib_Python_DatabaseEntry_GetFormatCodes(char *buffer, const EdsLi
 
     switch(TypeInfo.ElemType)
     {
+    case EDSLIB_BASICTYPE_CONTAINER:
+        /*
+         * Containers become a nested structure, where the members are
+         * at offsets relative to the start of the container.
+         */
+        if (RepeatCount > 1)
+        {
+            EdsLib_Python_FormatBuilder_Append(Builder, "(%u)", (unsigned int)RepeatCount);
+        }
+        EdsLib_Python_FormatBuilder_Append(Builder, "T{");
+        SavedPosition = Builder->Position;
+        Builder->Position = 0;
+        EdsLib_DisplayDB_IterateBaseEntities(Builder->refdb->GD, EdsId,
+                EdsLib_Python_DatabaseEntry_format_member_callback, Builder);
+        if (MinSize < TypeInfo.Size.Bytes)
+        {
+            MinSize = TypeInfo.Size.Bytes;
+        }
+        if (Builder->Position < MinSize)
+        {
+            EdsLib_Python_FormatBuilder_Append(Builder, "%ux",
+                    (unsigned int)(MinSize - Builder->Position));
+        }
+        EdsLib_Python_FormatBuilder_Append(Builder, "}");
+        Builder->Position = SavedPosition;
+        return RepeatCount * MinSize;
     case EDSLIB_BASICTYPE_UNSIGNED_INT:
         if (TypeInfo.Size.Bytes == sizeof(unsigned char))
         {
@@ -156,22 +288,63 @@ static void EdsLib_Python_DatabaseEntry_GetFormatCodes(char *buffer, const EdsLi
         break;
     }
 
+    FieldSize = RepeatCount * TypeInfo.Size.Bytes;
     if (code == 0)
     {
-        RepeatCount *= TypeInfo.Size.Bytes;
+        RepeatCount = FieldSize;
         code = 'B';
     }
 
     if (RepeatCount > 1)
     {
-        snprintf(buffer, EDSLIB_PYTHON_FORMATCODE_LEN, "%u%c",
-                (unsigned int)RepeatCount, code);
+        EdsLib_Python_FormatBuilder_Append(Builder, "%u%c", (unsigned int)RepeatCount, code);
+    }
+    else
+    {
+        EdsLib_Python_FormatBuilder_Append(Builder, "%c", code);
+    }
+
+    return FieldSize;
+}
+
+static char *EdsLib_Python_DatabaseEntry_GetFormatCodes(const EdsLib_Python_Database_t *refdb, EdsLib_Id_t EdsId)
+{
+    EdsLib_Python_FormatBuilder_t Builder;
+    EdsLib_DataTypeDB_DerivedTypeInfo_t DerivInfo;
+    size_t MinSize;
+
+    memset(&Builder, 0, sizeof(Builder));
+    Builder.refdb = refdb;
+    Builder.Capacity = 16;
+    Builder.Buffer = PyMem_Malloc(Builder.Capacity);
+    if (Builder.Buffer == NULL)
+    {
+        PyErr_NoMemory();
+        return NULL;
+    }
+
+    /*
+     * The item size of an EDS object in a buffer is the size of the largest
+     * derivative (see EdsLib_Python_DatabaseEntry_GetMaxSize) so the format
+     * for a container is padded out to that size.
+     */
+    if (EdsLib_DataTypeDB_GetDerivedInfo(refdb->GD, EdsId, &DerivInfo) == EDSLIB_SUCCESS)
+    {
+        MinSize = DerivInfo.MaxSize.Bytes;
     }
     else
     {
-        buffer[0] = code;
-        buffer[1] = 0;
+        MinSize = 0;
+    }
+
+    EdsLib_Python_DatabaseEntry_AppendFormatCodes(&Builder, EdsId, MinSize);
+    if (PyErr_Occurred())
+    {
+        PyMem_Free(Builder.Buffer);
+        Builder.Buffer = NULL;
     }
+
+    return Builder.Buffer;
 }
 
 
@@ -397,7 +570,13 @@ PyTypeObject *EdsLib_Python_DatabaseEntry_GetFromEdsId_Impl(EdsLib_Python_Databa
                 EdsLib_DisplayDB_GetNamespace(refdb->GD, EdsId),
                 EdsLib_DisplayDB_GetBaseName(refdb->GD, EdsId));
 
-        EdsLib_Python_DatabaseEntry_GetFormatCodes(selfptr->dbent.FormatInfo, refdb, EdsId);
+        selfptr->dbent.FormatInfo = EdsLib_Python_DatabaseEntry_GetFormatCodes(refdb, EdsId);
+        if (selfptr->dbent.FormatInfo == NULL)
+        {
+            Py_DECREF(selfptr);
+            selfptr = NULL;
+            break;
+        }
 
         /* "steal" the reference to typelist, if valid */
         selfptr->dbent.SubEntityList = typelist;
@@ -560,6 +739,12 @@ static void EdsLib_Python_DatabaseEntry_dealloc(PyObject * obj)
 
     Py_CLEAR(self->EdsDb);
 
+    if (self->FormatInfo != NULL)
+    {
+        PyMem_Free(self->FormatInfo);
+        self->FormatInfo = NULL;
+    }
+
     /*
      * Call the base type dealloc in case there is complicated logic
      * (for simple objects this just calls tp_free(), but it might do more)
@@ -685,3 +870,148 @@ Py_ssize_t EdsLib_Python_DatabaseEntry_GetMaxSize(PyTypeObject* objtype)
     return DerivInfo.MaxSize.Bytes;
 }
 
+
+static PyObject *EdsLib_Python_DatabaseEntry_get_format(PyObject *obj, void *closure)
+{
+    EdsLib_Python_DatabaseEntry_t *self = (EdsLib_Python_DatabaseEntry_t *)obj;
+
+    return PyUnicode_FromString(self->FormatInfo);
+}
+
+static PyObject *EdsLib_Python_DatabaseEntry_unpackstream(PyObject *obj, PyObject *args)
+{
+    static const char *kwlist[] = { "buffer", "dbent", "nelem", "elemsz", NULL };
+    EdsLib_Python_DatabaseEntry_t *self = (EdsLib_Python_DatabaseEntry_t *)obj;
+    EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
+    EdsLib_DataTypeDB_DerivedTypeInfo_t DerivInfo;
+    EdsLib_Python_Buffer_t *storage = NULL;
+    PyObject *kwargs = NULL;
+    PyObject *result = NULL;
+    Py_buffer packed;
+    Py_ssize_t maxcount = -1;
+    Py_ssize_t count;
+    Py_ssize_t elemsz;
+    Py_ssize_t minpackedsz;
+    Py_ssize_t srcoffset;
+    Py_ssize_t idx;
+    EdsLib_Id_t EdsId;
+    uint8_t *dst;
+    void *mem;
+    int32_t Status;
+
+    /*
+     * Decodes a contiguous series of packed objects, such as a telemetry
+     * archive containing records of a single type, into a dynamic array
+     * of native objects.  The optional second argument limits the number of
+     * objects decoded, which also bounds the size of the allocated buffer.
+     */
+    if (!PyArg_ParseTuple(args, "s*|n:UnpackStream", &packed, &maxcount))
+    {
+        return NULL;
+    }
+
+    do
+    {
+        EdsLib_DataTypeDB_GetTypeInfo(self->EdsDb->GD, self->EdsId, &TypeInfo);
+        if (EdsLib_DataTypeDB_GetDerivedInfo(self->EdsDb->GD, self->EdsId, &DerivInfo) != EDSLIB_SUCCESS)
+        {
+            PyErr_Format(PyExc_RuntimeError, "Error getting derived type info");
+            break;
+        }
+
+        /*
+         * Each object occupies at least the packed size of the base type in the
+         * input, which gives the upper bound on the number of objects.
+         * Each native object is allocated at the size of the largest derivative.
+         */
+        minpackedsz = (TypeInfo.Size.Bits + 7) / 8;
+        elemsz = DerivInfo.MaxSize.Bytes;
+        if (minpackedsz <= 0 || elemsz <= 0)
+        {
+            PyErr_Format(PyExc_TypeError, "Cannot unpack objects of type \'%s\'",
+                    self->type_base.ht_type.tp_name);
+            break;
+        }
+
+        count = packed.len / minpackedsz;
+        if (maxcount >= 0 && count > maxcount)
+        {
+            count = maxcount;
+        }
+        if (count <= 0)
+        {
+            PyErr_Format(PyExc_ValueError, "Buffer does not contain a complete object");
+            break;
+        }
+
+        storage = EdsLib_Python_Buffer_New(count * elemsz);
+        if (storage == NULL)
+        {
+            break;
+        }
+
+        /*
+         * The decode loop only touches the input buffer (held by the
+         * Py_buffer) and the newly allocated storage, so it can run
+         * without holding the interpreter lock.
+         */
+        dst = storage->edsbuf.Data;
+        srcoffset = 0;
+        Status = EDSLIB_SUCCESS;
+        Py_BEGIN_ALLOW_THREADS
+        for (idx = 0; idx < count && (packed.len - srcoffset) >= minpackedsz; ++idx)
+        {
+            EdsId = self->EdsId;
+            Status = EdsLib_DataTypeDB_UnpackCompleteObject(self->EdsDb->GD, &EdsId,
+                    dst, (const uint8_t *)packed.buf + srcoffset, elemsz,
+                    8 * (packed.len - srcoffset));
+            if (Status != EDSLIB_SUCCESS)
+            {
+                break;
+            }
+
+            /* advance by the size of the actual (possibly derived) object decoded */
+            EdsLib_DataTypeDB_GetTypeInfo(self->EdsDb->GD, EdsId, &TypeInfo);
+            srcoffset += (TypeInfo.Size.Bits + 7) / 8;
+            dst += elemsz;
+        }
+        Py_END_ALLOW_THREADS
+
+        if (Status != EDSLIB_SUCCESS)
+        {
+            PyErr_Format(PyExc_RuntimeError, "Error %d unpacking object %zd at offset %zd",
+                    (int)Status, idx, srcoffset);
+            break;
+        }
+
+        /* give back any space that was reserved for objects that were not present */
+        if (idx < count)
+        {
+            mem = PyMem_Realloc(storage->edsbuf.Data, idx * elemsz);
+            if (mem != NULL)
+            {
+                EdsLib_Binding_InitUnmanagedBuffer(&storage->edsbuf, mem, idx * elemsz);
+            }
+        }
+
+        /* content is already fully decoded, so skip static field initialization */
+        EdsLib_Python_Buffer_SetInitialized(storage);
+
+        kwargs = EdsLib_Python_ObjectBase_BuildKwArgs("NOnn", kwlist,
+                storage, obj, idx, elemsz);
+        storage = NULL;     /* reference was stolen */
+        if (kwargs == NULL)
+        {
+            break;
+        }
+
+        result = EdsLib_Python_ObjectBase_GenericNew(&EdsLib_Python_DynamicArrayType, kwargs);
+    }
+    while(0);
+
+    PyBuffer_Release(&packed);
+    Py_XDECREF(storage);
+    Py_XDECREF(kwargs);
+
+    return result;
+}
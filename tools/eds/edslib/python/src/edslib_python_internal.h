@@ -39,13 +39,12 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdarg.h>
 #include <unistd.h>
 #include <errno.h>
 
 #include "edslib_binding_objects.h"
 
-#define EDSLIB_PYTHON_FORMATCODE_LEN    12
-
 typedef struct
 {
     PyObject_HEAD
@@ -66,7 +65,7 @@ typedef struct
     EdsLib_Python_Database_t *EdsDb;
     PyObject *EdsTypeName;
     EdsLib_Id_t EdsId;
-    char FormatInfo[EDSLIB_PYTHON_FORMATCODE_LEN];
+    char *FormatInfo;
     PyObject* SubEntityList;
 } EdsLib_Python_DatabaseEntry_t;
 
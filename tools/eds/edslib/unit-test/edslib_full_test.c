@@ -30,6 +30,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stddef.h>
+#include <time.h>
 
 #include "utassert.h"
 
@@ -39,6 +41,7 @@
 
 #include "edslib_displaydb.h"
 #include "edslib_id.h"
+#include "edslib_database_types.h"
 #include "UTHDR_msgdefs.h"
 #include "UT1_msgdefs.h"
 
@@ -646,3 +649,318 @@ void EdsLib_StringConv_Test(void)
 
 }
 
+/*
+ * Builds the "Namespace/Name" string that the type name index is sorted on
+ */
+static void EdsLib_NameIndex_QualifiedName(char *Buffer, size_t BufferSize, const EdsLib_DisplayDB_Entry_t *DisplayInfo)
+{
+    if (DisplayInfo->Namespace != NULL)
+    {
+        snprintf(Buffer, BufferSize, "%s/%s", DisplayInfo->Namespace, DisplayInfo->Name);
+    }
+    else
+    {
+        snprintf(Buffer, BufferSize, "%s", DisplayInfo->Name);
+    }
+}
+
+/*
+ * The generated name indices are binary searched with strcmp() at runtime,
+ * so they must be in strictly increasing byte-wise order no matter what locale
+ * the database was generated under.  Every indexed name must then be found by
+ * the lookup functions at the position it was indexed at.
+ */
+void EdsLib_NameIndex_Test(void)
+{
+    EdsLib_DataTypeDB_t DataDict;
+    EdsLib_DisplayDB_t DisplayDict;
+    const EdsLib_DisplayDB_Entry_t *DisplayInfo;
+    const char * const *NameTable;
+    char PrevName[128];
+    char CurrName[128];
+    EdsLib_Id_t EdsId;
+    uint16_t AppIdx;
+    uint16_t TypeIdx;
+    uint16_t k;
+    uint16_t SubIndex;
+    uint32_t NumLookups;
+    uint32_t NumChecked;
+    uint32_t Iteration;
+    int32_t TestResult;
+    clock_t StartTime;
+    double ElapsedSec;
+
+    NumChecked = 0;
+    for (AppIdx = 0; AppIdx < GD_FULL.AppTableSize; ++AppIdx)
+    {
+        DataDict = GD_FULL.DataTypeDB_Table[AppIdx];
+        DisplayDict = GD_FULL.DisplayDB_Table[AppIdx];
+        if (DataDict == NULL || DisplayDict == NULL)
+        {
+            continue;
+        }
+
+        if (DisplayDict->TypeNameIndex != NULL)
+        {
+            for (k = 0; k < DisplayDict->TypeNameIndexSize; ++k)
+            {
+                TypeIdx = DisplayDict->TypeNameIndex[k];
+                UtAssert_True(TypeIdx < DataDict->DataTypeTableSize, "%s TypeNameIndex[%u] (%u) < %u",
+                        DisplayDict->EdsName, (unsigned int)k, (unsigned int)TypeIdx,
+                        (unsigned int)DataDict->DataTypeTableSize);
+                EdsLib_NameIndex_QualifiedName(CurrName, sizeof(CurrName), &DisplayDict->DisplayInfoTable[TypeIdx]);
+                if (k > 0)
+                {
+                    UtAssert_True(strcmp(PrevName, CurrName) < 0, "TypeNameIndex order: %s < %s",
+                            PrevName, CurrName);
+                }
+                EdsId = EdsLib_DisplayDB_LookupTypeName(&GD_FULL, CurrName);
+                UtAssert_True(EdsLib_Get_AppIdx(EdsId) == AppIdx && EdsLib_Get_FormatIdx(EdsId) == TypeIdx,
+                        "EdsLib_DisplayDB_LookupTypeName(%s) (%08x) == %u/%u", CurrName,
+                        (unsigned int)EdsId, (unsigned int)AppIdx, (unsigned int)TypeIdx);
+                strcpy(PrevName, CurrName);
+                ++NumChecked;
+            }
+        }
+
+        for (TypeIdx = 0; TypeIdx < DataDict->DataTypeTableSize; ++TypeIdx)
+        {
+            DisplayInfo = &DisplayDict->DisplayInfoTable[TypeIdx];
+            if (DisplayInfo->DisplayHint != EDSLIB_DISPLAYHINT_MEMBER_NAMETABLE ||
+                    DisplayInfo->NameIndex == NULL)
+            {
+                continue;
+            }
+
+            NameTable = DisplayInfo->DisplayArg.NameTable;
+            EdsId = EDSLIB_MAKE_ID(AppIdx, TypeIdx);
+            for (k = 0; k < DisplayInfo->NameIndexSize; ++k)
+            {
+                if (k > 0)
+                {
+                    UtAssert_True(strcmp(NameTable[DisplayInfo->NameIndex[k-1]],
+                            NameTable[DisplayInfo->NameIndex[k]]) < 0,
+                            "%s NameIndex order: %s < %s", DisplayInfo->Name,
+                            NameTable[DisplayInfo->NameIndex[k-1]], NameTable[DisplayInfo->NameIndex[k]]);
+                }
+                SubIndex = 0xFFFF;
+                TestResult = EdsLib_DisplayDB_GetIndexByName(&GD_FULL, EdsId,
+                        NameTable[DisplayInfo->NameIndex[k]], &SubIndex);
+                UtAssert_True(TestResult == EDSLIB_SUCCESS && SubIndex == DisplayInfo->NameIndex[k],
+                        "EdsLib_DisplayDB_GetIndexByName(%s.%s) (%d/%u) == %u", DisplayInfo->Name,
+                        NameTable[DisplayInfo->NameIndex[k]], (int)TestResult, (unsigned int)SubIndex,
+                        (unsigned int)DisplayInfo->NameIndex[k]);
+                ++NumChecked;
+            }
+
+            TestResult = EdsLib_DisplayDB_GetIndexByName(&GD_FULL, EdsId, "NoSuchMember", &SubIndex);
+            UtAssert_True(TestResult == EDSLIB_NAME_NOT_FOUND,
+                    "EdsLib_DisplayDB_GetIndexByName(%s.NoSuchMember) (%d) == EDSLIB_NAME_NOT_FOUND",
+                    DisplayInfo->Name, (int)TestResult);
+        }
+    }
+
+    UtAssert_True(NumChecked > 0, "Name index entries checked (%lu) > 0", (unsigned long)NumChecked);
+
+    /*
+     * Lookup benchmark: resolve every indexed member name repeatedly.
+     * This is informational only; the timing is reported but not asserted.
+     */
+    NumLookups = 0;
+    StartTime = clock();
+    for (Iteration = 0; Iteration < 10000; ++Iteration)
+    {
+        for (AppIdx = 0; AppIdx < GD_FULL.AppTableSize; ++AppIdx)
+        {
+            DataDict = GD_FULL.DataTypeDB_Table[AppIdx];
+            DisplayDict = GD_FULL.DisplayDB_Table[AppIdx];
+            if (DataDict == NULL || DisplayDict == NULL)
+            {
+                continue;
+            }
+            for (TypeIdx = 0; TypeIdx < DataDict->DataTypeTableSize; ++TypeIdx)
+            {
+                DisplayInfo = &DisplayDict->DisplayInfoTable[TypeIdx];
+                if (DisplayInfo->DisplayHint != EDSLIB_DISPLAYHINT_MEMBER_NAMETABLE ||
+                        DisplayInfo->NameIndex == NULL)
+                {
+                    continue;
+                }
+                NameTable = DisplayInfo->DisplayArg.NameTable;
+                EdsId = EDSLIB_MAKE_ID(AppIdx, TypeIdx);
+                for (k = 0; k < DisplayInfo->NameIndexSize; ++k)
+                {
+                    EdsLib_DisplayDB_GetIndexByName(&GD_FULL, EdsId, NameTable[DisplayInfo->NameIndex[k]], &SubIndex);
+                    ++NumLookups;
+                }
+            }
+        }
+    }
+    ElapsedSec = (double)(clock() - StartTime) / CLOCKS_PER_SEC;
+
+    if (NumLookups > 0)
+    {
+        UtPrintf("Name index lookup benchmark: %lu lookups in %.3f sec, %.1f ns/lookup\n",
+                (unsigned long)NumLookups, ElapsedSec, (ElapsedSec * 1.0e9) / NumLookups);
+    }
+}
+
+/*
+ * Reference packer for the scalar array test: writes Value as a big-endian
+ * field of NumBits bits starting at BitPos, one bit at a time.
+ */
+static void EdsLib_ScalarArray_PutBits(uint8_t *Buffer, uint32_t BitPos, uint32_t NumBits, uint32_t Value)
+{
+    while (NumBits > 0)
+    {
+        --NumBits;
+        if ((Value >> NumBits) & 1)
+        {
+            Buffer[BitPos / 8] |= 0x80 >> (BitPos & 0x07);
+        }
+        ++BitPos;
+    }
+}
+
+/*
+ * Arrays of plain numbers are packed/unpacked as a batch rather than element by
+ * element.  Check the batch produces exactly what a bit-by-bit reference packer
+ * does for byte aligned (block copy) and non-aligned (bitwise) arrays, and that
+ * a partial pass starting in the middle of an array leaves the already
+ * processed elements alone.
+ */
+void EdsLib_ScalarArray_Test(void)
+{
+    UT1_ScalarArrays_t Native;
+    UT1_ScalarArrays_t Unpacked;
+    uint8_t Packed[64];
+    uint8_t Expected[64];
+    EdsLib_Id_t EdsId;
+    uint32_t BitPos;
+    uint32_t PackedBits;
+    uint32_t SplitBit;
+    uint32_t SplitByte;
+    uint32_t i;
+    uint32_t Iteration;
+    int32_t TestResult;
+    clock_t StartTime;
+    double ElapsedSec;
+
+    memset(&Native, 0, sizeof(Native));
+    memset(Expected, 0, sizeof(Expected));
+
+    BitPos = 0;
+    Native.hdr = 0xA5;
+    EdsLib_ScalarArray_PutBits(Expected, BitPos, 8, Native.hdr);
+    BitPos += 8;
+    for (i = 0; i < 6; ++i)
+    {
+        Native.words[i] = 0x1234 + (0x1111 * i);
+        EdsLib_ScalarArray_PutBits(Expected, BitPos, 16, Native.words[i]);
+        BitPos += 16;
+    }
+    SplitBit = BitPos + 64;     /* start of dwords[2] in the packed form */
+    for (i = 0; i < 4; ++i)
+    {
+        Native.dwords[i] = 0x89ABCDEF - (0x01010101 * i);
+        EdsLib_ScalarArray_PutBits(Expected, BitPos, 32, Native.dwords[i]);
+        BitPos += 32;
+    }
+    for (i = 0; i < 5; ++i)
+    {
+        Native.nibbles[i] = (0xF00 >> i) | i;
+        EdsLib_ScalarArray_PutBits(Expected, BitPos, 12, Native.nibbles[i]);
+        BitPos += 12;
+    }
+    PackedBits = BitPos;
+
+    /* Complete pack must match the reference packer */
+    memset(Packed, 0, sizeof(Packed));
+    EdsId = EDSLIB_MAKE_ID(UTM_EDS_UT1_INDEX, UT1_ScalarArrays_t_DATADICTIONARY);
+    TestResult = EdsLib_DataTypeDB_PackCompleteObject(&GD_FULL, &EdsId, Packed, &Native,
+            8 * sizeof(Packed), sizeof(Native));
+    UtAssert_True(TestResult == EDSLIB_SUCCESS, "EdsLib_DataTypeDB_PackCompleteObject(ScalarArrays) (%d) == EDSLIB_SUCCESS",
+            (int)TestResult);
+    UtAssert_True(memcmp(Packed, Expected, (PackedBits + 7) / 8) == 0, "Packed ScalarArrays matches reference");
+
+    /* Complete unpack must restore every element */
+    memset(&Unpacked, 0xEE, sizeof(Unpacked));
+    EdsId = EDSLIB_MAKE_ID(UTM_EDS_UT1_INDEX, UT1_ScalarArrays_t_DATADICTIONARY);
+    TestResult = EdsLib_DataTypeDB_UnpackCompleteObject(&GD_FULL, &EdsId, &Unpacked, Packed,
+            sizeof(Unpacked), PackedBits);
+    UtAssert_True(TestResult == EDSLIB_SUCCESS, "EdsLib_DataTypeDB_UnpackCompleteObject(ScalarArrays) (%d) == EDSLIB_SUCCESS",
+            (int)TestResult);
+    UtAssert_True(Unpacked.hdr == Native.hdr, "Unpacked.hdr (%x) == %x",
+            (unsigned int)Unpacked.hdr, (unsigned int)Native.hdr);
+    for (i = 0; i < 6; ++i)
+    {
+        UtAssert_True(Unpacked.words[i] == Native.words[i], "Unpacked.words[%u] (%x) == %x",
+                (unsigned int)i, (unsigned int)Unpacked.words[i], (unsigned int)Native.words[i]);
+    }
+    for (i = 0; i < 4; ++i)
+    {
+        UtAssert_True(Unpacked.dwords[i] == Native.dwords[i], "Unpacked.dwords[%u] (%lx) == %lx",
+                (unsigned int)i, (unsigned long)Unpacked.dwords[i], (unsigned long)Native.dwords[i]);
+    }
+    for (i = 0; i < 5; ++i)
+    {
+        UtAssert_True(Unpacked.nibbles[i] == Native.nibbles[i], "Unpacked.nibbles[%u] (%x) == %x",
+                (unsigned int)i, (unsigned int)Unpacked.nibbles[i], (unsigned int)Native.nibbles[i]);
+    }
+
+    /*
+     * Partial pack starting at dwords[2]: everything before it was done by an
+     * earlier pass and must not be written again.
+     */
+    memset(Packed, 0x5A, sizeof(Packed));
+    EdsId = EDSLIB_MAKE_ID(UTM_EDS_UT1_INDEX, UT1_ScalarArrays_t_DATADICTIONARY);
+    TestResult = EdsLib_DataTypeDB_PackPartialObject(&GD_FULL, &EdsId, Packed, &Native,
+            8 * sizeof(Packed), sizeof(Native), SplitBit);
+    UtAssert_True(TestResult == EDSLIB_SUCCESS, "EdsLib_DataTypeDB_PackPartialObject(ScalarArrays) (%d) == EDSLIB_SUCCESS",
+            (int)TestResult);
+    for (i = 0; i < (SplitBit / 8); ++i)
+    {
+        UtAssert_True(Packed[i] == 0x5A, "Partial pack Packed[%u] (%02x) untouched",
+                (unsigned int)i, (unsigned int)Packed[i]);
+    }
+    UtAssert_True(memcmp(&Packed[SplitBit / 8], &Expected[SplitBit / 8], ((PackedBits + 7) / 8) - (SplitBit / 8)) == 0,
+            "Partial pack remainder matches reference");
+
+    /* Same for a partial unpack starting at dwords[2] */
+    memset(&Unpacked, 0xEE, sizeof(Unpacked));
+    SplitByte = offsetof(UT1_ScalarArrays_t, dwords[2]);
+    EdsId = EDSLIB_MAKE_ID(UTM_EDS_UT1_INDEX, UT1_ScalarArrays_t_DATADICTIONARY);
+    TestResult = EdsLib_DataTypeDB_UnpackPartialObject(&GD_FULL, &EdsId, &Unpacked, Expected,
+            sizeof(Unpacked), PackedBits, SplitByte);
+    UtAssert_True(TestResult == EDSLIB_SUCCESS, "EdsLib_DataTypeDB_UnpackPartialObject(ScalarArrays) (%d) == EDSLIB_SUCCESS",
+            (int)TestResult);
+    UtAssert_True(Unpacked.words[5] == 0xEEEE, "Partial unpack words[5] (%x) untouched",
+            (unsigned int)Unpacked.words[5]);
+    UtAssert_True(Unpacked.dwords[0] == 0xEEEEEEEE && Unpacked.dwords[1] == 0xEEEEEEEE,
+            "Partial unpack dwords[0..1] (%lx, %lx) untouched",
+            (unsigned long)Unpacked.dwords[0], (unsigned long)Unpacked.dwords[1]);
+    UtAssert_True(Unpacked.dwords[2] == Native.dwords[2] && Unpacked.dwords[3] == Native.dwords[3],
+            "Partial unpack dwords[2..3] (%lx, %lx) == (%lx, %lx)",
+            (unsigned long)Unpacked.dwords[2], (unsigned long)Unpacked.dwords[3],
+            (unsigned long)Native.dwords[2], (unsigned long)Native.dwords[3]);
+    UtAssert_True(Unpacked.nibbles[4] == Native.nibbles[4], "Partial unpack nibbles[4] (%x) == %x",
+            (unsigned int)Unpacked.nibbles[4], (unsigned int)Native.nibbles[4]);
+
+    /*
+     * Pack/unpack benchmark.
+     * This is informational only; the timing is reported but not asserted.
+     */
+    StartTime = clock();
+    for (Iteration = 0; Iteration < 100000; ++Iteration)
+    {
+        EdsId = EDSLIB_MAKE_ID(UTM_EDS_UT1_INDEX, UT1_ScalarArrays_t_DATADICTIONARY);
+        EdsLib_DataTypeDB_PackCompleteObject(&GD_FULL, &EdsId, Packed, &Native,
+                8 * sizeof(Packed), sizeof(Native));
+        EdsId = EDSLIB_MAKE_ID(UTM_EDS_UT1_INDEX, UT1_ScalarArrays_t_DATADICTIONARY);
+        EdsLib_DataTypeDB_UnpackPartialObject(&GD_FULL, &EdsId, &Unpacked, Packed,
+                sizeof(Unpacked), PackedBits, 0);
+    }
+    ElapsedSec = (double)(clock() - StartTime) / CLOCKS_PER_SEC;
+    UtPrintf("Scalar array pack/unpack benchmark: %lu round trips in %.3f sec, %.1f ns/round trip\n",
+            (unsigned long)Iteration, ElapsedSec, (ElapsedSec * 1.0e9) / Iteration);
+}
@@ -33,11 +33,15 @@
 extern void EdsLib_Basic_Test(void);
 extern void EdsLib_Full_Test(void);
 extern void EdsLib_StringConv_Test(void);
+extern void EdsLib_NameIndex_Test(void);
+extern void EdsLib_ScalarArray_Test(void);
 
 void UtTest_Setup(void)
 {
     UtTest_Add(EdsLib_Basic_Test, NULL, NULL, "EDS Basic");
     UtTest_Add(EdsLib_Full_Test, NULL, NULL, "EDS Full");
     UtTest_Add(EdsLib_StringConv_Test, NULL, NULL, "EDS String Conversions");
+    UtTest_Add(EdsLib_NameIndex_Test, NULL, NULL, "EDS Name Index");
+    UtTest_Add(EdsLib_ScalarArray_Test, NULL, NULL, "EDS Scalar Arrays");
 }
 